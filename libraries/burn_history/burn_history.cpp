@@ -0,0 +1,138 @@
+#include "burn_history.h"
+#include "temperature.h"
+#include "../damper_control/damper_control.h"
+#include "../lv_display/lv_display.h"   // is_manual_damper_mode()
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <esp_littlefs.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <sys/stat.h>
+#include <string.h>
+#include <time.h>
+
+static const char *TAG = "BURN_HISTORY";
+
+static hist_store_t store;
+static SemaphoreHandle_t store_mutex = NULL;
+static TaskHandle_t history_task_handle = NULL;
+static bool history_ready = false;
+
+// ===== Failu sistēma =====
+static bool mount_filesystem()
+{
+    esp_vfs_littlefs_conf_t conf = {};
+    conf.base_path = BURN_HISTORY_BASE_PATH;
+    conf.partition_label = BURN_HISTORY_PARTITION;
+    conf.format_if_mount_failed = true;
+
+    esp_err_t ret = esp_vfs_littlefs_register(&conf);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "LittleFS mount failed: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    size_t total = 0, used = 0;
+    if (esp_littlefs_info(BURN_HISTORY_PARTITION, &total, &used) == ESP_OK) {
+        ESP_LOGI(TAG, "LittleFS mounted: %u / %u bytes used", (unsigned)used, (unsigned)total);
+    }
+
+    struct stat st;
+    if (stat(BURN_HISTORY_DIR, &st) != 0 && mkdir(BURN_HISTORY_DIR, 0775) != 0) {
+        ESP_LOGE(TAG, "Cannot create %s", BURN_HISTORY_DIR);
+        return false;
+    }
+    return true;
+}
+
+burn_phase_t burn_history_current_phase()
+{
+    if (is_manual_damper_mode()) return BURN_PHASE_MANUAL;
+
+    const char *msg = messageDamp.c_str();
+    if (strcmp(msg, "AUTO") == 0) return BURN_PHASE_AUTO;
+    if (strcmp(msg, "FILL!") == 0) return BURN_PHASE_FILL;
+    if (strcmp(msg, "END!") == 0) return BURN_PHASE_END;
+    if (strcmp(msg, "MANUAL") == 0) return BURN_PHASE_MANUAL;
+    return BURN_PHASE_IDLE;
+}
+
+// ===== Ierakstīšanas uzdevums =====
+static void history_task(void *pvParameters)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t since_flush = 0;
+
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000));
+
+        hist_sample_t sample;
+        sample.temperature = temperature;
+        sample.damper = damper < 0 ? 0 : (damper > 100 ? 100 : damper);
+        sample.target = target_temp_c < 0 ? 0 : (target_temp_c > 127 ? 127 : target_temp_c);
+        sample.phase = burn_history_current_phase();
+
+        xSemaphoreTake(store_mutex, portMAX_DELAY);
+        hist_store_append(&store, (uint32_t)time(NULL), &sample);
+        // Flash raksta tikai reizi BURN_HISTORY_FLUSH_INTERVAL_S (bloka aizvēršanu raksta pats store)
+        if (++since_flush >= BURN_HISTORY_FLUSH_INTERVAL_S) {
+            since_flush = 0;
+            if (!hist_store_flush(&store)) ESP_LOGW(TAG, "History flush failed");
+        }
+        xSemaphoreGive(store_mutex);
+    }
+}
+
+// ===== Publiskās funkcijas =====
+void burn_history_init()
+{
+    if (history_ready) return;
+
+    size_t ram_size = (size_t)BURN_HISTORY_RAM_BLOCKS * HIST_BLOCK_SIZE;
+    uint8_t *ram = (uint8_t *)heap_caps_malloc(ram_size, MALLOC_CAP_SPIRAM);
+    if (!ram) {
+        ESP_LOGE(TAG, "No PSRAM for history (%u bytes)", (unsigned)ram_size);
+        return;
+    }
+
+    store_mutex = xSemaphoreCreateMutex();
+    bool fs_ok = mount_filesystem();
+    hist_store_init(&store, ram, BURN_HISTORY_RAM_BLOCKS,
+                    fs_ok ? BURN_HISTORY_DIR : NULL, BURN_HISTORY_FLASH_BLOCKS);
+    history_ready = true;
+
+    ESP_LOGI(TAG, "Burn history ready: %u KB PSRAM, %s, next block %u", (unsigned)(ram_size / 1024),
+             fs_ok ? "flash spill on" : "RAM only", (unsigned)store.head_seq);
+}
+
+void burn_history_start()
+{
+    if (!history_ready || history_task_handle) return;
+
+    // Zema prioritāte, otrais kodols (kā damper uzdevums)
+    xTaskCreatePinnedToCore(history_task, "BurnHistory", 3072, NULL, 1, &history_task_handle, 1);
+}
+
+void burn_history_flush()
+{
+    if (!history_ready) return;
+
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    hist_store_flush(&store);
+    xSemaphoreGive(store_mutex);
+}
+
+bool burn_history_buckets(uint32_t from, uint32_t bucket_s, uint32_t cnt, hist_bucket_t *out)
+{
+    if (!history_ready) {
+        memset(out, 0, cnt * sizeof(hist_bucket_t));
+        return false;
+    }
+
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    hist_store_buckets(&store, from, bucket_s, cnt, out);
+    xSemaphoreGive(store_mutex);
+    return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "history_store.h"
+
+// Degšanas vēsture: katru sekundi saglabā temperatūru, damper, mērķa temperatūru un degšanas fāzi.
+// Paraugi glabājas PSRAM blokos (history_store) un tiek periodiski ierakstīti "spiffs" partīcijā (littlefs).
+
+#define BURN_HISTORY_BASE_PATH          "/littlefs"
+#define BURN_HISTORY_PARTITION          "spiffs"
+#define BURN_HISTORY_DIR                BURN_HISTORY_BASE_PATH "/hist"
+
+#define BURN_HISTORY_RAM_BLOCKS         32      // 32 x 4 KB PSRAM (līdz 4 h katrā blokā)
+#define BURN_HISTORY_FLASH_BLOCKS       160     // 160 x 4 KB segmentu faili flash
+#define BURN_HISTORY_FLUSH_INTERVAL_S   600     // Cik bieži pašreizējais bloks tiek ierakstīts flash
+
+// Piemontē failu sistēmu, rezervē PSRAM un ielādē iepriekšējo vēsturi
+void burn_history_init();
+
+// Sāk 1 Hz ierakstīšanas uzdevumu
+void burn_history_start();
+
+// Ieraksta neierakstītos paraugus flash (piem. pirms deep sleep)
+void burn_history_flush();
+
+// Apkopo [from, from + cnt * bucket_s) cnt intervālos (sk. hist_store_buckets). Atgriež false, ja vēsture nav pieejama.
+bool burn_history_buckets(uint32_t from, uint32_t bucket_s, uint32_t cnt, hist_bucket_t *out);
+
+// Pašreizējā degšanas fāze no damper_control statusa
+burn_phase_t burn_history_current_phase();
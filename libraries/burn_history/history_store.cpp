@@ -0,0 +1,479 @@
+#include "history_store.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ============================================
+// BLOKA FORMĀTS
+// ============================================
+// Galvene (HIST_BLOCK_HDR_SIZE baiti, little endian):
+//   0  u16 magic      4  u32 seq        12 u16 span (sekundes no start līdz pēdējam paraugam + 1)
+//   2  u8  version    8  u32 start      14 u16 nbits (izlietotie biti pēc galvenes)
+//   3  u8  phase      16 i16 temperature  18 u8 damper  19 u8 target   <- pirmais paraugs
+//
+// Katrs nākamais paraugs ir bitu ieraksts (jaunākais bits pirmais):
+//   0                          - nekas nav mainījies
+//   10 s                       - temperatūra +1 (s=0) vai -1 (s=1)
+//   11 mmmm ...                - mainītie lauki pēc maskas: temp 10b, damper 7b, target 7b, phase 3b
+//   11 0000 gggggggggggg       - pārtraukums: nākamais ieraksts ir pēc g + 1 izlaistām sekundēm
+
+#define HIST_MAGIC      0x4842
+#define HIST_VERSION    1
+
+#define MASK_TEMP       0x1
+#define MASK_DAMPER     0x2
+#define MASK_TARGET     0x4
+#define MASK_PHASE      0x8
+
+#define TEMP_BITS       10
+#define DAMPER_BITS     7
+#define TARGET_BITS     7
+#define PHASE_BITS      3
+#define GAP_BITS        12
+
+static_assert(HIST_TEMP_MIN == -(1 << (TEMP_BITS - 1)) && HIST_TEMP_MAX == (1 << (TEMP_BITS - 1)) - 1,
+              "HIST_TEMP_MIN/MAX must match TEMP_BITS");
+static_assert(HIST_MAX_GAP == 1 << GAP_BITS, "the gap record stores 1..HIST_MAX_GAP");
+
+#define PAYLOAD_BITS    ((HIST_BLOCK_SIZE - HIST_BLOCK_HDR_SIZE) * 8)
+#define GAP_RECORD_BITS (2 + 4 + GAP_BITS)
+
+typedef struct {
+    uint32_t seq;
+    uint32_t start;
+    uint16_t span;
+    uint16_t nbits;
+    hist_sample_t first;
+} block_hdr_t;
+
+// ============================================
+// PALĪGFUNKCIJAS
+// ============================================
+
+static inline void put_u16(uint8_t *p, uint16_t v) { p[0] = v & 0xff; p[1] = v >> 8; }
+static inline void put_u32(uint8_t *p, uint32_t v) { put_u16(p, v & 0xffff); put_u16(p + 2, v >> 16); }
+static inline uint16_t get_u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t get_u32(const uint8_t *p) { return get_u16(p) | ((uint32_t)get_u16(p + 2) << 16); }
+
+static void hdr_write(uint8_t *blk, const block_hdr_t *h)
+{
+    put_u16(blk + 0, HIST_MAGIC);
+    blk[2] = HIST_VERSION;
+    blk[3] = h->first.phase;
+    put_u32(blk + 4, h->seq);
+    put_u32(blk + 8, h->start);
+    put_u16(blk + 12, h->span);
+    put_u16(blk + 14, h->nbits);
+    put_u16(blk + 16, (uint16_t)h->first.temperature);
+    blk[18] = h->first.damper;
+    blk[19] = h->first.target;
+}
+
+static bool hdr_read(const uint8_t *blk, block_hdr_t *h)
+{
+    if (get_u16(blk) != HIST_MAGIC || blk[2] != HIST_VERSION) return false;
+    h->first.phase = blk[3];
+    h->seq = get_u32(blk + 4);
+    h->start = get_u32(blk + 8);
+    h->span = get_u16(blk + 12);
+    h->nbits = get_u16(blk + 14);
+    h->first.temperature = (int16_t)get_u16(blk + 16);
+    h->first.damper = blk[18];
+    h->first.target = blk[19];
+    return h->nbits <= PAYLOAD_BITS && h->span <= HIST_BLOCK_MAX_SPAN;
+}
+
+static void bits_put(uint8_t *payload, uint32_t *pos, uint32_t v, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++, (*pos)++) {
+        if ((v >> i) & 1) payload[*pos >> 3] |= 1 << (*pos & 7);
+    }
+}
+
+static uint32_t bits_get(const uint8_t *payload, uint32_t *pos, uint32_t n)
+{
+    uint32_t v = 0;
+    for (uint32_t i = 0; i < n; i++, (*pos)++) {
+        v |= (uint32_t)((payload[*pos >> 3] >> (*pos & 7)) & 1) << i;
+    }
+    return v;
+}
+
+static inline uint8_t *ram_block(const hist_store_t *s, uint32_t seq)
+{
+    return s->ram + (seq % s->ram_blocks) * HIST_BLOCK_SIZE;
+}
+
+static void segment_path(const hist_store_t *s, uint32_t seq, char *path, size_t len)
+{
+    snprintf(path, len, "%s/%03u.bin", s->dir, (unsigned)(seq % s->flash_blocks));
+}
+
+// ============================================
+// FLASH
+// ============================================
+
+// Viens bloks = viens fails. Faili tiek izmantoti pa apli (seq % flash_blocks),
+// un littlefs katru pārrakstīšanu novieto citā fiziskajā blokā (copy-on-write), tāpēc nolietojums izlīdzinās.
+static bool flash_write_block(hist_store_t *s, const uint8_t *blk)
+{
+    block_hdr_t h;
+    if (!s->flash_blocks || !hdr_read(blk, &h)) return false;
+
+    char path[48];
+    segment_path(s, h.seq, path, sizeof(path));
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    size_t len = HIST_BLOCK_HDR_SIZE + (h.nbits + 7) / 8;
+    bool ok = fwrite(blk, 1, len, f) == len;
+    ok = (fclose(f) == 0) && ok;
+
+    if (ok) {
+        s->flushed = true;
+        s->flushed_seq = h.seq;
+        s->flushed_bits = h.nbits;
+        s->stats.flash_writes++;
+        s->stats.flash_bytes += len;
+    }
+    return ok;
+}
+
+static bool flash_read_block(const hist_store_t *s, uint32_t seq, uint8_t *blk)
+{
+    if (!s->flash_blocks) return false;
+
+    char path[48];
+    segment_path(s, seq, path, sizeof(path));
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    memset(blk, 0, HIST_BLOCK_SIZE);
+    size_t len = fread(blk, 1, HIST_BLOCK_SIZE, f);
+    fclose(f);
+
+    block_hdr_t h;
+    return len >= HIST_BLOCK_HDR_SIZE && hdr_read(blk, &h) && h.seq == seq &&
+           len >= HIST_BLOCK_HDR_SIZE + (h.nbits + 7) / 8u;
+}
+
+// ============================================
+// RAKSTĪŠANA
+// ============================================
+
+static void block_close(hist_store_t *s)
+{
+    if (!s->open) return;
+
+    // Aizvērts bloks vairs nemainās - ierakstām to līdz galam
+    block_hdr_t h;
+    hdr_read(ram_block(s, s->head_seq), &h);
+    if (s->flash_blocks && !(s->flushed && s->flushed_seq == h.seq && s->flushed_bits == h.nbits)) {
+        flash_write_block(s, ram_block(s, s->head_seq));
+    }
+
+    s->head_seq++;
+    s->open = false;
+}
+
+static void block_start(hist_store_t *s, uint32_t time, const hist_sample_t *sample)
+{
+    uint8_t *blk = ram_block(s, s->head_seq);
+    memset(blk, 0, HIST_BLOCK_SIZE);
+
+    block_hdr_t h = {};
+    h.seq = s->head_seq;
+    h.start = time;
+    h.span = 1;
+    h.nbits = 0;
+    h.first = *sample;
+    hdr_write(blk, &h);
+
+    // Vecākais bloks, kas vēl var būt RAM vai flash
+    uint32_t keep = s->flash_blocks > s->ram_blocks ? s->flash_blocks : s->ram_blocks;
+    if (s->head_seq + 1 > keep && s->first_seq < s->head_seq + 1 - keep) s->first_seq = s->head_seq + 1 - keep;
+
+    s->open = true;
+    s->bitpos = 0;
+    s->last = *sample;
+    s->last_time = time;
+    s->stats.blocks++;
+}
+
+static uint32_t record_bits(const hist_sample_t *prev, const hist_sample_t *cur, uint32_t *mask)
+{
+    *mask = 0;
+    if (cur->temperature != prev->temperature) *mask |= MASK_TEMP;
+    if (cur->damper != prev->damper) *mask |= MASK_DAMPER;
+    if (cur->target != prev->target) *mask |= MASK_TARGET;
+    if (cur->phase != prev->phase) *mask |= MASK_PHASE;
+
+    if (*mask == 0) return 1;
+    if (*mask == MASK_TEMP && (cur->temperature - prev->temperature == 1 || cur->temperature - prev->temperature == -1)) {
+        return 3;
+    }
+
+    uint32_t n = 2 + 4;
+    if (*mask & MASK_TEMP) n += TEMP_BITS;
+    if (*mask & MASK_DAMPER) n += DAMPER_BITS;
+    if (*mask & MASK_TARGET) n += TARGET_BITS;
+    if (*mask & MASK_PHASE) n += PHASE_BITS;
+    return n;
+}
+
+static void record_write(uint8_t *payload, uint32_t *pos, const hist_sample_t *prev, const hist_sample_t *cur)
+{
+    uint32_t mask;
+    uint32_t n = record_bits(prev, cur, &mask);
+
+    if (n == 1) {
+        bits_put(payload, pos, 0, 1);
+    } else if (n == 3) {
+        bits_put(payload, pos, 0x1, 2);
+        bits_put(payload, pos, cur->temperature < prev->temperature ? 1 : 0, 1);
+    } else {
+        bits_put(payload, pos, 0x3, 2);
+        bits_put(payload, pos, mask, 4);
+        if (mask & MASK_TEMP) bits_put(payload, pos, (uint32_t)cur->temperature & ((1 << TEMP_BITS) - 1), TEMP_BITS);
+        if (mask & MASK_DAMPER) bits_put(payload, pos, cur->damper, DAMPER_BITS);
+        if (mask & MASK_TARGET) bits_put(payload, pos, cur->target, TARGET_BITS);
+        if (mask & MASK_PHASE) bits_put(payload, pos, cur->phase, PHASE_BITS);
+    }
+}
+
+void hist_store_init(hist_store_t *s, uint8_t *ram, uint32_t ram_blocks, const char *dir, uint32_t flash_blocks)
+{
+    memset(s, 0, sizeof(*s));
+    s->ram = ram;
+    s->ram_blocks = ram_blocks;
+    memset(ram, 0, (size_t)ram_blocks * HIST_BLOCK_SIZE);
+
+    if (!dir) return;
+    snprintf(s->dir, sizeof(s->dir), "%s", dir);
+    s->flash_blocks = flash_blocks;
+
+    // Atrodam jaunāko bloku pēc seq (laiks var būt lēcis, seq tikai aug)
+    uint8_t hdr[HIST_BLOCK_HDR_SIZE];
+    bool found = false;
+    uint32_t max_seq = 0;
+    for (uint32_t i = 0; i < flash_blocks; i++) {
+        char path[48];
+        snprintf(path, sizeof(path), "%s/%03u.bin", s->dir, (unsigned)i);
+        FILE *f = fopen(path, "rb");
+        if (!f) continue;
+        size_t len = fread(hdr, 1, sizeof(hdr), f);
+        fclose(f);
+
+        block_hdr_t h;
+        if (len != sizeof(hdr) || !hdr_read(hdr, &h) || h.seq % flash_blocks != i) continue;
+        if (!found || h.seq > max_seq) max_seq = h.seq;
+        found = true;
+    }
+    if (!found) return;
+
+    // Jaunākos blokus ielādējam RAM, lai pēc pārstartēšanas (arī pēc deep sleep) vēsture turpinās
+    s->head_seq = max_seq + 1;
+    s->first_seq = s->head_seq > flash_blocks ? s->head_seq - flash_blocks : 0;
+    uint32_t first_ram = s->head_seq > ram_blocks ? s->head_seq - ram_blocks : 0;
+    for (uint32_t seq = first_ram; seq < s->head_seq; seq++) {
+        if (!flash_read_block(s, seq, ram_block(s, seq))) memset(ram_block(s, seq), 0, HIST_BLOCK_SIZE);
+    }
+}
+
+void hist_store_append(hist_store_t *s, uint32_t time, const hist_sample_t *sample)
+{
+    s->stats.samples++;
+
+    // Lai TEMP_BITS ieraksts neaptītos (piem. sensora kļūdas vērtība)
+    hist_sample_t clamped;
+    if (sample->temperature < HIST_TEMP_MIN || sample->temperature > HIST_TEMP_MAX) {
+        clamped = *sample;
+        clamped.temperature = sample->temperature < HIST_TEMP_MIN ? HIST_TEMP_MIN : HIST_TEMP_MAX;
+        sample = &clamped;
+    }
+
+    if (!s->open) {
+        block_start(s, time, sample);
+        return;
+    }
+
+    uint8_t *blk = ram_block(s, s->head_seq);
+    block_hdr_t h;
+    hdr_read(blk, &h);
+
+    // Laiks gāja atpakaļ vai pārāk liels pārtraukums - jauns bloks
+    if (time <= s->last_time) {
+        if (time == s->last_time) return;
+        block_close(s);
+        block_start(s, time, sample);
+        return;
+    }
+
+    uint32_t gap = time - s->last_time - 1;
+    uint32_t mask;
+    uint32_t need = record_bits(&s->last, sample, &mask) + (gap ? GAP_RECORD_BITS : 0);
+    if (gap > HIST_MAX_GAP || time - h.start + 1 > HIST_BLOCK_MAX_SPAN || s->bitpos + need > PAYLOAD_BITS) {
+        block_close(s);
+        block_start(s, time, sample);
+        return;
+    }
+
+    uint8_t *payload = blk + HIST_BLOCK_HDR_SIZE;
+    uint32_t start_pos = s->bitpos;
+    if (gap) {
+        bits_put(payload, &s->bitpos, 0x3, 2);
+        bits_put(payload, &s->bitpos, 0, 4);
+        bits_put(payload, &s->bitpos, gap - 1, GAP_BITS);
+    }
+    record_write(payload, &s->bitpos, &s->last, sample);
+    s->stats.payload_bits += s->bitpos - start_pos;
+
+    h.span = time - h.start + 1;
+    h.nbits = s->bitpos;
+    hdr_write(blk, &h);
+
+    s->last = *sample;
+    s->last_time = time;
+}
+
+bool hist_store_flush(hist_store_t *s)
+{
+    if (!s->flash_blocks || !s->open) return true;
+
+    // Pēc pēdējās ierakstīšanas nekas nav mainījies
+    if (s->flushed && s->flushed_seq == s->head_seq && s->flushed_bits == s->bitpos) return true;
+
+    return flash_write_block(s, ram_block(s, s->head_seq));
+}
+
+// ============================================
+// LASĪŠANA
+// ============================================
+
+static uint32_t block_decode(const uint8_t *blk, uint32_t from, uint32_t to, hist_sample_cb_t cb, void *user)
+{
+    block_hdr_t h;
+    if (!hdr_read(blk, &h)) return 0;
+    if (h.start >= to || h.start + h.span <= from) return 0;
+
+    const uint8_t *payload = blk + HIST_BLOCK_HDR_SIZE;
+    hist_sample_t cur = h.first;
+    uint32_t t = h.start;
+    uint32_t cnt = 0;
+
+    if (t >= from) {
+        cb(t, &cur, user);
+        cnt++;
+    }
+
+    uint32_t pos = 0;
+    while (pos < h.nbits) {
+        if (!bits_get(payload, &pos, 1)) {
+            // Nemainīgs
+        } else if (!bits_get(payload, &pos, 1)) {
+            cur.temperature += bits_get(payload, &pos, 1) ? -1 : 1;
+        } else {
+            uint32_t mask = bits_get(payload, &pos, 4);
+            if (mask == 0) {
+                t += bits_get(payload, &pos, GAP_BITS) + 1;
+                continue;
+            }
+            if (mask & MASK_TEMP) {
+                uint32_t v = bits_get(payload, &pos, TEMP_BITS);
+                cur.temperature = (int16_t)((int32_t)(v << (32 - TEMP_BITS)) >> (32 - TEMP_BITS));
+            }
+            if (mask & MASK_DAMPER) cur.damper = bits_get(payload, &pos, DAMPER_BITS);
+            if (mask & MASK_TARGET) cur.target = bits_get(payload, &pos, TARGET_BITS);
+            if (mask & MASK_PHASE) cur.phase = bits_get(payload, &pos, PHASE_BITS);
+        }
+
+        t++;
+        if (t >= to) break;
+        if (t >= from) {
+            cb(t, &cur, user);
+            cnt++;
+        }
+    }
+    return cnt;
+}
+
+uint32_t hist_store_query(const hist_store_t *s, uint32_t from, uint32_t to, hist_sample_cb_t cb, void *user)
+{
+    uint32_t end_seq = s->open ? s->head_seq + 1 : s->head_seq;
+    uint32_t first_ram = end_seq > s->ram_blocks ? end_seq - s->ram_blocks : 0;
+    uint32_t cnt = 0;
+    uint8_t *tmp = NULL;
+
+    // Ja vecākais bloks RAM sākas pirms `from`, flash failus nav jāskatās
+    uint32_t seq = s->first_seq;
+    block_hdr_t ram_first_hdr;
+    if (seq < first_ram && hdr_read(ram_block(s, first_ram), &ram_first_hdr) && ram_first_hdr.seq == first_ram &&
+        ram_first_hdr.start <= from) {
+        seq = first_ram;
+    }
+
+    for (; seq < end_seq; seq++) {
+        const uint8_t *blk = ram_block(s, seq);
+        if (seq < first_ram) {
+            // Vecāki bloki ir tikai flash. Vispirms pārbaudām galveni, lai nelasītu nevajadzīgos failus.
+            if (!s->flash_blocks) continue;
+            char path[48];
+            segment_path(s, seq, path, sizeof(path));
+            FILE *f = fopen(path, "rb");
+            if (!f) continue;
+            uint8_t hdr[HIST_BLOCK_HDR_SIZE];
+            size_t len = fread(hdr, 1, sizeof(hdr), f);
+            fclose(f);
+            block_hdr_t h;
+            if (len != sizeof(hdr) || !hdr_read(hdr, &h) || h.seq != seq) continue;
+            if (h.start >= to || h.start + h.span <= from) continue;
+
+            if (!tmp) tmp = new uint8_t[HIST_BLOCK_SIZE];
+            if (!flash_read_block(s, seq, tmp)) continue;
+            blk = tmp;
+        } else {
+            block_hdr_t h;
+            if (!hdr_read(blk, &h) || h.seq != seq) continue;
+        }
+        cnt += block_decode(blk, from, to, cb, user);
+    }
+
+    delete[] tmp;
+    return cnt;
+}
+
+typedef struct {
+    uint32_t from;
+    uint32_t bucket_s;
+    uint32_t cnt;
+    hist_bucket_t *out;
+} bucket_ctx_t;
+
+static void bucket_cb(uint32_t time, const hist_sample_t *sample, void *user)
+{
+    bucket_ctx_t *ctx = (bucket_ctx_t *)user;
+    uint32_t i = (time - ctx->from) / ctx->bucket_s;
+    if (i >= ctx->cnt) return;
+
+    hist_bucket_t *b = &ctx->out[i];
+    if (b->cnt == 0 || sample->temperature < b->temp_min) b->temp_min = sample->temperature;
+    if (b->cnt == 0 || sample->temperature > b->temp_max) b->temp_max = sample->temperature;
+    b->damper = sample->damper;
+    b->target = sample->target;
+    b->phase = sample->phase;
+    if (b->cnt < UINT16_MAX) b->cnt++;
+}
+
+void hist_store_buckets(const hist_store_t *s, uint32_t from, uint32_t bucket_s, uint32_t cnt, hist_bucket_t *out)
+{
+    memset(out, 0, cnt * sizeof(hist_bucket_t));
+    if (bucket_s == 0 || cnt == 0) return;
+
+    bucket_ctx_t ctx = {from, bucket_s, cnt, out};
+    hist_store_query(s, from, from + bucket_s * cnt, bucket_cb, &ctx);
+}
+
+const hist_stats_t *hist_store_get_stats(const hist_store_t *s)
+{
+    return &s->stats;
+}
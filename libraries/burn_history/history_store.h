@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Kompakta laika rindu glabātuve degšanas vēsturei (1 paraugs sekundē).
+// Paraugi tiek delta kodēti 4 KB blokos. Bloki glabājas fiksēta izmēra gredzenā RAM (PSRAM),
+// un aizvērtie bloki + periodiski arī pašreizējais tiek ierakstīti failos (littlefs).
+// Šis fails nav atkarīgs no ESP-IDF, tāpēc to var kompilēt un mērīt arī uz datora.
+
+#define HIST_BLOCK_SIZE         4096    // Viens bloks = viens flash sektors / littlefs bloks
+#define HIST_BLOCK_HDR_SIZE     20
+#define HIST_BLOCK_MAX_SPAN     14400   // Bloks aptver ne vairāk kā 4 stundas (ierobežo atkodēšanas laiku)
+#define HIST_MAX_GAP            4096    // Garāks pārtraukums sāk jaunu bloku
+#define HIST_TEMP_MIN           (-512)  // Temperatūras ieraksts ir 10 biti; ārpus robežām saglabājas robežvērtība
+#define HIST_TEMP_MAX           511
+
+// Degšanas fāze (no damper_control statusa)
+typedef enum {
+    BURN_PHASE_IDLE = 0,
+    BURN_PHASE_MANUAL,
+    BURN_PHASE_AUTO,
+    BURN_PHASE_FILL,
+    BURN_PHASE_END,
+    BURN_PHASE_COUNT
+} burn_phase_t;
+
+typedef struct {
+    int16_t temperature;    // °C
+    uint8_t damper;         // 0..100 %
+    uint8_t target;         // °C
+    uint8_t phase;          // burn_phase_t
+} hist_sample_t;
+
+// Apkopojums vienam laika intervālam (diagrammas kolonnai)
+typedef struct {
+    int16_t temp_min;
+    int16_t temp_max;
+    uint8_t damper;         // pēdējā vērtība intervālā
+    uint8_t target;         // pēdējā vērtība intervālā
+    uint8_t phase;          // pēdējā vērtība intervālā
+    uint16_t cnt;           // paraugu skaits; 0 = nav datu
+} hist_bucket_t;
+
+typedef struct {
+    uint32_t samples;       // Pievienotie paraugi kopš init
+    uint32_t payload_bits;  // To kodētais izmērs bitos (bez bloku galvenēm)
+    uint32_t blocks;        // Sāktie bloki kopš init
+    uint32_t flash_writes;  // Failu ierakstīšanas reizes
+    uint32_t flash_bytes;   // Ierakstītie baiti
+} hist_stats_t;
+
+typedef struct {
+    uint8_t *ram;           // ram_blocks * HIST_BLOCK_SIZE
+    uint32_t ram_blocks;
+    uint32_t flash_blocks;  // Segmentu failu skaits; 0 = tikai RAM
+    char dir[32];
+
+    uint32_t head_seq;      // Pašreizējā (rakstāmā) bloka numurs
+    uint32_t first_seq;     // Vecākais bloks, kas varētu būt pieejams (RAM vai flash)
+    bool open;              // Pašreizējā blokā jau ir pirmais paraugs
+    uint32_t bitpos;        // Pašreizējā bloka izlietotie biti
+    uint32_t last_time;
+    hist_sample_t last;
+
+    uint32_t flushed_seq;   // Kurš bloks un cik bitu no tā jau ir flash
+    uint32_t flushed_bits;
+    bool flushed;
+
+    hist_stats_t stats;
+} hist_store_t;
+
+// Izsaukts katram paraugam vaicājuma laikā; time ir sekundes (time())
+typedef void (*hist_sample_cb_t)(uint32_t time, const hist_sample_t *sample, void *user);
+
+// Inicializē glabātuvi. `ram` jābūt ram_blocks * HIST_BLOCK_SIZE baitiem.
+// Ja `dir` nav NULL, no tā tiek ielādēti jaunākie bloki un turpmāk tajā tiek glabāti flash_blocks segmentu faili.
+void hist_store_init(hist_store_t *s, uint8_t *ram, uint32_t ram_blocks, const char *dir, uint32_t flash_blocks);
+
+// Pievieno paraugu. Laikam jāaug pa 1 s; izlaistās sekundes tiek glabātas kā pārtraukums.
+void hist_store_append(hist_store_t *s, uint32_t time, const hist_sample_t *sample);
+
+// Ieraksta pašreizējo bloku flash, ja kopš pēdējās reizes ir nākuši klāt paraugi. Atgriež false kļūdas gadījumā.
+bool hist_store_flush(hist_store_t *s);
+
+// Izsauc cb katram paraugam laikā [from, to) laika secībā. Atgriež paraugu skaitu.
+uint32_t hist_store_query(const hist_store_t *s, uint32_t from, uint32_t to, hist_sample_cb_t cb, void *user);
+
+// Sadala [from, from + cnt * bucket_s) cnt intervālos un apkopo katru no tiem
+void hist_store_buckets(const hist_store_t *s, uint32_t from, uint32_t bucket_s, uint32_t cnt, hist_bucket_t *out);
+
+const hist_stats_t *hist_store_get_stats(const hist_store_t *s);
@@ -30,9 +30,20 @@ static uint32_t last_time_tick = 0;
 static const char* pending_warning_title = nullptr;
 static const char* pending_warning_message = nullptr;
 
+// lv_timer_ready() maina LVGL taimeru kaudzi, tāpēc tikai ar LVGL mutex.
+// Ja LVGL šobrīd ir aizņemts, dm_timer tāpat izpildīsies sava perioda laikā.
+static void make_timer_ready() {
+    if (!dm_timer) return;
+    if (lvgl_port_lock(1)) {
+        lv_timer_ready(dm_timer);
+        lvgl_port_unlock();
+        lvgl_port_wake(); // LVGL task guļ līdz nākamajam taimerim
+    }
+}
+
 static inline void request(uint32_t bits) {
     req_mask.fetch_or(bits, std::memory_order_relaxed);
-    if (dm_timer) lv_timer_ready(dm_timer); // pamodina, neko nekrāj rindā
+    make_timer_ready(); // pamodina, neko nekrāj rindā
 }
 
 static void dm_timer_cb(lv_timer_t*) {
@@ -121,7 +132,7 @@ void display_manager_notify_time_synced()                  { request(DM_TIME); }
 void display_manager_notify_damper_changed()               { request(DM_DAMPER_STATUS); }
 void display_manager_notify_damper_position_changed()      { request(DM_DAMPER); }
 
-bool display_manager_try_update()                          { if (dm_timer) lv_timer_ready(dm_timer); return true; }
+bool display_manager_try_update()                          { make_timer_ready(); return true; }
 
 void display_manager_set_wifi_status(bool connected) {
     static bool time_synced_once = false;
@@ -149,6 +160,6 @@ void display_manager_force_update_warning()                { request(DM_WARN_SHO
 // Deprecated: atstāts saderībai. Nelietot jauniem izsaukumiem.
 bool safe_lvgl_operation(std::function<void(void)> update_func) {
     (void)update_func;
-    if (dm_timer) lv_timer_ready(dm_timer);
+    make_timer_ready();
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "history_screen.h"
+#include "lv_display.h"
+#include "burn_history.h"
+#include <string.h>
+#include <time.h>
+
+// Diagrammas viena kolonna (pikselis) = viens vēstures intervāls (bucket)
+#define HISTORY_MAX_BUCKETS 320
+
+// Temperatūras ass: pēc datiem, noapaļota uz TEMP_AXIS_STEP, DS18B20 mērījumu robežās
+#define TEMP_AXIS_MIN       (-55)
+#define TEMP_AXIS_MAX       125
+#define TEMP_AXIS_STEP      10
+#define TEMP_AXIS_DEFAULT_MIN   0       // Kad logā nav datu
+#define TEMP_AXIS_DEFAULT_MAX   100
+
+// ===== Ekrāna objekti =====
+static lv_obj_t * history_screen = NULL;
+static bool is_visible = false;
+static lv_obj_t * span_btns = NULL;
+static lv_obj_t * chart = NULL;
+static lv_obj_t * phase_strip = NULL;
+static lv_timer_t * update_timer = NULL;
+
+static lv_chart_series_t * ser_temp = NULL;
+static lv_chart_series_t * ser_target = NULL;
+static lv_chart_series_t * ser_damper = NULL;
+static lv_chart_ring_t * ring_temp = NULL;
+static lv_chart_ring_t * ring_target = NULL;
+static lv_chart_ring_t * ring_damper = NULL;
+
+// ===== Stāvoklis =====
+static const uint32_t span_seconds[] = {3600, 8 * 3600, 24 * 3600};
+static uint32_t span_index = 1;              // Sākumā 8h
+static uint32_t bucket_cnt = 0;              // = diagrammas satura platums
+static uint32_t bucket_s = 0;
+static uint32_t next_bucket_start = 0;       // Nākamais vēl neparādītais intervāls
+static uint8_t phases[HISTORY_MAX_BUCKETS];  // Fāze katrai kolonnai (vecākā pirmā); BURN_PHASE_COUNT = nav datu
+static hist_bucket_t buckets[HISTORY_MAX_BUCKETS];
+static lv_coord_t temp_axis_min = TEMP_AXIS_DEFAULT_MIN;
+static lv_coord_t temp_axis_max = TEMP_AXIS_DEFAULT_MAX;
+
+static lv_color_t phase_color(uint8_t phase)
+{
+    switch (phase) {
+        case BURN_PHASE_MANUAL: return lv_color_hex(0x7997a3);
+        case BURN_PHASE_AUTO:   return lv_color_hex(0x0088FF);
+        case BURN_PHASE_FILL:   return lv_color_hex(0xFFA000);
+        case BURN_PHASE_END:    return lv_color_hex(0xE53935);
+        default:                return lv_color_hex(0xD0D0D0);
+    }
+}
+
+// ===== Datu ielāde =====
+static lv_coord_t temp_axis_floor(lv_coord_t v)
+{
+    v = (v >= 0 ? v : v - (TEMP_AXIS_STEP - 1)) / TEMP_AXIS_STEP * TEMP_AXIS_STEP;
+    return LV_CLAMP(TEMP_AXIS_MIN, v, TEMP_AXIS_MAX);
+}
+
+static lv_coord_t temp_axis_ceil(lv_coord_t v)
+{
+    v = (v > 0 ? v + (TEMP_AXIS_STEP - 1) : v) / TEMP_AXIS_STEP * TEMP_AXIS_STEP;
+    return LV_CLAMP(TEMP_AXIS_MIN, v, TEMP_AXIS_MAX);
+}
+
+// Paplašina temperatūras asi, lai ietilpst intervāla temperatūra un mērķis (ar vienu soli rezervei)
+static bool temp_axis_fit(const hist_bucket_t * b, lv_coord_t * lo, lv_coord_t * hi)
+{
+    if (!b->cnt) return false;
+    lv_coord_t b_min = LV_MIN(b->temp_min, (lv_coord_t)b->target);
+    lv_coord_t b_max = LV_MAX(b->temp_max, (lv_coord_t)b->target);
+    bool changed = false;
+    if (b_min < *lo + TEMP_AXIS_STEP / 2 && *lo > TEMP_AXIS_MIN) {
+        *lo = temp_axis_floor(b_min - TEMP_AXIS_STEP / 2);
+        changed = true;
+    }
+    if (b_max > *hi - TEMP_AXIS_STEP / 2 && *hi < TEMP_AXIS_MAX) {
+        *hi = temp_axis_ceil(b_max + TEMP_AXIS_STEP / 2);
+        changed = true;
+    }
+    return changed;
+}
+
+static void temp_axis_apply(void)
+{
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, temp_axis_min, temp_axis_max);
+}
+
+// Katrs intervāls ir 2 paraugi ringā (min un max), tāpēc lv_chart kolonnā zīmē vertikālu līniju min..max
+static void push_bucket(const hist_bucket_t * b)
+{
+    lv_coord_t t_min = b->cnt ? b->temp_min : LV_CHART_POINT_NONE;
+    lv_coord_t t_max = b->cnt ? b->temp_max : LV_CHART_POINT_NONE;
+    lv_coord_t tgt = b->cnt ? b->target : LV_CHART_POINT_NONE;
+    lv_coord_t dmp = b->cnt ? b->damper : LV_CHART_POINT_NONE;
+
+    lv_chart_set_next_value(chart, ser_temp, t_min);
+    lv_chart_set_next_value(chart, ser_temp, t_max);
+    lv_chart_set_next_value(chart, ser_target, tgt);
+    lv_chart_set_next_value(chart, ser_target, tgt);
+    lv_chart_set_next_value(chart, ser_damper, dmp);
+    lv_chart_set_next_value(chart, ser_damper, dmp);
+
+    memmove(phases, phases + 1, bucket_cnt - 1);
+    phases[bucket_cnt - 1] = b->cnt ? b->phase : (uint8_t)BURN_PHASE_COUNT;
+}
+
+static void reload_history(void)
+{
+    if (!chart || bucket_cnt == 0) return;
+
+    uint32_t span = span_seconds[span_index];
+    bucket_s = (span + bucket_cnt - 1) / bucket_cnt;
+
+    // Intervāli ir nolīdzināti uz bucket_s, lai nākamie pievienotos tieši blakus
+    uint32_t now = (uint32_t)time(NULL);
+    uint32_t end = (now / bucket_s) * bucket_s;
+    uint32_t from = end - bucket_cnt * bucket_s;
+
+    burn_history_buckets(from, bucket_s, bucket_cnt, buckets);
+
+    // Ass no jauna pēc loga datiem; bez datiem paliek noklusētā
+    lv_coord_t lo = LV_COORD_MAX;
+    lv_coord_t hi = LV_COORD_MIN;
+    for (uint32_t i = 0; i < bucket_cnt; i++) {
+        if (!buckets[i].cnt) continue;
+        lo = LV_MIN(lo, LV_MIN(buckets[i].temp_min, (lv_coord_t)buckets[i].target));
+        hi = LV_MAX(hi, LV_MAX(buckets[i].temp_max, (lv_coord_t)buckets[i].target));
+    }
+    if (lo <= hi) {
+        temp_axis_min = temp_axis_floor(lo - TEMP_AXIS_STEP / 2);
+        temp_axis_max = temp_axis_ceil(hi + TEMP_AXIS_STEP / 2);
+        if (temp_axis_max - temp_axis_min < 2 * TEMP_AXIS_STEP) {
+            temp_axis_max = LV_MIN(temp_axis_min + 2 * TEMP_AXIS_STEP, TEMP_AXIS_MAX);
+            temp_axis_min = temp_axis_max - 2 * TEMP_AXIS_STEP;
+        }
+    } else {
+        temp_axis_min = TEMP_AXIS_DEFAULT_MIN;
+        temp_axis_max = TEMP_AXIS_DEFAULT_MAX;
+    }
+    temp_axis_apply();
+
+    lv_chart_ring_clear(ring_temp);
+    lv_chart_ring_clear(ring_target);
+    lv_chart_ring_clear(ring_damper);
+    for (uint32_t i = 0; i < bucket_cnt; i++) {
+        push_bucket(&buckets[i]);
+    }
+    next_bucket_start = end;
+
+    lv_chart_refresh(chart);
+    lv_obj_invalidate(phase_strip);
+}
+
+// Katru sekundi: pievieno pabeigtos intervālus labajā malā
+static void update_timer_cb(lv_timer_t * timer)
+{
+    (void)timer;
+    if (!is_visible || bucket_s == 0) return;
+
+    uint32_t now = (uint32_t)time(NULL);
+    if (now < next_bucket_start || now - next_bucket_start > bucket_cnt * bucket_s) {
+        // Pulkstenis pārlēca (NTP sinhronizācija) - ielādējam visu no jauna
+        reload_history();
+        return;
+    }
+
+    bool changed = false;
+    while (next_bucket_start + bucket_s <= now) {
+        hist_bucket_t b;
+        burn_history_buckets(next_bucket_start, bucket_s, 1, &b);
+        // Jauni dati ārpus ass to tikai paplašina; sašaurina nākamā pārlāde
+        if (temp_axis_fit(&b, &temp_axis_min, &temp_axis_max)) temp_axis_apply();
+        push_bucket(&b);
+        next_bucket_start += bucket_s;
+        changed = true;
+    }
+    if (changed) lv_obj_invalidate(phase_strip);
+}
+
+static void phase_strip_draw_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    if (bucket_cnt == 0) return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_coord_t w = lv_area_get_width(&coords);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+
+    // Vienādas fāzes secīgās kolonnas zīmē kā vienu taisnstūri
+    uint32_t run_start = 0;
+    for (uint32_t i = 1; i <= bucket_cnt; i++) {
+        if (i < bucket_cnt && phases[i] == phases[run_start]) continue;
+
+        if (phases[run_start] != BURN_PHASE_COUNT) {
+            lv_area_t a;
+            a.x1 = coords.x1 + (lv_coord_t)(run_start * w / bucket_cnt);
+            a.x2 = coords.x1 + (lv_coord_t)(i * w / bucket_cnt) - 1;
+            a.y1 = coords.y1;
+            a.y2 = coords.y2;
+            rect_dsc.bg_color = phase_color(phases[run_start]);
+            lv_draw_rect(draw_ctx, &rect_dsc, &a);
+        }
+        run_start = i;
+    }
+}
+
+static lv_obj_t * create_legend(lv_obj_t * parent, const char * text, lv_color_t color, int x, int y)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_color(label, color, 0);
+    lv_obj_set_pos(label, x, y);
+    return label;
+}
+
+// ===== Ekrāna izveide =====
+void history_screen_create(void)
+{
+    if (history_screen) {
+        return;
+    }
+
+    history_screen = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(history_screen, LV_HOR_RES, LV_VER_RES);
+    lv_obj_set_pos(history_screen, 0, 0);
+    lv_obj_clear_flag(history_screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(history_screen, LV_OBJ_FLAG_HIDDEN);
+
+    // Back button
+    lv_obj_t * back_btn = lv_btn_create(history_screen);
+    lv_obj_set_size(back_btn, 80, 40);
+    lv_obj_set_pos(back_btn, 20, 20);
+    lv_obj_t * back_label = lv_label_create(back_btn);
+    lv_label_set_text(back_label, "Back");
+    lv_obj_center(back_label);
+    lv_obj_add_event_cb(back_btn, [](lv_event_t * e) {
+        (void)e;
+        history_screen_hide();
+    }, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t * title = lv_label_create(history_screen);
+    lv_label_set_text(title, "Burn history");
+    lv_obj_set_pos(title, 130, 30);
+
+    // Laika loga izvēle
+    static const char * span_map[] = {"1h", "8h", "24h", ""};
+    span_btns = lv_btnmatrix_create(history_screen);
+    lv_btnmatrix_set_map(span_btns, span_map);
+    lv_btnmatrix_set_btn_ctrl_all(span_btns, LV_BTNMATRIX_CTRL_CHECKABLE);
+    lv_btnmatrix_set_one_checked(span_btns, true);
+    lv_btnmatrix_set_btn_ctrl(span_btns, span_index, LV_BTNMATRIX_CTRL_CHECKED);
+    lv_obj_set_size(span_btns, LV_HOR_RES - 40, 50);
+    lv_obj_set_pos(span_btns, 0, 70);
+    lv_obj_add_event_cb(span_btns, [](lv_event_t * e) {
+        uint16_t id = lv_btnmatrix_get_selected_btn(lv_event_get_target(e));
+        if (id < sizeof(span_seconds) / sizeof(span_seconds[0]) && id != span_index) {
+            span_index = id;
+            reload_history();
+        }
+    }, LV_EVENT_VALUE_CHANGED, NULL);
+
+    // Diagramma: temperatūra un mērķis pa kreiso asi, damper % pa labo
+    chart = lv_chart_create(history_screen);
+    lv_obj_set_size(chart, LV_HOR_RES - 40, 250);
+    lv_obj_set_pos(chart, 0, 130);
+    lv_obj_set_style_pad_hor(chart, 0, 0);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_ITEMS);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_div_line_count(chart, 5, 0);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, temp_axis_min, temp_axis_max);
+    lv_chart_set_range(chart, LV_CHART_AXIS_SECONDARY_Y, 0, 100);
+
+    ser_damper = lv_chart_add_series(chart, lv_color_hex(0x0088FF), LV_CHART_AXIS_SECONDARY_Y);
+    ser_target = lv_chart_add_series(chart, lv_color_hex(0x7997a3), LV_CHART_AXIS_PRIMARY_Y);
+    ser_temp = lv_chart_add_series(chart, lv_color_hex(0xE53935), LV_CHART_AXIS_PRIMARY_Y);
+
+    lv_obj_update_layout(chart);
+    bucket_cnt = LV_MIN(lv_obj_get_content_width(chart), HISTORY_MAX_BUCKETS);
+
+    ring_temp = lv_chart_ring_create(bucket_cnt * 2);
+    ring_target = lv_chart_ring_create(bucket_cnt * 2);
+    ring_damper = lv_chart_ring_create(bucket_cnt * 2);
+    if (!ring_temp || !ring_target || !ring_damper) {
+        LV_LOG_WARN("history: out of memory for chart rings");
+        bucket_cnt = 0;
+        return;
+    }
+    lv_chart_set_series_ring(chart, ser_temp, ring_temp);
+    lv_chart_set_series_ring(chart, ser_target, ring_target);
+    lv_chart_set_series_ring(chart, ser_damper, ring_damper);
+    lv_chart_set_ring_view_count(chart, 0);
+
+    // Degšanas fāžu josla zem diagrammas (tikpat plata kā diagrammas saturs)
+    lv_area_t content;
+    lv_obj_get_content_coords(chart, &content);
+    phase_strip = lv_obj_create(history_screen);
+    lv_obj_remove_style_all(phase_strip);
+    lv_obj_set_size(phase_strip, lv_area_get_width(&content), 12);
+    lv_obj_align_to(phase_strip, chart, LV_ALIGN_OUT_BOTTOM_LEFT, content.x1 - chart->coords.x1, 4);
+    lv_obj_add_event_cb(phase_strip, phase_strip_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    // Leģenda
+    create_legend(history_screen, "Temp", lv_color_hex(0xE53935), 0, 405);
+    create_legend(history_screen, "Target", lv_color_hex(0x7997a3), 70, 405);
+    create_legend(history_screen, "Damper %", lv_color_hex(0x0088FF), 150, 405);
+    create_legend(history_screen, "MANUAL", phase_color(BURN_PHASE_MANUAL), 0, 430);
+    create_legend(history_screen, "AUTO", phase_color(BURN_PHASE_AUTO), 80, 430);
+    create_legend(history_screen, "FILL", phase_color(BURN_PHASE_FILL), 140, 430);
+    create_legend(history_screen, "END", phase_color(BURN_PHASE_END), 195, 430);
+
+    update_timer = lv_timer_create(update_timer_cb, 1000, NULL);
+    lv_timer_pause(update_timer);
+}
+
+void history_screen_show(void)
+{
+    if (!history_screen) {
+        history_screen_create();
+    }
+    is_visible = true;
+    lv_obj_clear_flag(history_screen, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(history_screen);
+
+    reload_history();
+    if (update_timer) lv_timer_resume(update_timer);
+}
+
+void history_screen_hide(void)
+{
+    if (history_screen) {
+        lv_obj_add_flag(history_screen, LV_OBJ_FLAG_HIDDEN);
+        is_visible = false;
+        if (update_timer) lv_timer_pause(update_timer);
+    }
+}
+
+bool history_screen_is_visible(void)
+{
+    return is_visible;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Create history UI objects if not created yet
+void history_screen_create(void);
+
+// Show/hide helpers
+void history_screen_show(void);
+void history_screen_hide(void);
+bool history_screen_is_visible(void);
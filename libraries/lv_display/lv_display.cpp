@@ -2,8 +2,11 @@
 #include "temperature.h"      // Pievienojam īstā temperatūras sensora atbalstu
 #include "display_manager.h"  // Pievienojam display manager atbalstu
 #include "settings_screen.h"  // JAUNS: settings screen (VVC minimal)
+#include "history_screen.h"   // JAUNS: degšanas vēstures ekrāns
+#include "burn_history.h"     // JAUNS: vēstures ierakstīšana pirms deep sleep
 #include "../damper_control/damper_control.h"   // Pievienojam damper kontroli ar relatīvo ceļu
 #include "../wifi/wifi.h"     // JAUNS: WiFi bibliotēka laika funkcijām
+#include "app_assets.h"        // JAUNS: fonti no "assets" flash partīcijas
 #include <string>
 #include <esp_sleep.h>        // JAUNS: Deep sleep atbalsts
 #include <driver/rtc_io.h>    // JAUNS: RTC GPIO atbalsts
@@ -22,9 +25,30 @@ static int saved_damper = 0; // Lai saglabātu vērtību pirms manuālā režīm
 
 static const char *TAG = "LV_DISPLAY";
 
+// JAUNS: Fonti tiek ņemti no "assets" partīcijas (idf.py flash to ieraksta), ja tā ir ierakstīta.
+// Ar -D APP_BUILTIN_FONTS=0 iebūvētie fonti netiek piesaistīti un linkeris tos izmet no app (mazāks OTA).
+#ifndef APP_BUILTIN_FONTS
+#define APP_BUILTIN_FONTS 1
+#endif
+
+#if APP_BUILTIN_FONTS
 LV_FONT_DECLARE(ekstra);
 LV_FONT_DECLARE(ekstra1);
 LV_FONT_DECLARE(eeet);
+#define BUILTIN_FONT(f) (&(f))
+#else
+#define BUILTIN_FONT(f) LV_FONT_DEFAULT
+#endif
+
+static const lv_font_t *font_ekstra = BUILTIN_FONT(ekstra);
+static const lv_font_t *font_ekstra1 = BUILTIN_FONT(ekstra1);
+static const lv_font_t *font_eeet = BUILTIN_FONT(eeet);
+static const lv_font_t *font_m14 = BUILTIN_FONT(lv_font_montserrat_14);
+static const lv_font_t *font_m20 = BUILTIN_FONT(lv_font_montserrat_20);
+static const lv_font_t *font_m22 = BUILTIN_FONT(lv_font_montserrat_22);
+static const lv_font_t *font_m24 = BUILTIN_FONT(lv_font_montserrat_24);
+static const lv_font_t *font_m26 = BUILTIN_FONT(lv_font_montserrat_26);
+static const lv_font_t *font_m28 = BUILTIN_FONT(lv_font_montserrat_28);
 
 // UI objekti no test22 (ar rolleriem)
 lv_obj_t *blue_bar = NULL;
@@ -111,7 +135,7 @@ void setup_invisible_roller_style(lv_obj_t* roller)
     lv_obj_set_style_pad_all(roller, 0, LV_PART_MAIN);
     
     // Selected teksts
-    lv_obj_set_style_text_font(roller, &lv_font_montserrat_28, LV_PART_SELECTED);
+    lv_obj_set_style_text_font(roller, font_m28, LV_PART_SELECTED);
     lv_obj_set_style_text_color(roller, lv_color_hex(0x7997a3), LV_PART_SELECTED);
     lv_obj_set_style_bg_opa(roller, LV_OPA_TRANSP, LV_PART_SELECTED);
     lv_obj_set_style_border_width(roller, 0, LV_PART_SELECTED);
@@ -259,6 +283,9 @@ void lv_display_show_warning(const char* title, const char* message) {
         warning_popup_visible = false;
     }
     
+    // Brīdinājumam jābūt redzamam arī tad, ja displejs guļ
+    bsp_display_idle_wake();
+
     // Izveidojam jaunu popup
     warning_popup = lv_obj_create(lv_scr_act());
     lv_obj_set_size(warning_popup, 300, 160); // Mazāks, jo nav mute pogas
@@ -272,14 +299,14 @@ void lv_display_show_warning(const char* title, const char* message) {
     // Virsraksts ar lielāku brīdinājuma ikonu
     lv_obj_t * title_label = lv_label_create(warning_popup);
     lv_label_set_text_fmt(title_label, LV_SYMBOL_WARNING " %s", title);
-    lv_obj_set_style_text_font(title_label, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_font(title_label, font_m24, 0);
     lv_obj_set_style_text_color(title_label, lv_color_hex(0xFF0000), 0); // Spilgti sarkans
     lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 15);
     
     // Brīdinājuma ziņojums - lielāks un treknāks
     lv_obj_t * message_label = lv_label_create(warning_popup);
     lv_label_set_text(message_label, message);
-    lv_obj_set_style_text_font(message_label, &lv_font_montserrat_22, 0);
+    lv_obj_set_style_text_font(message_label, font_m22, 0);
     lv_obj_set_style_text_color(message_label, lv_color_hex(0x000000), 0);
     // Iestatām maksimālo platumu, lai teksts automātiski ietītos
     lv_obj_set_width(message_label, 260);
@@ -290,7 +317,7 @@ void lv_display_show_warning(const char* title, const char* message) {
     // Pievienojam automātiskas izslēgšanās norādi
     lv_obj_t * auto_close_label = lv_label_create(warning_popup);
     lv_label_set_text(auto_close_label, "bridinajums");
-    lv_obj_set_style_text_font(auto_close_label, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_font(auto_close_label, font_m14, 0);
     lv_obj_set_style_text_color(auto_close_label, lv_color_hex(0x888888), 0);
     lv_obj_align(auto_close_label, LV_ALIGN_BOTTOM_MID, 0, -10);
     
@@ -327,6 +354,9 @@ void enter_deep_sleep_with_touch_wakeup() {
     ESP_LOGI(TAG, "GPIO %d configured as touch interrupt wake-up source", EXAMPLE_PIN_NUM_QSPI_TOUCH_INT);
     ESP_LOGI(TAG, "Entering deep sleep mode...");
     
+    // JAUNS: Saglabājam vēl neierakstīto degšanas vēsturi
+    burn_history_flush();
+
     // Neliela pauze, lai log ziņojumi tiktu nosūtīti
     vTaskDelay(pdMS_TO_TICKS(100));
     
@@ -396,7 +426,7 @@ void create_main_ui() {
 
     // Laika etiķete
     time_label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(time_label, &lv_font_montserrat_26, 0);
+    lv_obj_set_style_text_font(time_label, font_m26, 0);
     lv_obj_set_style_text_color(time_label, lv_color_hex(0x7997a3), 0);
     lv_obj_set_pos(time_label, 180, 25);
     lv_label_set_text(time_label, LV_SYMBOL_WIFI " 00:00");
@@ -444,14 +474,14 @@ void create_main_ui() {
 
     // Temperatūras teksts
     temp_label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(temp_label, &ekstra, 0);
+    lv_obj_set_style_text_font(temp_label, font_ekstra, 0);
     lv_obj_set_style_text_color(temp_label, lv_color_hex(0xF3F4F3), 0);
     lv_obj_set_pos(temp_label, 45, 360);
     lv_label_set_text(temp_label, "25");
 
     // Grādu simbols
     temp0 = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(temp0, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_font(temp0, font_m20, 0);
     lv_obj_set_style_text_color(temp0, lv_color_hex(0xF3F4F3), 0);
     lv_obj_set_style_bg_color(temp0, lv_color_hex(0xF3F4F3), 0);
     lv_obj_set_pos(temp0, 140, 360);
@@ -459,7 +489,7 @@ void create_main_ui() {
 
     // Target etiķete
     target = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(target, &lv_font_montserrat_22, 0);
+    lv_obj_set_style_text_font(target, font_m22, 0);
     lv_obj_set_style_text_color(target, lv_color_hex(0x7997a3), 0);
     lv_obj_set_style_bg_color(target, lv_color_hex(0x7997a3), 0);
     lv_obj_set_pos(target, 170, 110);
@@ -467,7 +497,7 @@ void create_main_ui() {
 
     // Damper procenti
     damper_label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(damper_label, &lv_font_montserrat_28, 0);
+    lv_obj_set_style_text_font(damper_label, font_m28, 0);
     lv_obj_set_style_text_color(damper_label, lv_color_hex(0x7997a3), 0);
     lv_obj_set_style_bg_color(damper_label, lv_color_hex(0x7997a3), 0);
     lv_obj_set_pos(damper_label, 200, 290);
@@ -476,7 +506,7 @@ void create_main_ui() {
     // Settings poga (label_one) - S burts
     lv_obj_t *label_one = lv_label_create(lv_scr_act());
     lv_label_set_text(label_one, "2"); // No test22 - cipars 2
-    lv_obj_set_style_text_font(label_one, &eeet, 0);
+    lv_obj_set_style_text_font(label_one, font_eeet, 0);
     lv_obj_set_style_text_color(label_one, lv_color_hex(0x7997a3), 0);
     lv_obj_set_style_bg_color(label_one, lv_color_hex(0x7997a3), 0);
     lv_obj_set_pos(label_one, 240, 390);
@@ -505,9 +535,22 @@ void create_main_ui() {
         }
     }, LV_EVENT_HIT_TEST, NULL);
 
+    // JAUNS: Vēstures poga - atver degšanas vēstures diagrammu
+    lv_obj_t *history_btn = lv_label_create(lv_scr_act());
+    lv_label_set_text(history_btn, LV_SYMBOL_LIST);
+    lv_obj_set_style_text_font(history_btn, font_m28, 0);
+    lv_obj_set_style_text_color(history_btn, lv_color_hex(0x7997a3), 0);
+    lv_obj_set_pos(history_btn, 180, 435);
+    lv_obj_add_flag(history_btn, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_ext_click_area(history_btn, 10);
+    lv_obj_add_event_cb(history_btn, [](lv_event_t * e) {
+        (void)e;
+        history_screen_show();
+    }, LV_EVENT_PRESSED, NULL);
+
     // Damper statuss
     damper_status_label = lv_label_create(lv_scr_act());
-    lv_obj_set_style_text_font(damper_status_label, &ekstra1, 0);
+    lv_obj_set_style_text_font(damper_status_label, font_ekstra1, 0);
     lv_obj_set_style_text_color(damper_status_label, lv_color_hex(0x7997a3), 0);
     lv_obj_set_style_bg_color(damper_status_label, lv_color_hex(0x7997a3), 0);
     lv_obj_set_pos(damper_status_label, 180, 230);
@@ -653,8 +696,35 @@ void lvgl_task(void *pvParameter) {
     }
 }
 
+// JAUNS: Tiešās simbolu tabulas fontiem (ASCII/Latin-1), lai teksta mērīšana nemeklē katru simbolu
+static void prepare_fonts() {
+    // JAUNS: Fonti no assets partīcijas (bitmapi paliek flash), citādi iebūvētie
+    if (app_assets_mount() == ESP_OK) {
+        font_ekstra = app_assets_font("ekstra", font_ekstra);
+        font_ekstra1 = app_assets_font("ekstra1", font_ekstra1);
+        font_eeet = app_assets_font("eeet", font_eeet);
+        font_m14 = app_assets_font("lv_font_montserrat_14", font_m14);
+        font_m20 = app_assets_font("lv_font_montserrat_20", font_m20);
+        font_m22 = app_assets_font("lv_font_montserrat_22", font_m22);
+        font_m24 = app_assets_font("lv_font_montserrat_24", font_m24);
+        font_m26 = app_assets_font("lv_font_montserrat_26", font_m26);
+        font_m28 = app_assets_font("lv_font_montserrat_28", font_m28);
+    }
+
+    const lv_font_t *fonts[] = {
+        font_ekstra, font_ekstra1, font_eeet,
+        font_m14, font_m20, font_m22, font_m24, font_m26, font_m28,
+    };
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        if (lv_font_fmt_txt_build_lut(fonts[i], 0x100) != LV_RES_OK) {
+            ESP_LOGW(TAG, "Font lookup table not created (%u)", (unsigned)i);
+        }
+    }
+}
+
 // UI objektu inicializācija
 void lv_display_init_objects() {
+    prepare_fonts();
     create_main_ui();
     ESP_LOGI(TAG, "LV Display objects initialized");
 }
@@ -730,8 +800,10 @@ void lv_display_show_touch_point(uint16_t x, uint16_t y, bool show) {
 // Display hardware initialization and configuration
 void lv_display_init_hardware() {
     // Displeja konfigurācija
+    lvgl_port_cfg_t port_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    port_cfg.task_affinity = 0;  // LVGL uz 0. kodola, joslu palīgs (LV_USE_DRAW_SW_MT) uz 1.
     bsp_display_cfg_t cfg = {
-        .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
+        .lvgl_port_cfg = port_cfg,
         .buffer_size = EXAMPLE_LCD_QSPI_H_RES * EXAMPLE_LCD_QSPI_V_RES,
 #if LVGL_PORT_ROTATION_DEGREE == 90
         .rotate = LV_DISP_ROT_90,
@@ -746,6 +818,10 @@ void lv_display_init_hardware() {
 
     bsp_display_start_with_config(&cfg);
     bsp_display_backlight_on();
+
+    // Aptumšo un iemidzina displeju, ja to neaiztiek; pamostas no touch
+    const bsp_display_idle_cfg_t idle_cfg = BSP_DISPLAY_IDLE_DEFAULT_CONFIG();
+    bsp_display_idle_start(&idle_cfg);
     ESP_LOGI(TAG, "Display hardware initialized");
 }
 
@@ -66,6 +66,12 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Size of the arena of a slab allocator in bytes (multiple of 1024). 0: disable.
+ *The allocations up to 256 bytes (objects, styles, event descriptors, timers, animations) are stored in
+ *size classes in this arena. It's a normal array, so it's in the internal RAM on MCUs with external RAM.
+ *The larger allocations and the ones which don't fit anymore use the allocator above.*/
+#define LV_MEM_SLAB_SIZE 0
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
@@ -117,8 +123,8 @@
     #define LV_SHADOW_CACHE_SIZE 0
 
     /* Set number of maximally cached circle data.
-    * The circumference of 1/4 circle are saved for anti-aliasing
-    * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+    * The circumference of 1/4 circle are saved for anti-aliasing, ordered for the left and right corners
+    * radius * 12 bytes are used per circle (the most often used radiuses are saved and kept between refreshes)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
 #endif /*LV_DRAW_COMPLEX*/
@@ -146,6 +152,11 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Memory budget of the image cache in bytes.
+ *The least recently used images are closed while the decoded images are larger than this.
+ *0: limit only the number of images with LV_IMG_CACHE_DEF_SIZE*/
+#define LV_IMG_CACHE_MEM_SIZE 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -157,6 +168,23 @@
  *0 mean no caching.*/
 #define LV_GRAD_CACHE_DEF_SIZE 0
 
+/*Default glyph cache size in bytes.
+ *The software renderer keeps the recently drawn letters as 8 bit opacity maps,
+ *so the glyphs of compressed or large fonts are not decompressed and converted again on every redraw.
+ *The least recently used glyphs are dropped when the cache is full.
+ *0: to disable caching*/
+#define LV_GLYPH_CACHE_DEF_SIZE 0
+#if LV_GLYPH_CACHE_DEF_SIZE
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #define LV_GLYPH_CACHE_CUSTOM 0
+    #if LV_GLYPH_CACHE_CUSTOM
+        #define LV_GLYPH_CACHE_CUSTOM_INCLUDE <stdlib.h>   /*Header for the allocator*/
+        #define LV_GLYPH_CACHE_CUSTOM_ALLOC   malloc
+        #define LV_GLYPH_CACHE_CUSTOM_FREE    free
+    #endif
+#endif
+
 /*Allow dithering the gradients (to achieve visual smooth color gradients on limited color depth display)
  *LV_DITHER_GRADIENT implies allocating one or two more lines of the object's rendering surface
  *The increase in memory consumption is (32 bits * object width) plus 24 bits * object width if using error diffusion */
@@ -172,6 +200,17 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render the large fills and image blits in horizontal bands on helper threads too (e.g. on the second core).
+ *Requires pthreads. The result is pixel-identical to the single threaded rendering.*/
+#define LV_USE_DRAW_SW_MT 0
+#if LV_USE_DRAW_SW_MT
+    /*Number of helper threads. The drawing thread renders a band too.*/
+    #define LV_DRAW_SW_MT_THREAD_CNT 1
+
+    /*Blends smaller than this many pixels are rendered by the drawing thread only*/
+    #define LV_DRAW_SW_MT_MIN_PX 4096
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -294,6 +333,22 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Record the time spent in the rendering stages into a ring buffer which can be exported
+ *as Chrome trace JSON by `lv_profiler_dump()`*/
+#define LV_USE_PROFILER 0
+#if LV_USE_PROFILER
+    /*Number of events kept in the ring buffer (12..16 bytes each). The oldest ones are overwritten*/
+    #define LV_PROFILER_BUF_SIZE 4096
+    /*Header to include for the time stamp and thread ID getters*/
+    #define LV_PROFILER_INCLUDE <stdint.h>
+    /*Time stamp of the events, e.g. a CPU cycle counter. Can wrap around at 32 bits*/
+    #define LV_PROFILER_TICK_GET() lv_tick_get()
+    /*Ticks of `LV_PROFILER_TICK_GET()` per second*/
+    #define LV_PROFILER_TICK_PER_SEC 1000
+    /*ID of the current thread or CPU core (0..239) to show the events of each on its own track*/
+    #define LV_PROFILER_TID_GET() 0
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -306,6 +361,11 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of the objects, so the drawing doesn't have to search all the styles
+ *of an object for every property. The cache of an object is dropped when its styles or state change.
+ *Number of properties cached per object part, must be a power of 2. 0: disable caching*/
+#define LV_OBJ_STYLE_CACHE_SIZE 0
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -491,6 +551,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 1   /*Save the line breaks and letter widths of the labels to skip measuring the text on redraw*/
 #endif
 
 #define LV_USE_LINE       1
@@ -646,6 +707,19 @@
     #define LV_FS_LITTLEFS_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
 #endif
 
+/*Share a cache of fixed size blocks between the files opened for reading on the POSIX and LittleFS drives
+ *instead of their `*_CACHE_SIZE` buffers. The blocks are kept after closing the files.*/
+#define LV_FS_BLOCK_CACHE 0
+#if LV_FS_BLOCK_CACHE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 4096   /*[bytes]*/
+    #define LV_FS_BLOCK_CACHE_BLOCK_CNT 8       /*Number of blocks, at least 2*/
+
+    /*Read this many blocks ahead on a helper thread when a file is read sequentially (e.g. by a decoder). Requires pthreads.
+     *The driver is called from the helper thread too (with an other file handle), so only the drivers with `thread_safe` set
+     *are read ahead (POSIX, and LittleFS built with LFS_THREADSAFE).*/
+    #define LV_FS_BLOCK_CACHE_READ_AHEAD 0
+#endif
+
 /*PNG decoder library*/
 #define LV_USE_PNG 0
 
@@ -659,6 +733,10 @@
 /*GIF decoder library*/
 #define LV_USE_GIF 0
 
+/*Decoder of pre-decoded RGB565 images compressed with run-length encoding.
+ *Create them with `scripts/png_to_rle.py`*/
+#define LV_USE_RLE_IMG 0
+
 /*QR code library*/
 #define LV_USE_QRCODE 0
 
@@ -684,6 +762,17 @@
 #if LV_USE_TINY_TTF
     /*Load TTF data from files*/
     #define LV_TINY_TTF_FILE_SUPPORT 0
+    /*Size of the glyph cache shared by all Tiny TTF fonts and sizes in bytes.
+     *It keeps the metrics and the rendered bitmaps of the recently used letters. 0: don't cache*/
+    #define LV_TINY_TTF_CACHE_SIZE (32 * 1024)
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #define LV_TINY_TTF_CACHE_CUSTOM 0
+    #if LV_TINY_TTF_CACHE_CUSTOM
+        #define LV_TINY_TTF_CACHE_CUSTOM_INCLUDE <stdlib.h>   /*Header for the allocator*/
+        #define LV_TINY_TTF_CACHE_CUSTOM_ALLOC   malloc
+        #define LV_TINY_TTF_CACHE_CUSTOM_FREE    free
+    #endif
 #endif
 
 /*Rlottie library*/
@@ -719,6 +808,14 @@
 /*1: Enable a published subscriber based messaging system */
 #define LV_USE_MSG 0
 
+/*1: Enable fonts and images from an asset bundle in memory mapped flash.
+ *Create the bundles with `scripts/lv_assets_pack.py`*/
+#define LV_USE_ASSETS 0
+#if LV_USE_ASSETS
+    /*1: Add `lv_assets_map_file()` to map bundle files with POSIX `mmap()`, e.g. on a PC simulator*/
+    #define LV_ASSETS_POSIX_MMAP 0
+#endif
+
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
 #define LV_USE_IME_PINYIN 0
@@ -0,0 +1,299 @@
+#!/usr/bin/env python3
+##################################################################
+# Asset bundle packer for `lv_assets`
+# Dependencies: (PYTHON-3), no other packages
+##################################################################
+#
+# Packs fonts and images to one binary file which can be written to a flash partition
+# and used from the memory mapped flash without copying. See the format in
+# src/extra/others/assets/lv_assets.c.
+#
+# usage: python3 lv_assets_pack.py -o assets.bin [--color-depth 16|32] [--swap] [--large-glyphs] [--max-size N]
+#                                   [name=]file ...
+#   file.c    font created by lv_font_conv with `--format lvgl`. Default name: the name of the font variable.
+#   file.png  image, converted to true color (with alpha if any pixel is not opaque)
+#   file.rle  run-length encoded image created by png_to_rle.py (needs LV_USE_RLE_IMG)
+#   file.bin  LVGL image file (the 4 byte header and the pixels), stored as it is
+#   other     stored as raw data
+#   Default name of the files: the file name without extension.
+#
+#   --color-depth  LV_COLOR_DEPTH of the target, default: 16
+#   --swap         for LV_COLOR_16_SWAP 1
+#   --large-glyphs for LV_FONT_FMT_TXT_LARGE 1
+#   --max-size     fail if the bundle is larger, e.g. the size of the partition
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from png_to_rle import read_png  # noqa: E402
+
+VERSION = 2
+NAME_MAX = 22
+FLAG_SWAP = 0x01
+FONT_FLAG_LARGE = 0x01
+FONT_HEADER_SIZE = 40
+
+TYPE_RAW = 0
+TYPE_IMG = 1
+TYPE_FONT = 2
+
+# lv_img_cf_t
+CF_TRUE_COLOR = 4
+CF_TRUE_COLOR_ALPHA = 5
+CF_RAW = 1
+CF_RAW_ALPHA = 2
+
+CMAP_TYPES = {
+    "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL": 0,
+    "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL": 1,
+    "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY": 2,
+    "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY": 3,
+}
+
+SUBPX = {"LV_FONT_SUBPX_NONE": 0, "LV_FONT_SUBPX_HOR": 1, "LV_FONT_SUBPX_VER": 2, "LV_FONT_SUBPX_BOTH": 3}
+
+
+def align(data, n=4):
+    return data + bytes(-len(data) % n)
+
+
+def img_header(cf, w, h):
+    # lv_img_header_t on little endian: cf:5, always_zero:3, reserved:2, w:11, h:11
+    return struct.pack("<I", cf | (w << 10) | (h << 21))
+
+
+##################################################################
+# Fonts
+##################################################################
+
+def c_value(v):
+    v = v.strip()
+    if v in ("NULL", "0"):
+        return 0
+    if v in CMAP_TYPES:
+        return CMAP_TYPES[v]
+    if v in SUBPX:
+        return SUBPX[v]
+    try:
+        return int(v, 0)
+    except ValueError:
+        return v  # A name, e.g. of an array or a font
+
+
+def c_fields(text):
+    return {k: c_value(v) for k, v in re.findall(r"\.(\w+)\s*=\s*([^,}\n]+)", text)}
+
+
+def c_struct(src, decl):
+    # With `#if` removed, both branches remain: `... x = {` + `... x = { fields }`. Only the last has no `{` inside.
+    m = re.findall(decl + r"\s*=\s*\{([^{}]*)\}", src)
+    return c_fields(m[-1]) if m else None
+
+
+def parse_font(path):
+    """Parse a font created by lv_font_conv in LVGL's C format"""
+    with open(path) as f:
+        src = f.read()
+
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    src = re.sub(r"//[^\n]*", "", src)
+    src = re.sub(r"^\s*#[^\n]*", "", src, flags=re.M)
+
+    arrays = {}
+    for ctype, name, body in re.findall(r"(u?int(?:8|16)_t)\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", src, re.S):
+        arrays[name] = (ctype, [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)])
+
+    m = re.search(r"lv_font_fmt_txt_glyph_dsc_t\s+\w+\s*\[\s*\]\s*=\s*\{(.*?)\};", src, re.S)
+    glyphs = [c_fields(g) for g in re.findall(r"\{([^{}]*)\}", m.group(1))]
+
+    m = re.search(r"lv_font_fmt_txt_cmap_t\s+\w+\s*\[\s*\]\s*=\s*\{(.*?)\};", src, re.S)
+    cmaps = [c_fields(c) for c in re.findall(r"\{([^{}]*)\}", m.group(1))]
+
+    dsc = c_struct(src, r"lv_font_fmt_txt_dsc_t\s+\w+")
+    font = re.findall(r"lv_font_t\s+(\w+)\s*=\s*\{([^{}]*)\}", src)
+    if not dsc or not font or not glyphs or not cmaps:
+        raise ValueError(path + " is not a font created by lv_font_conv")
+    font_name, font = font[-1][0], c_fields(font[-1][1])
+
+    kern = None
+    if dsc.get("kern_dsc"):
+        kern = c_struct(src, r"lv_font_fmt_txt_kern_(?:classes|pair)_t\s+\w+")
+
+    return font_name, dict(font=font, dsc=dsc, glyphs=glyphs, cmaps=cmaps, kern=kern, arrays=arrays)
+
+
+def pack_font(f, path, large):
+    arrays = f["arrays"]
+
+    def array(name, fmt):
+        values = arrays[name][1]
+        return struct.pack("<%d%s" % (len(values), fmt), *values)
+
+    dsc = f["dsc"]
+    glyph_data = bytearray()
+    for g in f["glyphs"]:
+        # lv_font_fmt_txt_glyph_dsc_t
+        if large:
+            glyph_data += struct.pack("<IIHHhh", g["bitmap_index"], g["adv_w"],
+                                      g["box_w"], g["box_h"], g["ofs_x"], g["ofs_y"])
+            continue
+        if g["bitmap_index"] >= 1 << 20 or g["adv_w"] >= 1 << 12:
+            raise ValueError(path + ": the font is too large, use --large-glyphs and LV_FONT_FMT_TXT_LARGE")
+        glyph_data += struct.pack("<IBBbb", g["bitmap_index"] | (g["adv_w"] << 20),
+                                  g["box_w"], g["box_h"], g["ofs_x"], g["ofs_y"])
+
+    # The header, cmap records and kerning record have fixed size, the tables follow them
+    body = bytearray()
+    fixed = FONT_HEADER_SIZE + len(f["cmaps"]) * 20 + (16 if f["kern"] else 0)
+
+    def add(data, n=4):
+        body.extend(bytes(-(fixed + len(body)) % n))
+        ofs = fixed + len(body)
+        body.extend(data)
+        return ofs
+
+    # The decompressor has no end marker: it reads at most bpp + 7 bits per pixel and 1 byte ahead.
+    # Pad the bitmaps so that this worst case of every glyph is in them, lv_assets checks it.
+    bitmap = array(dsc["glyph_bitmap"], "B")
+    bitmap_size = len(bitmap)
+    for g in f["glyphs"]:
+        px = g["box_w"] * g["box_h"]
+        if px and dsc.get("bitmap_format", 0):
+            bitmap_size = max(bitmap_size, g["bitmap_index"] + (px * (dsc["bpp"] + 7) + 7) // 8 + 1)
+    bitmap_ofs = add(bitmap + bytes(bitmap_size - len(bitmap)))
+    glyph_dsc_ofs = add(glyph_data)
+
+    cmap_data = bytearray()
+    for c in f["cmaps"]:
+        ul = add(array(c["unicode_list"], "H"), 2) if c["unicode_list"] else 0
+        ol = 0
+        if c["glyph_id_ofs_list"]:
+            wide = arrays[c["glyph_id_ofs_list"]][0] == "uint16_t"
+            ol = add(array(c["glyph_id_ofs_list"], "H" if wide else "B"), 2 if wide else 1)
+        cmap_data += struct.pack("<IHHIIHBB", c["range_start"], c["range_length"], c["glyph_id_start"],
+                                 ul, ol, c["list_length"], c["type"], 0)
+
+    kern_data = b""
+    k = f["kern"]
+    if k and dsc["kern_classes"]:
+        kern_data = struct.pack("<IIIBBH", add(array(k["class_pair_values"], "b"), 1),
+                                add(array(k["left_class_mapping"], "B"), 1),
+                                add(array(k["right_class_mapping"], "B"), 1),
+                                k["left_class_cnt"], k["right_class_cnt"], 0)
+    elif k:
+        wide = k.get("glyph_ids_size", 0)
+        kern_data = struct.pack("<IIIB3x", add(array(k["glyph_ids"], "H" if wide else "B"), 2 if wide else 1),
+                                add(array(k["values"], "b"), 1), k["pair_cnt"], wide)
+
+    font = f["font"]
+    header = struct.pack("<HhbbBBBBHHHB3xIIIII", font["line_height"], font["base_line"],
+                         font.get("underline_position", 0), font.get("underline_thickness", 0),
+                         font.get("subpx", 0), dsc["bpp"], dsc.get("bitmap_format", 0),
+                         dsc.get("kern_classes", 0), dsc.get("kern_scale", 0), len(f["cmaps"]),
+                         len(f["glyphs"]), FONT_FLAG_LARGE if large else 0, bitmap_ofs, glyph_dsc_ofs,
+                         FONT_HEADER_SIZE, FONT_HEADER_SIZE + len(cmap_data) if k else 0, bitmap_size)
+
+    return header + cmap_data + kern_data + bytes(body)
+
+
+##################################################################
+# Images
+##################################################################
+
+def encode_px(p, alpha, depth, swap):
+    r, g, b, a = p
+    if depth == 32:
+        return bytes([b, g, r, a if alpha else 255])
+    c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    out = struct.pack(">H" if swap else "<H", c)
+    return out + bytes([a]) if alpha else out
+
+
+def pack_png(path, depth, swap):
+    w, h, rows = read_png(path)
+    if w > 2047 or h > 2047:
+        raise ValueError(path + ": the images can be at most 2047 x 2047")
+    alpha = any(p[3] != 255 for row in rows for p in row)
+    data = b"".join(encode_px(p, alpha, depth, swap) for row in rows for p in row)
+    return img_header(CF_TRUE_COLOR_ALPHA if alpha else CF_TRUE_COLOR, w, h) + data
+
+
+def pack_rle(path, swap):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"LVRL":
+        raise ValueError(path + " is not an RLE image")
+    flags, w, h = data[5], *struct.unpack("<HH", data[6:10])
+    if bool(flags & 0x02) != swap:
+        print("warning: %s: the byte order of the pixels doesn't match --swap" % path)
+    return img_header(CF_RAW_ALPHA if flags & 0x01 else CF_RAW, w, h) + data
+
+
+##################################################################
+# Bundle
+##################################################################
+
+def pack(entries, depth, swap):
+    """entries: list of (name, type, data)"""
+    entries = sorted(entries, key=lambda e: e[0].encode())
+    header_size = 16 + 32 * len(entries)
+    table = bytearray()
+    body = bytearray()
+    for name, type, data in entries:
+        ofs = header_size + len(body)
+        table += struct.pack("<23sBII", name.encode(), type, ofs, len(data))
+        body += align(data)
+
+    size = header_size + len(body)
+    header = b"LVAB" + struct.pack("<BBBBII", VERSION, depth, FLAG_SWAP if swap else 0, 0, len(entries), size)
+    return header + bytes(table) + bytes(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack fonts and images to an asset bundle of lv_assets")
+    parser.add_argument("files", nargs="+", help="[name=]path")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--color-depth", type=int, choices=[16, 32], default=16)
+    parser.add_argument("--swap", action="store_true", help="high byte first, for LV_COLOR_16_SWAP 1")
+    parser.add_argument("--large-glyphs", action="store_true", help="for LV_FONT_FMT_TXT_LARGE 1")
+    parser.add_argument("--max-size", type=lambda v: int(v, 0), help="max. size of the bundle")
+    args = parser.parse_args()
+
+    entries = []
+    for arg in args.files:
+        name, path = arg.split("=", 1) if "=" in arg else (None, arg)
+        base, ext = os.path.splitext(os.path.basename(path))
+        ext = ext.lower()
+        if ext == ".c":
+            font_name, font = parse_font(path)
+            entry = (name or font_name, TYPE_FONT, pack_font(font, path, args.large_glyphs))
+        elif ext == ".png":
+            entry = (name or base, TYPE_IMG, pack_png(path, args.color_depth, args.swap))
+        elif ext == ".rle":
+            entry = (name or base, TYPE_IMG, pack_rle(path, args.swap))
+        else:
+            with open(path, "rb") as f:
+                entry = (name or base, TYPE_IMG if ext == ".bin" else TYPE_RAW, f.read())
+
+        if len(entry[0].encode()) > NAME_MAX:
+            sys.exit("%s: the name can be at most %d characters" % (entry[0], NAME_MAX))
+        if any(e[0] == entry[0] for e in entries):
+            sys.exit("%s: the name is used twice" % entry[0])
+        entries.append(entry)
+        print("%-22s %-4s %8d bytes" % (entry[0], ["raw", "img", "font"][entry[1]], len(entry[2])))
+
+    data = pack(entries, args.color_depth, args.swap)
+    if args.max_size is not None and len(data) > args.max_size:
+        sys.exit("the bundle is %d bytes, larger than %d" % (len(data), args.max_size))
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print("%s: %d assets, %d bytes" % (args.output, len(entries), len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+##################################################################
+# PNG to RLE image converter for the `lv_rle_img` decoder
+# Dependencies: (PYTHON-3), no other packages
+##################################################################
+#
+# The images are converted to RGB565 (and 8 bit alpha if any pixel is not opaque)
+# and compressed with run-length encoding row by row. See the format in
+# src/extra/libs/rle_img/lv_rle_img.c.
+#
+# usage: python3 png_to_rle.py [--swap] [--name NAME] [--out-dir DIR] image.png [image2.png ...]
+#   --swap     store RGB565 with the high byte first (for LV_COLOR_16_SWAP 1)
+#   --name     name of the C variable (only with one image), default: the file name
+#   --out-dir  where to write the .rle and .c files, default: next to the image
+#
+# It creates a binary file (.rle) and a C array (.c) for every image.
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+RLE_VERSION = 1
+FLAG_ALPHA = 0x01
+FLAG_SWAP = 0x02
+MAX_PACKET = 128
+
+
+def read_png(path):
+    """Return (width, height, rows) where rows are lists of (r, g, b, a) tuples"""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(path + " is not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            w, h, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b"tRNS":
+            trns = chunk
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError(path + ": only 8 bit, not interlaced PNG files are supported")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    raw = zlib.decompress(idat)
+    stride = w * channels
+    prev = bytearray(stride)
+    rows = []
+    i = 0
+    for _ in range(h):
+        ftype = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        prev = line
+
+        px = []
+        for x in range(w):
+            v = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                px.append((v[0], v[0], v[0], 255))
+            elif color_type == 2:
+                px.append((v[0], v[1], v[2], 255))
+            elif color_type == 3:
+                alpha = trns[v[0]] if v[0] < len(trns) else 255
+                px.append(palette[v[0]] + (alpha,))
+            elif color_type == 4:
+                px.append((v[0], v[0], v[0], v[1]))
+            else:
+                px.append(tuple(v))
+        rows.append(px)
+
+    return w, h, rows
+
+
+def encode_px(p, alpha, swap):
+    r, g, b, a = p
+    c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    out = struct.pack(">H" if swap else "<H", c)
+    if alpha:
+        out += bytes([a])
+    return out
+
+
+def encode_row(px, alpha, swap):
+    # Fully transparent pixels have the same value to make longer runs
+    px = [encode_px((0, 0, 0, 0) if alpha and p[3] == 0 else p, alpha, swap) for p in px]
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            n = min(len(literal), MAX_PACKET)
+            out.append(n - 1)
+            for p in literal[:n]:
+                out.extend(p)
+            del literal[:n]
+
+    i = 0
+    while i < len(px):
+        n = 1
+        while i + n < len(px) and n < MAX_PACKET and px[i + n] == px[i]:
+            n += 1
+        # A run of 2 pixels is not shorter than adding them to a literal packet
+        if n >= 3:
+            flush()
+            out.append(0x80 | (n - 1))
+            out += px[i]
+            i += n
+        else:
+            literal.append(px[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def convert(w, h, rows, swap):
+    alpha = any(p[3] != 255 for row in rows for p in row)
+    flags = (FLAG_ALPHA if alpha else 0) | (FLAG_SWAP if swap else 0)
+
+    encoded = [encode_row(row, alpha, swap) for row in rows]
+    offset = 12 + (h + 1) * 4
+    table = bytearray()
+    for e in encoded:
+        table += struct.pack("<I", offset)
+        offset += len(e)
+    table += struct.pack("<I", offset)
+
+    header = b"LVRL" + struct.pack("<BBHHH", RLE_VERSION, flags, w, h, 0)
+    return header + bytes(table) + b"".join(encoded), alpha
+
+
+def c_array(name, data, w, h, alpha):
+    attr = "LV_ATTRIBUTE_IMG_" + name.upper()
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02x," % b for b in data[i:i + 16]))
+
+    return """#include "lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attr}
+    #define {attr}
+#endif
+
+/*RLE image created by png_to_rle.py, needs LV_USE_RLE_IMG*/
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attr} uint8_t {name}_map[] = {{
+{data}
+}};
+
+const lv_img_dsc_t {name} = {{
+    .header.always_zero = 0,
+    .header.w = {w},
+    .header.h = {h},
+    .data_size = {size},
+    .header.cf = {cf},
+    .data = {name}_map,
+}};
+""".format(attr=attr, name=name, data="\n".join(lines), w=w, h=h, size=len(data),
+           cf="LV_IMG_CF_RAW_ALPHA" if alpha else "LV_IMG_CF_RAW")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert PNG images to the RLE format of lv_rle_img")
+    parser.add_argument("images", nargs="+")
+    parser.add_argument("--swap", action="store_true", help="high byte first, for LV_COLOR_16_SWAP 1")
+    parser.add_argument("--name", help="name of the C variable")
+    parser.add_argument("--out-dir", help="output directory")
+    args = parser.parse_args()
+
+    if args.name and len(args.images) > 1:
+        sys.exit("--name can be used only with one image")
+
+    for path in args.images:
+        w, h, rows = read_png(path)
+        if w > 2047 or h > 2047:
+            sys.exit(path + ": the images can be at most 2047 x 2047")
+
+        data, alpha = convert(w, h, rows, args.swap)
+        base = os.path.splitext(os.path.basename(path))[0]
+        name = args.name or base.replace("-", "_").replace(" ", "_")
+        out_dir = args.out_dir or os.path.dirname(path)
+
+        with open(os.path.join(out_dir, base + ".rle"), "wb") as f:
+            f.write(data)
+        with open(os.path.join(out_dir, base + ".c"), "w") as f:
+            f.write(c_array(name, data, w, h, alpha))
+
+        raw_size = w * h * (3 if alpha else 2)
+        print("%s: %d x %d, %s, %d bytes (RGB565%s: %d bytes)" % (path, w, h, "alpha" if alpha else "no alpha",
+                                                                  len(data), "A8" if alpha else "", raw_size))
+
+
+if __name__ == "__main__":
+    main()
@@ -27,6 +27,7 @@ typedef struct _lv_event_dsc_t {
  *  STATIC PROTOTYPES
  **********************/
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
+static void update_event_mask(lv_obj_t * obj);
 static lv_res_t event_send_core(lv_event_t * e);
 static bool event_is_bubbled(lv_event_t * e);
 
@@ -34,6 +35,7 @@ static bool event_is_bubbled(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 static lv_event_t * event_head;
+static lv_event_stat_t event_stat;
 
 /**********************
  *      MACROS
@@ -85,14 +87,19 @@ lv_res_t lv_obj_event_base(const lv_obj_class_t * class_p, lv_event_t * e)
     if(class_p == NULL) base = e->current_target->class_p;
     else base = class_p->base_class;
 
-    /*Find a base in which call the ancestor's event handler_cb if set*/
-    while(base && base->event_cb == NULL) base = base->base_class;
+    /*Find a base in which call the ancestor's event handler_cb if set and handles this event*/
+    uint64_t code_mask = LV_EVENT_MASK(e->code);
+    while(base && (base->event_cb == NULL || (base->event_mask && (base->event_mask & code_mask) == 0))) {
+        if(base->event_cb) event_stat.skipped++;
+        base = base->base_class;
+    }
 
     if(base == NULL) return LV_RES_OK;
     if(base->event_cb == NULL) return LV_RES_OK;
 
     /*Call the actual event callback*/
     e->user_data = NULL;
+    event_stat.delivered++;
     base->event_cb(base, e);
 
     lv_res_t res = LV_RES_OK;
@@ -137,6 +144,17 @@ void lv_event_stop_processing(lv_event_t * e)
     e->stop_processing = 1;
 }
 
+void lv_event_get_stat(lv_event_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+    *stat = event_stat;
+}
+
+void lv_event_reset_stat(void)
+{
+    lv_memset_00(&event_stat, sizeof(event_stat));
+}
+
 uint32_t lv_event_register_id(void)
 {
     static uint32_t last_id = _LV_EVENT_LAST;
@@ -168,6 +186,7 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    update_event_mask(obj);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -188,6 +207,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -213,6 +233,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -237,6 +258,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -417,6 +439,20 @@ static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id)
     return &obj->spec_attr->event_dsc[id];
 }
 
+/**
+ * Collect the event codes of the object's event callbacks to skip them quickly for the other events
+ */
+static void update_event_mask(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        mask |= filter == LV_EVENT_ALL ? LV_EVENT_MASK_ALL : LV_EVENT_MASK(filter);
+    }
+    obj->spec_attr->event_mask = mask;
+}
+
 static lv_res_t event_send_core(lv_event_t * e)
 {
     EVENT_TRACE("Sending event %d to %p with %p param", e->code, (void *)e->current_target, e->param);
@@ -429,8 +465,18 @@ static lv_res_t event_send_core(lv_event_t * e)
         if(e->deleted) return LV_RES_INV;
     }
 
+    event_stat.dispatched++;
+
+    /*Walk the event callbacks only if some of them are interested in this event*/
+    uint64_t code_mask = LV_EVENT_MASK(e->code);
+    lv_obj_t * obj = e->current_target;
+    if(obj->spec_attr && (obj->spec_attr->event_mask & code_mask) == 0) {
+        event_stat.skipped += obj->spec_attr->event_dsc_cnt;
+    }
+
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    lv_event_dsc_t * event_dsc = NULL;
+    if(obj->spec_attr && (obj->spec_attr->event_mask & code_mask)) event_dsc = lv_obj_get_event_dsc(obj, 0);
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -438,6 +484,7 @@ static lv_res_t event_send_core(lv_event_t * e)
            && (event_dsc->filter == (LV_EVENT_ALL | LV_EVENT_PREPROCESS) ||
                (event_dsc->filter & ~LV_EVENT_PREPROCESS) == e->code)) {
             e->user_data = event_dsc->user_data;
+            event_stat.delivered++;
             event_dsc->cb(e);
 
             if(e->stop_processing) return LV_RES_OK;
@@ -451,13 +498,18 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    /*The class might have added an event callback*/
+    event_dsc = NULL;
+    if(res == LV_RES_OK && obj->spec_attr && (obj->spec_attr->event_mask & code_mask)) {
+        event_dsc = lv_obj_get_event_dsc(obj, 0);
+    }
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
         if(event_dsc->cb && ((event_dsc->filter & LV_EVENT_PREPROCESS) == 0)
            && (event_dsc->filter == LV_EVENT_ALL || event_dsc->filter == e->code)) {
             e->user_data = event_dsc->user_data;
+            event_stat.delivered++;
             event_dsc->cb(e);
 
             if(e->stop_processing) return LV_RES_OK;
@@ -13,12 +13,20 @@ extern "C" {
 /*********************
  *      INCLUDES
  *********************/
+#include <stdint.h>
 #include <stdbool.h>
 
 /*********************
  *      DEFINES
  *********************/
 
+/**
+ * The bit of an event code in the event masks (e.g. `lv_obj_class_t::event_mask`).
+ * The codes from 63 (registered with ::lv_event_register_id) share the last bit.
+ */
+#define LV_EVENT_MASK(code)     ((uint64_t)1 << ((uint32_t)(code) < 63 ? (uint32_t)(code) : 63))
+#define LV_EVENT_MASK_ALL       (~(uint64_t)0)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -102,6 +110,12 @@ typedef struct _lv_event_t {
     uint8_t stop_bubbling : 1;
 } lv_event_t;
 
+typedef struct {
+    uint32_t dispatched;    /**< Objects reached by the sent events, including the parents they bubbled to*/
+    uint32_t delivered;     /**< Event callbacks and class event handlers called*/
+    uint32_t skipped;       /**< Event callbacks and class event handlers not called as their event mask excludes the event*/
+} lv_event_stat_t;
+
 /**
  * @brief Event callback.
  * Events are used to notify the user of some action being taken on the object.
@@ -202,6 +216,17 @@ void lv_event_stop_bubbling(lv_event_t * e);
  */
 void lv_event_stop_processing(lv_event_t * e);
 
+/**
+ * Get the number of dispatched events and called event handlers.
+ * @param stat      store the result here
+ */
+void lv_event_get_stat(lv_event_stat_t * stat);
+
+/**
+ * Zero the event counters.
+ */
+void lv_event_reset_stat(void);
+
 /**
  * Register a new, custom event ID.
  * It can be used the same way as e.g. `LV_EVENT_CLICKED` to send custom events
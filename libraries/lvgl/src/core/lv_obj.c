@@ -21,6 +21,7 @@
 #include "../misc/lv_gc.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_log.h"
+#include "../misc/lv_profiler.h"
 #include "../hal/lv_hal.h"
 #include "../extra/lv_extra.h"
 #include <stdint.h>
@@ -64,6 +65,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
+static void mark_children_dirty(lv_obj_t * obj);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
 
 /**********************
@@ -71,6 +73,7 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
  **********************/
 static bool lv_initialized = false;
 const lv_obj_class_t lv_obj_class = {
+    .name = "obj",
     .constructor_cb = lv_obj_constructor,
     .destructor_cb = lv_obj_destructor,
     .event_cb = lv_obj_event,
@@ -110,6 +113,10 @@ void lv_init(void)
 
     _lv_timer_core_init();
 
+#if LV_USE_PROFILER
+    _lv_profiler_init();
+#endif
+
     _lv_fs_init();
 
     _lv_anim_core_init();
@@ -196,9 +203,15 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_cleanup();
+#endif
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
+#if LV_USE_PROFILER
+    _lv_profiler_deinit();
+#endif
     lv_mem_deinit();
     lv_initialized = false;
 
@@ -478,6 +491,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         lv_mem_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
+
+    _lv_obj_style_cache_free(obj);
 }
 
 static void lv_obj_draw(lv_event_t * e)
@@ -746,11 +761,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_obj_clear_state(obj, LV_STATE_PRESSED);
     }
     else if(code == LV_EVENT_STYLE_CHANGED) {
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-        for(uint32_t i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
-        }
+        mark_children_dirty(obj);
     }
     else if(code == LV_EVENT_KEY) {
         if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CHECKABLE)) {
@@ -845,18 +856,20 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
             lv_obj_mark_layout_as_dirty(obj);
         }
 
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
-        }
+        mark_children_dirty(obj);
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
         lv_coord_t w = lv_obj_get_style_width(obj, LV_PART_MAIN);
         lv_coord_t h = lv_obj_get_style_height(obj, LV_PART_MAIN);
         lv_coord_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
+
+        /*The layout arranges only the layout positioned children. (The child can be also moved to an other parent.)*/
+        if(layout) {
+            lv_obj_t * child = lv_event_get_param(e);
+            if(child && child->parent == obj && !lv_obj_is_layout_positioned(child)) layout = 0;
+        }
+
         if(layout || align || w == LV_SIZE_CONTENT || h == LV_SIZE_CONTENT) {
             lv_obj_mark_layout_as_dirty(obj);
         }
@@ -953,6 +966,32 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     }
 }
 
+/**
+ * Mark the children to be updated after the size or content area of their parent has changed.
+ * Children with percentage size are measured again, the others are only aligned to the new area:
+ * their size and the layout of their children remain the same.
+ * @param obj       pointer to the parent object
+ */
+static void mark_children_dirty(lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(LV_COORD_IS_PCT(lv_obj_get_style_width(child, LV_PART_MAIN)) ||
+           LV_COORD_IS_PCT(lv_obj_get_style_height(child, LV_PART_MAIN)) ||
+           LV_COORD_IS_PCT(lv_obj_get_style_min_width(child, LV_PART_MAIN)) ||
+           LV_COORD_IS_PCT(lv_obj_get_style_max_width(child, LV_PART_MAIN)) ||
+           LV_COORD_IS_PCT(lv_obj_get_style_min_height(child, LV_PART_MAIN)) ||
+           LV_COORD_IS_PCT(lv_obj_get_style_max_height(child, LV_PART_MAIN))) {
+            lv_obj_mark_layout_as_dirty(child);
+        }
+        else {
+            lv_obj_mark_pos_as_dirty(child);
+        }
+    }
+}
+
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find)
 {
     /*Check all children of `parent`*/
@@ -157,6 +157,7 @@ typedef struct {
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint64_t event_mask;                /**< Event codes of the callbacks in `event_dsc` (see ::LV_EVENT_MASK)*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -175,6 +176,9 @@ typedef struct _lv_obj_t {
     struct _lv_obj_t * parent;
     _lv_obj_spec_attr_t * spec_attr;
     _lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    struct _lv_obj_style_cache_t * style_cache;
+#endif
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
@@ -182,6 +186,8 @@ typedef struct _lv_obj_t {
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv : 1;
+    uint16_t pos_inv : 1;               /*Only the position needs to be refreshed*/
+    uint16_t layout_child_inv : 1;      /*A descendant needs layout or scroll update*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -168,6 +168,16 @@ bool lv_obj_is_group_def(lv_obj_t * obj)
     return class_p->group_def == LV_OBJ_CLASS_GROUP_DEF_TRUE ? true : false;
 }
 
+const char * lv_obj_get_class_name(const lv_obj_t * obj)
+{
+    const lv_obj_class_t * class_p = obj->class_p;
+
+    /*Find a base which has a name*/
+    while(class_p && class_p->name == NULL) class_p = class_p->base_class;
+
+    return class_p ? class_p->name : "unknown";
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
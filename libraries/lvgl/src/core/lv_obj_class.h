@@ -54,11 +54,14 @@ typedef struct _lv_obj_class_t {
 #endif
     void (*event_cb)(const struct _lv_obj_class_t * class_p,
                      struct _lv_event_t * e);  /**< Widget type specific event function*/
+    uint64_t event_mask;               /**< Event codes handled by `event_cb` (see ::LV_EVENT_MASK), the others are passed
+                                            to the base class directly. 0: all the codes*/
     lv_coord_t width_def;
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
     uint32_t instance_size : 16;
+    const char * name;                 /**< Name of the widget type, e.g. in the profiler's traces. NULL: use the base's*/
 } lv_obj_class_t;
 
 /**********************
@@ -81,6 +84,13 @@ bool lv_obj_is_editable(struct _lv_obj_t * obj);
 
 bool lv_obj_is_group_def(struct _lv_obj_t * obj);
 
+/**
+ * Get the name of an object's type
+ * @param obj       pointer to an object
+ * @return          the name of the nearest class which has a name, or "unknown"
+ */
+const char * lv_obj_get_class_name(const struct _lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -26,12 +26,15 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_dirty_path(lv_obj_t * obj);
+static void mark_ancestors(lv_obj_t * obj);
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+static lv_obj_layout_stat_t layout_stat;
 
 /**********************
  *      MACROS
@@ -200,7 +203,9 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
 
+    /*Done at the end of this object's layout update or on the next update of the screen*/
     obj->readjust_scroll_after_layout = 1;
+    mark_ancestors(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -288,14 +293,16 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_dirty_path(obj);
+}
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
+void lv_obj_mark_pos_as_dirty(lv_obj_t * obj)
+{
+    /*A full update is already pending*/
+    if(obj->layout_inv) return;
 
-    /*Make the display refreshing*/
-    lv_disp_t * disp = lv_obj_get_disp(scr);
-    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+    obj->pos_inv = 1;
+    mark_dirty_path(obj);
 }
 
 void lv_obj_update_layout(const lv_obj_t * obj)
@@ -310,16 +317,32 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     lv_obj_t * scr = lv_obj_get_screen(obj);
 
     /*Repeat until there where layout invalidations*/
-    while(scr->scr_layout_inv) {
-        LV_LOG_INFO("Layout update begin");
-        scr->scr_layout_inv = 0;
-        layout_update_core(scr);
-        LV_LOG_TRACE("Layout update end");
+    if(scr->scr_layout_inv) {
+        uint32_t t_start = lv_tick_get();
+        while(scr->scr_layout_inv) {
+            LV_LOG_INFO("Layout update begin");
+            scr->scr_layout_inv = 0;
+            layout_stat.pass_cnt++;
+            layout_update_core(scr);
+            LV_LOG_TRACE("Layout update end");
+        }
+        layout_stat.time += lv_tick_elaps(t_start);
     }
 
     mutex = false;
 }
 
+void lv_obj_layout_get_stat(lv_obj_layout_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+    *stat = layout_stat;
+}
+
+void lv_obj_layout_reset_stat(void)
+{
+    lv_memset_00(&layout_stat, sizeof(layout_stat));
+}
+
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
 {
     layout_cnt++;
@@ -1121,28 +1144,76 @@ static lv_coord_t calc_content_height(lv_obj_t * obj)
 
 }
 
+/**
+ * Mark the ancestors of an object as having a dirty descendant.
+ * The walk stops at the first marked ancestor as its ancestors are already marked too.
+ * @param obj       pointer to an object which needs layout, position or scroll update
+ */
+static void mark_ancestors(lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    while(parent && !parent->layout_child_inv) {
+        parent->layout_child_inv = 1;
+        parent = parent->parent;
+    }
+}
+
+/**
+ * Mark the path to a dirty object and its screen to be updated.
+ * @param obj       pointer to an object which needs layout or position update
+ */
+static void mark_dirty_path(lv_obj_t * obj)
+{
+    mark_ancestors(obj);
+
+    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    scr->scr_layout_inv = 1;
+
+    /*Make the display refreshing*/
+    lv_disp_t * disp = lv_obj_get_disp(scr);
+    if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+}
+
 static void layout_update_core(lv_obj_t * obj)
 {
-    uint32_t i;
-    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    layout_stat.visit_cnt++;
+
+    /*Go only into the children which are dirty or have dirty descendants.
+     *Clear the flag before it as the children's layout can mark other objects again.*/
+    if(obj->layout_child_inv) {
+        obj->layout_child_inv = 0;
+        uint32_t i;
+        for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->pos_inv || child->layout_child_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child);
+            }
+        }
     }
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
+        obj->pos_inv = 0;
+        layout_stat.refr_cnt++;
         lv_obj_refr_size(obj);
         lv_obj_refr_pos(obj);
 
-        if(child_cnt > 0) {
+        if(lv_obj_get_child_cnt(obj) > 0) {
             uint32_t layout_id = lv_obj_get_style_layout(obj, LV_PART_MAIN);
             if(layout_id > 0 && layout_id <= layout_cnt) {
                 void  * user_data = LV_GC_ROOT(_lv_layout_list)[layout_id - 1].user_data;
+                layout_stat.layout_cnt++;
                 LV_GC_ROOT(_lv_layout_list)[layout_id - 1].cb(obj, user_data);
             }
         }
     }
+    else if(obj->pos_inv) {
+        /*Only the position has changed: the size and the children's layout are the same*/
+        obj->pos_inv = 0;
+        layout_stat.pos_refr_cnt++;
+        lv_obj_refr_pos(obj);
+    }
 
     if(obj->readjust_scroll_after_layout) {
         obj->readjust_scroll_after_layout = 0;
@@ -30,6 +30,15 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+typedef struct {
+    uint32_t pass_cnt;      /**< Walks of a screen's dirty objects (`lv_obj_update_layout` repeats until nothing is dirty)*/
+    uint32_t visit_cnt;     /**< Objects visited by the walks*/
+    uint32_t refr_cnt;      /**< Objects whose size and position were recalculated*/
+    uint32_t pos_refr_cnt;  /**< Objects whose position only was recalculated*/
+    uint32_t layout_cnt;    /**< Calls of layout callbacks (flex, grid, ...)*/
+    uint32_t time;          /**< Time spent with the walks [ms]*/
+} lv_obj_layout_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -146,12 +155,31 @@ bool lv_obj_is_layout_positioned(const struct _lv_obj_t * obj);
  */
 void lv_obj_mark_layout_as_dirty(struct _lv_obj_t * obj);
 
+/**
+ * Mark only the position of the object for update.
+ * Its size and the layout of its children are not recalculated.
+ * @param obj      pointer to an object whose position needs to be updated
+ */
+void lv_obj_mark_pos_as_dirty(struct _lv_obj_t * obj);
+
 /**
  * Update the layout of an object.
  * @param obj      pointer to an object whose children needs to be updated
  */
 void lv_obj_update_layout(const struct _lv_obj_t * obj);
 
+/**
+ * Get the counters of the layout updates since the last `lv_obj_layout_reset_stat()`.
+ * Reading and resetting them in the display driver's `monitor_cb` gives the values of each frame.
+ * @param stat     store the result here
+ */
+void lv_obj_layout_get_stat(lv_obj_layout_stat_t * stat);
+
+/**
+ * Zero the counters of the layout updates.
+ */
+void lv_obj_layout_reset_stat(void);
+
 /**
  * Register a new layout
  * @param cb        the layout update callback
@@ -15,6 +15,9 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*Max. number of part and state combinations cached per object*/
+#define STYLE_CACHE_MAX_CNT     8
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +38,25 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+typedef struct {
+    lv_style_value_t value;
+    lv_style_prop_t prop;       /*`LV_STYLE_PROP_INV`: unused entry*/
+    uint8_t res;                /*`lv_style_res_t` of the property*/
+} style_cache_entry_t;
+
+/*The resolved properties of a part of an object in a state.
+ *The caches of an object are in a linked list, the most recently used first.*/
+typedef struct _lv_obj_style_cache_t {
+    struct _lv_obj_style_cache_t * next;
+    lv_part_t part;
+    uint32_t change_cnt;        /*`_lv_style_get_change_cnt()` when the entries were valid. 0: invalid*/
+    lv_state_t state;
+    uint8_t skip_trans;
+    style_cache_entry_t entries[LV_OBJ_STYLE_CACHE_SIZE];
+} style_cache_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -45,6 +67,12 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+#if LV_OBJ_STYLE_CACHE_SIZE
+    static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop,
+                                          lv_style_value_t * v);
+    static style_cache_t * get_style_cache(lv_obj_t * obj, lv_part_t part);
+#endif
+static void style_cache_invalidate(lv_obj_t * obj);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -59,6 +87,11 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+#if LV_OBJ_STYLE_CACHE_SIZE
+    static bool style_cache_en = true;
+    static uint32_t style_cache_hit_cnt;
+    static uint32_t style_cache_miss_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -99,6 +132,7 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
+    style_cache_invalidate(obj);
 
     lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
 }
@@ -142,6 +176,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         obj->styles = lv_mem_realloc(obj->styles, obj->style_cnt * sizeof(_lv_obj_style_t));
 
         deleted = true;
+        style_cache_invalidate(obj);
         /*The style from the current `i` index is removed, so `i` points to the next style.
          *Therefore it doesn't needs to be incremented*/
     }
@@ -179,18 +214,38 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
 
+    /*Position only properties don't change the size of the object and the layout of its children*/
+    bool is_pos_refr = (part == LV_PART_ANY || part == LV_PART_MAIN) &&
+                       (prop == LV_STYLE_X || prop == LV_STYLE_Y || prop == LV_STYLE_ALIGN ||
+                        prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y);
+
     if(is_layout_refr) {
         if(part == LV_PART_ANY ||
            part == LV_PART_MAIN ||
            lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
            lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
+            /*Moving doesn't change the content area so the children (which get LV_EVENT_STYLE_CHANGED)
+             *and the widget's own look need no update*/
+            if(is_pos_refr) {
+                lv_obj_mark_pos_as_dirty(obj);
+            }
+            else {
+                lv_event_send(obj, LV_EVENT_STYLE_CHANGED, NULL);
+                lv_obj_mark_layout_as_dirty(obj);
+            }
         }
     }
     if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
+        /*If the object moves the parent gets LV_EVENT_CHILD_CHANGED anyway.
+         *Only the translation of a layout positioned object needs the parent's layout: the layout applies it.*/
+        bool parent_refr = true;
+        if(is_pos_refr) {
+            parent_refr = (prop == LV_STYLE_TRANSLATE_X || prop == LV_STYLE_TRANSLATE_Y) &&
+                          lv_obj_is_layout_positioned(obj);
+        }
+
         lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
+        if(parent && parent_refr) lv_obj_mark_layout_as_dirty(parent);
     }
 
     /*Cache the layer type*/
@@ -220,13 +275,61 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+void lv_obj_enable_style_cache(bool en)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_en = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+#if LV_OBJ_STYLE_CACHE_SIZE
+    stat->hit = style_cache_hit_cnt;
+    stat->miss = style_cache_miss_cnt;
+#else
+    stat->hit = 0;
+    stat->miss = 0;
+#endif
+}
+
+void lv_obj_style_cache_reset_stat(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_hit_cnt = 0;
+    style_cache_miss_cnt = 0;
+#endif
+}
+
+void _lv_obj_style_cache_free(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_t * cache = obj->style_cache;
+    while(cache) {
+        style_cache_t * next = cache->next;
+        lv_mem_free(cache);
+        cache = next;
+    }
+    obj->style_cache = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     lv_style_value_t value_act;
     bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
     lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
     while(obj) {
+#if LV_OBJ_STYLE_CACHE_SIZE
+        found = get_prop_cached(obj, part, prop, &value_act);
+#else
         found = get_prop_core(obj, part, prop, &value_act);
+#endif
         if(found == LV_STYLE_RES_FOUND) break;
         if(!inheritable) break;
 
@@ -665,6 +768,105 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Get a property from the cache of the object's part or search it with `get_prop_core()` and cache it.
+ * The result is the same as the result of `get_prop_core()`.
+ */
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
+{
+    /*The cache belongs to the object but it's not a visible change of the object*/
+    style_cache_t * cache = style_cache_en ? get_style_cache((lv_obj_t *)obj, part) : NULL;
+    if(cache == NULL) return get_prop_core(obj, part, prop, v);
+
+    style_cache_entry_t * e = &cache->entries[prop & (LV_OBJ_STYLE_CACHE_SIZE - 1)];
+    if(e->prop == prop) {
+        style_cache_hit_cnt++;
+        if(e->res == LV_STYLE_RES_FOUND) *v = e->value;
+        return e->res;
+    }
+
+    style_cache_miss_cnt++;
+    lv_style_res_t res = get_prop_core(obj, part, prop, v);
+    e->prop = prop;
+    e->res = res;
+    if(res == LV_STYLE_RES_FOUND) e->value = *v;
+    return res;
+}
+
+/**
+ * Get the cache of a part of an object in its current state. Create it if it doesn't exist yet, and empty it
+ * if any style has changed since it was filled.
+ * Widgets like the button matrix draw their items by changing the state temporarily,
+ * so more states of the same part can be cached.
+ * @return the cache or NULL if it can't be allocated
+ */
+static style_cache_t * get_style_cache(lv_obj_t * obj, lv_part_t part)
+{
+    style_cache_t * cache = obj->style_cache;
+    style_cache_t * prev = NULL;
+    style_cache_t * prev_prev = NULL;
+    uint32_t cnt = 0;
+    while(cache) {
+        if(cache->part == part && cache->state == obj->state && cache->skip_trans == obj->skip_trans) break;
+        prev_prev = prev;
+        prev = cache;
+        cache = cache->next;
+        cnt++;
+    }
+
+    if(cache) {
+        /*Move to the front*/
+        if(prev) {
+            prev->next = cache->next;
+            cache->next = obj->style_cache;
+            obj->style_cache = cache;
+        }
+    }
+    else {
+        if(cnt >= STYLE_CACHE_MAX_CNT) {
+            /*Reuse the least recently used one*/
+            cache = prev;
+            prev_prev->next = NULL;
+        }
+        else {
+            cache = lv_mem_alloc(sizeof(style_cache_t));
+            if(cache == NULL) return NULL;
+        }
+        cache->part = part;
+        cache->state = obj->state;
+        cache->skip_trans = obj->skip_trans;
+        cache->change_cnt = 0;
+        cache->next = obj->style_cache;
+        obj->style_cache = cache;
+    }
+
+    uint32_t change_cnt = _lv_style_get_change_cnt();
+    if(cache->change_cnt != change_cnt) {
+        lv_memset_00(cache->entries, sizeof(cache->entries));
+        cache->change_cnt = change_cnt;
+    }
+
+    return cache;
+}
+#endif
+
+/**
+ * Drop the cached properties of an object, e.g. because a style was added or removed
+ */
+static void style_cache_invalidate(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_t * cache;
+    for(cache = obj->style_cache; cache; cache = cache->next) {
+        cache->change_cnt = 0;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
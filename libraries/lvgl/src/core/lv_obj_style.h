@@ -54,6 +54,11 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+typedef struct {
+    uint32_t hit;           /**< Properties read from the cache*/
+    uint32_t miss;          /**< Properties searched in the styles of the object*/
+} lv_obj_style_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +123,31 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Enable or disable the caching of the resolved style properties.
+ * Has effect only if `LV_OBJ_STYLE_CACHE_SIZE > 0`. Enabled by default.
+ * @param en        true: use the cache; false: always search the styles of the object
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Get the hit and miss counters of the style property cache.
+ * @param stat      store the result here
+ */
+void lv_obj_style_cache_get_stat(lv_obj_style_cache_stat_t * stat);
+
+/**
+ * Zero the hit and miss counters of the style property cache.
+ */
+void lv_obj_style_cache_reset_stat(void);
+
+/**
+ * Free the cached style properties of an object.
+ * Called by LVGL when the object is deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_free(struct _lv_obj_t * obj);
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -15,6 +15,7 @@
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_profiler.h"
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
@@ -52,6 +53,8 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void lv_refr_join_area_by_cost(void);
+static uint32_t get_refr_cost(const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -244,6 +247,21 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
         if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
+    /*Consecutive invalidations usually come from the same object, e.g. the old and new position of an animated object.
+     *Join the area into the last saved one if it's smaller than the two areas separately*/
+    if(disp->inv_p > 0) {
+        lv_area_t * last_area = &disp->inv_areas[disp->inv_p - 1];
+        if(_lv_area_is_on(last_area, &com_area)) {
+            lv_area_t joined_area;
+            _lv_area_join(&joined_area, last_area, &com_area);
+            if(lv_area_get_size(&joined_area) < lv_area_get_size(last_area) + lv_area_get_size(&com_area)) {
+                lv_area_copy(last_area, &joined_area);
+                if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
+                return;
+            }
+        }
+    }
+
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
@@ -283,6 +301,7 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
 void _lv_disp_refr_timer(lv_timer_t * tmr)
 {
     REFR_TRACE("begin");
+    LV_PROFILER_BEGIN;
 
     uint32_t start = lv_tick_get();
     volatile uint32_t elaps = 0;
@@ -302,17 +321,20 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 
     /*Refresh the screen's layout if required*/
+    LV_PROFILER_BEGIN_TAG("layout");
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
 
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+    LV_PROFILER_END_TAG("layout");
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
+        LV_PROFILER_END;
         return;
     }
 
@@ -352,10 +374,6 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     lv_mem_buf_free_all();
     _lv_font_clean_up_fmt_txt();
 
-#if LV_DRAW_COMPLEX
-    _lv_draw_mask_cleanup();
-#endif
-
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
     lv_obj_t * perf_label = perf_monitor.perf_label;
     if(perf_label == NULL) {
@@ -445,6 +463,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 #endif
 
     REFR_TRACE("finished");
+    LV_PROFILER_END;
 }
 
 #if LV_USE_PERF_MONITOR
@@ -472,6 +491,11 @@ uint32_t lv_refr_get_fps_avg(void)
  */
 static void lv_refr_join_area(void)
 {
+    if(disp_refr->driver->flush_cost) {
+        lv_refr_join_area_by_cost();
+        return;
+    }
+
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
@@ -504,6 +528,70 @@ static void lv_refr_join_area(void)
     }
 }
 
+/**
+ * Join the areas greedily, always the pair which saves the most refresh time, until no join makes it faster.
+ * The areas are already rounded and it's assumed that a bounding box of rounded areas doesn't need rounding.
+ */
+static void lv_refr_join_area_by_cost(void)
+{
+    uint32_t cost[LV_INV_BUF_SIZE];
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i] == 0) cost[i] = get_refr_cost(&disp_refr->inv_areas[i]);
+    }
+
+    while(1) {
+        uint32_t best_gain = 0;
+        uint32_t best_cost = 0;
+        uint32_t join_in = 0;
+        uint32_t join_from = 0;
+        lv_area_t best_area;
+        lv_area_t joined_area;
+        for(i = 0; i < disp_refr->inv_p; i++) {
+            if(disp_refr->inv_area_joined[i] != 0) continue;
+            for(j = i + 1; j < disp_refr->inv_p; j++) {
+                if(disp_refr->inv_area_joined[j] != 0) continue;
+
+                _lv_area_join(&joined_area, &disp_refr->inv_areas[i], &disp_refr->inv_areas[j]);
+                uint32_t joined_cost = get_refr_cost(&joined_area);
+                if(cost[i] + cost[j] > joined_cost + best_gain) {
+                    best_gain = cost[i] + cost[j] - joined_cost;
+                    best_cost = joined_cost;
+                    join_in = i;
+                    join_from = j;
+                    lv_area_copy(&best_area, &joined_area);
+                }
+            }
+        }
+
+        if(best_gain == 0) break;
+
+        lv_area_copy(&disp_refr->inv_areas[join_in], &best_area);
+        cost[join_in] = best_cost;
+        disp_refr->inv_area_joined[join_from] = 1;
+    }
+}
+
+/**
+ * Estimate the time of refreshing an area in pixel times.
+ * The area is drawn and flushed in as many parts as the draw buffer requires and each flush has a fixed cost.
+ */
+static uint32_t get_refr_cost(const lv_area_t * area)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t part_cnt = 1;
+    if(!drv->direct_mode) {
+        uint32_t max_row = drv->draw_buf->size / w;
+        if(max_row == 0) max_row = 1;
+        part_cnt = (h + max_row - 1) / max_row;
+    }
+
+    return part_cnt * drv->flush_cost + w * h;
+}
+
 /**
  * Refresh the sync areas
  */
@@ -585,6 +673,8 @@ static void refr_invalid_areas(void)
 
     if(disp_refr->inv_p == 0) return;
 
+    LV_PROFILER_BEGIN;
+
     /*Find the last area which will be drawn*/
     int32_t i;
     int32_t last_i = 0;
@@ -617,6 +707,8 @@ static void refr_invalid_areas(void)
     }
 
     disp_refr->rendering_in_progress = false;
+
+    LV_PROFILER_END;
 }
 
 /**
@@ -703,9 +795,11 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     bool full_sized = draw_buf->size == (uint32_t)disp_refr->driver->hor_res * disp_refr->driver->ver_res;
     if((draw_buf->buf1 && !draw_buf->buf2) ||
        (draw_buf->buf1 && draw_buf->buf2 && full_sized)) {
+        LV_PROFILER_BEGIN_TAG("wait_for_flush");
         while(draw_buf->flushing) {
             if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
         }
+        LV_PROFILER_END_TAG("wait_for_flush");
 
         /*If the screen is transparent initialize it when the flushing is ready*/
 #if LV_COLOR_SCREEN_TRANSP
@@ -962,17 +1056,30 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+#if LV_USE_PROFILER
+    /*Show the time spent with the widget and its children by the widget's type*/
+    const char * class_name = lv_obj_get_class_name(obj);
+#endif
+    LV_PROFILER_BEGIN_TAG(class_name);
+
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(draw_ctx, obj);
     }
     else {
         lv_opa_t opa = lv_obj_get_style_opa_layered(obj, 0);
-        if(opa < LV_OPA_MIN) return;
+        if(opa < LV_OPA_MIN) {
+            LV_PROFILER_END_TAG(class_name);
+            return;
+        }
 
         lv_area_t layer_area_full;
         lv_res_t res = layer_get_area(draw_ctx, obj, layer_type, &layer_area_full);
-        if(res != LV_RES_OK) return;
+        if(res != LV_RES_OK) {
+            LV_PROFILER_END_TAG(class_name);
+            return;
+        }
 
         lv_draw_layer_flags_t flags = LV_DRAW_LAYER_FLAG_HAS_ALPHA;
 
@@ -989,6 +1096,7 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         lv_draw_layer_ctx_t * layer_ctx = lv_draw_layer_create(draw_ctx, &layer_area_full, flags);
         if(layer_ctx == NULL) {
             LV_LOG_WARN("Couldn't create a new layer context");
+            LV_PROFILER_END_TAG(class_name);
             return;
         }
         lv_point_t pivot = {
@@ -1041,6 +1149,8 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
         lv_draw_layer_destroy(draw_ctx, layer_ctx);
     }
+
+    LV_PROFILER_END_TAG(class_name);
 }
 
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
@@ -1267,15 +1377,21 @@ static void draw_buf_flush(lv_disp_t * disp)
 
     /*Flush the rendered content to the display*/
     lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
-    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+    if(draw_ctx->wait_for_finish) {
+        LV_PROFILER_BEGIN_TAG("wait_for_finish");
+        draw_ctx->wait_for_finish(draw_ctx);
+        LV_PROFILER_END_TAG("wait_for_finish");
+    }
 
     /* In partial double buffered mode wait until the other buffer is freed
      * and driver is ready to receive the new buffer */
     bool full_sized = draw_buf->size == (uint32_t)disp_refr->driver->hor_res * disp_refr->driver->ver_res;
-    if(draw_buf->buf1 && draw_buf->buf2 && !full_sized) {
+    if(draw_buf->buf1 && draw_buf->buf2 && !full_sized && draw_buf->flushing) {
+        LV_PROFILER_BEGIN_TAG("wait_for_flush");
         while(draw_buf->flushing) {
             if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
         }
+        LV_PROFILER_END_TAG("wait_for_flush");
     }
 
     draw_buf->flushing = 1;
@@ -1316,7 +1432,10 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
         .y2 = area->y2 + drv->offset_y
     };
 
+    LV_PROFILER_BEGIN_TRACK("flush", LV_PROFILER_TRACK_FLUSH);
+    LV_PROFILER_BEGIN_TAG("flush_cb");
     drv->flush_cb(drv, &offset_area, color_p);
+    LV_PROFILER_END_TAG("flush_cb");
 }
 
 #if LV_USE_PERF_MONITOR
@@ -39,7 +39,8 @@
 
 void lv_draw_init(void)
 {
-    /*Nothing to init now*/
+    /*Select the blend kernels here, before any (helper thread) rendering can use them*/
+    lv_draw_sw_blend_rgb565_set_backend(NULL);
 }
 
 void lv_draw_wait_for_finish(lv_draw_ctx_t * draw_ctx)
@@ -329,10 +329,14 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
             read_res = lv_img_decoder_read_line(&cdsc->dec_dsc, x, y, width, buf);
             if(read_res != LV_RES_OK) {
-                lv_img_decoder_close(&cdsc->dec_dsc);
                 LV_LOG_WARN("Image draw can't read the line");
                 lv_mem_buf_release(buf);
+                /*Close the image only once, and don't leave a closed image in the cache*/
+#if LV_IMG_CACHE_DEF_SIZE
+                lv_img_cache_invalidate_src(src);
+#else
                 draw_cleanup(cdsc);
+#endif
                 draw_ctx->clip_area = clip_area_ori;
                 return LV_RES_INV;
             }
@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -35,6 +36,10 @@ typedef uint8_t cmd_state_t;
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static uint32_t get_line_end(const lv_txt_layout_t * layout, uint32_t line_id, const char * txt, uint32_t line_start,
+                             const lv_draw_label_dsc_t * dsc, lv_coord_t max_w);
+static lv_coord_t get_line_width(const lv_txt_layout_t * layout, uint32_t line_id, const char * txt,
+                                 uint32_t line_start, uint32_t line_end, const lv_draw_label_dsc_t * dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -106,10 +111,19 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     lv_bidi_calculate_align(&align, &base_dir, txt);
 
+    /*The already measured lines can be used only if they were measured for this width*/
+    const lv_txt_layout_t * layout = dsc->layout;
+    if(layout && !_lv_txt_layout_is_for(layout, font, dsc->letter_space, lv_area_get_width(coords), dsc->flag)) {
+        layout = NULL;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(layout) {
+        w = layout->width;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -134,8 +148,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_id        = 0;    /*Index of the line in `layout`*/
     int32_t last_line_start = -1;
 
+    /*The layout is faster than the hint*/
+    if(layout) hint = NULL;
+
     /*Check the hint to use the cached info*/
     if(hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
@@ -151,13 +169,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(layout, line_id, txt, line_start, dsc, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(layout, line_id, txt, line_start, dsc, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +191,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(layout, line_id, txt, line_start, line_end, dsc);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(layout, line_id, txt, line_start, line_end, dsc);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -225,6 +244,15 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         const char * bidi_txt = txt + line_start;
 #endif
 
+        const uint16_t * letter_w_saved = NULL;
+        if(layout) {
+            letter_w_saved = &layout->letter_w[layout->lines[line_id].letter_id];
+#if LV_USE_BIDI
+            /*The widths are saved in logical order so they can't be used if bidi has reordered the letters*/
+            if(memcmp(bidi_txt, txt + line_start, line_end - line_start) != 0) letter_w_saved = NULL;
+#endif
+        }
+
         while(i < line_end - line_start) {
             uint32_t logical_char_pos = 0;
             if(sel_start != 0xFFFF && sel_end != 0xFFFF) {
@@ -240,6 +268,11 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
             uint32_t letter;
             uint32_t letter_next;
             _lv_txt_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &i);
+
+            /*The recolor commands have saved width too, so step it for every letter*/
+            int32_t letter_w_cached = -1;
+            if(letter_w_saved) letter_w_cached = *letter_w_saved++;
+
             /*Handle the re-color command*/
             if((dsc->flag & LV_TEXT_FLAG_RECOLOR) != 0) {
                 if(letter == (uint32_t)LV_TXT_COLOR_CMD[0]) {
@@ -284,7 +317,8 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
             if(cmd_state == CMD_STATE_IN) color = recolor;
 
-            letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+            if(letter_w_cached >= 0) letter_w = letter_w_cached;
+            else letter_w = lv_font_get_glyph_width(font, letter, letter_next);
 
             if(sel_start != 0xFFFF && sel_end != 0xFFFF) {
                 if(logical_char_pos >= sel_start && logical_char_pos < sel_end) {
@@ -334,21 +368,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(layout, line_id, txt, line_start, dsc, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(layout, line_id, txt, line_start, line_end, dsc);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(layout, line_id, txt, line_start, line_end, dsc);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -371,6 +404,42 @@ void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the end of a line from the measured layout or by measuring the line.
+ * @param layout pointer to a layout matching the text or NULL
+ * @param line_id index of the line
+ * @param txt the text
+ * @param line_start byte index of the line's start
+ * @param dsc pointer to the draw descriptor
+ * @param max_w max width of the lines
+ * @return byte index of the next line's start
+ */
+static uint32_t get_line_end(const lv_txt_layout_t * layout, uint32_t line_id, const char * txt, uint32_t line_start,
+                             const lv_draw_label_dsc_t * dsc, lv_coord_t max_w)
+{
+    if(layout) return layout->lines[LV_MIN(line_id + 1, layout->line_cnt)].start;
+
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_w, NULL, dsc->flag);
+}
+
+/**
+ * Get the width of a line from the measured layout or by measuring the line.
+ * @param layout pointer to a layout matching the text or NULL
+ * @param line_id index of the line
+ * @param txt the text
+ * @param line_start byte index of the line's start
+ * @param line_end byte index of the next line's start
+ * @param dsc pointer to the draw descriptor
+ * @return width of the line
+ */
+static lv_coord_t get_line_width(const lv_txt_layout_t * layout, uint32_t line_id, const char * txt,
+                                 uint32_t line_start, uint32_t line_end, const lv_draw_label_dsc_t * dsc)
+{
+    if(layout) return layout->lines[LV_MIN(line_id, layout->line_cnt)].width;
+
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -42,6 +42,7 @@ typedef struct {
     lv_base_dir_t bidi_dir;
     lv_text_align_t align;
     lv_text_flag_t flag;
+    const lv_txt_layout_t * layout; /*Measured lines of the text or NULL. Used only if it matches the other fields.*/
     lv_text_decor_t decor : 3;
     lv_blend_mode_t blend_mode: 3;
 } lv_draw_label_dsc_t;
@@ -19,6 +19,9 @@
 #define CIRCLE_CACHE_LIFE_MAX   1000
 #define CIRCLE_CACHE_AGING(life, r)   life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
 
+/*6 arrays of `radius + 1` elements: 4 opacity and 2 uint16_t arrays*/
+#define CIRCLE_BUF_SIZE(r)      ((r) * 12 + 12)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -59,10 +62,15 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
 static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+static inline void /* LV_ATTRIBUTE_FAST_MEM */ span_mix(lv_opa_t * mask_buf, lv_coord_t len, lv_coord_t x,
+                                                        const lv_opa_t * opa, lv_coord_t opa_len);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t circle_hit_cnt;
+static uint32_t circle_miss_cnt;
+static uint32_t circle_evict_cnt;
 
 /**********************
  *      MACROS
@@ -229,6 +237,31 @@ void lv_draw_mask_free_param(void * p)
     }
 }
 
+void lv_draw_mask_circle_cache_get_stat(lv_draw_mask_circle_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    lv_memset_00(stat, sizeof(lv_draw_mask_circle_cache_stat_t));
+    stat->hit = circle_hit_cnt;
+    stat->miss = circle_miss_cnt;
+    stat->evict = circle_evict_cnt;
+
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
+            stat->size += CIRCLE_BUF_SIZE(LV_GC_ROOT(_lv_circle_cache[i]).radius);
+            stat->entry_cnt++;
+        }
+    }
+}
+
+void lv_draw_mask_circle_cache_reset_stat(void)
+{
+    circle_hit_cnt = 0;
+    circle_miss_cnt = 0;
+    circle_evict_cnt = 0;
+}
+
 void _lv_draw_mask_cleanup(void)
 {
     uint8_t i;
@@ -499,6 +532,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+            circle_hit_cnt++;
             return;
         }
     }
@@ -512,6 +546,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         }
     }
 
+    circle_miss_cnt++;
     if(!entry) {
         entry = lv_mem_alloc(sizeof(_lv_draw_mask_radius_circle_dsc_t));
         LV_ASSERT_MALLOC(entry);
@@ -519,6 +554,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         entry->life = -1;
     }
     else {
+        if(entry->buf) circle_evict_cnt++;
         entry->used_cnt++;
         entry->life = 0;
         CIRCLE_CACHE_AGING(entry->life, radius);
@@ -529,6 +565,29 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     circ_calc_aa4(param->circle, radius);
 }
 
+bool lv_draw_mask_radius_get_cover(const lv_draw_mask_radius_param_t * param, lv_coord_t abs_y, lv_coord_t * x1,
+                                   lv_coord_t * x2)
+{
+    const lv_area_t * rect = &param->cfg.rect;
+    lv_coord_t radius = param->cfg.radius;
+    if(param->cfg.outer) return false;
+    if(abs_y < rect->y1 || abs_y > rect->y2) return false;
+
+    if(abs_y >= rect->y1 + radius && abs_y <= rect->y2 - radius) {
+        *x1 = rect->x1;
+        *x2 = rect->x2;
+        return true;
+    }
+
+    /*The AA pixels of the corners are around `x_start` from the inner edges of the corners*/
+    lv_coord_t y = abs_y - rect->y1;
+    lv_coord_t cir_y = y < radius ? radius - y - 1 : y - (lv_area_get_height(rect) - radius);
+    lv_coord_t x_start = param->circle->x_start_on_y[cir_y];
+    *x1 = rect->x1 + radius - x_start;
+    *x2 = rect->x2 - radius + x_start;
+    return *x1 <= *x2;
+}
+
 /**
  * Initialize a fade mask.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
@@ -1100,13 +1159,6 @@ static lv_draw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_radius(lv_opa_t * m
         }
         return LV_DRAW_MASK_RES_CHANGED;
     }
-    //    printf("exec: x:%d.. %d, y:%d: r:%d, %s\n", abs_x, abs_x + len - 1, abs_y, p->cfg.radius, p->cfg.outer ? "inv" : "norm");
-
-    //    if( abs_x == 276 && abs_x + len - 1 == 479 && abs_y == 63 && p->cfg.radius == 5 && p->cfg.outer == 1) {
-    //        char x = 0;
-    //    }
-    //exec: x:276.. 479, y:63: r:5, inv)
-
     int32_t k = rect.x1 - abs_x; /*First relevant coordinate on the of the mask*/
     int32_t w = lv_area_get_width(&rect);
     int32_t h = lv_area_get_height(&rect);
@@ -1122,42 +1174,33 @@ static lv_draw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_mask_radius(lv_opa_t * m
     else {
         cir_y = abs_y - (h - radius);
     }
-    lv_opa_t * aa_opa = get_next_line(p->circle, cir_y, &aa_len, &x_start);
+    _lv_draw_mask_radius_circle_dsc_t * c = p->circle;
+    get_next_line(c, cir_y, &aa_len, &x_start);
+    uint32_t opa_start = c->opa_start_on_y[cir_y];
+
+    /*The row of a corner is: a transparent span, the AA span of the left corner, a fully covered span,
+     *the AA span of the right corner and a transparent span. The AA spans are stored in the cached circle
+     *in drawing order so they are blended as a whole, only clipped once to the mask buffer.*/
     lv_coord_t cir_x_right = k + w - radius + x_start;
-    lv_coord_t cir_x_left = k + radius - x_start - 1;
-    lv_coord_t i;
+    lv_coord_t cir_x_left = k + radius - x_start - aa_len;
 
     if(outer == false) {
-        for(i = 0; i < aa_len; i++) {
-            lv_opa_t opa = aa_opa[aa_len - i - 1];
-            if(cir_x_right + i >= 0 && cir_x_right + i < len) {
-                mask_buf[cir_x_right + i] = mask_mix(opa, mask_buf[cir_x_right + i]);
-            }
-            if(cir_x_left - i >= 0 && cir_x_left - i < len) {
-                mask_buf[cir_x_left - i] = mask_mix(opa, mask_buf[cir_x_left - i]);
-            }
-        }
+        span_mix(mask_buf, len, cir_x_left, &c->cir_opa[opa_start], aa_len);
+        span_mix(mask_buf, len, cir_x_right, &c->cir_opa_rev[opa_start], aa_len);
 
         /*Clean the right side*/
-        cir_x_right = LV_CLAMP(0, cir_x_right + i, len);
+        cir_x_right = LV_CLAMP(0, cir_x_right + aa_len, len);
         lv_memset_00(&mask_buf[cir_x_right], len - cir_x_right);
 
         /*Clean the left side*/
-        cir_x_left = LV_CLAMP(0, cir_x_left - aa_len + 1, len);
+        cir_x_left = LV_CLAMP(0, cir_x_left, len);
         lv_memset_00(&mask_buf[0], cir_x_left);
     }
     else {
-        for(i = 0; i < aa_len; i++) {
-            lv_opa_t opa = 255 - (aa_opa[aa_len - 1 - i]);
-            if(cir_x_right + i >= 0 && cir_x_right + i < len) {
-                mask_buf[cir_x_right + i] = mask_mix(opa, mask_buf[cir_x_right + i]);
-            }
-            if(cir_x_left - i >= 0 && cir_x_left - i < len) {
-                mask_buf[cir_x_left - i] = mask_mix(opa, mask_buf[cir_x_left - i]);
-            }
-        }
+        span_mix(mask_buf, len, cir_x_left, &c->cir_opa_inv[opa_start], aa_len);
+        span_mix(mask_buf, len, cir_x_right, &c->cir_opa_inv_rev[opa_start], aa_len);
 
-        lv_coord_t clr_start = LV_CLAMP(0, cir_x_left + 1, len);
+        lv_coord_t clr_start = LV_CLAMP(0, cir_x_left + aa_len, len);
         lv_coord_t clr_len = LV_CLAMP(0, cir_x_right - clr_start, len - clr_start);
         lv_memset_00(&mask_buf[clr_start], clr_len);
     }
@@ -1367,15 +1410,21 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
     /*Allocate buffers*/
     if(c->buf) lv_mem_free(c->buf);
 
-    c->buf = lv_mem_alloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
+    c->buf = lv_mem_alloc(CIRCLE_BUF_SIZE(radius));  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
     LV_ASSERT_MALLOC(c->buf);
     c->cir_opa = c->buf;
     c->opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
     c->x_start_on_y = (uint16_t *)(c->buf + 4 * radius + 4);
+    c->cir_opa_rev = c->buf + 6 * radius + 6;
+    c->cir_opa_inv = c->buf + 8 * radius + 8;
+    c->cir_opa_inv_rev = c->buf + 10 * radius + 10;
 
     /*Special case, handle manually*/
     if(radius == 1) {
         c->cir_opa[0] = 180;
+        c->cir_opa_rev[0] = 180;
+        c->cir_opa_inv[0] = 255 - 180;
+        c->cir_opa_inv_rev[0] = 255 - 180;
         c->opa_start_on_y[0] = 0;
         c->opa_start_on_y[1] = 1;
         c->x_start_on_y[0] = 0;
@@ -1501,9 +1550,22 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
         for(; cir_y[i] == y && i < (int32_t)cir_size; i++) {
             c->x_start_on_y[y] = LV_MIN(c->x_start_on_y[y], cir_x[i]);
         }
+
+        /*Store the row in the order of the right corners too*/
+        int32_t row_start = c->opa_start_on_y[y];
+        int32_t j;
+        for(j = row_start; j < i; j++) {
+            c->cir_opa_rev[j] = c->cir_opa[row_start + i - 1 - j];
+        }
         y++;
     }
 
+    /*The inverted masks keep the outside of the circle*/
+    for(i = 0; i < cir_size; i++) {
+        c->cir_opa_inv[i] = 255 - c->cir_opa[i];
+        c->cir_opa_inv_rev[i] = 255 - c->cir_opa_rev[i];
+    }
+
     lv_mem_buf_release(cir_x);
 }
 
@@ -1523,4 +1585,29 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);// >> 8);
 }
 
+/**
+ * Blend a span of opacities on a mask buffer
+ * @param mask_buf the mask buffer of the line
+ * @param len length of `mask_buf`
+ * @param x position of the span in `mask_buf`. Can be negative or beyond `len`, the span is clipped.
+ * @param opa the opacities of the span
+ * @param opa_len number of opacities in the span
+ */
+static inline void LV_ATTRIBUTE_FAST_MEM span_mix(lv_opa_t * mask_buf, lv_coord_t len, lv_coord_t x,
+                                                  const lv_opa_t * opa, lv_coord_t opa_len)
+{
+    if(x < 0) {
+        opa -= x;
+        opa_len += x;
+        x = 0;
+    }
+    if(x + opa_len > len) opa_len = len - x;
+
+    lv_opa_t * buf = &mask_buf[x];
+    lv_coord_t i;
+    for(i = 0; i < opa_len; i++) {
+        buf[i] = mask_mix(opa[i], buf[i]);
+    }
+}
+
 #endif /*LV_DRAW_COMPLEX*/
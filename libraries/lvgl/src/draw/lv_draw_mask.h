@@ -155,6 +155,9 @@ typedef struct  {
     lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
     uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
     uint16_t * opa_start_on_y;      /*The index of `cir_opa` for each y value*/
+    lv_opa_t * cir_opa_rev;     /*`cir_opa` with each row reversed, i.e. the right corners from left to right*/
+    lv_opa_t * cir_opa_inv;     /*`255 - cir_opa` for the inverted (outer) masks*/
+    lv_opa_t * cir_opa_inv_rev; /*`255 - cir_opa_rev`*/
     int32_t life;               /*How many times the entry way used*/
     uint32_t used_cnt;          /*Like a semaphore to count the referencing masks*/
     lv_coord_t radius;          /*The radius of the entry*/
@@ -162,6 +165,14 @@ typedef struct  {
 
 typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
 
+typedef struct {
+    uint32_t hit;           /**< Radius masks which found their circle in the cache*/
+    uint32_t miss;          /**< Radius masks whose circle had to be calculated*/
+    uint32_t evict;         /**< Cached circles replaced by an other radius*/
+    uint32_t size;          /**< Bytes used by the cached circles*/
+    uint32_t entry_cnt;     /**< Number of cached circles*/
+} lv_draw_mask_circle_cache_stat_t;
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_mask_common_dsc_t dsc;
@@ -283,11 +294,22 @@ void * lv_draw_mask_remove_custom(void * custom_id);
 void lv_draw_mask_free_param(void * p);
 
 /**
- * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * Free the cached circles of the radius masks.
+ * The cache is kept between the refreshes so it's called only by `lv_deinit()`.
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Get the state and the hit/miss counters of the circle cache of the radius masks.
+ * @param stat      store the result here
+ */
+void lv_draw_mask_circle_cache_get_stat(lv_draw_mask_circle_cache_stat_t * stat);
+
+/**
+ * Zero the hit, miss and evict counters of the circle cache.
+ */
+void lv_draw_mask_circle_cache_reset_stat(void);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -352,6 +374,18 @@ void lv_draw_mask_angle_init(lv_draw_mask_angle_param_t * param, lv_coord_t vert
  */
 void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area_t * rect, lv_coord_t radius, bool inv);
 
+/**
+ * Get the span of a row which is fully covered by a radius mask, i.e. not affected by the mask.
+ * Only for not inverted masks.
+ * @param param     pointer to an initialized radius mask
+ * @param abs_y     absolute Y coordinate of the row
+ * @param x1        store the absolute X coordinate of the first covered pixel here
+ * @param x2        store the absolute X coordinate of the last covered pixel here
+ * @return          true: the row has covered pixels; false: no covered pixels or the mask is inverted
+ */
+bool lv_draw_mask_radius_get_cover(const lv_draw_mask_radius_param_t * param, lv_coord_t abs_y, lv_coord_t * x1,
+                                   lv_coord_t * x2);
+
 /**
  * Initialize a fade mask.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
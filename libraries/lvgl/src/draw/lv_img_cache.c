@@ -16,15 +16,6 @@
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
-
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
 
 /**********************
  *      TYPEDEFS
@@ -35,6 +26,9 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t get_entry_mem_size(const lv_img_decoder_dsc_t * dsc);
+    static void close_entry(_lv_img_cache_entry_t * entry);
+    static void keep_mem_size(const _lv_img_cache_entry_t * keep);
 #endif
 
 /**********************
@@ -42,6 +36,10 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint32_t use_cnt;
+    static uint32_t mem_size;
+    static uint32_t mem_max_size = LV_IMG_CACHE_MEM_SIZE;
+    static lv_img_cache_stat_t stat;
 #endif
 
 /**********************
@@ -72,44 +70,37 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     }
 
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    use_cnt++;
 
-    /*Decrement all lifes. Make the entries older*/
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
+        if(cache[i].dec_dsc.src != NULL &&
+           color.full == cache[i].dec_dsc.color.full &&
            frame_id == cache[i].dec_dsc.frame_id &&
            lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
             cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+            cached_src->last_use = use_cnt;
+            stat.hit++;
             LV_LOG_TRACE("image source found in the cache");
-            break;
+            return cached_src;
         }
     }
 
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    stat.miss++;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
+    /*The image is not cached then cache it now.
+     *Use an empty entry or the least recently used one.*/
     cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
+    for(i = 0; i < entry_cnt && cached_src->dec_dsc.src != NULL; i++) {
+        if(cache[i].dec_dsc.src == NULL ||
+           use_cnt - cache[i].last_use > use_cnt - cached_src->last_use) {
             cached_src = &cache[i];
         }
     }
 
     /*Close the decoder to reuse if it was opened (has a valid source)*/
     if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
+        close_entry(cached_src);
         LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
     }
     else {
@@ -124,12 +115,9 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -137,6 +125,13 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    cached_src->last_use = use_cnt;
+    cached_src->mem_size = get_entry_mem_size(&cached_src->dec_dsc);
+    mem_size += cached_src->mem_size;
+    keep_mem_size(cached_src);
+#endif
+
     return cached_src;
 }
 
@@ -172,6 +167,54 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
 #endif
 }
 
+/**
+ * Set the memory budget of the cache. The least recently used images are closed while the decoded images
+ * are larger than the budget. The image being drawn is kept open even if it's larger alone.
+ * @param new_mem_size size of the decoded images to keep open in bytes. 0: no limit, only the number of entries
+ */
+void lv_img_cache_set_mem_size(uint32_t new_mem_size)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(new_mem_size);
+    LV_LOG_WARN("Can't change cache size because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    mem_max_size = new_mem_size;
+    keep_mem_size(NULL);
+#endif
+}
+
+/**
+ * Get the state and the hit/miss counters of the image cache.
+ * @param stat_p store the result here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    lv_memset_00(stat_p, sizeof(lv_img_cache_stat_t));
+#else
+    *stat_p = stat;
+    stat_p->size = mem_size;
+    stat_p->max_size = mem_max_size;
+    stat_p->entry_cnt = 0;
+
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src) stat_p->entry_cnt++;
+    }
+#endif
+}
+
+/**
+ * Zero the hit, miss and evict counters.
+ */
+void lv_img_cache_reset_stat(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    lv_memset_00(&stat, sizeof(stat));
+#endif
+}
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -186,11 +229,7 @@ void lv_img_cache_invalidate_src(const void * src)
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+            if(cache[i].dec_dsc.src != NULL) close_entry(&cache[i]);
         }
     }
 #endif
@@ -212,4 +251,56 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * The size of the pixels the decoder allocated for the image.
+ * The built-in decoder uses the pixels of the variables directly and reads the files line by line,
+ * these are not counted.
+ */
+static uint32_t get_entry_mem_size(const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->img_data == NULL) return 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE && dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return 0;
+
+    /*The decoders give the `LV_IMG_CF_RAW...` images in true color format*/
+    lv_img_cf_t cf = dsc->header.cf;
+    if(cf == LV_IMG_CF_RAW || cf == LV_IMG_CF_RAW_ALPHA || cf == LV_IMG_CF_RAW_CHROMA_KEYED) {
+        cf = lv_img_cf_has_alpha(cf) ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    }
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, cf);
+}
+
+static void close_entry(_lv_img_cache_entry_t * entry)
+{
+    lv_img_decoder_close(&entry->dec_dsc);
+    mem_size -= entry->mem_size;
+    lv_memset_00(entry, sizeof(_lv_img_cache_entry_t));
+}
+
+/**
+ * Close the least recently used images while the decoded images are larger than the budget.
+ * @param keep an entry which shouldn't be closed (the one which is being opened to draw) or NULL
+ */
+static void keep_mem_size(const _lv_img_cache_entry_t * keep)
+{
+    if(mem_max_size == 0) return;
+
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    while(mem_size > mem_max_size) {
+        _lv_img_cache_entry_t * lru = NULL;
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
+            if(&cache[i] == keep || cache[i].mem_size == 0) continue;
+            if(lru == NULL || use_cnt - cache[i].last_use > use_cnt - lru->last_use) lru = &cache[i];
+        }
+
+        /*Only the kept image is left, it's larger than the budget alone*/
+        if(lru == NULL) break;
+
+        LV_LOG_INFO("image cache: close an image to stay in the memory budget");
+        close_entry(lru);
+        stat.evict++;
+    }
+}
 #endif
@@ -31,12 +31,24 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    /** Value of the cache's use counter when the entry was used the last time.
+     * The least recently used entry is closed first.*/
+    uint32_t last_use;
+
+    /** Size of the decoded image kept open by the entry in bytes.
+     * 0 if the decoder didn't allocate the pixels (e.g. the built-in decoder with a variable)*/
+    uint32_t mem_size;
 } _lv_img_cache_entry_t;
 
+typedef struct {
+    uint32_t hit;           /**< Images found open in the cache*/
+    uint32_t miss;          /**< Images which had to be opened (decoded)*/
+    uint32_t evict;         /**< Images closed to stay in the memory budget*/
+    uint32_t size;          /**< Bytes used by the decoded images*/
+    uint32_t max_size;      /**< Memory budget set by `lv_img_cache_set_mem_size()`, 0: no limit*/
+    uint32_t entry_cnt;     /**< Number of open images*/
+} lv_img_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -60,6 +72,24 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Set the memory budget of the cache. The least recently used images are closed while the decoded images
+ * are larger than the budget. The image being drawn is kept open even if it's larger alone.
+ * @param new_mem_size size of the decoded images to keep open in bytes. 0: no limit, only the number of entries
+ */
+void lv_img_cache_set_mem_size(uint32_t new_mem_size);
+
+/**
+ * Get the state and the hit/miss counters of the image cache.
+ * @param stat_p store the result here
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p);
+
+/**
+ * Zero the hit, miss and evict counters.
+ */
+void lv_img_cache_reset_stat(void);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
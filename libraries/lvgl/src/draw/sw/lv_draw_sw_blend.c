@@ -7,9 +7,11 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_sw.h"
+#include "lv_draw_sw_blend_rgb565.h"
 #include "../../misc/lv_math.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -102,7 +104,9 @@ void lv_draw_sw_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * d
 
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
+    LV_PROFILER_BEGIN;
     ((lv_draw_sw_ctx_t *)draw_ctx)->blend(draw_ctx, dsc);
+    LV_PROFILER_END;
 }
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx,
@@ -246,6 +250,11 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
     int32_t w = lv_area_get_width(dest_area);
     int32_t h = lv_area_get_height(dest_area);
 
+#if LV_DRAW_SW_BLEND_RGB565
+    lv_draw_sw_blend_rgb565_fill((uint16_t *)dest_buf, dest_stride, w, h, color.full, opa, mask, mask_stride);
+    return;
+#endif
+
     int32_t x;
     int32_t y;
 
@@ -647,6 +656,12 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
     int32_t w = lv_area_get_width(dest_area);
     int32_t h = lv_area_get_height(dest_area);
 
+#if LV_DRAW_SW_BLEND_RGB565
+    lv_draw_sw_blend_rgb565_map((uint16_t *)dest_buf, dest_stride, (const uint16_t *)src_buf, src_stride, w, h, opa,
+                                mask, mask_stride);
+    return;
+#endif
+
     int32_t x;
     int32_t y;
 
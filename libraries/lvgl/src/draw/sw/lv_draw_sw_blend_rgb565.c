@@ -0,0 +1,537 @@
+/**
+ * @file lv_draw_sw_blend_rgb565.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_rgb565.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The color components of a pixel spread in a 32 bit word: 0bGGGGGG00000RRRRR000000BBBBB*/
+#define RGB565_SPREAD_MASK  0x7E0F81FU
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_draw_sw_blend_rgb565_backend_t * backend_act = &lv_draw_sw_blend_rgb565_swar;
+
+/**********************
+ *      MACROS
+ **********************/
+/*The kernel of the backend or the SWAR one if the backend doesn't have it*/
+#define KERNEL(b, name) ((b)->name ? (b)->name : lv_draw_sw_blend_rgb565_swar.name)
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline uint16_t px_swap(uint16_t c)
+{
+    return (uint16_t)((c << 8) | (c >> 8));
+}
+
+/*Same as `lv_color_mix()` with 16 bit color depth and `LV_COLOR_MIX_ROUND_OFS == 0`*/
+static inline uint16_t px_mix(uint16_t fg, uint16_t bg, uint8_t mix, bool swap)
+{
+    if(swap) {
+        fg = px_swap(fg);
+        bg = px_swap(bg);
+    }
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg32 = ((uint32_t)bg | ((uint32_t)bg << 16)) & RGB565_SPREAD_MASK;
+    uint32_t fg32 = ((uint32_t)fg | ((uint32_t)fg << 16)) & RGB565_SPREAD_MASK;
+    uint32_t res = ((((fg32 - bg32) * mix) >> 5) + bg32) & RGB565_SPREAD_MASK;
+    uint16_t c = (uint16_t)((res >> 16) | res);
+    return swap ? px_swap(c) : c;
+}
+
+/*Same as `lv_color_premult()` + `lv_color_mix_premult()` with 16 bit color depth*/
+static inline void px_premult(uint16_t c, lv_opa_t opa, bool swap, uint16_t * out)
+{
+    if(swap) c = px_swap(c);
+    out[0] = (uint16_t)(c >> 11) * opa;
+    out[1] = (uint16_t)((c >> 5) & 0x3F) * opa;
+    out[2] = (uint16_t)(c & 0x1F) * opa;
+}
+
+static inline uint16_t px_mix_premult(const uint16_t * premult, uint16_t bg, lv_opa_t opa_inv, bool swap)
+{
+    if(swap) bg = px_swap(bg);
+    uint16_t r = LV_UDIV255(premult[0] + (uint32_t)(bg >> 11) * opa_inv);
+    uint16_t g = LV_UDIV255(premult[1] + (uint32_t)((bg >> 5) & 0x3F) * opa_inv);
+    uint16_t b = LV_UDIV255(premult[2] + (uint32_t)(bg & 0x1F) * opa_inv);
+    uint16_t c = (uint16_t)((r << 11) | (g << 5) | b);
+    return swap ? px_swap(c) : c;
+}
+
+/*`fill_normal()` rounds the opacity like `lv_color_mix()` does, to give the same result*/
+static inline lv_opa_t opa_round(lv_opa_t opa)
+{
+    return (lv_opa_t)((((uint32_t)opa + 4) >> 3) << 3);
+}
+
+/*--------------------
+ * Reference kernels
+ *--------------------*/
+
+static void ref_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) dest[x] = color;
+        dest += dest_stride;
+    }
+}
+
+static inline void ref_fill_opa_core(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                                     lv_opa_t opa, bool swap)
+{
+    /*`fill_normal()` seeds its cache with black mixed by `lv_color_mix()`, so black pixels get that result
+     *until an other color is seen*/
+    uint16_t last_dest = 0;
+    uint16_t last_res = px_mix(color, 0, opa, swap);
+
+    opa = opa_round(opa);
+    uint16_t premult[3];
+    px_premult(color, opa, swap, premult);
+    lv_opa_t opa_inv = 255 - opa;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            if(dest[x] != last_dest) {
+                last_dest = dest[x];
+                last_res = px_mix_premult(premult, dest[x], opa_inv, swap);
+            }
+            dest[x] = last_res;
+        }
+        dest += dest_stride;
+    }
+}
+
+static inline void ref_fill_mask_core(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                                      lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride, bool swap)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            if(opa >= LV_OPA_MAX) {
+                if(mask[x] == LV_OPA_COVER) dest[x] = color;
+                else dest[x] = px_mix(color, dest[x], mask[x], swap);
+            }
+            else if(mask[x]) {
+                lv_opa_t opa_tmp = mask[x] == LV_OPA_COVER ? opa : (uint32_t)((uint32_t)mask[x] * opa) >> 8;
+                if(opa_tmp == LV_OPA_COVER) dest[x] = color;
+                else dest[x] = px_mix(color, dest[x], opa_tmp, swap);
+            }
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void ref_copy(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                     int32_t h)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) dest[x] = src[x];
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+static inline void ref_copy_opa_core(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride,
+                                     int32_t w, int32_t h, lv_opa_t opa, bool swap)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) dest[x] = px_mix(src[x], dest[x], opa, swap);
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+static inline void ref_copy_mask_core(uint16_t * dest, int32_t dest_stride, const uint16_t * src,
+                                      int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa, const lv_opa_t * mask,
+                                      int32_t mask_stride, bool swap)
+{
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            if(mask[x] == 0) continue;
+            if(opa > LV_OPA_MAX) {
+                if(mask[x] == LV_OPA_COVER) dest[x] = src[x];
+                else dest[x] = px_mix(src[x], dest[x], mask[x], swap);
+            }
+            else {
+                lv_opa_t opa_tmp = mask[x] >= LV_OPA_MAX ? opa : ((opa * mask[x]) >> 8);
+                dest[x] = px_mix(src[x], dest[x], opa_tmp, swap);
+            }
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+/*--------------------
+ * SWAR kernels
+ *--------------------*/
+
+static void swar_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color)
+{
+    uint32_t c32 = (uint32_t)color | ((uint32_t)color << 16);
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = dest;
+        int32_t n = w;
+        if(n > 0 && ((lv_uintptr_t)d & 0x3)) {
+            *d++ = color;
+            n--;
+        }
+        uint32_t * d32 = (uint32_t *)d;
+        while(n >= 8) {
+            d32[0] = c32;
+            d32[1] = c32;
+            d32[2] = c32;
+            d32[3] = c32;
+            d32 += 4;
+            n -= 8;
+        }
+        while(n >= 2) {
+            *d32++ = c32;
+            n -= 2;
+        }
+        if(n) *((uint16_t *)d32) = color;
+        dest += dest_stride;
+    }
+}
+
+static inline void swar_fill_opa_core(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                                      lv_opa_t opa, bool swap)
+{
+    uint16_t last_dest = 0;
+    uint16_t last_res = px_mix(color, 0, opa, swap);
+
+    opa = opa_round(opa);
+    uint16_t premult[3];
+    px_premult(color, opa, swap, premult);
+    lv_opa_t opa_inv = 255 - opa;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+        if(w > 0 && ((lv_uintptr_t)dest & 0x3)) {
+            if(dest[0] != last_dest) {
+                last_dest = dest[0];
+                last_res = px_mix_premult(premult, dest[0], opa_inv, swap);
+            }
+            dest[0] = last_res;
+            x = 1;
+        }
+        /*Backgrounds are mostly plain: handle 2 pixels with one compare and store*/
+        for(; x < w - 1; x += 2) {
+            uint32_t * d32 = (uint32_t *)&dest[x];
+            uint32_t last_dest32 = (uint32_t)last_dest | ((uint32_t)last_dest << 16);
+            if(*d32 == last_dest32) {
+                *d32 = (uint32_t)last_res | ((uint32_t)last_res << 16);
+                continue;
+            }
+            int32_t i;
+            for(i = 0; i < 2; i++) {
+                if(dest[x + i] != last_dest) {
+                    last_dest = dest[x + i];
+                    last_res = px_mix_premult(premult, dest[x + i], opa_inv, swap);
+                }
+                dest[x + i] = last_res;
+            }
+        }
+        if(x < w) {
+            if(dest[x] != last_dest) {
+                last_dest = dest[x];
+                last_res = px_mix_premult(premult, dest[x], opa_inv, swap);
+            }
+            dest[x] = last_res;
+        }
+        dest += dest_stride;
+    }
+}
+
+static inline void swar_fill_mask_core(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h,
+                                       uint16_t color, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride, bool swap)
+{
+    if(opa < LV_OPA_MAX) {
+        ref_fill_mask_core(dest, dest_stride, w, h, color, opa, mask, mask_stride, swap);
+        return;
+    }
+
+    uint32_t c32 = (uint32_t)color | ((uint32_t)color << 16);
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = color;
+            else if(mask[x]) dest[x] = px_mix(color, dest[x], mask[x], swap);
+        }
+
+        /*Anti-aliased edges are short, the inside of a shape is fully covered or transparent*/
+        for(; x < w - 3; x += 4) {
+            uint32_t mask32 = *((const uint32_t *)&mask[x]);
+            if(mask32 == 0) continue;
+            if(mask32 == 0xFFFFFFFF) {
+                if(((lv_uintptr_t)&dest[x] & 0x3) == 0) {
+                    uint32_t * d32 = (uint32_t *)&dest[x];
+                    d32[0] = c32;
+                    d32[1] = c32;
+                }
+                else {
+                    dest[x] = color;
+                    dest[x + 1] = color;
+                    dest[x + 2] = color;
+                    dest[x + 3] = color;
+                }
+                continue;
+            }
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                lv_opa_t m = mask[x + i];
+                if(m == LV_OPA_COVER) dest[x + i] = color;
+                else if(m) dest[x + i] = px_mix(color, dest[x + i], m, swap);
+            }
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = color;
+            else if(mask[x]) dest[x] = px_mix(color, dest[x], mask[x], swap);
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void swar_copy(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                      int32_t h)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_memcpy(dest, src, w * sizeof(uint16_t));
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+/*A real mix for every pixel, the reference is as good as it gets*/
+static inline void swar_copy_opa_core(uint16_t * dest, int32_t dest_stride, const uint16_t * src,
+                                      int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa, bool swap)
+{
+    ref_copy_opa_core(dest, dest_stride, src, src_stride, w, h, opa, swap);
+}
+
+static inline void swar_copy_mask_core(uint16_t * dest, int32_t dest_stride, const uint16_t * src,
+                                       int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa, const lv_opa_t * mask,
+                                       int32_t mask_stride, bool swap)
+{
+    if(opa <= LV_OPA_MAX) {
+        ref_copy_mask_core(dest, dest_stride, src, src_stride, w, h, opa, mask, mask_stride, swap);
+        return;
+    }
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x;
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = src[x];
+            else if(mask[x]) dest[x] = px_mix(src[x], dest[x], mask[x], swap);
+        }
+
+        for(; x < w - 3; x += 4) {
+            uint32_t mask32 = *((const uint32_t *)&mask[x]);
+            if(mask32 == 0) continue;
+            if(mask32 == 0xFFFFFFFF) {
+                dest[x] = src[x];
+                dest[x + 1] = src[x + 1];
+                dest[x + 2] = src[x + 2];
+                dest[x + 3] = src[x + 3];
+                continue;
+            }
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                lv_opa_t m = mask[x + i];
+                if(m == LV_OPA_COVER) dest[x + i] = src[x + i];
+                else if(m) dest[x + i] = px_mix(src[x + i], dest[x + i], m, swap);
+            }
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = src[x];
+            else if(mask[x]) dest[x] = px_mix(src[x], dest[x], mask[x], swap);
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+/*Instantiate the normal and byte swapped variants of the blending kernels*/
+#define KERNEL_VARIANTS(prefix)                                                                                     \
+    static void prefix##_fill_opa(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,       \
+                                  lv_opa_t opa)                                                                     \
+    {                                                                                                               \
+        prefix##_fill_opa_core(dest, dest_stride, w, h, color, opa, false);                                         \
+    }                                                                                                               \
+    static void prefix##_fill_opa_swap(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,  \
+                                       lv_opa_t opa)                                                                \
+    {                                                                                                               \
+        prefix##_fill_opa_core(dest, dest_stride, w, h, color, opa, true);                                          \
+    }                                                                                                               \
+    static void prefix##_fill_mask(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,      \
+                                   lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride)                        \
+    {                                                                                                               \
+        prefix##_fill_mask_core(dest, dest_stride, w, h, color, opa, mask, mask_stride, false);                     \
+    }                                                                                                               \
+    static void prefix##_fill_mask_swap(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color, \
+                                        lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride)                   \
+    {                                                                                                               \
+        prefix##_fill_mask_core(dest, dest_stride, w, h, color, opa, mask, mask_stride, true);                      \
+    }                                                                                                               \
+    static void prefix##_copy_opa(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride,   \
+                                  int32_t w, int32_t h, lv_opa_t opa)                                               \
+    {                                                                                                               \
+        prefix##_copy_opa_core(dest, dest_stride, src, src_stride, w, h, opa, false);                               \
+    }                                                                                                               \
+    static void prefix##_copy_opa_swap(uint16_t * dest, int32_t dest_stride, const uint16_t * src,                  \
+                                       int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa)                      \
+    {                                                                                                               \
+        prefix##_copy_opa_core(dest, dest_stride, src, src_stride, w, h, opa, true);                                \
+    }                                                                                                               \
+    static void prefix##_copy_mask(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride,  \
+                                   int32_t w, int32_t h, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride)  \
+    {                                                                                                               \
+        prefix##_copy_mask_core(dest, dest_stride, src, src_stride, w, h, opa, mask, mask_stride, false);           \
+    }                                                                                                               \
+    static void prefix##_copy_mask_swap(uint16_t * dest, int32_t dest_stride, const uint16_t * src,                 \
+                                        int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa,                     \
+                                        const lv_opa_t * mask, int32_t mask_stride)                                 \
+    {                                                                                                               \
+        prefix##_copy_mask_core(dest, dest_stride, src, src_stride, w, h, opa, mask, mask_stride, true);            \
+    }
+
+KERNEL_VARIANTS(ref)
+KERNEL_VARIANTS(swar)
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const lv_draw_sw_blend_rgb565_backend_t lv_draw_sw_blend_rgb565_ref = {
+    .name = "ref",
+    .fill = ref_fill,
+    .fill_opa = ref_fill_opa,
+    .fill_mask = ref_fill_mask,
+    .copy = ref_copy,
+    .copy_opa = ref_copy_opa,
+    .copy_mask = ref_copy_mask,
+    .fill_opa_swap = ref_fill_opa_swap,
+    .fill_mask_swap = ref_fill_mask_swap,
+    .copy_opa_swap = ref_copy_opa_swap,
+    .copy_mask_swap = ref_copy_mask_swap,
+};
+
+const lv_draw_sw_blend_rgb565_backend_t lv_draw_sw_blend_rgb565_swar = {
+    .name = "swar",
+    .fill = swar_fill,
+    .fill_opa = swar_fill_opa,
+    .fill_mask = swar_fill_mask,
+    .copy = swar_copy,
+    .copy_opa = swar_copy_opa,
+    .copy_mask = swar_copy_mask,
+    .fill_opa_swap = swar_fill_opa_swap,
+    .fill_mask_swap = swar_fill_mask_swap,
+    .copy_opa_swap = swar_copy_opa_swap,
+    .copy_mask_swap = swar_copy_mask_swap,
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_blend_rgb565_set_backend(const lv_draw_sw_blend_rgb565_backend_t * backend)
+{
+#if defined(__XTENSA__) && LV_DRAW_SW_BLEND_RGB565_PIE
+    if(backend == NULL) backend = lv_draw_sw_blend_rgb565_pie();
+#endif
+    if(backend == NULL) backend = &lv_draw_sw_blend_rgb565_swar;
+
+    backend_act = backend;
+}
+
+const lv_draw_sw_blend_rgb565_backend_t * lv_draw_sw_blend_rgb565_get_backend(void)
+{
+    return backend_act;
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_rgb565_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h,
+                                                        uint16_t color, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride)
+{
+    const lv_draw_sw_blend_rgb565_backend_t * b = lv_draw_sw_blend_rgb565_get_backend();
+
+    if(mask == NULL) {
+        if(opa >= LV_OPA_MAX) b->fill(dest, dest_stride, w, h, color);
+#if LV_COLOR_16_SWAP
+        else KERNEL(b, fill_opa_swap)(dest, dest_stride, w, h, color, opa);
+#else
+        else KERNEL(b, fill_opa)(dest, dest_stride, w, h, color, opa);
+#endif
+    }
+    else {
+#if LV_COLOR_16_SWAP
+        KERNEL(b, fill_mask_swap)(dest, dest_stride, w, h, color, opa, mask, mask_stride);
+#else
+        KERNEL(b, fill_mask)(dest, dest_stride, w, h, color, opa, mask, mask_stride);
+#endif
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_rgb565_map(uint16_t * dest, int32_t dest_stride, const uint16_t * src,
+                                                       int32_t src_stride, int32_t w, int32_t h, lv_opa_t opa,
+                                                       const lv_opa_t * mask, int32_t mask_stride)
+{
+    const lv_draw_sw_blend_rgb565_backend_t * b = lv_draw_sw_blend_rgb565_get_backend();
+
+    if(mask == NULL) {
+        if(opa >= LV_OPA_MAX) b->copy(dest, dest_stride, src, src_stride, w, h);
+#if LV_COLOR_16_SWAP
+        else KERNEL(b, copy_opa_swap)(dest, dest_stride, src, src_stride, w, h, opa);
+#else
+        else KERNEL(b, copy_opa)(dest, dest_stride, src, src_stride, w, h, opa);
+#endif
+    }
+    else {
+#if LV_COLOR_16_SWAP
+        KERNEL(b, copy_mask_swap)(dest, dest_stride, src, src_stride, w, h, opa, mask, mask_stride);
+#else
+        KERNEL(b, copy_mask)(dest, dest_stride, src, src_stride, w, h, opa, mask, mask_stride);
+#endif
+    }
+}
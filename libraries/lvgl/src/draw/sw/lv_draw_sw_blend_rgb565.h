@@ -0,0 +1,121 @@
+/**
+ * @file lv_draw_sw_blend_rgb565.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_RGB565_H
+#define LV_DRAW_SW_BLEND_RGB565_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "../../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The RGB565 kernels replace the generic loops of `lv_draw_sw_blend.c` only where they give the same result*/
+#define LV_DRAW_SW_BLEND_RGB565 (LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS == 0)
+
+/*Let `lv_draw_sw_blend_rgb565_set_backend(NULL)` select the ESP32-S3 PIE kernels.
+ *Off until they have been run on the hardware against the reference kernels.*/
+#ifndef LV_DRAW_SW_BLEND_RGB565_PIE
+#define LV_DRAW_SW_BLEND_RGB565_PIE 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Set of blend kernels working on raw RGB565 pixels.
+ * Strides are in pixels. `opa`/`mask` handling follows `lv_draw_sw_blend_basic()` exactly.
+ * The `_swap` kernels work on byte swapped pixels (`LV_COLOR_16_SWAP`). `fill` and `copy` don't care about the byte order.
+ * `fill` and `copy` are mandatory, the other kernels can be NULL to use the SWAR ones.
+ */
+typedef struct {
+    const char * name;
+
+    void (*fill)(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color);
+    void (*fill_opa)(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa);
+    void (*fill_mask)(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa,
+                      const lv_opa_t * mask, int32_t mask_stride);
+    void (*copy)(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w, int32_t h);
+    void (*copy_opa)(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                     int32_t h, lv_opa_t opa);
+    void (*copy_mask)(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                      int32_t h, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride);
+
+    void (*fill_opa_swap)(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa);
+    void (*fill_mask_swap)(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa,
+                           const lv_opa_t * mask, int32_t mask_stride);
+    void (*copy_opa_swap)(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                          int32_t h, lv_opa_t opa);
+    void (*copy_mask_swap)(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                           int32_t h, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride);
+} lv_draw_sw_blend_rgb565_backend_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Per pixel reference kernels. Slow, but the result is the definition of correct.
+ */
+extern const lv_draw_sw_blend_rgb565_backend_t lv_draw_sw_blend_rgb565_ref;
+
+/**
+ * Portable kernels working on 2 pixels (32 bit) at once where possible. Bit exact with the reference.
+ */
+extern const lv_draw_sw_blend_rgb565_backend_t lv_draw_sw_blend_rgb565_swar;
+
+#if defined(__XTENSA__)
+/**
+ * ESP32-S3 `fill` and `copy` using the 128 bit PIE vector unit, the rest are the SWAR kernels. NULL on other chips.
+ * Selected by `lv_draw_sw_blend_rgb565_set_backend(NULL)` only if `LV_DRAW_SW_BLEND_RGB565_PIE` is 1.
+ */
+const lv_draw_sw_blend_rgb565_backend_t * lv_draw_sw_blend_rgb565_pie(void);
+#endif
+
+/**
+ * Select the kernels used by the software renderer. `lv_init()` selects the default one.
+ * The blend calls (also the ones on the render helper threads) read it without locking,
+ * so change it only while nothing is being rendered.
+ * @param backend   pointer to a kernel set or NULL to select the default (SWAR, or PIE if enabled)
+ */
+void lv_draw_sw_blend_rgb565_set_backend(const lv_draw_sw_blend_rgb565_backend_t * backend);
+
+/**
+ * Get the kernels used by the software renderer.
+ * @return          pointer to the active kernel set
+ */
+const lv_draw_sw_blend_rgb565_backend_t * lv_draw_sw_blend_rgb565_get_backend(void);
+
+/**
+ * Fill an area with a color using the active kernels. Same arguments as `fill_normal()` in `lv_draw_sw_blend.c`.
+ */
+void lv_draw_sw_blend_rgb565_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color,
+                                  lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride);
+
+/**
+ * Blend an image to an area using the active kernels. Same arguments as `map_normal()` in `lv_draw_sw_blend.c`.
+ */
+void lv_draw_sw_blend_rgb565_map(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride,
+                                 int32_t w, int32_t h, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_RGB565_H*/
@@ -0,0 +1,157 @@
+/**
+ * @file lv_draw_sw_blend_rgb565_pie.c
+ *
+ * RGB565 `fill` and `copy` for the ESP32-S3 PIE (128 bit SIMD) unit.
+ * There are no PIE blending (opa/mask) kernels, the table leaves them NULL and the SWAR ones are used.
+ * `lv_color_mix()` would fit 16 bit lanes (`bg + ((fg - bg) * mix >> 5)` per channel with `ee.vmul.s16`),
+ * but PIE shifts 16 bit lanes only through a multiply by SAR, so splitting, byte swapping (`LV_COLOR_16_SWAP`)
+ * and merging the channels of 8 pixels is unlikely to beat the SWAR kernels.
+ *
+ * Not selected by default (`LV_DRAW_SW_BLEND_RGB565_PIE`): it has not been run on the hardware yet.
+ * The loops are plain branches and not `loop`/`loopnez`, because the compiler doesn't know that
+ * inline asm uses LBEG/LEND/LCOUNT and may keep its own zero overhead loop in them.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_rgb565.h"
+#include "../../misc/lv_mem.h"
+
+#if defined(__XTENSA__)
+
+#if defined(ESP_PLATFORM)
+    #include "sdkconfig.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+    #define RGB565_PIE 1
+#else
+    #define RGB565_PIE 0
+#endif
+
+#if RGB565_PIE
+
+/*Rows shorter than this are faster with the scalar code (no alignment head/tail)*/
+#define PIE_MIN_W   16
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void pie_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h, uint16_t color);
+static void pie_copy(uint16_t * dest, int32_t dest_stride, const uint16_t * src, int32_t src_stride, int32_t w,
+                     int32_t h);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Constant, so the render helper threads can use it without locking*/
+static const lv_draw_sw_blend_rgb565_backend_t pie_backend = {
+    .name = "pie",
+    .fill = pie_fill,
+    .copy = pie_copy,
+    /*The blending kernels are NULL: the SWAR ones*/
+};
+
+#endif /*RGB565_PIE*/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_draw_sw_blend_rgb565_backend_t * lv_draw_sw_blend_rgb565_pie(void)
+{
+#if RGB565_PIE
+    return &pie_backend;
+#else
+    return NULL;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if RGB565_PIE
+
+static void LV_ATTRIBUTE_FAST_MEM pie_fill(uint16_t * dest, int32_t dest_stride, int32_t w, int32_t h,
+                                           uint16_t color)
+{
+    uint32_t c32 = (uint32_t)color | ((uint32_t)color << 16);
+    uint32_t c128[4] __attribute__((aligned(16))) = {c32, c32, c32, c32};
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = dest;
+        int32_t n = w;
+
+        if(n >= PIE_MIN_W) {
+            while((lv_uintptr_t)d & 0xF) {
+                *d++ = color;
+                n--;
+            }
+            uint32_t blocks = n >> 3;   /*8 pixels per 128 bit store*/
+            n &= 0x7;
+            if(blocks) {
+                __asm__ volatile(
+                    "ee.vld.128.ip      q0, %[c], 0         \n"
+                    "1:                                     \n"
+                    "ee.vst.128.ip      q0, %[d], 16        \n"
+                    "addi               %[b], %[b], -1      \n"
+                    "bnez               %[b], 1b            \n"
+                    : [d] "+r"(d), [b] "+r"(blocks)
+                    : [c] "r"(c128)
+                    : "memory");
+            }
+        }
+        while(n--) *d++ = color;
+
+        dest += dest_stride;
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM pie_copy(uint16_t * dest, int32_t dest_stride, const uint16_t * src,
+                                           int32_t src_stride, int32_t w, int32_t h)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        uint16_t * d = dest;
+        const uint16_t * s = src;
+        int32_t n = w;
+
+        /*Vector loads and stores need the same 16 byte alignment on both sides*/
+        if(n >= PIE_MIN_W && (((lv_uintptr_t)d ^ (lv_uintptr_t)s) & 0xF) == 0) {
+            while((lv_uintptr_t)d & 0xF) {
+                *d++ = *s++;
+                n--;
+            }
+            uint32_t blocks = n >> 3;
+            n &= 0x7;
+            if(blocks) {
+                __asm__ volatile(
+                    "1:                                     \n"
+                    "ee.vld.128.ip      q0, %[s], 16        \n"
+                    "ee.vst.128.ip      q0, %[d], 16        \n"
+                    "addi               %[b], %[b], -1      \n"
+                    "bnez               %[b], 1b            \n"
+                    : [d] "+r"(d), [s] "+r"(s), [b] "+r"(blocks)
+                    :
+                    : "memory");
+            }
+            while(n--) *d++ = *s++;
+        }
+        else {
+            lv_memcpy(d, s, n * sizeof(uint16_t));
+        }
+
+        dest += dest_stride;
+        src += src_stride;
+    }
+}
+
+#endif /*RGB565_PIE*/
+
+#endif /*defined(__XTENSA__)*/
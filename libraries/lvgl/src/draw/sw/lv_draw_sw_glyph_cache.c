@@ -0,0 +1,311 @@
+/**
+ * @file lv_draw_sw_glyph_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_glyph_cache.h"
+#include "../../misc/lv_mem.h"
+#include "../../misc/lv_gc.h"
+#include "../../misc/lv_log.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_printf.h"
+
+#if LV_GLYPH_CACHE_DEF_SIZE && LV_GLYPH_CACHE_CUSTOM
+    #include LV_GLYPH_CACHE_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_GLYPH_CACHE_DEF_SIZE && LV_GLYPH_CACHE_CUSTOM
+    #define GLYPH_ALLOC(size)   LV_GLYPH_CACHE_CUSTOM_ALLOC(size)
+    #define GLYPH_FREE(p)       LV_GLYPH_CACHE_CUSTOM_FREE(p)
+#else
+    #define GLYPH_ALLOC(size)   lv_mem_alloc(size)
+    #define GLYPH_FREE(p)       lv_mem_free(p)
+#endif
+
+/*Must be power of 2*/
+#define GLYPH_CACHE_BUCKET_CNT  32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _glyph_entry_t {
+    struct _glyph_entry_t * bucket_next;
+    struct _glyph_entry_t * lru_prev;   /*Towards the most recently used*/
+    struct _glyph_entry_t * lru_next;   /*Towards the least recently used*/
+    const lv_font_t * font;
+    uint32_t letter;
+    uint16_t box_w;
+    uint16_t box_h;
+    uint8_t bpp;
+    /*Followed by the `box_w * box_h` opacity map*/
+} glyph_entry_t;
+
+typedef struct {
+    glyph_entry_t * bucket[GLYPH_CACHE_BUCKET_CNT];
+    glyph_entry_t * lru_head;
+    glyph_entry_t * lru_tail;
+    uint32_t size;
+    uint32_t entry_cnt;
+} glyph_cache_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static glyph_cache_t * get_cache(bool create);
+static uint32_t get_bucket_id(const lv_font_t * font, uint32_t letter);
+static void lru_unlink(glyph_cache_t * cache, glyph_entry_t * e);
+static void lru_push_head(glyph_cache_t * cache, glyph_entry_t * e);
+static void drop_entry(glyph_cache_t * cache, glyph_entry_t * e);
+static void shrink(glyph_cache_t * cache, uint32_t size);
+static bool unpack(lv_opa_t * out, const uint8_t * in, uint32_t px_cnt, uint32_t bpp);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t max_size = LV_GLYPH_CACHE_DEF_SIZE;
+static uint32_t hit_cnt;
+static uint32_t miss_cnt;
+static uint32_t evict_cnt;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+extern const uint8_t _lv_bpp1_opa_table[2];
+extern const uint8_t _lv_bpp2_opa_table[4];
+extern const uint8_t _lv_bpp4_opa_table[16];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_glyph_cache_set_size(uint32_t size)
+{
+    max_size = size;
+
+    glyph_cache_t * cache = get_cache(false);
+    if(cache == NULL) return;
+
+    shrink(cache, size);
+    if(size == 0) {
+        lv_mem_free(cache);
+        LV_GC_ROOT(_lv_glyph_cache) = NULL;
+    }
+}
+
+void lv_draw_sw_glyph_cache_invalidate_font(const lv_font_t * font)
+{
+    glyph_cache_t * cache = get_cache(false);
+    if(cache == NULL) return;
+
+    glyph_entry_t * e = cache->lru_head;
+    while(e) {
+        glyph_entry_t * next = e->lru_next;
+        if(font == NULL || e->font == font) drop_entry(cache, e);
+        e = next;
+    }
+}
+
+void lv_draw_sw_glyph_cache_get_stat(lv_draw_sw_glyph_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    glyph_cache_t * cache = get_cache(false);
+    stat->hit = hit_cnt;
+    stat->miss = miss_cnt;
+    stat->evict = evict_cnt;
+    stat->size = cache ? cache->size : 0;
+    stat->max_size = max_size;
+    stat->entry_cnt = cache ? cache->entry_cnt : 0;
+}
+
+void lv_draw_sw_glyph_cache_reset_stat(void)
+{
+    hit_cnt = 0;
+    miss_cnt = 0;
+    evict_cnt = 0;
+}
+
+const lv_opa_t * _lv_draw_sw_glyph_cache_get(const lv_font_glyph_dsc_t * g, uint32_t letter)
+{
+    if(max_size == 0) return NULL;
+
+    const lv_font_t * font = g->resolved_font;
+    glyph_cache_t * cache = get_cache(true);
+    if(cache == NULL) return NULL;
+
+    glyph_entry_t ** bucket = &cache->bucket[get_bucket_id(font, letter)];
+    glyph_entry_t * e;
+    for(e = *bucket; e; e = e->bucket_next) {
+        if(e->font != font || e->letter != letter) continue;
+
+        /*The same font can render a glyph differently after e.g. `lv_tiny_ttf_set_size()`*/
+        if(e->box_w == g->box_w && e->box_h == g->box_h && e->bpp == g->bpp) {
+            hit_cnt++;
+            if(cache->lru_head != e) {
+                lru_unlink(cache, e);
+                lru_push_head(cache, e);
+            }
+            return (const lv_opa_t *)(e + 1);
+        }
+
+        drop_entry(cache, e);
+        break;
+    }
+
+    miss_cnt++;
+
+    uint32_t px_cnt = (uint32_t)g->box_w * g->box_h;
+    uint32_t entry_size = sizeof(glyph_entry_t) + px_cnt;
+    if(entry_size > max_size) return NULL;
+
+    const uint8_t * bitmap = lv_font_get_glyph_bitmap(g->resolved_font, letter);
+    if(bitmap == NULL) return NULL;
+
+    shrink(cache, max_size - entry_size);
+    e = GLYPH_ALLOC(entry_size);
+    if(e == NULL) {
+        LV_LOG_WARN("couldn't allocate %" LV_PRIu32 " bytes for a glyph", entry_size);
+        return NULL;
+    }
+
+    if(!unpack((lv_opa_t *)(e + 1), bitmap, px_cnt, g->bpp)) {
+        GLYPH_FREE(e);
+        return NULL;
+    }
+
+    e->font = font;
+    e->letter = letter;
+    e->box_w = g->box_w;
+    e->box_h = g->box_h;
+    e->bpp = g->bpp;
+    e->bucket_next = *bucket;
+    *bucket = e;
+    lru_push_head(cache, e);
+    cache->size += entry_size;
+    cache->entry_cnt++;
+
+    return (const lv_opa_t *)(e + 1);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static glyph_cache_t * get_cache(bool create)
+{
+    glyph_cache_t * cache = LV_GC_ROOT(_lv_glyph_cache);
+    if(cache == NULL && create) {
+        cache = lv_mem_alloc(sizeof(glyph_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        lv_memset_00(cache, sizeof(glyph_cache_t));
+        LV_GC_ROOT(_lv_glyph_cache) = cache;
+    }
+    return cache;
+}
+
+static uint32_t get_bucket_id(const lv_font_t * font, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font >> 2) ^ (letter * 2654435761u);
+    return (h ^ (h >> 16)) & (GLYPH_CACHE_BUCKET_CNT - 1);
+}
+
+static void lru_unlink(glyph_cache_t * cache, glyph_entry_t * e)
+{
+    if(e->lru_prev) e->lru_prev->lru_next = e->lru_next;
+    else cache->lru_head = e->lru_next;
+
+    if(e->lru_next) e->lru_next->lru_prev = e->lru_prev;
+    else cache->lru_tail = e->lru_prev;
+}
+
+static void lru_push_head(glyph_cache_t * cache, glyph_entry_t * e)
+{
+    e->lru_prev = NULL;
+    e->lru_next = cache->lru_head;
+    if(cache->lru_head) cache->lru_head->lru_prev = e;
+    else cache->lru_tail = e;
+    cache->lru_head = e;
+}
+
+static void drop_entry(glyph_cache_t * cache, glyph_entry_t * e)
+{
+    glyph_entry_t ** p = &cache->bucket[get_bucket_id(e->font, e->letter)];
+    while(*p != e) p = &(*p)->bucket_next;
+    *p = e->bucket_next;
+
+    lru_unlink(cache, e);
+    cache->size -= sizeof(glyph_entry_t) + (uint32_t)e->box_w * e->box_h;
+    cache->entry_cnt--;
+    GLYPH_FREE(e);
+}
+
+/**
+ * Drop the least recently used glyphs until the cache is not larger than `size`
+ */
+static void shrink(glyph_cache_t * cache, uint32_t size)
+{
+    while(cache->size > size && cache->lru_tail) {
+        drop_entry(cache, cache->lru_tail);
+        evict_cnt++;
+    }
+}
+
+/**
+ * Convert a glyph bitmap to opacity values the same way `lv_draw_sw_letter()` does.
+ * The pixels are packed continuously, rows don't start on byte boundary.
+ */
+static bool unpack(lv_opa_t * out, const uint8_t * in, uint32_t px_cnt, uint32_t bpp)
+{
+    const uint8_t * table;
+    if(bpp == 3) bpp = 4;
+    switch(bpp) {
+        case 1:
+            table = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            table = _lv_bpp2_opa_table;
+            break;
+        case 4:
+            table = _lv_bpp4_opa_table;
+            break;
+        case 8:
+            lv_memcpy(out, in, px_cnt);
+            return true;
+        default:
+            return false;
+    }
+
+    uint32_t shift = 8 - bpp;
+    uint32_t px_per_byte = 8 / bpp;
+    while(px_cnt >= px_per_byte) {
+        uint8_t b = *in++;
+        uint32_t i;
+        for(i = 0; i < px_per_byte; i++) {
+            *out++ = table[b >> shift];
+            b = (uint8_t)(b << bpp);
+        }
+        px_cnt -= px_per_byte;
+    }
+
+    if(px_cnt) {
+        uint8_t b = *in;
+        while(px_cnt--) {
+            *out++ = table[b >> shift];
+            b = (uint8_t)(b << bpp);
+        }
+    }
+
+    return true;
+}
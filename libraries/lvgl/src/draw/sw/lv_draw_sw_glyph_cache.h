@@ -0,0 +1,81 @@
+/**
+ * @file lv_draw_sw_glyph_cache.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_GLYPH_CACHE_H
+#define LV_DRAW_SW_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_conf_internal.h"
+#include "../../misc/lv_color.h"
+#include "../../font/lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t hit;           /**< Letters drawn from the cache*/
+    uint32_t miss;          /**< Letters which had to be decoded (and were added to the cache if they fit)*/
+    uint32_t evict;         /**< Glyphs dropped to make room for new ones*/
+    uint32_t size;          /**< Bytes used by the cached glyphs*/
+    uint32_t max_size;      /**< Size limit set by `lv_draw_sw_glyph_cache_set_size()`*/
+    uint32_t entry_cnt;     /**< Number of cached glyphs*/
+} lv_draw_sw_glyph_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the size of the glyph cache. The least recently used glyphs are dropped if the new size is smaller.
+ * @param size      size in bytes. 0: disable caching and free all the cached glyphs
+ */
+void lv_draw_sw_glyph_cache_set_size(uint32_t size);
+
+/**
+ * Drop the cached glyphs of a font. Has to be called before a font is freed or its glyphs change.
+ * @param font      pointer to a font or NULL to drop all the glyphs
+ */
+void lv_draw_sw_glyph_cache_invalidate_font(const lv_font_t * font);
+
+/**
+ * Get the state and the hit/miss counters of the glyph cache.
+ * @param stat      store the result here
+ */
+void lv_draw_sw_glyph_cache_get_stat(lv_draw_sw_glyph_cache_stat_t * stat);
+
+/**
+ * Zero the hit, miss and evict counters.
+ */
+void lv_draw_sw_glyph_cache_reset_stat(void);
+
+/**
+ * Get the 8 bit opacity map of a glyph from the cache or decode and add it.
+ * Used internally by `lv_draw_sw_letter()`.
+ * @param g         the resolved glyph descriptor of `letter`
+ * @param letter    the Unicode code point of the glyph
+ * @return          `g->box_w * g->box_h` opacity values or NULL if the glyph can't be cached
+ */
+const lv_opa_t * _lv_draw_sw_glyph_cache_get(const lv_font_glyph_dsc_t * g, uint32_t letter);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_GLYPH_CACHE_H*/
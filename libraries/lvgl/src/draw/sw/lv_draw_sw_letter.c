@@ -29,6 +29,8 @@
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                            const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+static void /* LV_ATTRIBUTE_FAST_MEM */ draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                           const lv_point_t * pos, lv_font_glyph_dsc_t * g, const lv_opa_t * map_p);
 
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
@@ -139,6 +141,19 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
         return;
     }
 
+    /*Reuse the already decoded opacity map of the glyph if possible*/
+    if(!g.resolved_font->subpx
+#if LV_USE_IMGFONT
+       && g.bpp != LV_IMGFONT_BPP
+#endif
+      ) {
+        const lv_opa_t * cached_map_p = _lv_draw_sw_glyph_cache_get(&g, letter);
+        if(cached_map_p) {
+            draw_letter_cached(draw_ctx, dsc, &gpos, &g, cached_map_p);
+            return;
+        }
+    }
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -350,6 +365,115 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     lv_mem_buf_release(mask_buf);
 }
 
+/**
+ * Draw a letter from the 8 bit opacity map of the glyph cache.
+ * Gives the same result as `draw_letter_normal()` but no bpp conversion is required
+ * and without other masks the map is blended directly.
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos, lv_font_glyph_dsc_t * g, const lv_opa_t * map_p)
+{
+    lv_area_t letter_area;
+    letter_area.x1 = pos->x;
+    letter_area.y1 = pos->y;
+    letter_area.x2 = pos->x + g->box_w - 1;
+    letter_area.y2 = pos->y + g->box_h - 1;
+
+    lv_area_t fill_area;
+    if(!_lv_area_intersect(&fill_area, &letter_area, draw_ctx->clip_area)) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+
+    lv_opa_t opa = dsc->opa;
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+#if LV_DRAW_COMPLEX
+    bool mask_any = lv_draw_mask_is_any(&fill_area);
+#else
+    bool mask_any = false;
+#endif
+
+    /*The blend modifies the mask if anti-aliasing is disabled so use the cached map only if it's not the case*/
+    if(!mask_any && opa >= LV_OPA_MAX && disp->driver->antialiasing) {
+        blend_dsc.blend_area = &fill_area;
+        blend_dsc.mask_area = &letter_area;
+        blend_dsc.mask_buf = (lv_opa_t *)map_p;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        return;
+    }
+
+    int32_t box_w = g->box_w;
+    int32_t box_h = g->box_h;
+    lv_coord_t fill_w = lv_area_get_width(&fill_area);
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp);
+    uint32_t mask_buf_size = box_w * box_h > hor_res ? hor_res : box_w * box_h;
+    lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
+    blend_dsc.mask_buf = mask_buf;
+    int32_t mask_p = 0;
+
+    lv_area_t part_area;
+    part_area.x1 = fill_area.x1;
+    part_area.x2 = fill_area.x2;
+    part_area.y1 = fill_area.y1;
+    part_area.y2 = fill_area.y1;
+    blend_dsc.blend_area = &part_area;
+    blend_dsc.mask_area = &part_area;
+
+    map_p += (fill_area.y1 - pos->y) * box_w + (fill_area.x1 - pos->x);
+
+    int32_t row;
+    for(row = fill_area.y1; row <= fill_area.y2; row++) {
+        lv_opa_t * mask_row = mask_buf + mask_p;
+        if(opa >= LV_OPA_MAX) {
+            lv_memcpy(mask_row, map_p, fill_w);
+        }
+        else {
+            int32_t col;
+            for(col = 0; col < fill_w; col++) {
+                mask_row[col] = map_p[col] == LV_OPA_COVER ? opa : ((map_p[col] * opa) >> 8);
+            }
+        }
+
+#if LV_DRAW_COMPLEX
+        /*Apply masks if any*/
+        if(mask_any) {
+            blend_dsc.mask_res = lv_draw_mask_apply(mask_row, part_area.x1, part_area.y2, fill_w);
+            if(blend_dsc.mask_res == LV_DRAW_MASK_RES_TRANSP) {
+                lv_memset_00(mask_row, fill_w);
+            }
+        }
+#endif
+
+        mask_p += fill_w;
+        map_p += box_w;
+
+        if((uint32_t) mask_p + fill_w < mask_buf_size) {
+            part_area.y2 ++;
+        }
+        else {
+            blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+            part_area.y1 = part_area.y2 + 1;
+            part_area.y2 = part_area.y1;
+            mask_p = 0;
+        }
+    }
+
+    /*Flush the last part*/
+    if(part_area.y1 != part_area.y2) {
+        part_area.y2--;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p)
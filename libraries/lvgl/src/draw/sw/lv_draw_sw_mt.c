@@ -0,0 +1,265 @@
+/**
+ * @file lv_draw_sw_mt.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_mt.h"
+#if LV_USE_DRAW_SW_MT
+
+#include <pthread.h>
+#include "../../hal/lv_hal_disp.h"
+#include "../../core/lv_refr.h"
+#include "../../misc/lv_log.h"
+#include "../../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_DRAW_SW_MT_THREAD_CNT < 1
+    #error "LV_DRAW_SW_MT_THREAD_CNT must be at least 1"
+#endif
+
+#define BAND_MAX    (LV_DRAW_SW_MT_THREAD_CNT + 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The helper threads and the blend being rendered in bands.
+ *Only one blend is rendered at a time: the drawing thread waits for all its bands before returning.*/
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t job_cond;        /*Signaled when new bands are posted or on exit*/
+    pthread_cond_t done_cond;       /*Signaled when the last band is ready*/
+    pthread_t threads[LV_DRAW_SW_MT_THREAD_CNT];
+    uint32_t thread_cnt;
+    uint32_t ref_cnt;               /*Number of draw contexts using the threads*/
+    bool exit;
+
+    /*The current job*/
+    lv_draw_ctx_t * draw_ctx;
+    const lv_draw_sw_blend_dsc_t * dsc;
+    lv_area_t bands[BAND_MAX];
+    uint32_t band_cnt;
+    uint32_t band_next;             /*Index of the next band to take*/
+    uint32_t pending;               /*Bands taken by the helpers but not ready yet*/
+} band_pool_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void blend_mt(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+static bool can_split(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, lv_area_t * blend_area);
+static void render_band(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, const lv_area_t * band);
+static void * helper_main(void * arg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static band_pool_t pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .job_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER,
+};
+static uint32_t min_px = LV_DRAW_SW_MT_MIN_PX;
+static uint32_t split_cnt;
+static uint32_t serial_cnt;
+static uint32_t helper_band_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_mt_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+
+    lv_draw_sw_mt_ctx_t * mt_draw_ctx = (lv_draw_sw_mt_ctx_t *)draw_ctx;
+    mt_draw_ctx->blend = blend_mt;
+
+    pool.ref_cnt++;
+    if(pool.ref_cnt > 1) return;
+
+    pool.exit = false;
+    pool.band_cnt = 0;
+    pool.band_next = 0;
+    pool.pending = 0;
+    for(pool.thread_cnt = 0; pool.thread_cnt < LV_DRAW_SW_MT_THREAD_CNT; pool.thread_cnt++) {
+        if(pthread_create(&pool.threads[pool.thread_cnt], NULL, helper_main, NULL) != 0) {
+            LV_LOG_WARN("couldn't start a helper thread, %"LV_PRIu32" are running", pool.thread_cnt);
+            break;
+        }
+    }
+}
+
+void lv_draw_sw_mt_ctx_deinit(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    LV_ASSERT(pool.ref_cnt > 0);
+    pool.ref_cnt--;
+    if(pool.ref_cnt == 0) {
+        pthread_mutex_lock(&pool.lock);
+        pool.exit = true;
+        pthread_cond_broadcast(&pool.job_cond);
+        pthread_mutex_unlock(&pool.lock);
+
+        uint32_t i;
+        for(i = 0; i < pool.thread_cnt; i++) {
+            pthread_join(pool.threads[i], NULL);
+        }
+        pool.thread_cnt = 0;
+    }
+
+    lv_draw_sw_deinit_ctx(drv, draw_ctx);
+}
+
+void lv_draw_sw_mt_set_min_px(uint32_t px)
+{
+    min_px = px;
+}
+
+void lv_draw_sw_mt_get_stat(lv_draw_sw_mt_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    pthread_mutex_lock(&pool.lock);
+    stat->split = split_cnt;
+    stat->serial = serial_cnt;
+    stat->helper_bands = helper_band_cnt;
+    stat->thread_cnt = pool.thread_cnt;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+void lv_draw_sw_mt_reset_stat(void)
+{
+    pthread_mutex_lock(&pool.lock);
+    split_cnt = 0;
+    serial_cnt = 0;
+    helper_band_cnt = 0;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void blend_mt(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_area_t blend_area;
+    if(!can_split(draw_ctx, dsc, &blend_area)) {
+        serial_cnt++;
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    /*Split the rows evenly, the first bands get the remaining rows*/
+    uint32_t h = lv_area_get_height(&blend_area);
+    uint32_t band_cnt = LV_MIN(pool.thread_cnt + 1, h);
+    uint32_t band_h = h / band_cnt;
+    uint32_t rest = h % band_cnt;
+    lv_coord_t y = blend_area.y1;
+
+    pthread_mutex_lock(&pool.lock);
+    uint32_t i;
+    for(i = 0; i < band_cnt; i++) {
+        pool.bands[i] = blend_area;
+        pool.bands[i].y1 = y;
+        y += band_h + (i < rest ? 1 : 0);
+        pool.bands[i].y2 = y - 1;
+    }
+    pool.draw_ctx = draw_ctx;
+    pool.dsc = dsc;
+    pool.band_cnt = band_cnt;
+    pool.band_next = 1;     /*The first band is always rendered here*/
+    split_cnt++;
+    pthread_cond_broadcast(&pool.job_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    render_band(draw_ctx, dsc, &pool.bands[0]);
+
+    /*Take the bands the helpers haven't started yet (e.g. they are busy on an other core)
+     *and wait for the others*/
+    pthread_mutex_lock(&pool.lock);
+    while(pool.band_next < pool.band_cnt) {
+        uint32_t band = pool.band_next++;
+        pthread_mutex_unlock(&pool.lock);
+        render_band(draw_ctx, dsc, &pool.bands[band]);
+        pthread_mutex_lock(&pool.lock);
+    }
+    while(pool.pending > 0) {
+        pthread_cond_wait(&pool.done_cond, &pool.lock);
+    }
+    pool.band_cnt = 0;
+    pool.band_next = 0;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+/**
+ * Check if a blend is worth splitting and its pixels can be calculated independently
+ * @param draw_ctx      the draw context
+ * @param dsc           the blend
+ * @param blend_area    store the clipped area of the blend here
+ * @return              true: the blend can be rendered in bands
+ */
+static bool can_split(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, lv_area_t * blend_area)
+{
+    if(pool.thread_cnt == 0) return false;
+    if(dsc->mask_buf && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return false;
+    if(!_lv_area_intersect(blend_area, dsc->blend_area, draw_ctx->clip_area)) return false;
+    if(lv_area_get_height(blend_area) < 2 || lv_area_get_size(blend_area) < min_px) return false;
+
+    /*`set_px_cb` is the user's code, the ARGB blending uses static variables
+     *and without anti-aliasing the whole mask is modified in place*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp->driver->set_px_cb) return false;
+    if(disp->driver->screen_transp) return false;
+    if(dsc->mask_buf && dsc->mask_res != LV_DRAW_MASK_RES_FULL_COVER && disp->driver->antialiasing == 0) return false;
+
+    return true;
+}
+
+/**
+ * Render a band of a blend. The pixels are calculated by `lv_draw_sw_blend_basic()`
+ * with the band as clip area, so the mask and source buffers are addressed as usual.
+ */
+static void render_band(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, const lv_area_t * band)
+{
+    lv_draw_sw_ctx_t band_ctx = *(lv_draw_sw_ctx_t *)draw_ctx;
+    band_ctx.base_draw.clip_area = band;
+    lv_draw_sw_blend_basic(&band_ctx.base_draw, dsc);
+}
+
+static void * helper_main(void * arg)
+{
+    LV_UNUSED(arg);
+
+    pthread_mutex_lock(&pool.lock);
+    while(1) {
+        while(!pool.exit && pool.band_next >= pool.band_cnt) {
+            pthread_cond_wait(&pool.job_cond, &pool.lock);
+        }
+        if(pool.exit) break;
+
+        uint32_t band = pool.band_next++;
+        pool.pending++;
+        helper_band_cnt++;
+        pthread_mutex_unlock(&pool.lock);
+
+        render_band(pool.draw_ctx, pool.dsc, &pool.bands[band]);
+
+        pthread_mutex_lock(&pool.lock);
+        pool.pending--;
+        if(pool.pending == 0) pthread_cond_signal(&pool.done_cond);
+    }
+    pthread_mutex_unlock(&pool.lock);
+
+    return NULL;
+}
+
+#endif /*LV_USE_DRAW_SW_MT*/
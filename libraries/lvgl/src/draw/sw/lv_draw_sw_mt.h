@@ -0,0 +1,91 @@
+/**
+ * @file lv_draw_sw_mt.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_MT_H
+#define LV_DRAW_SW_MT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_MT
+
+#include "lv_draw_sw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * The software draw context with the large blends split to horizontal bands.
+ * The bands are disjoint and each pixel is calculated exactly as by `lv_draw_sw_blend_basic()`
+ * so the result is the same as with a single thread, independently from the timing of the threads.
+ */
+typedef lv_draw_sw_ctx_t lv_draw_sw_mt_ctx_t;
+
+typedef struct {
+    uint32_t split;         /**< Blends rendered in bands in parallel*/
+    uint32_t serial;        /**< Blends rendered by the drawing thread only (too small or not splittable)*/
+    uint32_t helper_bands;  /**< Bands rendered by the helper threads*/
+    uint32_t thread_cnt;    /**< Number of running helper threads*/
+} lv_draw_sw_mt_stat_t;
+
+struct _lv_disp_drv_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a parallel software draw context. The helper threads are started with the first context.
+ * @param drv       pointer to a display driver
+ * @param draw_ctx  pointer to a draw context with `sizeof(lv_draw_sw_mt_ctx_t)` size
+ */
+void lv_draw_sw_mt_ctx_init(struct _lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+
+/**
+ * Deinitialize a parallel software draw context. The helper threads are stopped with the last context.
+ * @param drv       pointer to a display driver
+ * @param draw_ctx  pointer to an initialized draw context
+ */
+void lv_draw_sw_mt_ctx_deinit(struct _lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+
+/**
+ * Set the minimal size of the blends which are split to bands.
+ * @param px        size in pixels. 0: split every blend with at least 2 rows; `UINT32_MAX`: don't split any blends
+ */
+void lv_draw_sw_mt_set_min_px(uint32_t px);
+
+/**
+ * Get the counters of the parallel rendering.
+ * @param stat      store the result here
+ */
+void lv_draw_sw_mt_get_stat(lv_draw_sw_mt_stat_t * stat);
+
+/**
+ * Zero the split, serial and band counters.
+ */
+void lv_draw_sw_mt_reset_stat(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW_MT*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_MT_H*/
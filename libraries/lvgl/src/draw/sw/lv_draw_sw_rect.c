@@ -39,6 +39,8 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_shadow(lv_draw_ctx_t * draw_ctx, co
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf,
                                                                lv_coord_t s, lv_coord_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf);
+static void blend_corner_row(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc,
+                             const lv_draw_mask_radius_param_t * mask_param, lv_opa_t opa);
 #endif
 
 void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
@@ -254,7 +256,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
             if(dither_func) dither_func(grad, blend_area.x1,  top_y - bg_coords.y1, grad_size);
 #endif
             if(grad_dir == LV_GRAD_DIR_VER) blend_dsc.color = grad->map[top_y - bg_coords.y1];
-            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            blend_corner_row(draw_ctx, &blend_dsc, &mask_rout_param, opa);
         }
 
         if(bottom_y <= clipped_coords.y2) {
@@ -265,7 +267,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
             if(dither_func) dither_func(grad, blend_area.x1,  bottom_y - bg_coords.y1, grad_size);
 #endif
             if(grad_dir == LV_GRAD_DIR_VER) blend_dsc.color = grad->map[bottom_y - bg_coords.y1];
-            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            blend_corner_row(draw_ctx, &blend_dsc, &mask_rout_param, opa);
         }
     }
 
@@ -321,6 +323,62 @@ bg_clean_up:
 #endif
 }
 
+#if LV_DRAW_COMPLEX
+/**
+ * Blend a row of the rounded corners where the mask is the radius mask of the rectangle only.
+ * Only the anti-aliased ends are blended with the mask, the fully covered span between them
+ * is filled without it, which is much faster on wide rows.
+ * @param draw_ctx      pointer to a draw context
+ * @param blend_dsc     blend descriptor of the row with the calculated mask
+ * @param mask_param    the radius mask of the rectangle
+ * @param opa           opacity of the rectangle (the mask buffer was initialized with it)
+ */
+static void blend_corner_row(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc,
+                             const lv_draw_mask_radius_param_t * mask_param, lv_opa_t opa)
+{
+    const lv_area_t * row = blend_dsc->blend_area;
+    lv_coord_t cover_x1;
+    lv_coord_t cover_x2;
+
+    /*Gradients and dithering use a per pixel color map which is not split*/
+    if(blend_dsc->src_buf || blend_dsc->mask_res == LV_DRAW_MASK_RES_TRANSP ||
+       !lv_draw_mask_radius_get_cover(mask_param, row->y1, &cover_x1, &cover_x2)) {
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+        return;
+    }
+
+    cover_x1 = LV_MAX(cover_x1, row->x1);
+    cover_x2 = LV_MIN(cover_x2, row->x2);
+    if(cover_x1 > cover_x2) {
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+        return;
+    }
+
+    lv_draw_sw_blend_dsc_t span_dsc = *blend_dsc;
+    lv_area_t span = *row;
+    span_dsc.blend_area = &span;
+    span_dsc.mask_area = row;
+
+    if(cover_x1 > row->x1) {
+        span.x2 = cover_x1 - 1;
+        lv_draw_sw_blend(draw_ctx, &span_dsc);
+    }
+
+    if(cover_x2 < row->x2) {
+        span.x1 = cover_x2 + 1;
+        span.x2 = row->x2;
+        lv_draw_sw_blend(draw_ctx, &span_dsc);
+    }
+
+    span.x1 = cover_x1;
+    span.x2 = cover_x2;
+    span_dsc.mask_buf = NULL;
+    span_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    span_dsc.opa = opa;
+    lv_draw_sw_blend(draw_ctx, &span_dsc);
+}
+#endif
+
 static void draw_bg_img(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
 {
     if(dsc->bg_img_src == NULL) return;
@@ -97,6 +97,7 @@ static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_ffmpeg_player_class = {
+    .name = "ffmpeg_player",
     .constructor_cb = lv_ffmpeg_player_constructor,
     .destructor_cb = lv_ffmpeg_player_destructor,
     .instance_size = sizeof(lv_ffmpeg_player_t),
@@ -76,6 +76,12 @@ void lv_fs_littlefs_init(void)
     /*Set up fields...*/
     fs_drv.letter = LV_FS_LITTLEFS_LETTER;
     fs_drv.cache_size = LV_FS_LITTLEFS_CACHE_SIZE;
+#if LV_FS_BLOCK_CACHE
+    fs_drv.block_cache = 1;
+#ifdef LFS_THREADSAFE
+    fs_drv.thread_safe = 1;     /*The read ahead thread uses the same lfs_t, so only with the lfs_config lock*/
+#endif
+#endif
 
     fs_drv.open_cb = fs_open;
     fs_drv.close_cb = fs_close;
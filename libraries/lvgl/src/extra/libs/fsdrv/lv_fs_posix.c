@@ -72,6 +72,10 @@ void lv_fs_posix_init(void)
     /*Set up fields...*/
     fs_drv.letter = LV_FS_POSIX_LETTER;
     fs_drv.cache_size = LV_FS_POSIX_CACHE_SIZE;
+#if LV_FS_BLOCK_CACHE
+    fs_drv.block_cache = 1;
+    fs_drv.thread_safe = 1;     /*Every file has its own descriptor*/
+#endif
 
     fs_drv.open_cb = fs_open;
     fs_drv.close_cb = fs_close;
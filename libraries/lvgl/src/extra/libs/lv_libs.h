@@ -19,6 +19,7 @@ extern "C" {
 #include "gif/lv_gif.h"
 #include "qrcode/lv_qrcode.h"
 #include "sjpg/lv_sjpg.h"
+#include "rle_img/lv_rle_img.h"
 #include "freetype/lv_freetype.h"
 #include "rlottie/lv_rlottie.h"
 #include "ffmpeg/lv_ffmpeg.h"
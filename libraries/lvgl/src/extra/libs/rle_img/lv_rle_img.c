@@ -0,0 +1,368 @@
+/**
+ * @file lv_rle_img.c
+ * Decoder of pre-decoded RGB565 images compressed with run-length encoding.
+ *
+ * The format (little endian):
+ * - [0..3]     "LVRL"
+ * - [4]        version: 1
+ * - [5]        flags: `LV_RLE_IMG_FLAG_...`
+ * - [6..7]     width
+ * - [8..9]     height
+ * - [10..11]   reserved: 0
+ * - (height + 1) x 4 bytes: offset of the rows from the beginning of the image. The last one is the end of the data.
+ * - the rows. A row is a series of packets starting with a control byte:
+ *   - bit 7 is 1: the next pixel is repeated (ctrl & 0x7F) + 1 times
+ *   - bit 7 is 0: ctrl + 1 different pixels follow
+ *   A pixel is RGB565 on 2 bytes followed by the opacity on 1 byte with `LV_RLE_IMG_FLAG_ALPHA`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_RLE_IMG
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define RLE_VERSION     1
+#define RLE_RUN         0x80
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const uint8_t * data;   /*The image in a C array*/
+    uint32_t data_size;
+    uint8_t flags;
+    lv_coord_t row_y;       /*The row decoded to `row_buf` or -1*/
+    uint8_t * row_buf;
+} rle_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static uint32_t read_u32(const uint8_t * p);
+static lv_res_t parse_header(const uint8_t * data, uint32_t data_size, lv_img_header_t * header, uint8_t * flags);
+static uint8_t * load_file(const char * fn, uint32_t * size);
+static lv_res_t decode_row(const uint8_t * data, uint32_t data_size, uint8_t flags, lv_coord_t w, lv_coord_t y,
+                           uint8_t * out);
+static void convert_px(const uint8_t * in, uint8_t * out, uint8_t flags);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#define IN_PX_SIZE(flags)   ((flags) & LV_RLE_IMG_FLAG_ALPHA ? 3 : 2)
+#define OUT_PX_SIZE(flags)  ((flags) & LV_RLE_IMG_FLAG_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_rle_img_init(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, decoder_info);
+    lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_close_cb(dec, decoder_close);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get info about an RLE image
+ * @param src can be file name or pointer to a C array
+ * @param header store the info here
+ * @return LV_RES_OK: no error; LV_RES_INV: can't get the info
+ */
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+
+    uint8_t flags;
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_FILE) {
+        const char * fn = src;
+        if(strcmp(lv_fs_get_ext(fn), "rle") != 0) return LV_RES_INV;
+
+        lv_fs_file_t f;
+        if(lv_fs_open(&f, fn, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+
+        /*Only the header is read, the size is needed to check the row offset table*/
+        uint8_t buf[LV_RLE_IMG_HEADER_SIZE];
+        uint32_t rn = 0;
+        uint32_t size = 0;
+        lv_fs_read(&f, buf, sizeof(buf), &rn);
+        lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+        lv_fs_tell(&f, &size);
+        lv_fs_close(&f);
+        if(rn != sizeof(buf)) return LV_RES_INV;
+
+        return parse_header(buf, size, header, &flags);
+    }
+    else if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = src;
+        return parse_header(img_dsc->data, img_dsc->data_size, header, &flags);
+    }
+
+    return LV_RES_INV;
+}
+
+/**
+ * Open an RLE image. Files are decoded at once, C arrays only prepare to decode rows in `decoder_read_line()`.
+ */
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    lv_img_header_t header;
+    uint8_t flags;
+
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        if(parse_header(img_dsc->data, img_dsc->data_size, &header, &flags) != LV_RES_OK) return LV_RES_INV;
+
+        rle_dsc_t * rle = lv_mem_alloc(sizeof(rle_dsc_t));
+        LV_ASSERT_MALLOC(rle);
+        if(rle == NULL) return LV_RES_INV;
+
+        rle->row_buf = lv_mem_alloc(header.w * OUT_PX_SIZE(flags));
+        LV_ASSERT_MALLOC(rle->row_buf);
+        if(rle->row_buf == NULL) {
+            lv_mem_free(rle);
+            return LV_RES_INV;
+        }
+
+        rle->data = img_dsc->data;
+        rle->data_size = img_dsc->data_size;
+        rle->flags = flags;
+        rle->row_y = -1;
+        dsc->user_data = rle;
+        dsc->img_data = NULL;
+        return LV_RES_OK;
+    }
+    else if(dsc->src_type == LV_IMG_SRC_FILE) {
+        const char * fn = dsc->src;
+        if(strcmp(lv_fs_get_ext(fn), "rle") != 0) return LV_RES_INV;
+
+        uint32_t size;
+        uint8_t * data = load_file(fn, &size);
+        if(data == NULL) return LV_RES_INV;
+
+        if(parse_header(data, size, &header, &flags) != LV_RES_OK) {
+            lv_mem_free(data);
+            return LV_RES_INV;
+        }
+
+        uint8_t * img_data = lv_mem_alloc(lv_img_buf_get_img_size(header.w, header.h, header.cf));
+        LV_ASSERT_MALLOC(img_data);
+        if(img_data == NULL) {
+            lv_mem_free(data);
+            return LV_RES_INV;
+        }
+
+        uint32_t row_size = header.w * OUT_PX_SIZE(flags);
+        lv_coord_t y;
+        for(y = 0; y < header.h; y++) {
+            if(decode_row(data, size, flags, header.w, y, img_data + y * row_size) != LV_RES_OK) {
+                LV_LOG_WARN("invalid row %d in %s", y, fn);
+                lv_mem_free(img_data);
+                lv_mem_free(data);
+                return LV_RES_INV;
+            }
+        }
+
+        lv_mem_free(data);
+        dsc->img_data = img_data;
+        return LV_RES_OK;
+    }
+
+    return LV_RES_INV;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    rle_dsc_t * rle = dsc->user_data;
+    if(rle == NULL) return LV_RES_INV;
+
+    /*The draw functions read the same row again for every clip area, so keep the last one*/
+    if(rle->row_y != y) {
+        if(decode_row(rle->data, rle->data_size, rle->flags, dsc->header.w, y, rle->row_buf) != LV_RES_OK) {
+            rle->row_y = -1;
+            return LV_RES_INV;
+        }
+        rle->row_y = y;
+    }
+
+    uint32_t px_size = OUT_PX_SIZE(rle->flags);
+    lv_memcpy(buf, rle->row_buf + x * px_size, len * px_size);
+    return LV_RES_OK;
+}
+
+/**
+ * Free the allocated resources
+ */
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    rle_dsc_t * rle = dsc->user_data;
+    if(rle) {
+        lv_mem_free(rle->row_buf);
+        lv_mem_free(rle);
+        dsc->user_data = NULL;
+    }
+
+    if(dsc->img_data) {
+        lv_mem_free((uint8_t *)dsc->img_data);
+        dsc->img_data = NULL;
+    }
+}
+
+static uint32_t read_u32(const uint8_t * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static lv_res_t parse_header(const uint8_t * data, uint32_t data_size, lv_img_header_t * header, uint8_t * flags)
+{
+    if(data == NULL || data_size < LV_RLE_IMG_HEADER_SIZE) return LV_RES_INV;
+    if(memcmp(data, "LVRL", 4) != 0 || data[4] != RLE_VERSION) return LV_RES_INV;
+
+    uint32_t w = data[6] | (data[7] << 8);
+    uint32_t h = data[8] | (data[9] << 8);
+    /*The size has 11 bits in `lv_img_header_t`*/
+    if(w == 0 || h == 0 || w > 2047 || h > 2047) return LV_RES_INV;
+    if(data_size < LV_RLE_IMG_HEADER_SIZE + (h + 1) * 4) return LV_RES_INV;
+
+    *flags = data[5];
+    header->always_zero = 0;
+    header->cf = *flags & LV_RLE_IMG_FLAG_ALPHA ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+    header->w = w;
+    header->h = h;
+    return LV_RES_OK;
+}
+
+static uint8_t * load_file(const char * fn, uint32_t * size)
+{
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, fn, LV_FS_MODE_RD) != LV_FS_RES_OK) return NULL;
+
+    *size = 0;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+
+    uint8_t * data = *size ? lv_mem_alloc(*size) : NULL;
+    if(data) {
+        uint32_t rn = 0;
+        lv_fs_read(&f, data, *size, &rn);
+        if(rn != *size) {
+            lv_mem_free(data);
+            data = NULL;
+        }
+    }
+
+    lv_fs_close(&f);
+    return data;
+}
+
+/**
+ * Decode a row of an RLE image
+ * @param data      the whole RLE image
+ * @param data_size size of `data` in bytes
+ * @param flags     `LV_RLE_IMG_FLAG_...` from the header
+ * @param w         width of the image
+ * @param y         index of the row to decode
+ * @param out       store `w` pixels here in `LV_IMG_CF_TRUE_COLOR(_ALPHA)` format
+ * @return          LV_RES_OK: decoded; LV_RES_INV: the data is corrupt
+ */
+static lv_res_t decode_row(const uint8_t * data, uint32_t data_size, uint8_t flags, lv_coord_t w, lv_coord_t y,
+                           uint8_t * out)
+{
+    const uint8_t * row_ofs = data + LV_RLE_IMG_HEADER_SIZE + y * 4;
+    uint32_t start = read_u32(row_ofs);
+    uint32_t end = read_u32(row_ofs + 4);
+    if(start > end || end > data_size) return LV_RES_INV;
+
+    const uint8_t * in = data + start;
+    const uint8_t * in_end = data + end;
+    uint32_t in_px_size = IN_PX_SIZE(flags);
+    uint32_t out_px_size = OUT_PX_SIZE(flags);
+
+#if LV_COLOR_DEPTH == 16
+    /*The pixels can be copied as they are*/
+    bool direct = ((flags & LV_RLE_IMG_FLAG_SWAP) != 0) == (LV_COLOR_16_SWAP != 0);
+#else
+    bool direct = false;
+#endif
+
+    int32_t remaining = w;
+    while(remaining > 0) {
+        if(in >= in_end) return LV_RES_INV;
+
+        uint8_t ctrl = *in;
+        in++;
+        int32_t cnt = (ctrl & 0x7F) + 1;
+        if(cnt > remaining) return LV_RES_INV;
+
+        int32_t i;
+        if(ctrl & RLE_RUN) {
+            if(in_end - in < (int32_t)in_px_size) return LV_RES_INV;
+            convert_px(in, out, flags);
+            for(i = 1; i < cnt; i++) lv_memcpy_small(out + i * out_px_size, out, out_px_size);
+            in += in_px_size;
+        }
+        else {
+            if(in_end - in < (int32_t)(cnt * in_px_size)) return LV_RES_INV;
+            if(direct) {
+                lv_memcpy(out, in, cnt * in_px_size);
+            }
+            else {
+                for(i = 0; i < cnt; i++) convert_px(in + i * in_px_size, out + i * out_px_size, flags);
+            }
+            in += cnt * in_px_size;
+        }
+
+        out += cnt * out_px_size;
+        remaining -= cnt;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Convert an RGB565 (and alpha) pixel to `lv_color_t` (and alpha)
+ */
+static void convert_px(const uint8_t * in, uint8_t * out, uint8_t flags)
+{
+    uint32_t c16 = flags & LV_RLE_IMG_FLAG_SWAP ? (in[0] << 8) | in[1] : (in[1] << 8) | in[0];
+    uint32_t r = (c16 >> 11) & 0x1F;
+    uint32_t g = (c16 >> 5) & 0x3F;
+    uint32_t b = c16 & 0x1F;
+
+    /*Repeat the high bits to make 255 from 31 and 63*/
+    lv_color_t c = lv_color_make((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    lv_memcpy_small(out, &c, sizeof(c));
+    if(flags & LV_RLE_IMG_FLAG_ALPHA) out[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = in[2];
+}
+
+#endif /*LV_USE_RLE_IMG*/
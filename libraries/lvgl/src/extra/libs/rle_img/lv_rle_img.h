@@ -0,0 +1,54 @@
+/**
+ * @file lv_rle_img.h
+ *
+ */
+
+#ifndef LV_RLE_IMG_H
+#define LV_RLE_IMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_RLE_IMG
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Size of the header of an RLE image. The row offset table and the rows follow it.*/
+#define LV_RLE_IMG_HEADER_SIZE  12
+
+#define LV_RLE_IMG_FLAG_ALPHA   0x01    /*An 8 bit opacity follows every pixel*/
+#define LV_RLE_IMG_FLAG_SWAP    0x02    /*The RGB565 pixels are stored with the high byte first*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the decoder of the pre-decoded, run-length encoded RGB565 images created by `scripts/png_to_rle.py`.
+ * C arrays are decoded row by row while drawing and don't use RAM except one row.
+ * `.rle` files are decoded to the RAM at once, so they stay in the image cache.
+ */
+void lv_rle_img_init(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_RLE_IMG*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_RLE_IMG_H*/
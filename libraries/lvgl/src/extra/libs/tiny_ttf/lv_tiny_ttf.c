@@ -2,7 +2,12 @@
 
 #if LV_USE_TINY_TTF
 #include <stdio.h>
-#include "../../../misc/lv_lru.h"
+#include <string.h>
+#include "../../../draw/sw/lv_draw_sw_glyph_cache.h"
+
+#if LV_TINY_TTF_CACHE_CUSTOM
+    #include LV_TINY_TTF_CACHE_CUSTOM_INCLUDE
+#endif
 
 #define STB_RECT_PACK_IMPLEMENTATION
 #define STBRP_STATIC
@@ -16,6 +21,18 @@
 #define TTF_MALLOC(x) (lv_mem_alloc(x))
 #define TTF_FREE(x) (lv_mem_free(x))
 
+#if LV_TINY_TTF_CACHE_CUSTOM
+    #define CACHE_ALLOC(size) LV_TINY_TTF_CACHE_CUSTOM_ALLOC(size)
+    #define CACHE_FREE(p) LV_TINY_TTF_CACHE_CUSTOM_FREE(p)
+#else
+    #define CACHE_ALLOC(size) lv_mem_alloc(size)
+    #define CACHE_FREE(p) lv_mem_free(p)
+#endif
+
+/*Must be power of 2*/
+#define GLYPH_BUCKET_CNT 64
+#define KERN_CACHE_CNT 64
+
 #if LV_TINY_TTF_FILE_SUPPORT
 /* a hydra stream that can be in memory or from a file*/
 typedef struct ttf_cb_stream {
@@ -63,7 +80,18 @@ static void ttf_cb_stream_seek(ttf_cb_stream_t * stream, size_t position)
 #include "stb_rect_pack.h"
 #include "stb_truetype_htcw.h"
 
-typedef struct ttf_font_desc {
+typedef struct ttf_kern {
+    uint16_t g1;    /*0: empty slot*/
+    uint16_t g2;
+    int16_t kern;
+} ttf_kern_t;
+
+/* the font data, shared by the fonts created from the same file or data at any size*/
+typedef struct ttf_face {
+    struct ttf_face * next;
+    uint32_t ref_cnt;
+    const void * data;  /*the font data or NULL if streamed from a file*/
+    char * path;        /*the path of the file or NULL*/
     lv_fs_file_t file;
 #if LV_TINY_TTF_FILE_SUPPORT
     ttf_cb_stream_t stream;
@@ -71,16 +99,186 @@ typedef struct ttf_font_desc {
     const uint8_t * stream;
 #endif
     stbtt_fontinfo info;
-    float scale;
     int ascent;
     int descent;
-    lv_lru_t * bitmap_cache;
+    int line_gap;
+    bool has_kern;
+    ttf_kern_t kern_cache[KERN_CACHE_CNT];  /*the recently used kerning pairs*/
+} ttf_face_t;
+
+typedef struct ttf_font_desc {
+    ttf_face_t * face;
+    lv_coord_t size;
+    float scale;
 } ttf_font_desc_t;
 
-typedef struct ttf_bitmap_cache_key {
-    uint32_t unicode_letter;
-    lv_coord_t line_height;
-} ttf_bitmap_cache_key_t;
+/* the metrics and the rendered bitmap of a letter at a font size*/
+typedef struct ttf_glyph {
+    struct ttf_glyph * bucket_next;
+    struct ttf_glyph * lru_prev;    /*towards the most recently used*/
+    struct ttf_glyph * lru_next;    /*towards the least recently used*/
+    const ttf_face_t * face;
+    uint32_t letter;
+    lv_coord_t size;
+    int glyph_id;                   /*0: the font has no glyph for the letter*/
+    int adv;                        /*advance width in font units*/
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint16_t box_w;
+    uint16_t box_h;
+    uint8_t * bitmap;               /*`box_w * box_h` opacity values or NULL if not rendered yet*/
+} ttf_glyph_t;
+
+/* the glyphs of all the faces and sizes share one size limit*/
+typedef struct ttf_cache {
+    ttf_glyph_t * bucket[GLYPH_BUCKET_CNT];
+    ttf_glyph_t * lru_head;
+    ttf_glyph_t * lru_tail;
+    uint32_t size;
+    uint32_t entry_cnt;
+    uint32_t max_size;
+    uint32_t hit;
+    uint32_t miss;
+    uint32_t bitmap_hit;
+    uint32_t bitmap_miss;
+    uint32_t evict;
+    uint8_t * scratch;              /*renders the bitmaps which don't fit into the cache*/
+    uint32_t scratch_size;
+} ttf_cache_t;
+
+static ttf_face_t * face_list;
+static ttf_cache_t cache = {.max_size = LV_TINY_TTF_CACHE_SIZE};
+
+static uint32_t get_bucket_id(const ttf_face_t * face, lv_coord_t size, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)face >> 2) ^ ((uint32_t)size << 21) ^ (letter * 2654435761u);
+    return (h ^ (h >> 16)) & (GLYPH_BUCKET_CNT - 1);
+}
+
+static void lru_unlink(ttf_glyph_t * g)
+{
+    if(g->lru_prev) g->lru_prev->lru_next = g->lru_next;
+    else cache.lru_head = g->lru_next;
+
+    if(g->lru_next) g->lru_next->lru_prev = g->lru_prev;
+    else cache.lru_tail = g->lru_prev;
+}
+
+static void lru_push_head(ttf_glyph_t * g)
+{
+    g->lru_prev = NULL;
+    g->lru_next = cache.lru_head;
+    if(cache.lru_head) cache.lru_head->lru_prev = g;
+    else cache.lru_tail = g;
+    cache.lru_head = g;
+}
+
+static void drop_glyph(ttf_glyph_t * g)
+{
+    ttf_glyph_t ** p = &cache.bucket[get_bucket_id(g->face, g->size, g->letter)];
+    while(*p != g) p = &(*p)->bucket_next;
+    *p = g->bucket_next;
+
+    lru_unlink(g);
+    cache.size -= sizeof(ttf_glyph_t);
+    if(g->bitmap) {
+        cache.size -= (uint32_t)g->box_w * g->box_h;
+        CACHE_FREE(g->bitmap);
+    }
+    cache.entry_cnt--;
+    CACHE_FREE(g);
+}
+
+/* drop the least recently used glyphs, except `keep`, until the cache is not larger than `size`*/
+static void shrink(uint32_t size, const ttf_glyph_t * keep)
+{
+    ttf_glyph_t * g = cache.lru_tail;
+    while(cache.size > size && g) {
+        ttf_glyph_t * prev = g->lru_prev;
+        if(g != keep) {
+            drop_glyph(g);
+            cache.evict++;
+        }
+        g = prev;
+    }
+}
+
+static void load_glyph(const ttf_font_desc_t * dsc, uint32_t unicode_letter, ttf_glyph_t * g)
+{
+    const stbtt_fontinfo * info = &dsc->face->info;
+    g->face = dsc->face;
+    g->letter = unicode_letter;
+    g->size = dsc->size;
+    g->bitmap = NULL;
+    g->glyph_id = stbtt_FindGlyphIndex(info, (int)unicode_letter);
+    if(g->glyph_id == 0) {
+        /* Glyph not found, cached too to not search for it again*/
+        g->adv = 0;
+        g->ofs_x = 0;
+        g->ofs_y = 0;
+        g->box_w = 0;
+        g->box_h = 0;
+        return;
+    }
+
+    int lsb;
+    stbtt_GetGlyphHMetrics(info, g->glyph_id, &g->adv, &lsb);
+    int x1, y1, x2, y2;
+    stbtt_GetGlyphBitmapBox(info, g->glyph_id, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    g->box_w = (uint16_t)(x2 - x1 + 1);
+    g->box_h = (uint16_t)(y2 - y1 + 1);
+    g->ofs_x = (int16_t)x1;
+    g->ofs_y = (int16_t)(-y2);
+}
+
+/* get a glyph from the cache or load and add it. `tmp` is used if the glyph can't be cached*/
+static ttf_glyph_t * get_glyph(const ttf_font_desc_t * dsc, uint32_t unicode_letter, ttf_glyph_t * tmp)
+{
+    ttf_glyph_t ** bucket = &cache.bucket[get_bucket_id(dsc->face, dsc->size, unicode_letter)];
+    ttf_glyph_t * g;
+    for(g = *bucket; g; g = g->bucket_next) {
+        if(g->face == dsc->face && g->size == dsc->size && g->letter == unicode_letter) {
+            cache.hit++;
+            if(cache.lru_head != g) {
+                lru_unlink(g);
+                lru_push_head(g);
+            }
+            return g;
+        }
+    }
+
+    cache.miss++;
+    g = NULL;
+    if(cache.max_size >= sizeof(ttf_glyph_t)) {
+        shrink(cache.max_size - sizeof(ttf_glyph_t), NULL);
+        g = CACHE_ALLOC(sizeof(ttf_glyph_t));
+    }
+    if(g == NULL) {
+        load_glyph(dsc, unicode_letter, tmp);
+        return tmp;
+    }
+
+    load_glyph(dsc, unicode_letter, g);
+    g->bucket_next = *bucket;
+    *bucket = g;
+    lru_push_head(g);
+    cache.size += sizeof(ttf_glyph_t);
+    cache.entry_cnt++;
+    return g;
+}
+
+static int get_kern(ttf_face_t * face, int g1, int g2)
+{
+    if(!face->has_kern || g1 == 0 || g2 == 0) return 0;
+
+    ttf_kern_t * k = &face->kern_cache[((uint32_t)g1 * 31 + (uint32_t)g2) & (KERN_CACHE_CNT - 1)];
+    if(k->g1 != g1 || k->g2 != g2) {
+        k->g1 = (uint16_t)g1;
+        k->g2 = (uint16_t)g2;
+        k->kern = (int16_t)stbtt_GetGlyphKernAdvance(&face->info, g1, g2);
+    }
+    return k->kern;
+}
 
 static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                  uint32_t unicode_letter_next)
@@ -98,129 +296,199 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
         return true;
     }
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    int g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
-    if(g1 == 0) {
+    ttf_glyph_t tmp;
+    ttf_glyph_t * g = get_glyph(dsc, unicode_letter, &tmp);
+    if(g->glyph_id == 0) {
         /* Glyph not found */
         return false;
     }
-    int x1, y1, x2, y2;
+    /*Copy the metrics before looking up the next letter as it might evict this glyph*/
+    int g1 = g->glyph_id;
+    int advw = g->adv;
+    dsc_out->box_w = g->box_w;  /*width of the bitmap in [px]*/
+    dsc_out->box_h = g->box_h;  /*height of the bitmap in [px]*/
+    dsc_out->ofs_x = g->ofs_x;  /*X offset of the bitmap in [pf]*/
+    dsc_out->ofs_y = g->ofs_y;  /*Y offset of the bitmap measured from the as line*/
+    dsc_out->bpp = 8;           /*Bits per pixel: 1/2/4/8*/
+    dsc_out->is_placeholder = false;
 
-    stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-    int g2 = 0;
-    if(unicode_letter_next != 0) {
-        g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
+    int k = 0;
+    if(unicode_letter_next != 0 && dsc->face->has_kern) {
+        ttf_glyph_t tmp_next;
+        k = get_kern(dsc->face, g1, get_glyph(dsc, unicode_letter_next, &tmp_next)->glyph_id);
     }
-    int advw, lsb;
-    stbtt_GetGlyphHMetrics(&dsc->info, g1, &advw, &lsb);
-    int k = stbtt_GetGlyphKernAdvance(&dsc->info, g1, g2);
     dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
                                      0.5f); /*Horizontal space required by the glyph in [px]*/
-
-    dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
-                                     0.5f); /*Horizontal space required by the glyph in [px]*/
-    dsc_out->box_w = (x2 - x1 + 1);         /*width of the bitmap in [px]*/
-    dsc_out->box_h = (y2 - y1 + 1);         /*height of the bitmap in [px]*/
-    dsc_out->ofs_x = x1;                    /*X offset of the bitmap in [pf]*/
-    dsc_out->ofs_y = -y2;                   /*Y offset of the bitmap measured from the as line*/
-    dsc_out->bpp = 8;                       /*Bits per pixel: 1/2/4/8*/
-    dsc_out->is_placeholder = false;
     return true; /*true: glyph found; false: glyph was not found*/
 }
 
 static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter)
 {
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
-    int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
-    if(g1 == 0) {
+    ttf_glyph_t tmp;
+    ttf_glyph_t * g = get_glyph(dsc, unicode_letter, &tmp);
+    if(g->glyph_id == 0) {
         /* Glyph not found */
         return NULL;
     }
-    int x1, y1, x2, y2;
-    stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-    int w, h;
-    w = x2 - x1 + 1;
-    h = y2 - y1 + 1;
-    uint32_t stride = w;
-    /*Try to load from cache*/
-    ttf_bitmap_cache_key_t cache_key;
-    lv_memset(&cache_key, 0, sizeof(cache_key)); /*Zero padding*/
-    cache_key.unicode_letter = unicode_letter;
-    cache_key.line_height = font->line_height;
-    uint8_t * buffer = NULL;
-    lv_lru_get(dsc->bitmap_cache, &cache_key, sizeof(cache_key), (void **)&buffer);
-    if(buffer) {
-        return buffer;
+    if(g->bitmap) {
+        cache.bitmap_hit++;
+        return g->bitmap;
     }
     LV_LOG_TRACE("cache miss for letter: %u", unicode_letter);
+    cache.bitmap_miss++;
+
     /*Prepare space in cache*/
-    size_t szb = h * stride;
-    buffer = lv_mem_alloc(szb);
-    if(!buffer) {
-        LV_LOG_ERROR("failed to allocate cache value");
-        return NULL;
+    uint32_t szb = (uint32_t)g->box_w * g->box_h;
+    uint8_t * buffer = NULL;
+    if(g != &tmp && sizeof(ttf_glyph_t) + szb <= cache.max_size) {
+        shrink(cache.max_size - szb, g);
+        buffer = CACHE_ALLOC(szb);
+        if(buffer) {
+            g->bitmap = buffer;
+            cache.size += szb;
+        }
     }
-    lv_memset(buffer, 0, szb);
-    if(LV_LRU_OK != lv_lru_set(dsc->bitmap_cache, &cache_key, sizeof(cache_key), buffer, szb)) {
-        LV_LOG_ERROR("failed to add cache value");
-        lv_mem_free(buffer);
-        return NULL;
+    /*Render the glyph which don't fit into the cache into a buffer valid until the next call*/
+    if(buffer == NULL) {
+        if(cache.scratch_size < szb) {
+            uint8_t * scratch = lv_mem_realloc(cache.scratch, szb);
+            if(scratch == NULL) {
+                LV_LOG_ERROR("failed to allocate the glyph bitmap");
+                return NULL;
+            }
+            cache.scratch = scratch;
+            cache.scratch_size = szb;
+        }
+        buffer = cache.scratch;
     }
-    /*Render into cache*/
-    stbtt_MakeGlyphBitmap(info, buffer, w, h, stride, dsc->scale, dsc->scale, g1);
+    lv_memset_00(buffer, szb);
+    stbtt_MakeGlyphBitmap(&dsc->face->info, buffer, g->box_w, g->box_h, g->box_w, dsc->scale, dsc->scale, g->glyph_id);
     return buffer;
 }
 
-static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size, lv_coord_t font_size,
-                                      size_t cache_size)
+static ttf_face_t * face_open(const char * path, const void * data, size_t data_size)
 {
-    if((path == NULL && data == NULL) || 0 >= font_size) {
-        LV_LOG_ERROR("tiny_ttf: invalid argument\n");
-        return NULL;
+    ttf_face_t * face;
+    for(face = face_list; face != NULL; face = face->next) {
+        if(path != NULL ? (face->path != NULL && strcmp(face->path, path) == 0) : face->data == data) {
+            face->ref_cnt++;
+            return face;
+        }
     }
-    ttf_font_desc_t * dsc = (ttf_font_desc_t *)TTF_MALLOC(sizeof(ttf_font_desc_t));
-    if(dsc == NULL) {
+
+    face = (ttf_face_t *)TTF_MALLOC(sizeof(ttf_face_t));
+    if(face == NULL) {
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         return NULL;
     }
+    lv_memset_00(face, sizeof(ttf_face_t));
 #if LV_TINY_TTF_FILE_SUPPORT
     if(path != NULL) {
-        if(LV_FS_RES_OK != lv_fs_open(&dsc->file, path, LV_FS_MODE_RD)) {
+        face->path = TTF_MALLOC(strlen(path) + 1);
+        if(face->path == NULL) {
+            LV_LOG_ERROR("tiny_ttf: out of memory\n");
+            goto err_after_face;
+        }
+        strcpy(face->path, path);
+        if(LV_FS_RES_OK != lv_fs_open(&face->file, path, LV_FS_MODE_RD)) {
             LV_LOG_ERROR("tiny_ttf: unable to open %s\n", path);
-            goto err_after_dsc;
+            goto err_after_face;
         }
-        dsc->stream.file = &dsc->file;
+        face->stream.file = &face->file;
     }
     else {
-        dsc->stream.file = NULL;
-        dsc->stream.data = (const uint8_t *)data;
-        dsc->stream.size = data_size;
-        dsc->stream.position = 0;
+        face->data = data;
+        face->stream.file = NULL;
+        face->stream.data = (const uint8_t *)data;
+        face->stream.size = data_size;
+        face->stream.position = 0;
     }
-    if(0 == stbtt_InitFont(&dsc->info, &dsc->stream, stbtt_GetFontOffsetForIndex(&dsc->stream, 0))) {
+    if(0 == stbtt_InitFont(&face->info, &face->stream, stbtt_GetFontOffsetForIndex(&face->stream, 0))) {
         LV_LOG_ERROR("tiny_ttf: init failed\n");
-        goto err_after_dsc;
+        if(face->stream.file != NULL) lv_fs_close(&face->file);
+        goto err_after_face;
     }
 
 #else
-    dsc->stream = (const uint8_t *)data;
+    LV_UNUSED(path);
     LV_UNUSED(data_size);
-    if(0 == stbtt_InitFont(&dsc->info, dsc->stream, stbtt_GetFontOffsetForIndex(dsc->stream, 0))) {
+    face->data = data;
+    face->stream = (const uint8_t *)data;
+    if(0 == stbtt_InitFont(&face->info, face->stream, stbtt_GetFontOffsetForIndex(face->stream, 0))) {
         LV_LOG_ERROR("tiny_ttf: init failed\n");
-        goto err_after_dsc;
+        goto err_after_face;
+    }
+#endif
+
+    stbtt_GetFontVMetrics(&face->info, &face->ascent, &face->descent, &face->line_gap);
+    face->has_kern = face->info.kern != 0 || face->info.gpos != 0;
+    face->ref_cnt = 1;
+    face->next = face_list;
+    face_list = face;
+    return face;
+
+err_after_face:
+    if(face->path != NULL) TTF_FREE(face->path);
+    TTF_FREE(face);
+    return NULL;
+}
+
+static void face_close(ttf_face_t * face)
+{
+    face->ref_cnt--;
+    if(face->ref_cnt > 0) return;
+
+    ttf_glyph_t * g = cache.lru_head;
+    while(g) {
+        ttf_glyph_t * next = g->lru_next;
+        if(g->face == face) drop_glyph(g);
+        g = next;
+    }
+
+    ttf_face_t ** p = &face_list;
+    while(*p != face) p = &(*p)->next;
+    *p = face->next;
+
+#if LV_TINY_TTF_FILE_SUPPORT
+    if(face->stream.file != NULL) {
+        lv_fs_close(&face->file);
     }
 #endif
+    if(face->path != NULL) TTF_FREE(face->path);
+    TTF_FREE(face);
+
+    if(face_list == NULL && cache.scratch != NULL) {
+        lv_mem_free(cache.scratch);
+        cache.scratch = NULL;
+        cache.scratch_size = 0;
+    }
+}
 
-    dsc->bitmap_cache = lv_lru_create(cache_size, font_size * font_size, lv_mem_free, lv_mem_free);
-    if(dsc->bitmap_cache == NULL) {
-        LV_LOG_ERROR("failed to create lru cache");
+static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size_t data_size, lv_coord_t font_size,
+                                      size_t cache_size)
+{
+    if((path == NULL && data == NULL) || 0 >= font_size) {
+        LV_LOG_ERROR("tiny_ttf: invalid argument\n");
+        return NULL;
+    }
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)TTF_MALLOC(sizeof(ttf_font_desc_t));
+    if(dsc == NULL) {
+        LV_LOG_ERROR("tiny_ttf: out of memory\n");
+        return NULL;
+    }
+    dsc->face = face_open(path, data, data_size);
+    if(dsc->face == NULL) {
         goto err_after_dsc;
     }
 
     lv_font_t * out_font = (lv_font_t *)TTF_MALLOC(sizeof(lv_font_t));
     if(out_font == NULL) {
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
-        goto err_after_bitmap_cache;
+        goto err_after_face;
+    }
+    if(cache.max_size < cache_size) {
+        cache.max_size = cache_size;
     }
     lv_memset(out_font, 0, sizeof(lv_font_t));
     out_font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
@@ -228,8 +496,8 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
     out_font->dsc = dsc;
     lv_tiny_ttf_set_size(out_font, font_size);
     return out_font;
-err_after_bitmap_cache:
-    lv_lru_del(dsc->bitmap_cache);
+err_after_face:
+    face_close(dsc->face);
 err_after_dsc:
     TTF_FREE(dsc);
     return NULL;
@@ -241,7 +509,7 @@ lv_font_t * lv_tiny_ttf_create_file_ex(const char * path, lv_coord_t font_size,
 }
 lv_font_t * lv_tiny_ttf_create_file(const char * path, lv_coord_t font_size)
 {
-    return lv_tiny_ttf_create_file_ex(path, font_size, 4096);
+    return lv_tiny_ttf_create_file_ex(path, font_size, 0);
 }
 #endif /*LV_TINY_TTF_FILE_SUPPORT*/
 lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_coord_t font_size, size_t cache_size)
@@ -250,7 +518,7 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_c
 }
 lv_font_t * lv_tiny_ttf_create_data(const void * data, size_t data_size, lv_coord_t font_size)
 {
-    return lv_tiny_ttf_create_data_ex(data, data_size, font_size, 4096);
+    return lv_tiny_ttf_create_data_ex(data, data_size, font_size, 0);
 }
 void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size)
 {
@@ -258,27 +526,62 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size)
         LV_LOG_ERROR("invalid font size: %"PRIx32, font_size);
         return;
     }
+    lv_draw_sw_glyph_cache_invalidate_font(font);
+    lv_txt_layout_invalidate_font(font);
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    dsc->scale = stbtt_ScaleForMappingEmToPixels(&dsc->info, font_size);
-    int line_gap = 0;
-    stbtt_GetFontVMetrics(&dsc->info, &dsc->ascent, &dsc->descent, &line_gap);
-    font->line_height = (lv_coord_t)(dsc->scale * (dsc->ascent - dsc->descent + line_gap));
-    font->base_line = (lv_coord_t)(dsc->scale * (line_gap - dsc->descent));
+    ttf_face_t * face = dsc->face;
+    /*The glyphs of the previous size stay in the cache for the other fonts of this face*/
+    dsc->size = font_size;
+    dsc->scale = stbtt_ScaleForMappingEmToPixels(&face->info, font_size);
+    font->line_height = (lv_coord_t)(dsc->scale * (face->ascent - face->descent + face->line_gap));
+    font->base_line = (lv_coord_t)(dsc->scale * (face->line_gap - face->descent));
+}
+uint32_t lv_tiny_ttf_prewarm(lv_font_t * font, const char * letters)
+{
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+    while(letters[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(letters, &i);
+        if(ttf_get_glyph_bitmap_cb(font, letter) != NULL) cnt++;
+    }
+    return cnt;
 }
 void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     if(font != NULL) {
+        lv_draw_sw_glyph_cache_invalidate_font(font);
+        lv_txt_layout_invalidate_font(font);
         if(font->dsc != NULL) {
             ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
-#if LV_TINY_TTF_FILE_SUPPORT
-            if(ttf->stream.file != NULL) {
-                lv_fs_close(&ttf->file);
-            }
-#endif
-            lv_lru_del(ttf->bitmap_cache);
+            face_close(ttf->face);
             TTF_FREE(ttf);
         }
         TTF_FREE(font);
     }
 }
+void lv_tiny_ttf_cache_set_size(uint32_t size)
+{
+    cache.max_size = size;
+    shrink(size, NULL);
+}
+void lv_tiny_ttf_cache_get_stat(lv_tiny_ttf_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+    stat->hit = cache.hit;
+    stat->miss = cache.miss;
+    stat->bitmap_hit = cache.bitmap_hit;
+    stat->bitmap_miss = cache.bitmap_miss;
+    stat->evict = cache.evict;
+    stat->size = cache.size;
+    stat->max_size = cache.max_size;
+    stat->entry_cnt = cache.entry_cnt;
+}
+void lv_tiny_ttf_cache_reset_stat(void)
+{
+    cache.hit = 0;
+    cache.miss = 0;
+    cache.bitmap_hit = 0;
+    cache.bitmap_miss = 0;
+    cache.evict = 0;
+}
 #endif /*LV_USE_TINY_TTF*/
@@ -25,6 +25,17 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t hit;           /**< Glyph metrics found in the cache*/
+    uint32_t miss;          /**< Glyphs which had to be looked up in the font data*/
+    uint32_t bitmap_hit;    /**< Bitmaps found in the cache*/
+    uint32_t bitmap_miss;   /**< Bitmaps which had to be rendered*/
+    uint32_t evict;         /**< Glyphs dropped to make room for new ones*/
+    uint32_t size;          /**< Bytes used by the cached glyphs*/
+    uint32_t max_size;      /**< Size limit set by `LV_TINY_TTF_CACHE_SIZE` or `lv_tiny_ttf_cache_set_size()`*/
+    uint32_t entry_cnt;     /**< Number of cached glyphs*/
+} lv_tiny_ttf_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -33,22 +44,37 @@ extern "C" {
 /* create a font from the specified file or path with the specified line height.*/
 lv_font_t * lv_tiny_ttf_create_file(const char * path, lv_coord_t font_size);
 
-/* create a font from the specified file or path with the specified line height with the specified cache size.*/
+/* create a font from the specified file or path with the specified line height.
+ * The glyph cache shared by all the fonts is enlarged to at least cache_size bytes.*/
 lv_font_t * lv_tiny_ttf_create_file_ex(const char * path, lv_coord_t font_size, size_t cache_size);
 #endif /*LV_TINY_TTF_FILE_SUPPORT*/
 
 /* create a font from the specified data pointer with the specified line height.*/
 lv_font_t * lv_tiny_ttf_create_data(const void * data, size_t data_size, lv_coord_t font_size);
 
-/* create a font from the specified data pointer with the specified line height and the specified cache size.*/
+/* create a font from the specified data pointer with the specified line height.
+ * The glyph cache shared by all the fonts is enlarged to at least cache_size bytes.*/
 lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_coord_t font_size, size_t cache_size);
 
 /* set the size of the font to a new font_size*/
 void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size);
 
+/* render the given UTF-8 letters (e.g. "0123456789") into the glyph cache to not render them on the first draw.
+ * returns the number of letters found in the font.*/
+uint32_t lv_tiny_ttf_prewarm(lv_font_t * font, const char * letters);
+
 /* destroy a font previously created with lv_tiny_ttf_create_xxxx()*/
 void lv_tiny_ttf_destroy(lv_font_t * font);
 
+/* set the size of the glyph cache shared by all the fonts in bytes. 0: don't cache*/
+void lv_tiny_ttf_cache_set_size(uint32_t size);
+
+/* get the state and the hit/miss counters of the glyph cache*/
+void lv_tiny_ttf_cache_get_stat(lv_tiny_ttf_cache_stat_t * stat);
+
+/* zero the hit, miss and evict counters of the glyph cache*/
+void lv_tiny_ttf_cache_reset_stat(void);
+
 /**********************
  *      MACROS
  **********************/
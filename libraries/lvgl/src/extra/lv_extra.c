@@ -82,6 +82,10 @@ void lv_extra_init(void)
     lv_bmp_init();
 #endif
 
+#if LV_USE_RLE_IMG
+    lv_rle_img_init();
+#endif
+
 #if LV_USE_FREETYPE
     /*Init freetype library*/
 #  if LV_FREETYPE_CACHE_SIZE >= 0
@@ -0,0 +1,517 @@
+/**
+ * @file lv_assets.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_assets.h"
+
+#if LV_USE_ASSETS
+
+#include <string.h>
+#include "../../../draw/sw/lv_draw_sw_glyph_cache.h"
+
+#if LV_ASSETS_POSIX_MMAP
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define FONT_FLAG_LARGE     0x01    /*The glyph descriptors are stored like with `LV_FONT_FMT_TXT_LARGE 1`*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The format of the bundle. All values are little endian, all offsets are 4 byte aligned.
+ *It's created by `scripts/lv_assets_pack.py`.*/
+typedef struct {
+    char magic[4];          /*"LVAB"*/
+    uint8_t version;
+    uint8_t color_depth;    /*Color depth of the true color images*/
+    uint8_t flags;          /*`LV_ASSETS_FLAG_...`*/
+    uint8_t reserved;
+    uint32_t entry_cnt;
+    uint32_t size;          /*Size of the whole bundle*/
+} bundle_header_t;
+
+/*The entry table follows the header. The entries are sorted by name.*/
+typedef struct {
+    char name[LV_ASSETS_NAME_MAX + 1];
+    uint8_t type;           /*`LV_ASSETS_TYPE_...`*/
+    uint32_t offset;        /*From the start of the bundle*/
+    uint32_t size;
+} bundle_entry_t;
+
+/*A font starts with this header. The offsets are from the start of the font, 0 means "none".*/
+typedef struct {
+    uint16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t subpx;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t kern_classes;   /*1: `font_kern_classes_t`, 0: `font_kern_pairs_t` at `kern_ofs`*/
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint16_t glyph_cnt;
+    uint8_t flags;          /*`FONT_FLAG_...`*/
+    uint8_t reserved[3];
+    uint32_t bitmap_ofs;
+    uint32_t glyph_dsc_ofs; /*`glyph_cnt` x `lv_font_fmt_txt_glyph_dsc_t`*/
+    uint32_t cmaps_ofs;     /*`cmap_num` x `font_cmap_t`*/
+    uint32_t kern_ofs;
+    uint32_t bitmap_size;   /*Padded so that the decompression of any glyph stays in it*/
+} font_header_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint32_t unicode_list_ofs;
+    uint32_t glyph_id_ofs_list_ofs;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t reserved;
+} font_cmap_t;
+
+typedef struct {
+    uint32_t glyph_ids_ofs;
+    uint32_t values_ofs;
+    uint32_t pair_cnt;
+    uint8_t glyph_ids_size;
+    uint8_t reserved[3];
+} font_kern_pairs_t;
+
+typedef struct {
+    uint32_t class_pair_values_ofs;
+    uint32_t left_class_mapping_ofs;
+    uint32_t right_class_mapping_ofs;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+    uint8_t reserved[2];
+} font_kern_classes_t;
+
+/*The RAM part of a font loaded from a bundle, allocated at once*/
+typedef struct {
+    lv_font_t font;         /*Must be the first to find the block from the font*/
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+    union {
+        lv_font_fmt_txt_kern_pair_t pairs;
+        lv_font_fmt_txt_kern_classes_t classes;
+    } kern;
+    lv_font_fmt_txt_cmap_t cmaps[];
+} font_block_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool in_range(uint32_t ofs, uint32_t len, uint32_t size);
+static bool array_in_range(uint32_t ofs, uint32_t cnt, uint32_t item_size, uint32_t size);
+static bool font_is_valid(const uint8_t * data, uint32_t size);
+static bool cmap_is_valid(const uint8_t * data, uint32_t size, const font_cmap_t * cmap, uint32_t glyph_cnt);
+static bool glyphs_are_valid(const font_header_t * header, const lv_font_fmt_txt_glyph_dsc_t * glyphs);
+static bool kern_is_valid(const uint8_t * data, uint32_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_res_t lv_assets_init(lv_assets_t * assets, const void * data, uint32_t size)
+{
+    LV_ASSERT_NULL(assets);
+    lv_memset_00(assets, sizeof(lv_assets_t));
+
+    const bundle_header_t * header = data;
+    if(data == NULL || ((lv_uintptr_t)data & 0x3) || size < sizeof(bundle_header_t)) return LV_RES_INV;
+    if(memcmp(header->magic, "LVAB", 4) != 0) return LV_RES_INV;
+    if(header->version != LV_ASSETS_VERSION) {
+        LV_LOG_WARN("unsupported version: %d", header->version);
+        return LV_RES_INV;
+    }
+    if(header->size > size ||
+       !array_in_range(sizeof(bundle_header_t), header->entry_cnt, sizeof(bundle_entry_t), header->size)) {
+        LV_LOG_WARN("the bundle doesn't fit in %" LV_PRIu32 " bytes", size);
+        return LV_RES_INV;
+    }
+
+    const bundle_entry_t * entries = (const bundle_entry_t *)(header + 1);
+    uint32_t i;
+    for(i = 0; i < header->entry_cnt; i++) {
+        if(entries[i].name[LV_ASSETS_NAME_MAX] != '\0' || (entries[i].offset & 0x3) ||
+           !in_range(entries[i].offset, entries[i].size, header->size)) {
+            LV_LOG_WARN("invalid entry: %" LV_PRIu32, i);
+            return LV_RES_INV;
+        }
+    }
+
+    assets->data = data;
+    assets->size = header->size;
+    assets->entry_cnt = header->entry_cnt;
+    assets->color_depth = header->color_depth;
+    assets->flags = header->flags;
+    return LV_RES_OK;
+}
+
+const void * lv_assets_get(const lv_assets_t * assets, const char * name, lv_assets_type_t * type, uint32_t * size)
+{
+    LV_ASSERT_NULL(assets);
+    LV_ASSERT_NULL(name);
+    if(assets->data == NULL) return NULL;
+
+    /*Binary search in the sorted entries*/
+    const bundle_entry_t * entries = (const bundle_entry_t *)(assets->data + sizeof(bundle_header_t));
+    int32_t min = 0;
+    int32_t max = (int32_t)assets->entry_cnt - 1;
+    while(min <= max) {
+        int32_t mid = (min + max) / 2;
+        int cmp = strncmp(name, entries[mid].name, LV_ASSETS_NAME_MAX + 1);
+        if(cmp == 0) {
+            if(type) *type = entries[mid].type;
+            if(size) *size = entries[mid].size;
+            return assets->data + entries[mid].offset;
+        }
+        if(cmp < 0) max = mid - 1;
+        else min = mid + 1;
+    }
+
+    return NULL;
+}
+
+lv_res_t lv_assets_get_img(const lv_assets_t * assets, const char * name, lv_img_dsc_t * dsc)
+{
+    LV_ASSERT_NULL(dsc);
+
+    lv_assets_type_t type;
+    uint32_t size;
+    const uint8_t * data = lv_assets_get(assets, name, &type, &size);
+    if(data == NULL || type != LV_ASSETS_TYPE_IMG || size < sizeof(lv_img_header_t)) {
+        LV_LOG_WARN("%s: image not found", name);
+        return LV_RES_INV;
+    }
+
+    lv_img_header_t header;
+    lv_memcpy_small(&header, data, sizeof(lv_img_header_t));
+    uint32_t data_size = size - sizeof(lv_img_header_t);
+
+    /*The true color images are drawn directly so they should match the display's color format*/
+    if(header.cf == LV_IMG_CF_TRUE_COLOR || header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+       header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        bool swap = (assets->flags & LV_ASSETS_FLAG_SWAP) != 0;
+        if(assets->color_depth != LV_COLOR_DEPTH || (LV_COLOR_DEPTH == 16 && swap != (LV_COLOR_16_SWAP != 0))) {
+            LV_LOG_WARN("%s: the bundle is for %d bit colors%s", name, assets->color_depth, swap ? " (swapped)" : "");
+            return LV_RES_INV;
+        }
+    }
+
+    if(header.cf != LV_IMG_CF_RAW && header.cf != LV_IMG_CF_RAW_ALPHA && header.cf != LV_IMG_CF_RAW_CHROMA_KEYED &&
+       lv_img_buf_get_img_size(header.w, header.h, header.cf) > data_size) {
+        LV_LOG_WARN("%s: not enough pixel data", name);
+        return LV_RES_INV;
+    }
+
+    dsc->header = header;
+    dsc->data_size = data_size;
+    dsc->data = data + sizeof(lv_img_header_t);
+    return LV_RES_OK;
+}
+
+lv_font_t * lv_assets_load_font(const lv_assets_t * assets, const char * name)
+{
+    lv_assets_type_t type;
+    uint32_t size;
+    const uint8_t * data = lv_assets_get(assets, name, &type, &size);
+    if(data == NULL || type != LV_ASSETS_TYPE_FONT) {
+        LV_LOG_WARN("%s: font not found", name);
+        return NULL;
+    }
+
+    /*The glyph descriptors are used in place so they should be stored in the same format*/
+    const font_header_t * header = (const font_header_t *)data;
+    if(size >= sizeof(font_header_t) &&
+       ((header->flags & FONT_FLAG_LARGE) != 0) != (LV_FONT_FMT_TXT_LARGE != 0)) {
+        LV_LOG_WARN("%s: LV_FONT_FMT_TXT_LARGE doesn't match the font. Use `--large-glyphs` of the packer.", name);
+        return NULL;
+    }
+
+    if(!font_is_valid(data, size)) {
+        LV_LOG_WARN("%s: invalid font", name);
+        return NULL;
+    }
+
+    font_block_t * block = lv_mem_alloc(sizeof(font_block_t) + header->cmap_num * sizeof(lv_font_fmt_txt_cmap_t));
+    LV_ASSERT_MALLOC(block);
+    if(block == NULL) return NULL;
+    lv_memset_00(block, sizeof(font_block_t));
+
+    const font_cmap_t * cmaps = (const font_cmap_t *)(data + header->cmaps_ofs);
+    uint32_t i;
+    for(i = 0; i < header->cmap_num; i++) {
+        lv_font_fmt_txt_cmap_t * cmap = &block->cmaps[i];
+        cmap->range_start = cmaps[i].range_start;
+        cmap->range_length = cmaps[i].range_length;
+        cmap->glyph_id_start = cmaps[i].glyph_id_start;
+        cmap->unicode_list = cmaps[i].unicode_list_ofs ? (const uint16_t *)(data + cmaps[i].unicode_list_ofs) : NULL;
+        cmap->glyph_id_ofs_list = cmaps[i].glyph_id_ofs_list_ofs ? data + cmaps[i].glyph_id_ofs_list_ofs : NULL;
+        cmap->list_length = cmaps[i].list_length;
+        cmap->type = cmaps[i].type;
+    }
+
+    lv_font_fmt_txt_dsc_t * dsc = &block->dsc;
+    dsc->glyph_bitmap = data + header->bitmap_ofs;
+    dsc->glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(data + header->glyph_dsc_ofs);
+    dsc->cmaps = block->cmaps;
+    dsc->kern_scale = header->kern_scale;
+    dsc->cmap_num = header->cmap_num;
+    dsc->bpp = header->bpp;
+    dsc->bitmap_format = header->bitmap_format;
+    dsc->cache = &block->cache;
+
+    if(header->kern_ofs) {
+        dsc->kern_classes = header->kern_classes;
+        if(header->kern_classes) {
+            const font_kern_classes_t * kern = (const font_kern_classes_t *)(data + header->kern_ofs);
+            block->kern.classes.class_pair_values = (const int8_t *)(data + kern->class_pair_values_ofs);
+            block->kern.classes.left_class_mapping = data + kern->left_class_mapping_ofs;
+            block->kern.classes.right_class_mapping = data + kern->right_class_mapping_ofs;
+            block->kern.classes.left_class_cnt = kern->left_class_cnt;
+            block->kern.classes.right_class_cnt = kern->right_class_cnt;
+        }
+        else {
+            const font_kern_pairs_t * kern = (const font_kern_pairs_t *)(data + header->kern_ofs);
+            block->kern.pairs.glyph_ids = data + kern->glyph_ids_ofs;
+            block->kern.pairs.values = (const int8_t *)(data + kern->values_ofs);
+            block->kern.pairs.pair_cnt = kern->pair_cnt;
+            block->kern.pairs.glyph_ids_size = kern->glyph_ids_size;
+        }
+        dsc->kern_dsc = &block->kern;
+    }
+
+    lv_font_t * font = &block->font;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->line_height = header->line_height;
+    font->base_line = header->base_line;
+    font->subpx = header->subpx;
+    font->underline_position = header->underline_position;
+    font->underline_thickness = header->underline_thickness;
+    font->dsc = dsc;
+    return font;
+}
+
+void lv_assets_free_font(lv_font_t * font)
+{
+    if(font == NULL) return;
+
+    lv_draw_sw_glyph_cache_invalidate_font(font);
+    lv_txt_layout_invalidate_font(font);
+    lv_font_fmt_txt_free_lut(font);
+    lv_mem_free(font);
+}
+
+#if LV_ASSETS_POSIX_MMAP
+lv_res_t lv_assets_map_file(lv_assets_t * assets, const char * path)
+{
+    LV_ASSERT_NULL(assets);
+    lv_memset_00(assets, sizeof(lv_assets_t));
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        LV_LOG_WARN("can't open %s", path);
+        return LV_RES_INV;
+    }
+
+    struct stat st;
+    void * map = MAP_FAILED;
+    if(fstat(fd, &st) == 0 && st.st_size > 0) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);  /*The mapping stays valid*/
+    if(map == MAP_FAILED) {
+        LV_LOG_WARN("can't map %s", path);
+        return LV_RES_INV;
+    }
+
+    if(lv_assets_init(assets, map, (uint32_t)st.st_size) != LV_RES_OK) {
+        munmap(map, (size_t)st.st_size);
+        return LV_RES_INV;
+    }
+
+    /*Unmap all of the file, not only the bundle*/
+    assets->size = (uint32_t)st.st_size;
+    assets->map_handle = map;
+    return LV_RES_OK;
+}
+
+void lv_assets_unmap_file(lv_assets_t * assets)
+{
+    LV_ASSERT_NULL(assets);
+
+    /*The image cache can refer to the images of the bundle*/
+    lv_img_cache_invalidate_src(NULL);
+    if(assets->map_handle) munmap(assets->map_handle, assets->size);
+    lv_memset_00(assets, sizeof(lv_assets_t));
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool in_range(uint32_t ofs, uint32_t len, uint32_t size)
+{
+    return ofs <= size && len <= size - ofs;
+}
+
+/*`cnt` items of `item_size` bytes from `ofs`, without overflowing `cnt * item_size`*/
+static bool array_in_range(uint32_t ofs, uint32_t cnt, uint32_t item_size, uint32_t size)
+{
+    return ofs <= size && cnt <= (size - ofs) / item_size;
+}
+
+/*Check the tables of a font and every glyph id and bitmap index in them,
+ *so that no letter can make the font read out of the font's data.
+ *The glyph descriptors have to be in the format of `LV_FONT_FMT_TXT_LARGE`.*/
+static bool font_is_valid(const uint8_t * data, uint32_t size)
+{
+    if(size < sizeof(font_header_t)) return false;
+
+    const font_header_t * header = (const font_header_t *)data;
+    if(header->cmap_num == 0 || header->cmap_num >= 512 || header->glyph_cnt == 0) return false;
+    if(header->bpp == 0 || (header->bpp > 4 && header->bpp != 8)) return false;
+    if((header->glyph_dsc_ofs & 0x3) || (header->cmaps_ofs & 0x3) || (header->kern_ofs & 0x3)) return false;
+    if(!in_range(header->bitmap_ofs, header->bitmap_size, size)) return false;
+    if(!array_in_range(header->glyph_dsc_ofs, header->glyph_cnt, sizeof(lv_font_fmt_txt_glyph_dsc_t), size)) return false;
+    if(!array_in_range(header->cmaps_ofs, header->cmap_num, sizeof(font_cmap_t), size)) return false;
+
+    const font_cmap_t * cmaps = (const font_cmap_t *)(data + header->cmaps_ofs);
+    uint32_t i;
+    for(i = 0; i < header->cmap_num; i++) {
+        if(!cmap_is_valid(data, size, &cmaps[i], header->glyph_cnt)) return false;
+    }
+
+    if(!glyphs_are_valid(header, (const lv_font_fmt_txt_glyph_dsc_t *)(data + header->glyph_dsc_ofs))) return false;
+
+    return header->kern_ofs == 0 || kern_is_valid(data, size);
+}
+
+/*All glyph ids of the character map should be below `glyph_cnt`*/
+static bool cmap_is_valid(const uint8_t * data, uint32_t size, const font_cmap_t * cmap, uint32_t glyph_cnt)
+{
+    if(cmap->unicode_list_ofs &&
+       ((cmap->unicode_list_ofs & 0x1) || !array_in_range(cmap->unicode_list_ofs, cmap->list_length, 2, size))) {
+        return false;
+    }
+
+    /*The glyph id offsets are `uint8_t` with full format 0 and `uint16_t` with full sparse maps*/
+    const uint8_t * ofs8;
+    const uint16_t * ofs16;
+    uint32_t i;
+    switch(cmap->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return cmap->range_length == 0 || (uint32_t)cmap->glyph_id_start + cmap->range_length <= glyph_cnt;
+
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            if(cmap->unicode_list_ofs == 0) return false;
+            return (uint32_t)cmap->glyph_id_start + cmap->list_length <= glyph_cnt;
+
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            /*Indexed with the code point relative to `range_start`*/
+            if(cmap->glyph_id_ofs_list_ofs == 0 || !in_range(cmap->glyph_id_ofs_list_ofs, cmap->range_length, size)) {
+                return false;
+            }
+            ofs8 = data + cmap->glyph_id_ofs_list_ofs;
+            for(i = 0; i < cmap->range_length; i++) {
+                if((uint32_t)cmap->glyph_id_start + ofs8[i] >= glyph_cnt) return false;
+            }
+            return true;
+
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            /*Indexed with the position in the unicode list*/
+            if(cmap->unicode_list_ofs == 0 || cmap->glyph_id_ofs_list_ofs == 0 || (cmap->glyph_id_ofs_list_ofs & 0x1) ||
+               !array_in_range(cmap->glyph_id_ofs_list_ofs, cmap->list_length, 2, size)) {
+                return false;
+            }
+            ofs16 = (const uint16_t *)(data + cmap->glyph_id_ofs_list_ofs);
+            for(i = 0; i < cmap->list_length; i++) {
+                if((uint32_t)cmap->glyph_id_start + ofs16[i] >= glyph_cnt) return false;
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/*The bitmap of every glyph should be in the bitmap table. A compressed glyph has no stored length, so its
+ *worst case is checked: the decompressor reads at most `bpp + 7` bits per pixel and 1 byte ahead.*/
+static bool glyphs_are_valid(const font_header_t * header, const lv_font_fmt_txt_glyph_dsc_t * glyphs)
+{
+    uint32_t i;
+    for(i = 0; i < header->glyph_cnt; i++) {
+        uint64_t px_cnt = (uint64_t)glyphs[i].box_w * glyphs[i].box_h;
+        if(px_cnt == 0) continue;
+
+        uint64_t len;
+        if(header->bitmap_format == LV_FONT_FMT_TXT_PLAIN) len = (px_cnt * header->bpp + 7) / 8;
+        else len = (px_cnt * (header->bpp + 7) + 7) / 8 + 1;
+
+        if(glyphs[i].bitmap_index > header->bitmap_size || len > header->bitmap_size - glyphs[i].bitmap_index) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*The kerning tables should be in the font and the kerning classes in the class matrix*/
+static bool kern_is_valid(const uint8_t * data, uint32_t size)
+{
+    const font_header_t * header = (const font_header_t *)data;
+    uint32_t i;
+
+    if(header->kern_classes) {
+        if(!in_range(header->kern_ofs, sizeof(font_kern_classes_t), size)) return false;
+        const font_kern_classes_t * kern = (const font_kern_classes_t *)(data + header->kern_ofs);
+        if(!in_range(kern->class_pair_values_ofs, kern->left_class_cnt * kern->right_class_cnt, size) ||
+           !in_range(kern->left_class_mapping_ofs, header->glyph_cnt, size) ||
+           !in_range(kern->right_class_mapping_ofs, header->glyph_cnt, size)) {
+            return false;
+        }
+
+        /*Class 0 means no kerning, the others index the class pair matrix*/
+        const uint8_t * left = data + kern->left_class_mapping_ofs;
+        const uint8_t * right = data + kern->right_class_mapping_ofs;
+        for(i = 0; i < header->glyph_cnt; i++) {
+            if(left[i] > kern->left_class_cnt || right[i] > kern->right_class_cnt) return false;
+        }
+        return true;
+    }
+    else {
+        if(!in_range(header->kern_ofs, sizeof(font_kern_pairs_t), size)) return false;
+        const font_kern_pairs_t * kern = (const font_kern_pairs_t *)(data + header->kern_ofs);
+        if(kern->glyph_ids_size > 1) return false;
+        uint32_t pair_size = kern->glyph_ids_size ? 4 : 2;
+        return (kern->glyph_ids_ofs & (pair_size / 2 - 1)) == 0 &&
+               array_in_range(kern->glyph_ids_ofs, kern->pair_cnt, pair_size, size) &&
+               in_range(kern->values_ofs, kern->pair_cnt, size);
+    }
+}
+
+#endif /*LV_USE_ASSETS*/
@@ -0,0 +1,131 @@
+/**
+ * @file lv_assets.h
+ *
+ */
+
+#ifndef LV_ASSETS_H
+#define LV_ASSETS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_ASSETS
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_ASSETS_VERSION       2
+#define LV_ASSETS_NAME_MAX      22      /*Max. length of the name of an asset without the terminating '\0'*/
+
+#define LV_ASSETS_FLAG_SWAP     0x01    /*The 16 bit true color images are stored with the high byte first*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_ASSETS_TYPE_RAW,     /*Any data*/
+    LV_ASSETS_TYPE_IMG,     /*`lv_img_header_t` and the pixels, like the `.bin` image files*/
+    LV_ASSETS_TYPE_FONT,    /*A font in LVGL's native format whose tables can be used in place*/
+};
+
+typedef uint8_t lv_assets_type_t;
+
+/**
+ * An asset bundle mapped to the memory.
+ * The assets are used directly from the mapping so it must stay valid while they are used.
+ */
+typedef struct {
+    const uint8_t * data;
+    uint32_t size;
+    uint32_t entry_cnt;
+    uint8_t color_depth;    /*Color depth of the true color images*/
+    uint8_t flags;          /*`LV_ASSETS_FLAG_...`*/
+    void * map_handle;      /*Used by the functions that map the bundle*/
+} lv_assets_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an asset bundle which is already in the memory, e.g. a memory mapped flash partition.
+ * Only the header and the entry table are checked, nothing is copied.
+ * @param assets    pointer to an `lv_assets_t` variable to initialize
+ * @param data      start of the bundle. Must be 4 byte aligned.
+ * @param size      size of the memory area of the bundle, can be larger than the bundle itself
+ * @return          LV_RES_OK: valid bundle; LV_RES_INV: not a bundle or it doesn't fit in `size`
+ */
+lv_res_t lv_assets_init(lv_assets_t * assets, const void * data, uint32_t size);
+
+/**
+ * Find an asset in a bundle
+ * @param assets    pointer to an initialized bundle
+ * @param name      name of the asset
+ * @param type      store the type of the asset here (can be NULL)
+ * @param size      store the size of the asset here (can be NULL)
+ * @return          pointer to the data of the asset in the bundle or NULL if not found
+ */
+const void * lv_assets_get(const lv_assets_t * assets, const char * name, lv_assets_type_t * type, uint32_t * size);
+
+/**
+ * Get an image from a bundle. The descriptor points to the pixels in the bundle, so they are drawn
+ * from the mapped memory directly without copying or decoding them.
+ * @param assets    pointer to an initialized bundle
+ * @param name      name of the image
+ * @param dsc       initialize this descriptor. Used as image source so it should be static or allocated.
+ * @return          LV_RES_OK: the image is found; LV_RES_INV: not found or its color format can't be used
+ */
+lv_res_t lv_assets_get_img(const lv_assets_t * assets, const char * name, lv_img_dsc_t * dsc);
+
+/**
+ * Create a font from a bundle. The bitmaps, glyph descriptors, character maps and kerning tables
+ * are used from the bundle; only the descriptors of the font (~150 bytes) are allocated.
+ * Every table, glyph id and glyph bitmap of the font is checked to be in the font once here.
+ * @param assets    pointer to an initialized bundle
+ * @param name      name of the font
+ * @return          pointer to the new font or NULL if not found or not valid
+ */
+lv_font_t * lv_assets_load_font(const lv_assets_t * assets, const char * name);
+
+/**
+ * Free a font created by `lv_assets_load_font()`. The bundle is not affected.
+ * @param font      pointer to the font
+ */
+void lv_assets_free_font(lv_font_t * font);
+
+#if LV_ASSETS_POSIX_MMAP
+/**
+ * Map a bundle file with POSIX `mmap()` and initialize the bundle with it
+ * @param assets    pointer to an `lv_assets_t` variable to initialize
+ * @param path      path of the file (without drive letter)
+ * @return          LV_RES_OK: the file is mapped and valid; LV_RES_INV: error
+ */
+lv_res_t lv_assets_map_file(lv_assets_t * assets, const char * path);
+
+/**
+ * Unmap a bundle mapped by `lv_assets_map_file()`. The fonts and images of the bundle can't be used after it.
+ * The image cache is invalidated as it can refer to the images of the bundle.
+ * @param assets    pointer to the bundle
+ */
+void lv_assets_unmap_file(lv_assets_t * assets);
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_ASSETS*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ASSETS_H*/
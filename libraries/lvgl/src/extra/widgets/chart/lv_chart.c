@@ -36,10 +36,14 @@ static void draw_div_lines(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+static void draw_series_ring(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_chart_series_t * ser,
+                             lv_draw_line_dsc_t * line_dsc);
 static void draw_cursors(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_axes(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x);
 static void invalidate_point(lv_obj_t * obj, uint16_t i);
+static void invalidate_ring_push(lv_obj_t * obj, lv_chart_series_t * ser);
+static uint32_t get_ring_view_cnt(lv_obj_t * obj, lv_chart_series_t * ser);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
 
@@ -47,6 +51,7 @@ lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_chart_class = {
+    .name = "chart",
     .constructor_cb = lv_chart_constructor,
     .destructor_cb = lv_chart_destructor,
     .event_cb = lv_chart_event,
@@ -366,6 +371,7 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
     }
 
     ser->start_point = 0;
+    ser->ring = NULL;
     ser->y_ext_buf_assigned = false;
     ser->hidden = 0;
     ser->x_axis_sec = axis & LV_CHART_AXIS_SECONDARY_X ? 1 : 0;
@@ -424,6 +430,26 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint16_
     ser->start_point = id;
 }
 
+void lv_chart_set_series_ring(lv_obj_t * obj, lv_chart_series_t * ser, lv_chart_ring_t * ring)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    if(ser->ring == ring) return;
+    ser->ring = ring;
+    lv_chart_refresh(obj);
+}
+
+void lv_chart_set_ring_view_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->ring_view_cnt == cnt) return;
+    chart->ring_view_cnt = cnt;
+    lv_chart_refresh(obj);
+}
+
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -537,6 +563,12 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(ser);
 
+    if(ser->ring) {
+        lv_chart_ring_push(ser->ring, value);
+        invalidate_ring_push(obj, ser);
+        return;
+    }
+
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
     invalidate_point(obj, ser->start_point);
@@ -916,6 +948,11 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         line_dsc_default.color = ser->color;
         point_dsc_default.bg_color = ser->color;
 
+        if(ser->ring) {
+            draw_series_ring(obj, draw_ctx, ser, &line_dsc_default);
+            continue;
+        }
+
         lv_coord_t start_point = lv_chart_get_x_start_point(obj, ser);
 
         p1.x = x_ofs;
@@ -1034,6 +1071,96 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     draw_ctx->clip_area = clip_area_ori;
 }
 
+/**
+ * Draw a series whose points are in a ring. The newest sample is on the right edge.
+ * If there are less samples than pixels the samples are connected with lines,
+ * else every column gets one vertical line between the smallest and largest sample in it.
+ * Columns are bound to the absolute index of the samples so a column changes only when a sample is added to it.
+ */
+static void draw_series_ring(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_chart_series_t * ser,
+                             lv_draw_line_dsc_t * line_dsc)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_ring_t * ring = ser->ring;
+    uint32_t total = lv_chart_ring_get_total(ring);
+    if(total == 0) return;
+
+    lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+    lv_coord_t w     = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
+    lv_coord_t h     = ((int32_t)lv_obj_get_content_height(obj) * chart->zoom_y) >> 8;
+    lv_coord_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    lv_coord_t y_ofs = obj->coords.y1 + pad_top - lv_obj_get_scroll_top(obj);
+    lv_coord_t x_last = x_ofs + w - 1;
+    if(w <= 0) return;
+
+    lv_coord_t ymin = chart->ymin[ser->y_axis_sec];
+    int32_t yrange = chart->ymax[ser->y_axis_sec] - ymin;
+    if(yrange == 0) return;
+
+    /*Lines near the clip area can still reach into it*/
+    lv_coord_t clip_x1 = draw_ctx->clip_area->x1 - line_dsc->width;
+    lv_coord_t clip_x2 = draw_ctx->clip_area->x2 + line_dsc->width;
+
+    uint32_t view_cnt = get_ring_view_cnt(obj, ser);
+    uint32_t last = total - 1;
+    lv_point_t p1;
+    lv_point_t p2;
+
+    if(view_cnt < (uint32_t)w) {
+        if(view_cnt < 2) return;
+        uint32_t id = LV_MAX(lv_chart_ring_get_first(ring), total > view_cnt ? total - view_cnt : 0);
+        bool prev_valid = false;
+        for(; id < total; id++) {
+            lv_coord_t v = lv_chart_ring_get_value(ring, id);
+            p2.x = x_last - (lv_coord_t)(((int64_t)(last - id) * (w - 1)) / (view_cnt - 1));
+            if(v != LV_CHART_POINT_NONE) {
+                p2.y = h - (lv_coord_t)(((int32_t)v - ymin) * h / yrange) + y_ofs;
+                if(prev_valid && p2.x >= clip_x1 && p1.x <= clip_x2) {
+                    lv_draw_line(draw_ctx, line_dsc, &p1, &p2);
+                }
+            }
+            p1 = p2;
+            prev_valid = v != LV_CHART_POINT_NONE;
+        }
+        return;
+    }
+
+    uint64_t col_last = ((uint64_t)last * w) / view_cnt;
+    lv_coord_t x = LV_MAX(x_ofs, clip_x1);
+    lv_coord_t x_end = LV_MIN(x_last, clip_x2);
+    for(; x <= x_end; x++) {
+        uint64_t dist = x_last - x;
+        if(dist > col_last) continue;
+
+        /*The samples whose column is `col`*/
+        uint64_t col = col_last - dist;
+        uint32_t id_start = (uint32_t)((col * view_cnt + w - 1) / w);
+        uint32_t id_end = (uint32_t)(((col + 1) * view_cnt + w - 1) / w);
+
+        lv_coord_t v_min;
+        lv_coord_t v_max;
+        if(!lv_chart_ring_get_min_max(ring, id_start, id_end, &v_min, &v_max)) continue;
+
+        /*Connect to the last sample of the previous column*/
+        if(id_start > 0) {
+            lv_coord_t v_prev = lv_chart_ring_get_value(ring, id_start - 1);
+            if(v_prev != LV_CHART_POINT_NONE) {
+                v_min = LV_MIN(v_min, v_prev);
+                v_max = LV_MAX(v_max, v_prev);
+            }
+        }
+
+        p1.x = x;
+        p2.x = x;
+        p1.y = h - (lv_coord_t)(((int32_t)v_max - ymin) * h / yrange) + y_ofs;
+        p2.y = h - (lv_coord_t)(((int32_t)v_min - ymin) * h / yrange) + y_ofs;
+        if(p1.y == p2.y) p2.y++;    /*If they are the same no line will be drawn*/
+        lv_draw_line(draw_ctx, line_dsc, &p1, &p2);
+    }
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 {
 
@@ -1740,6 +1867,46 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
     }
 }
 
+static void invalidate_ring_push(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t total = lv_chart_ring_get_total(ser->ring);
+    uint32_t view_cnt = get_ring_view_cnt(obj, ser);
+    lv_coord_t w  = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
+
+    /*If the new sample went to the column of the previous one only that column changed.
+     *Else all columns are shifted to the left.*/
+    if(chart->type != LV_CHART_TYPE_LINE || ser->hidden || w <= 0 || total < 2 || view_cnt < (uint32_t)w ||
+       ((uint64_t)(total - 1) * w) / view_cnt != ((uint64_t)(total - 2) * w) / view_cnt) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_coord_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    lv_coord_t x_ofs = obj->coords.x1 + pleft + bwidth - lv_obj_get_scroll_left(obj);
+    lv_coord_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+
+    lv_area_t coords;
+    lv_area_copy(&coords, &obj->coords);
+    coords.x1 = x_ofs + w - 1 - line_width;
+    coords.x2 = x_ofs + w - 1 + line_width;
+    lv_obj_invalidate_area(obj, &coords);
+
+    /*The oldest sample was dropped from the leftmost column*/
+    if(total > ser->ring->cap) {
+        coords.x1 = x_ofs - line_width;
+        coords.x2 = x_ofs + line_width;
+        lv_obj_invalidate_area(obj, &coords);
+    }
+}
+
+static uint32_t get_ring_view_cnt(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->ring_view_cnt ? chart->ring_view_cnt : ser->ring->cap;
+}
+
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a)
 {
     if((*a) == NULL) return;
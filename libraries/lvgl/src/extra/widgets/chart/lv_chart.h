@@ -17,6 +17,8 @@ extern "C" {
 
 #if LV_USE_CHART != 0
 
+#include "lv_chart_ring.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -71,6 +73,7 @@ typedef uint8_t lv_chart_axis_t;
 typedef struct {
     lv_coord_t * x_points;
     lv_coord_t * y_points;
+    lv_chart_ring_t * ring;     /**< If set the points are taken from this ring instead of `y_points`*/
     lv_color_t color;
     uint16_t start_point;
     uint8_t hidden : 1;
@@ -111,6 +114,7 @@ typedef struct {
     uint16_t hdiv_cnt;      /**< Number of horizontal division lines*/
     uint16_t vdiv_cnt;      /**< Number of vertical division lines*/
     uint16_t point_cnt;    /**< Point number in a data line*/
+    uint32_t ring_view_cnt; /**< Number of ring samples across the width. 0: the capacity of the ring*/
     uint16_t zoom_x;
     uint16_t zoom_y;
     lv_chart_type_t type  : 3; /**< Line or column chart*/
@@ -306,6 +310,25 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
  */
 void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id);
 
+/**
+ * Take the points of a series from a ring instead of the point array.
+ * The newest sample is drawn on the right edge and at most one line is drawn in every column
+ * from the minimum to the maximum of the samples falling into it. Works only with `LV_CHART_TYPE_LINE`.
+ * `lv_chart_set_next_value()` adds the new sample to the ring and invalidates only the newest column if possible.
+ * NOTE: It is the users responsibility to keep the ring alive while the series uses it.
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param ring      pointer to a ring created with `lv_chart_ring_create()` or NULL to use the point array again
+ */
+void lv_chart_set_series_ring(lv_obj_t * obj, lv_chart_series_t * ser, lv_chart_ring_t * ring);
+
+/**
+ * Set how many of the newest samples of the rings are shown across the width of the chart
+ * @param obj       pointer to a chart object
+ * @param cnt       number of samples or 0 to show all samples of the rings
+ */
+void lv_chart_set_ring_view_count(lv_obj_t * obj, uint32_t cnt);
+
 /**
  * Get the next series.
  * @param chart     pointer to a chart
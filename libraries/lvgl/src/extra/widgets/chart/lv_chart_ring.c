@@ -0,0 +1,196 @@
+/**
+ * @file lv_chart_ring.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_chart.h"
+#if LV_USE_CHART != 0
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Number of samples in a bucket of a level*/
+#define BUCKET_SIZE(level)  ((uint32_t)1 << (LV_CHART_RING_LOD_SHIFT * ((level) + 1)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline void merge(lv_coord_t v_min, lv_coord_t v_max, lv_coord_t * min, lv_coord_t * max, bool * found);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_chart_ring_t * lv_chart_ring_create(uint32_t cap)
+{
+    LV_ASSERT(cap > 0);
+
+    lv_chart_ring_t * ring = lv_mem_alloc(sizeof(lv_chart_ring_t));
+    LV_ASSERT_MALLOC(ring);
+    if(ring == NULL) return NULL;
+    lv_memset_00(ring, sizeof(lv_chart_ring_t));
+    ring->cap = cap;
+
+    ring->samples = lv_mem_alloc(cap * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(ring->samples);
+    if(ring->samples == NULL) {
+        lv_chart_ring_del(ring);
+        return NULL;
+    }
+
+    /*Add levels while a bucket is smaller than the ring.
+     *Keep 2 more buckets than needed for `cap` samples:
+     *the bucket being filled mustn't overwrite the one of the oldest sample*/
+    while(ring->lod_cnt < LV_CHART_RING_LOD_MAX && BUCKET_SIZE(ring->lod_cnt) < cap) {
+        uint32_t size = cap / BUCKET_SIZE(ring->lod_cnt) + 2;
+        ring->lod[ring->lod_cnt] = lv_mem_alloc(size * sizeof(lv_chart_ring_minmax_t));
+        LV_ASSERT_MALLOC(ring->lod[ring->lod_cnt]);
+        if(ring->lod[ring->lod_cnt] == NULL) {
+            lv_chart_ring_del(ring);
+            return NULL;
+        }
+        ring->lod_size[ring->lod_cnt] = size;
+        ring->lod_cnt++;
+    }
+
+    return ring;
+}
+
+void lv_chart_ring_del(lv_chart_ring_t * ring)
+{
+    if(ring == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_CHART_RING_LOD_MAX; i++) {
+        if(ring->lod[i]) lv_mem_free(ring->lod[i]);
+    }
+    if(ring->samples) lv_mem_free(ring->samples);
+    lv_mem_free(ring);
+}
+
+void lv_chart_ring_clear(lv_chart_ring_t * ring)
+{
+    LV_ASSERT_NULL(ring);
+    ring->total = 0;
+}
+
+void lv_chart_ring_push(lv_chart_ring_t * ring, lv_coord_t value)
+{
+    LV_ASSERT_NULL(ring);
+
+    uint32_t id = ring->total;
+    ring->samples[id % ring->cap] = value;
+    ring->total++;
+
+    uint32_t level;
+    for(level = 0; level < ring->lod_cnt; level++) {
+        uint32_t bucket_size = BUCKET_SIZE(level);
+        lv_chart_ring_minmax_t * b = &ring->lod[level][(id / bucket_size) % ring->lod_size[level]];
+        /*The first sample of a bucket*/
+        if(id % bucket_size == 0) {
+            b->min = value;
+            b->max = value;
+        }
+        else if(value != LV_CHART_POINT_NONE) {
+            if(b->min == LV_CHART_POINT_NONE) {
+                b->min = value;
+                b->max = value;
+            }
+            else {
+                if(value < b->min) b->min = value;
+                if(value > b->max) b->max = value;
+            }
+        }
+    }
+}
+
+uint32_t lv_chart_ring_get_total(const lv_chart_ring_t * ring)
+{
+    LV_ASSERT_NULL(ring);
+    return ring->total;
+}
+
+uint32_t lv_chart_ring_get_first(const lv_chart_ring_t * ring)
+{
+    LV_ASSERT_NULL(ring);
+    return ring->total > ring->cap ? ring->total - ring->cap : 0;
+}
+
+lv_coord_t lv_chart_ring_get_value(const lv_chart_ring_t * ring, uint32_t id)
+{
+    LV_ASSERT_NULL(ring);
+    if(id >= ring->total || id < lv_chart_ring_get_first(ring)) return LV_CHART_POINT_NONE;
+    return ring->samples[id % ring->cap];
+}
+
+bool lv_chart_ring_get_min_max(const lv_chart_ring_t * ring, uint32_t first, uint32_t end, lv_coord_t * min,
+                               lv_coord_t * max)
+{
+    LV_ASSERT_NULL(ring);
+
+    uint32_t first_valid = lv_chart_ring_get_first(ring);
+    if(first < first_valid) first = first_valid;
+    if(end > ring->total) end = ring->total;
+
+    /*Take the largest bucket which starts at `first` and fits into the range.
+     *So only a few samples and buckets are read on the two ends and the largest buckets in the middle.*/
+    bool found = false;
+    while(first < end) {
+        uint32_t level;
+        for(level = 0; level < ring->lod_cnt; level++) {
+            uint32_t bucket_size = BUCKET_SIZE(level);
+            if(first % bucket_size != 0 || end - first < bucket_size) break;
+        }
+
+        if(level == 0) {
+            lv_coord_t v = ring->samples[first % ring->cap];
+            merge(v, v, min, max, &found);
+            first++;
+        }
+        else {
+            level--;
+            uint32_t bucket_size = BUCKET_SIZE(level);
+            const lv_chart_ring_minmax_t * b = &ring->lod[level][(first / bucket_size) % ring->lod_size[level]];
+            merge(b->min, b->max, min, max, &found);
+            first += bucket_size;
+        }
+    }
+
+    return found;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline void merge(lv_coord_t v_min, lv_coord_t v_max, lv_coord_t * min, lv_coord_t * max, bool * found)
+{
+    if(v_min == LV_CHART_POINT_NONE) return;
+
+    if(!*found) {
+        *min = v_min;
+        *max = v_max;
+        *found = true;
+    }
+    else {
+        if(v_min < *min) *min = v_min;
+        if(v_max > *max) *max = v_max;
+    }
+}
+
+#endif /*LV_USE_CHART*/
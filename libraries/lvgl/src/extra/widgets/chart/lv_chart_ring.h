@@ -0,0 +1,131 @@
+/**
+ * @file lv_chart_ring.h
+ *
+ */
+
+#ifndef LV_CHART_RING_H
+#define LV_CHART_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+
+#if LV_USE_CHART != 0
+
+#include "../../../misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**Every level of the min/max pyramid merges this many buckets of the level below*/
+#define LV_CHART_RING_LOD_SHIFT 2
+
+/**Maximal number of levels of the min/max pyramid*/
+#define LV_CHART_RING_LOD_MAX   8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_coord_t min;
+    lv_coord_t max;
+} lv_chart_ring_minmax_t;
+
+/**
+ * A fixed size ring of samples for a chart series.
+ * Besides the samples it keeps the minimum and maximum of 4, 16, 64 ... samples
+ * so the min/max of any range can be get by reading only a few values.
+ * The samples are addressed by their absolute index: the number of samples pushed before them.
+ */
+typedef struct {
+    lv_coord_t * samples;
+    lv_chart_ring_minmax_t * lod[LV_CHART_RING_LOD_MAX];    /**< Buckets of the levels*/
+    uint32_t lod_size[LV_CHART_RING_LOD_MAX];               /**< Number of buckets on the levels*/
+    uint32_t cap;                                           /**< Number of samples kept*/
+    uint32_t total;                                         /**< Number of samples pushed since the last clear*/
+    uint8_t lod_cnt;                                        /**< Number of levels*/
+} lv_chart_ring_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a ring for samples
+ * @param cap       number of samples to keep
+ * @return          the new ring or NULL if out of memory
+ */
+lv_chart_ring_t * lv_chart_ring_create(uint32_t cap);
+
+/**
+ * Delete a ring. It must not be used by a chart series anymore.
+ * @param ring      pointer to a ring
+ */
+void lv_chart_ring_del(lv_chart_ring_t * ring);
+
+/**
+ * Remove all samples from a ring
+ * @param ring      pointer to a ring
+ */
+void lv_chart_ring_clear(lv_chart_ring_t * ring);
+
+/**
+ * Add a sample to a ring. If the ring is full the oldest sample is dropped.
+ * To add a sample to a ring shown by a chart use `lv_chart_set_next_value()` to refresh the chart too.
+ * @param ring      pointer to a ring
+ * @param value     the new sample or `LV_CHART_POINT_NONE` for a gap
+ */
+void lv_chart_ring_push(lv_chart_ring_t * ring, lv_coord_t value);
+
+/**
+ * Get the number of samples pushed since the last clear. It's also the absolute index of the next sample.
+ * @param ring      pointer to a ring
+ * @return          number of pushed samples
+ */
+uint32_t lv_chart_ring_get_total(const lv_chart_ring_t * ring);
+
+/**
+ * Get the absolute index of the oldest sample still in the ring
+ * @param ring      pointer to a ring
+ * @return          absolute index of the oldest sample
+ */
+uint32_t lv_chart_ring_get_first(const lv_chart_ring_t * ring);
+
+/**
+ * Get a sample
+ * @param ring      pointer to a ring
+ * @param id        absolute index of the sample
+ * @return          the sample or `LV_CHART_POINT_NONE` if it was dropped, not pushed yet or it's a gap
+ */
+lv_coord_t lv_chart_ring_get_value(const lv_chart_ring_t * ring, uint32_t id);
+
+/**
+ * Get the smallest and largest sample in a range
+ * @param ring      pointer to a ring
+ * @param first     absolute index of the first sample
+ * @param end       absolute index after the last sample
+ * @param min       store the smallest sample here
+ * @param max       store the largest sample here
+ * @return          true: there was at least one sample in the range; false: `min` and `max` are not set
+ */
+bool lv_chart_ring_get_min_max(const lv_chart_ring_t * ring, uint32_t first, uint32_t end, lv_coord_t * min,
+                               lv_coord_t * max);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_CHART*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CHART_RING_H*/
@@ -57,6 +57,7 @@ const lv_obj_class_t lv_colorwheel_class = {.instance_size = sizeof(lv_colorwhee
                                             .width_def = LV_DPI_DEF * 2,
                                             .height_def = LV_DPI_DEF * 2,
                                             .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
+                                            .name = "colorwheel",
                                            };
 
 static bool create_knob_recolor;
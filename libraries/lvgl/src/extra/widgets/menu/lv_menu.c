@@ -36,6 +36,7 @@ static void lv_menu_cont_constructor(const lv_obj_class_t * class_p, lv_obj_t *
 static void lv_menu_section_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 
 const lv_obj_class_t lv_menu_class = {
+    .name = "menu",
     .constructor_cb = lv_menu_constructor,
     .destructor_cb = lv_menu_destructor,
     .base_class = &lv_obj_class,
@@ -44,6 +45,7 @@ const lv_obj_class_t lv_menu_class = {
     .instance_size = sizeof(lv_menu_t)
 };
 const lv_obj_class_t lv_menu_page_class = {
+    .name = "menu_page",
     .constructor_cb = lv_menu_page_constructor,
     .destructor_cb = lv_menu_page_destructor,
     .base_class = &lv_obj_class,
@@ -53,6 +55,7 @@ const lv_obj_class_t lv_menu_page_class = {
 };
 
 const lv_obj_class_t lv_menu_cont_class = {
+    .name = "menu_cont",
     .constructor_cb = lv_menu_cont_constructor,
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
@@ -60,6 +63,7 @@ const lv_obj_class_t lv_menu_cont_class = {
 };
 
 const lv_obj_class_t lv_menu_section_class = {
+    .name = "menu_section",
     .constructor_cb = lv_menu_section_constructor,
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
@@ -67,24 +71,29 @@ const lv_obj_class_t lv_menu_section_class = {
 };
 
 const lv_obj_class_t lv_menu_separator_class = {
+    .name = "menu_separator",
     .base_class = &lv_obj_class,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT
 };
 
 const lv_obj_class_t lv_menu_sidebar_cont_class = {
+    .name = "menu_sidebar_cont",
     .base_class = &lv_obj_class
 };
 
 const lv_obj_class_t lv_menu_main_cont_class = {
+    .name = "menu_main_cont",
     .base_class = &lv_obj_class
 };
 
 const lv_obj_class_t lv_menu_main_header_cont_class = {
+    .name = "menu_main_header_cont",
     .base_class = &lv_obj_class
 };
 
 const lv_obj_class_t lv_menu_sidebar_header_cont_class = {
+    .name = "menu_sidebar_header_cont",
     .base_class = &lv_obj_class
 };
 
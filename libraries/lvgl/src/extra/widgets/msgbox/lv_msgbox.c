@@ -30,6 +30,7 @@ static void msgbox_close_click_event_cb(lv_event_t * e);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_msgbox_class = {
+    .name = "msgbox",
     .base_class = &lv_obj_class,
     .width_def = LV_DPI_DEF * 2,
     .height_def = LV_SIZE_CONTENT,
@@ -37,6 +38,7 @@ const lv_obj_class_t lv_msgbox_class = {
 };
 
 const lv_obj_class_t lv_msgbox_content_class = {
+    .name = "msgbox_content",
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
     .height_def = LV_SIZE_CONTENT,
@@ -44,6 +46,7 @@ const lv_obj_class_t lv_msgbox_content_class = {
 };
 
 const lv_obj_class_t lv_msgbox_backdrop_class = {
+    .name = "msgbox_backdrop",
     .base_class = &lv_obj_class,
     .width_def = LV_PCT(100),
     .height_def = LV_PCT(100),
@@ -69,6 +69,7 @@ static lv_coord_t convert_indent_pct(lv_obj_t * spans, lv_coord_t width);
 static struct _snippet_stack snippet_stack;
 
 const lv_obj_class_t lv_spangroup_class  = {
+    .name = "spangroup",
     .base_class = &lv_obj_class,
     .constructor_cb = lv_spangroup_constructor,
     .destructor_cb = lv_spangroup_destructor,
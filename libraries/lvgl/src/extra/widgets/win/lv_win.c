@@ -26,6 +26,7 @@ static void lv_win_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_win_class = {
+    .name = "win",
     .constructor_cb = lv_win_constructor,
     .width_def = LV_PCT(100),
     .height_def = LV_PCT(100),
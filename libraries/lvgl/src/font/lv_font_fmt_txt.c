@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_printf.h"
 
 /*********************
  *      DEFINES
@@ -36,6 +37,8 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
+static uint32_t build_kern_classes(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t glyph_cnt, uint8_t * tmp,
+                                   uint32_t * right_class_cnt);
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter);
@@ -189,6 +192,117 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+lv_res_t lv_font_fmt_txt_build_lut(const lv_font_t * font, uint32_t letter_cnt)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(font->get_glyph_dsc != lv_font_get_glyph_dsc_fmt_txt || fdsc->cache == NULL) {
+        LV_LOG_WARN("the font is not in LVGL's format or has no glyph cache");
+        return LV_RES_INV;
+    }
+
+    lv_font_fmt_txt_free_lut(font);
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+
+    /*Find the last code point with glyph and the largest glyph id to size the tables*/
+    if(letter_cnt > UINT16_MAX) letter_cnt = UINT16_MAX;
+    uint32_t lut_size = 0;
+    uint32_t glyph_cnt = 0;
+    uint32_t letter;
+    for(letter = 1; letter < letter_cnt; letter++) {
+        uint32_t gid = get_glyph_dsc_id(font, letter);
+        if(gid == 0) continue;
+        if(gid > UINT16_MAX) return LV_RES_INV;
+        lut_size = letter + 1;
+        if(gid >= glyph_cnt) glyph_cnt = gid + 1;
+    }
+
+    if(lut_size == 0) return LV_RES_INV;
+
+    /*Collect the kerning pairs of the indexed glyphs to a class matrix.
+     *It's not worth it above 256 glyphs, the matrix to find the classes would be too large*/
+    uint32_t left_class_cnt = 0;
+    uint32_t right_class_cnt = 0;
+    uint8_t * kern_tmp = NULL;
+    if(fdsc->kern_dsc && fdsc->kern_classes == 0 && glyph_cnt <= 256) {
+        kern_tmp = lv_mem_alloc(glyph_cnt * glyph_cnt + glyph_cnt * 2);
+        if(kern_tmp) {
+            left_class_cnt = build_kern_classes(fdsc, glyph_cnt, kern_tmp, &right_class_cnt);
+            if(left_class_cnt == 0) {
+                lv_mem_free(kern_tmp);
+                kern_tmp = NULL;
+            }
+        }
+    }
+
+    uint32_t matrix_size = left_class_cnt * right_class_cnt;
+    uint32_t size = lut_size * sizeof(uint16_t);
+    if(kern_tmp) size += matrix_size + glyph_cnt * 2;
+
+    uint8_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) {
+        LV_LOG_WARN("couldn't allocate %" LV_PRIu32 " bytes for the lookup tables", size);
+        if(kern_tmp) lv_mem_free(kern_tmp);
+        return LV_RES_INV;
+    }
+
+    uint16_t * gid_lut = (uint16_t *)buf;
+    gid_lut[0] = 0;
+    for(letter = 1; letter < lut_size; letter++) {
+        gid_lut[letter] = (uint16_t)get_glyph_dsc_id(font, letter);
+    }
+
+    if(kern_tmp) {
+        /*The class maps are after the matrix in `kern_tmp`. Keep the first element of every class in the matrix*/
+        int8_t * class_values = (int8_t *)(buf + lut_size * sizeof(uint16_t));
+        uint8_t * left_class = (uint8_t *)class_values + matrix_size;
+        uint8_t * right_class = left_class + glyph_cnt;
+        lv_memcpy(left_class, kern_tmp + glyph_cnt * glyph_cnt, glyph_cnt * 2);
+
+        uint32_t l;
+        uint32_t r;
+        for(l = 0; l < glyph_cnt; l++) {
+            if(left_class[l] == 0) continue;
+            for(r = 0; r < glyph_cnt; r++) {
+                if(right_class[r] == 0) continue;
+                class_values[(left_class[l] - 1) * right_class_cnt + (right_class[r] - 1)] =
+                    (int8_t)kern_tmp[l * glyph_cnt + r];
+            }
+        }
+        lv_mem_free(kern_tmp);
+
+        cache->kern_class_values = class_values;
+        cache->kern_left_class = left_class;
+        cache->kern_right_class = right_class;
+        cache->kern_right_class_cnt = (uint8_t)right_class_cnt;
+        cache->kern_glyph_cnt = (uint16_t)glyph_cnt;
+    }
+
+    cache->lut_size = (uint16_t)lut_size;
+    cache->gid_lut = gid_lut;
+
+    return LV_RES_OK;
+}
+
+void lv_font_fmt_txt_free_lut(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache == NULL || cache->gid_lut == NULL) return;
+
+    lv_mem_free(cache->gid_lut);
+    cache->gid_lut = NULL;
+    cache->lut_size = 0;
+    cache->kern_class_values = NULL;
+    cache->kern_left_class = NULL;
+    cache->kern_right_class = NULL;
+    cache->kern_glyph_cnt = 0;
+    cache->kern_right_class_cnt = 0;
+}
+
 /**
  * Free the allocated memories.
  */
@@ -213,14 +327,17 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
     /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    if(fdsc->cache) {
+        if(letter < fdsc->cache->lut_size) return fdsc->cache->gid_lut[letter];
+        if(letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    }
 
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
         /*Relative code point*/
         uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp > fdsc->cmaps[i].range_length) continue;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
         uint32_t glyph_id = 0;
         if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
             glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
@@ -273,6 +390,17 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 
     int8_t value = 0;
 
+    /*Use the class matrix built from the kerning pairs if both glyphs are in it*/
+    const lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache && gid_left < cache->kern_glyph_cnt && gid_right < cache->kern_glyph_cnt) {
+        uint8_t left_class = cache->kern_left_class[gid_left];
+        uint8_t right_class = cache->kern_right_class[gid_right];
+        if(left_class > 0 && right_class > 0) {
+            value = cache->kern_class_values[(left_class - 1) * cache->kern_right_class_cnt + (right_class - 1)];
+        }
+        return value;
+    }
+
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
@@ -323,6 +451,82 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+/**
+ * Sort the glyphs below `glyph_cnt` to kerning classes. Glyphs with the same kerning values get the same class.
+ * @param fdsc              font descriptor with kerning pairs
+ * @param glyph_cnt         number of glyph ids to handle
+ * @param tmp               `glyph_cnt * glyph_cnt` bytes for the kerning values
+ *                          followed by `glyph_cnt` left and `glyph_cnt` right classes.
+ *                          Class 0 means there is no kerning.
+ * @param right_class_cnt   store the number of right classes here
+ * @return                  the number of left classes or 0 if there is no kerning or too many classes
+ */
+static uint32_t build_kern_classes(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t glyph_cnt, uint8_t * tmp,
+                                   uint32_t * right_class_cnt)
+{
+    const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+    int8_t * m = (int8_t *)tmp;
+    uint8_t * left_class = tmp + glyph_cnt * glyph_cnt;
+    uint8_t * right_class = left_class + glyph_cnt;
+    lv_memset_00(tmp, glyph_cnt * glyph_cnt + glyph_cnt * 2);
+
+    uint32_t i;
+    for(i = 0; i < kdsc->pair_cnt; i++) {
+        uint32_t l;
+        uint32_t r;
+        if(kdsc->glyph_ids_size == 0) {
+            const uint8_t * ids = kdsc->glyph_ids;
+            l = ids[i * 2];
+            r = ids[i * 2 + 1];
+        }
+        else if(kdsc->glyph_ids_size == 1) {
+            const uint16_t * ids = kdsc->glyph_ids;
+            l = ids[i * 2];
+            r = ids[i * 2 + 1];
+        }
+        else {
+            return 0;
+        }
+        if(l < glyph_cnt && r < glyph_cnt) m[l * glyph_cnt + r] = kdsc->values[i];
+    }
+
+    /*Same row: same left class*/
+    uint32_t left_cnt = 0;
+    uint32_t a;
+    uint32_t b;
+    for(a = 0; a < glyph_cnt; a++) {
+        const int8_t * row_a = &m[a * glyph_cnt];
+        for(i = 0; i < glyph_cnt && row_a[i] == 0; i++);
+        if(i == glyph_cnt) continue;
+
+        for(b = 0; b < a; b++) {
+            if(left_class[b] && memcmp(row_a, &m[b * glyph_cnt], glyph_cnt) == 0) break;
+        }
+        if(b < a) left_class[a] = left_class[b];
+        else if(left_cnt < 255) left_class[a] = ++left_cnt;
+        else return 0;
+    }
+
+    /*Same column: same right class*/
+    uint32_t right_cnt = 0;
+    for(a = 0; a < glyph_cnt; a++) {
+        for(i = 0; i < glyph_cnt && m[i * glyph_cnt + a] == 0; i++);
+        if(i == glyph_cnt) continue;
+
+        for(b = 0; b < a; b++) {
+            if(right_class[b] == 0) continue;
+            for(i = 0; i < glyph_cnt && m[i * glyph_cnt + a] == m[i * glyph_cnt + b]; i++);
+            if(i == glyph_cnt) break;
+        }
+        if(b < a) right_class[a] = right_class[b];
+        else if(right_cnt < 255) right_class[a] = ++right_cnt;
+        else return 0;
+    }
+
+    *right_class_cnt = right_cnt;
+    return left_cnt;
+}
+
 static int32_t kern_pair_8_compare(const void * ref, const void * element)
 {
     const uint8_t * ref8_p = ref;
@@ -17,6 +17,7 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 #include "lv_font.h"
+#include "../misc/lv_types.h"
 
 /*********************
  *      DEFINES
@@ -154,6 +155,15 @@ typedef enum {
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+
+    /*Optional lookup tables created by `lv_font_fmt_txt_build_lut()`. Stored in one allocation starting at `gid_lut`*/
+    uint16_t * gid_lut;                 /*Glyph id of the code points 0..lut_size-1*/
+    const int8_t * kern_class_values;   /*Kerning class matrix, like `lv_font_fmt_txt_kern_classes_t`*/
+    const uint8_t * kern_left_class;    /*Left class of the glyph ids 0..kern_glyph_cnt-1*/
+    const uint8_t * kern_right_class;   /*Right class of the glyph ids 0..kern_glyph_cnt-1*/
+    uint16_t lut_size;
+    uint16_t kern_glyph_cnt;            /*0: no kerning matrix, search in the kerning pairs*/
+    uint8_t kern_right_class_cnt;
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -220,6 +230,23 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t lett
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Create direct lookup tables for a font to find the glyphs of the code points `0..letter_cnt-1`
+ * and their kerning values without searching. Meant to be called once for every font when the UI is created.
+ * The kerning pairs of these glyphs are converted to a class matrix.
+ * Requires the `cache` field of the font's descriptor.
+ * @param font          pointer to a font in LVGL's native format
+ * @param letter_cnt    number of code points to index, e.g. 0x80 for ASCII or 0x100 for Latin-1
+ * @return              LV_RES_OK: the tables are created; LV_RES_INV: not enough memory or not supported font
+ */
+lv_res_t lv_font_fmt_txt_build_lut(const lv_font_t * font, uint32_t letter_cnt);
+
+/**
+ * Free the lookup tables created by `lv_font_fmt_txt_build_lut()`.
+ * @param font          pointer to a font in LVGL's native format
+ */
+void lv_font_fmt_txt_free_lut(const lv_font_t * font);
+
 /**
  * Free the allocated memories.
  */
@@ -13,6 +13,7 @@
 #include "../lvgl.h"
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
+#include "../draw/sw/lv_draw_sw_glyph_cache.h"
 
 /**********************
  *      TYPEDEFS
@@ -117,6 +118,9 @@ lv_font_t * lv_font_load(const char * font_name)
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_draw_sw_glyph_cache_invalidate_font(font);
+        lv_txt_layout_invalidate_font(font);
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
@@ -172,6 +176,10 @@ void lv_font_free(lv_font_t * font)
             if(NULL != dsc->glyph_dsc) {
                 lv_mem_free((void *)dsc->glyph_dsc);
             }
+            if(NULL != dsc->cache) {
+                lv_font_fmt_txt_free_lut(font);
+                lv_mem_free(dsc->cache);
+            }
             lv_mem_free(dsc);
         }
         lv_mem_free(font);
@@ -489,6 +497,10 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     font->dsc = font_dsc;
 
+    /*Needed for the last letter cache and `lv_font_fmt_txt_build_lut()`*/
+    font_dsc->cache = lv_mem_alloc(sizeof(lv_font_fmt_txt_glyph_cache_t));
+    if(font_dsc->cache) memset(font_dsc->cache, 0, sizeof(lv_font_fmt_txt_glyph_cache_t));
+
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
     if(header_length < 0) {
@@ -14,11 +14,13 @@
 #include "../misc/lv_mem.h"
 #include "../misc/lv_gc.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_profiler.h"
 #include "../core/lv_obj.h"
 #include "../core/lv_refr.h"
 #include "../core/lv_theme.h"
 #include "../draw/sdl/lv_draw_sdl.h"
 #include "../draw/sw/lv_draw_sw.h"
+#include "../draw/sw/lv_draw_sw_mt.h"
 #include "../draw/sdl/lv_draw_sdl.h"
 #include "../draw/stm32_dma2d/lv_gpu_stm32_dma2d.h"
 #include "../draw/swm341_dma2d/lv_gpu_swm341_dma2d.h"
@@ -124,6 +126,10 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->draw_ctx_init = lv_draw_arm2d_ctx_init;
     driver->draw_ctx_deinit = lv_draw_arm2d_ctx_init;
     driver->draw_ctx_size = sizeof(lv_draw_arm2d_ctx_t);
+#elif LV_USE_DRAW_SW_MT
+    driver->draw_ctx_init = lv_draw_sw_mt_ctx_init;
+    driver->draw_ctx_deinit = lv_draw_sw_mt_ctx_deinit;
+    driver->draw_ctx_size = sizeof(lv_draw_sw_mt_ctx_t);
 #else
     driver->draw_ctx_init = lv_draw_sw_init_ctx;
     driver->draw_ctx_deinit = lv_draw_sw_init_ctx;
@@ -518,6 +524,8 @@ lv_coord_t lv_disp_get_dpi(const lv_disp_t * disp)
  */
 void LV_ATTRIBUTE_FLUSH_READY lv_disp_flush_ready(lv_disp_drv_t * disp_drv)
 {
+    LV_PROFILER_END_TRACK("flush", LV_PROFILER_TRACK_FLUSH);
+
     disp_drv->draw_buf->flushing = 0;
     disp_drv->draw_buf->flushing_last = 0;
 }
@@ -102,6 +102,11 @@ typedef struct _lv_disp_drv_t {
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
+    /** OPTIONAL: Fixed time of a `flush_cb` call (command setup, waiting for tearing sync, etc.) given in
+     * how many pixels could be rendered and sent meanwhile. If set, the invalidated areas are joined whenever
+     * it makes the refresh faster, not only if they overlap. 0: join only overlapping areas*/
+    uint32_t flush_cost;
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
     void (*flush_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
@@ -188,6 +188,18 @@
     #endif
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Size of the arena of a slab allocator in bytes (multiple of 1024). 0: disable.
+ *The allocations up to 256 bytes (objects, styles, event descriptors, timers, animations) are stored in
+ *size classes in this arena. It's a normal array, so it's in the internal RAM on MCUs with external RAM.
+ *The larger allocations and the ones which don't fit anymore use the allocator above.*/
+#ifndef LV_MEM_SLAB_SIZE
+    #ifdef CONFIG_LV_MEM_SLAB_SIZE
+        #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+    #else
+        #define LV_MEM_SLAB_SIZE 0
+    #endif
+#endif
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #ifndef LV_MEM_BUF_MAX_NUM
@@ -303,8 +315,8 @@
     #endif
 
     /* Set number of maximally cached circle data.
-    * The circumference of 1/4 circle are saved for anti-aliasing
-    * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+    * The circumference of 1/4 circle are saved for anti-aliasing, ordered for the left and right corners
+    * radius * 12 bytes are used per circle (the most often used radiuses are saved and kept between refreshes)
     * 0: to disable caching */
     #ifndef LV_CIRCLE_CACHE_SIZE
         #ifdef CONFIG_LV_CIRCLE_CACHE_SIZE
@@ -356,6 +368,17 @@
     #endif
 #endif
 
+/*Memory budget of the image cache in bytes.
+ *The least recently used images are closed while the decoded images are larger than this.
+ *0: limit only the number of images with LV_IMG_CACHE_DEF_SIZE*/
+#ifndef LV_IMG_CACHE_MEM_SIZE
+    #ifdef CONFIG_LV_IMG_CACHE_MEM_SIZE
+        #define LV_IMG_CACHE_MEM_SIZE CONFIG_LV_IMG_CACHE_MEM_SIZE
+    #else
+        #define LV_IMG_CACHE_MEM_SIZE 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -379,6 +402,53 @@
     #endif
 #endif
 
+/*Default glyph cache size in bytes.
+ *The software renderer keeps the recently drawn letters as 8 bit opacity maps,
+ *so the glyphs of compressed or large fonts are not decompressed and converted again on every redraw.
+ *The least recently used glyphs are dropped when the cache is full.
+ *0: to disable caching*/
+#ifndef LV_GLYPH_CACHE_DEF_SIZE
+    #ifdef CONFIG_LV_GLYPH_CACHE_DEF_SIZE
+        #define LV_GLYPH_CACHE_DEF_SIZE CONFIG_LV_GLYPH_CACHE_DEF_SIZE
+    #else
+        #define LV_GLYPH_CACHE_DEF_SIZE 0
+    #endif
+#endif
+#if LV_GLYPH_CACHE_DEF_SIZE
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #ifndef LV_GLYPH_CACHE_CUSTOM
+        #ifdef CONFIG_LV_GLYPH_CACHE_CUSTOM
+            #define LV_GLYPH_CACHE_CUSTOM CONFIG_LV_GLYPH_CACHE_CUSTOM
+        #else
+            #define LV_GLYPH_CACHE_CUSTOM 0
+        #endif
+    #endif
+    #if LV_GLYPH_CACHE_CUSTOM
+        #ifndef LV_GLYPH_CACHE_CUSTOM_INCLUDE
+            #ifdef CONFIG_LV_GLYPH_CACHE_CUSTOM_INCLUDE
+                #define LV_GLYPH_CACHE_CUSTOM_INCLUDE CONFIG_LV_GLYPH_CACHE_CUSTOM_INCLUDE
+            #else
+                #define LV_GLYPH_CACHE_CUSTOM_INCLUDE <stdlib.h>   /*Header for the allocator*/
+            #endif
+        #endif
+        #ifndef LV_GLYPH_CACHE_CUSTOM_ALLOC
+            #ifdef CONFIG_LV_GLYPH_CACHE_CUSTOM_ALLOC
+                #define LV_GLYPH_CACHE_CUSTOM_ALLOC CONFIG_LV_GLYPH_CACHE_CUSTOM_ALLOC
+            #else
+                #define LV_GLYPH_CACHE_CUSTOM_ALLOC   malloc
+            #endif
+        #endif
+        #ifndef LV_GLYPH_CACHE_CUSTOM_FREE
+            #ifdef CONFIG_LV_GLYPH_CACHE_CUSTOM_FREE
+                #define LV_GLYPH_CACHE_CUSTOM_FREE CONFIG_LV_GLYPH_CACHE_CUSTOM_FREE
+            #else
+                #define LV_GLYPH_CACHE_CUSTOM_FREE    free
+            #endif
+        #endif
+    #endif
+#endif
+
 /*Allow dithering the gradients (to achieve visual smooth color gradients on limited color depth display)
  *LV_DITHER_GRADIENT implies allocating one or two more lines of the object's rendering surface
  *The increase in memory consumption is (32 bits * object width) plus 24 bits * object width if using error diffusion */
@@ -412,6 +482,39 @@
     #endif
 #endif
 
+/*Render the large fills and image blits in horizontal bands on helper threads too (e.g. on the second core).
+ *Requires pthreads. The result is pixel-identical to the single threaded rendering.*/
+#ifndef LV_USE_DRAW_SW_MT
+    #ifdef CONFIG_LV_USE_DRAW_SW_MT
+        #define LV_USE_DRAW_SW_MT CONFIG_LV_USE_DRAW_SW_MT
+    #else
+        #define LV_USE_DRAW_SW_MT 0
+    #endif
+#endif
+#if LV_USE_DRAW_SW_MT
+    /*Number of helper threads. The drawing thread renders a band too.*/
+    #ifndef LV_DRAW_SW_MT_THREAD_CNT
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_DRAW_SW_MT_THREAD_CNT
+                #define LV_DRAW_SW_MT_THREAD_CNT CONFIG_LV_DRAW_SW_MT_THREAD_CNT
+            #else
+                #define LV_DRAW_SW_MT_THREAD_CNT 0
+            #endif
+        #else
+            #define LV_DRAW_SW_MT_THREAD_CNT 1
+        #endif
+    #endif
+
+    /*Blends smaller than this many pixels are rendered by the drawing thread only*/
+    #ifndef LV_DRAW_SW_MT_MIN_PX
+        #ifdef CONFIG_LV_DRAW_SW_MT_MIN_PX
+            #define LV_DRAW_SW_MT_MIN_PX CONFIG_LV_DRAW_SW_MT_MIN_PX
+        #else
+            #define LV_DRAW_SW_MT_MIN_PX 4096
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -796,6 +899,58 @@
     #endif
 #endif
 
+/*1: Record the time spent in the rendering stages into a ring buffer which can be exported
+ *as Chrome trace JSON by `lv_profiler_dump()`*/
+#ifndef LV_USE_PROFILER
+    #ifdef CONFIG_LV_USE_PROFILER
+        #define LV_USE_PROFILER CONFIG_LV_USE_PROFILER
+    #else
+        #define LV_USE_PROFILER 0
+    #endif
+#endif
+#if LV_USE_PROFILER
+    /*Number of events kept in the ring buffer (12..16 bytes each). The oldest ones are overwritten*/
+    #ifndef LV_PROFILER_BUF_SIZE
+        #ifdef CONFIG_LV_PROFILER_BUF_SIZE
+            #define LV_PROFILER_BUF_SIZE CONFIG_LV_PROFILER_BUF_SIZE
+        #else
+            #define LV_PROFILER_BUF_SIZE 4096
+        #endif
+    #endif
+    /*Header to include for the time stamp and thread ID getters*/
+    #ifndef LV_PROFILER_INCLUDE
+        #ifdef CONFIG_LV_PROFILER_INCLUDE
+            #define LV_PROFILER_INCLUDE CONFIG_LV_PROFILER_INCLUDE
+        #else
+            #define LV_PROFILER_INCLUDE <stdint.h>
+        #endif
+    #endif
+    /*Time stamp of the events, e.g. a CPU cycle counter. Can wrap around at 32 bits*/
+    #ifndef LV_PROFILER_TICK_GET
+        #ifdef CONFIG_LV_PROFILER_TICK_GET
+            #define LV_PROFILER_TICK_GET CONFIG_LV_PROFILER_TICK_GET
+        #else
+            #define LV_PROFILER_TICK_GET() lv_tick_get()
+        #endif
+    #endif
+    /*Ticks of `LV_PROFILER_TICK_GET()` per second*/
+    #ifndef LV_PROFILER_TICK_PER_SEC
+        #ifdef CONFIG_LV_PROFILER_TICK_PER_SEC
+            #define LV_PROFILER_TICK_PER_SEC CONFIG_LV_PROFILER_TICK_PER_SEC
+        #else
+            #define LV_PROFILER_TICK_PER_SEC 1000
+        #endif
+    #endif
+    /*ID of the current thread or CPU core (0..239) to show the events of each on its own track*/
+    #ifndef LV_PROFILER_TID_GET
+        #ifdef CONFIG_LV_PROFILER_TID_GET
+            #define LV_PROFILER_TID_GET CONFIG_LV_PROFILER_TID_GET
+        #else
+            #define LV_PROFILER_TID_GET() 0
+        #endif
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -848,6 +1003,17 @@
     #endif
 #endif
 
+/*Cache the resolved style properties of the objects, so the drawing doesn't have to search all the styles
+ *of an object for every property. The cache of an object is dropped when its styles or state change.
+ *Number of properties cached per object part, must be a power of 2. 0: disable caching*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #ifndef LV_ENABLE_GC
@@ -1497,6 +1663,17 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LAYOUT_CACHE
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_LABEL_LAYOUT_CACHE
+                #define LV_LABEL_LAYOUT_CACHE CONFIG_LV_LABEL_LAYOUT_CACHE
+            #else
+                #define LV_LABEL_LAYOUT_CACHE 0
+            #endif
+        #else
+            #define LV_LABEL_LAYOUT_CACHE 1   /*Save the line breaks and letter widths of the labels to skip measuring the text on redraw*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LINE
@@ -2124,6 +2301,43 @@
     #endif
 #endif
 
+/*Share a cache of fixed size blocks between the files opened for reading on the POSIX and LittleFS drives
+ *instead of their `*_CACHE_SIZE` buffers. The blocks are kept after closing the files.*/
+#ifndef LV_FS_BLOCK_CACHE
+    #ifdef CONFIG_LV_FS_BLOCK_CACHE
+        #define LV_FS_BLOCK_CACHE CONFIG_LV_FS_BLOCK_CACHE
+    #else
+        #define LV_FS_BLOCK_CACHE 0
+    #endif
+#endif
+#if LV_FS_BLOCK_CACHE
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 4096   /*[bytes]*/
+        #endif
+    #endif
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_CNT
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_CNT
+            #define LV_FS_BLOCK_CACHE_BLOCK_CNT CONFIG_LV_FS_BLOCK_CACHE_BLOCK_CNT
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_CNT 8       /*Number of blocks, at least 2*/
+        #endif
+    #endif
+
+    /*Read this many blocks ahead on a helper thread when a file is read sequentially (e.g. by a decoder). Requires pthreads.
+     *The driver is called from the helper thread too (with an other file handle), so only the drivers with `thread_safe` set
+     *are read ahead (POSIX, and LittleFS built with LFS_THREADSAFE).*/
+    #ifndef LV_FS_BLOCK_CACHE_READ_AHEAD
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+        #else
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD 0
+        #endif
+    #endif
+#endif
+
 /*PNG decoder library*/
 #ifndef LV_USE_PNG
     #ifdef CONFIG_LV_USE_PNG
@@ -2161,6 +2375,16 @@
     #endif
 #endif
 
+/*Decoder of pre-decoded RGB565 images compressed with run-length encoding.
+ *Create them with `scripts/png_to_rle.py`*/
+#ifndef LV_USE_RLE_IMG
+    #ifdef CONFIG_LV_USE_RLE_IMG
+        #define LV_USE_RLE_IMG CONFIG_LV_USE_RLE_IMG
+    #else
+        #define LV_USE_RLE_IMG 0
+    #endif
+#endif
+
 /*QR code library*/
 #ifndef LV_USE_QRCODE
     #ifdef CONFIG_LV_USE_QRCODE
@@ -2234,6 +2458,47 @@
             #define LV_TINY_TTF_FILE_SUPPORT 0
         #endif
     #endif
+    /*Size of the glyph cache shared by all Tiny TTF fonts and sizes in bytes.
+     *It keeps the metrics and the rendered bitmaps of the recently used letters. 0: don't cache*/
+    #ifndef LV_TINY_TTF_CACHE_SIZE
+        #ifdef CONFIG_LV_TINY_TTF_CACHE_SIZE
+            #define LV_TINY_TTF_CACHE_SIZE CONFIG_LV_TINY_TTF_CACHE_SIZE
+        #else
+            #define LV_TINY_TTF_CACHE_SIZE (32 * 1024)
+        #endif
+    #endif
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #ifndef LV_TINY_TTF_CACHE_CUSTOM
+        #ifdef CONFIG_LV_TINY_TTF_CACHE_CUSTOM
+            #define LV_TINY_TTF_CACHE_CUSTOM CONFIG_LV_TINY_TTF_CACHE_CUSTOM
+        #else
+            #define LV_TINY_TTF_CACHE_CUSTOM 0
+        #endif
+    #endif
+    #if LV_TINY_TTF_CACHE_CUSTOM
+        #ifndef LV_TINY_TTF_CACHE_CUSTOM_INCLUDE
+            #ifdef CONFIG_LV_TINY_TTF_CACHE_CUSTOM_INCLUDE
+                #define LV_TINY_TTF_CACHE_CUSTOM_INCLUDE CONFIG_LV_TINY_TTF_CACHE_CUSTOM_INCLUDE
+            #else
+                #define LV_TINY_TTF_CACHE_CUSTOM_INCLUDE <stdlib.h>   /*Header for the allocator*/
+            #endif
+        #endif
+        #ifndef LV_TINY_TTF_CACHE_CUSTOM_ALLOC
+            #ifdef CONFIG_LV_TINY_TTF_CACHE_CUSTOM_ALLOC
+                #define LV_TINY_TTF_CACHE_CUSTOM_ALLOC CONFIG_LV_TINY_TTF_CACHE_CUSTOM_ALLOC
+            #else
+                #define LV_TINY_TTF_CACHE_CUSTOM_ALLOC   malloc
+            #endif
+        #endif
+        #ifndef LV_TINY_TTF_CACHE_CUSTOM_FREE
+            #ifdef CONFIG_LV_TINY_TTF_CACHE_CUSTOM_FREE
+                #define LV_TINY_TTF_CACHE_CUSTOM_FREE CONFIG_LV_TINY_TTF_CACHE_CUSTOM_FREE
+            #else
+                #define LV_TINY_TTF_CACHE_CUSTOM_FREE    free
+            #endif
+        #endif
+    #endif
 #endif
 
 /*Rlottie library*/
@@ -2323,6 +2588,26 @@
     #endif
 #endif
 
+/*1: Enable fonts and images from an asset bundle in memory mapped flash.
+ *Create the bundles with `scripts/lv_assets_pack.py`*/
+#ifndef LV_USE_ASSETS
+    #ifdef CONFIG_LV_USE_ASSETS
+        #define LV_USE_ASSETS CONFIG_LV_USE_ASSETS
+    #else
+        #define LV_USE_ASSETS 0
+    #endif
+#endif
+#if LV_USE_ASSETS
+    /*1: Add `lv_assets_map_file()` to map bundle files with POSIX `mmap()`, e.g. on a PC simulator*/
+    #ifndef LV_ASSETS_POSIX_MMAP
+        #ifdef CONFIG_LV_ASSETS_POSIX_MMAP
+            #define LV_ASSETS_POSIX_MMAP CONFIG_LV_ASSETS_POSIX_MMAP
+        #else
+            #define LV_ASSETS_POSIX_MMAP 0
+        #endif
+    #endif
+#endif
+
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
 #ifndef LV_USE_IME_PINYIN
@@ -30,15 +30,23 @@
  **********************/
 static void anim_timer(lv_timer_t * param);
 static void anim_mark_list_change(void);
-static void anim_ready_handler(lv_anim_t * a);
+static void anim_ready_handler(uint32_t id, lv_anim_t * a);
+static bool reserve(uint32_t cnt);
+static void remove_at(uint32_t id);
+static void compact(void);
+static inline int32_t path_linear(const lv_anim_t * a);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t last_timer_run;
-static bool anim_list_changed;
 static bool anim_run_round;
 static lv_timer_t * _lv_anim_tmr;
+static uint32_t anim_cnt;       /*Used slots in `_lv_anim_arr`, including the removed ones*/
+static uint32_t anim_cap;       /*Size of `_lv_anim_arr` and `_lv_anim_val`*/
+static uint32_t anim_live_cnt;  /*Animations which are not removed*/
+static uint32_t iter_depth;     /*>0 while the array is being iterated, the removed slots are kept until then*/
+static bool has_removed;
 
 /**********************
  *      MACROS
@@ -55,10 +63,15 @@ static lv_timer_t * _lv_anim_tmr;
 
 void _lv_anim_core_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
+    LV_GC_ROOT(_lv_anim_arr) = NULL;
+    LV_GC_ROOT(_lv_anim_val) = NULL;
+    anim_cnt = 0;
+    anim_cap = 0;
+    anim_live_cnt = 0;
+    iter_depth = 0;
+    has_removed = false;
     _lv_anim_tmr = lv_timer_create(anim_timer, LV_DISP_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    anim_list_changed = false;
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -79,15 +92,19 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
     if(a->exec_cb != NULL) lv_anim_del(a->var, a->exec_cb); /*exec_cb == NULL would delete all animations of var*/
 
-    /*If the list is empty the anim timer was suspended and it's last run measure is invalid*/
-    if(_lv_ll_is_empty(&LV_GC_ROOT(_lv_anim_ll))) {
+    /*If there are no animations the anim timer was suspended and it's last run measure is invalid*/
+    if(anim_live_cnt == 0) {
         last_timer_run = lv_tick_get();
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
+    /*Add the new animation to the end of the array*/
+    if(!reserve(anim_cnt + 1)) return NULL;
+    lv_anim_t * new_anim = lv_mem_alloc(sizeof(lv_anim_t));
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
+    LV_GC_ROOT(_lv_anim_arr)[anim_cnt] = new_anim;
+    anim_cnt++;
+    anim_live_cnt++;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
@@ -105,8 +122,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         if(new_anim->exec_cb && new_anim->var) new_anim->exec_cb(new_anim->var, new_anim->start_value);
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
+    /*Resume the animation timer if it was paused*/
     anim_mark_list_change();
 
     TRACE_ANIM("finished");
@@ -136,40 +152,52 @@ uint32_t lv_anim_get_playtime(lv_anim_t * a)
 
 bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    lv_anim_t * a_next;
     bool del = false;
-    a        = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-    while(a != NULL) {
-        /*'a' might be deleted, so get the next object while 'a' is valid*/
-        a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+
+    /*`deleted_cb` might start or delete animations, so keep the indices valid until the end*/
+    iter_depth++;
+    uint32_t cnt = anim_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt && i < anim_cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a == NULL) continue;
 
         if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
+            remove_at(i);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_mem_free(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
             del = true;
         }
-
-        a = a_next;
     }
+    iter_depth--;
+
+    if(iter_depth == 0) compact();
+    if(del) anim_mark_list_change();
 
     return del;
 }
 
 void lv_anim_del_all(void)
 {
-    _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
+    uint32_t i;
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a == NULL) continue;
+        remove_at(i);
+        lv_mem_free(a);
+    }
+
+    if(iter_depth == 0) compact();
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+    /*The newest animation first*/
+    uint32_t i;
+    for(i = anim_cnt; i > 0; i--) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i - 1];
+        if(a && a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
     }
@@ -184,11 +212,7 @@ struct _lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) cnt++;
-
-    return cnt;
+    return anim_live_cnt;
 }
 
 uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end)
@@ -210,17 +234,7 @@ void lv_anim_refr_now(void)
 
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    int32_t step = lv_map(a->act_time, 0, a->time, 0, LV_ANIM_RESOLUTION);
-
-    /*Get the new value which will be proportional to `step`
-     *and the `start` and `end` values*/
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_ANIM_RES_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    return path_linear(a);
 }
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
@@ -344,77 +358,96 @@ int32_t lv_anim_path_step(const lv_anim_t * a)
 
 /**
  * Periodically handle the animations.
+ * The animations are handled in two passes over the array:
+ * first the time of all animations is stepped and their new values are calculated,
+ * then the changed values are applied and the ready animations are handled.
+ * The callbacks might start or delete animations, the started ones are appended and run only in the next round,
+ * the slots of the deleted ones are set to `NULL` and removed when both passes are ready.
+ * The array keeps the start order, it's not grouped by path or variable:
+ * the descriptors are handed out by `lv_anim_start()` and `lv_anim_get()` so they stay separate allocations.
  * @param param unused
  */
 static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
+    /*Called from a callback of an animation (e.g. by `lv_refr_now()`)*/
+    if(iter_depth > 0) return;
+
     uint32_t elaps = lv_tick_elaps(last_timer_run);
 
     /*Flip the run round*/
     anim_run_round = anim_run_round ? false : true;
 
-    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-
-    while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        anim_list_changed = false;
-
-        if(a->run_round != anim_run_round) {
-            a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
-
-            /*The animation will run now for the first time. Call `start_cb`*/
-            int32_t new_act_time = a->act_time + elaps;
-            if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
-            }
-            a->act_time += elaps;
-            if(a->act_time >= 0) {
-                if(a->act_time > a->time) a->act_time = a->time;
-
-                int32_t new_value;
-                new_value = a->path_cb(a);
-
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                }
-
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->time) {
-                    anim_ready_handler(a);
-                }
+    iter_depth++;
+    uint32_t cnt = anim_cnt;
+    uint32_t i;
+
+    /*Step the time and calculate the new values. The newest animations first like when they were in a list.*/
+    for(i = cnt; i > 0; i--) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i - 1];
+        if(a == NULL || a->run_round == anim_run_round) continue;
+        a->run_round = anim_run_round;
+
+        /*The animation will run now for the first time. Call `start_cb`*/
+        int32_t new_act_time = a->act_time + elaps;
+        if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
             }
+            if(a->start_cb) a->start_cb(a);
+            a->start_cb_called = 1;
+
+            /*`start_cb` might have deleted it*/
+            if(LV_GC_ROOT(_lv_anim_arr)[i - 1] != a) continue;
+        }
+        a->act_time += elaps;
+        if(a->act_time >= 0) {
+            if(a->act_time > a->time) a->act_time = a->time;
+
+            /*Most animations are linear, don't call it*/
+            if(a->path_cb == lv_anim_path_linear) LV_GC_ROOT(_lv_anim_val)[i - 1] = path_linear(a);
+            else LV_GC_ROOT(_lv_anim_val)[i - 1] = a->path_cb(a);
+        }
+    }
+
+    /*Apply the new values and handle the ready animations*/
+    for(i = cnt; i > 0; i--) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i - 1];
+        if(a == NULL || a->run_round != anim_run_round || a->act_time < 0) continue;
+
+        int32_t new_value = LV_GC_ROOT(_lv_anim_val)[i - 1];
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+            /*Apply the calculated value*/
+            if(a->exec_cb) a->exec_cb(a->var, new_value);
+
+            /*`exec_cb` might have deleted it*/
+            if(LV_GC_ROOT(_lv_anim_arr)[i - 1] != a) continue;
         }
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(anim_list_changed)
-            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-        else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+        /*If the time is elapsed the animation is ready*/
+        if(a->act_time >= a->time) {
+            anim_ready_handler(i - 1, a);
+        }
     }
 
+    iter_depth--;
+    compact();
+    anim_mark_list_change();
+
     last_timer_run = lv_tick_get();
 }
 
 /**
  * Called when an animation is ready to do the necessary thinks
  * e.g. repeat, play back, delete etc.
- * @param a pointer to an animation descriptor
+ * @param id    index of the animation in `_lv_anim_arr`
+ * @param a     pointer to an animation descriptor
  */
-static void anim_ready_handler(lv_anim_t * a)
+static void anim_ready_handler(uint32_t id, lv_anim_t * a)
 {
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->playback_now == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
@@ -426,11 +459,9 @@ static void anim_ready_handler(lv_anim_t * a)
      * - no repeat, play back is enabled and play back is ready*/
     if(a->repeat_cnt == 0 && (a->playback_time == 0 || a->playback_now == 1)) {
 
-        /*Delete the animation from the list.
+        /*Remove the animation from the array.
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
-        _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        remove_at(id);
 
         /*Call the callback function at the end*/
         if(a->ready_cb != NULL) a->ready_cb(a);
@@ -461,9 +492,77 @@ static void anim_ready_handler(lv_anim_t * a)
 
 static void anim_mark_list_change(void)
 {
-    anim_list_changed = true;
-    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
+    if(anim_live_cnt == 0)
         lv_timer_pause(_lv_anim_tmr);
     else
         lv_timer_resume(_lv_anim_tmr);
 }
+
+/**
+ * Make sure the arrays have room for `cnt` animations
+ * @param cnt   number of animations
+ * @return      true: success; false: out of memory
+ */
+static bool reserve(uint32_t cnt)
+{
+    if(cnt <= anim_cap) return true;
+
+    uint32_t new_cap = anim_cap ? anim_cap * 2 : 8;
+    while(new_cap < cnt) new_cap *= 2;
+
+    lv_anim_t ** arr = lv_mem_realloc(LV_GC_ROOT(_lv_anim_arr), new_cap * sizeof(lv_anim_t *));
+    LV_ASSERT_MALLOC(arr);
+    if(arr == NULL) return false;
+    LV_GC_ROOT(_lv_anim_arr) = arr;
+
+    int32_t * val = lv_mem_realloc(LV_GC_ROOT(_lv_anim_val), new_cap * sizeof(int32_t));
+    LV_ASSERT_MALLOC(val);
+    if(val == NULL) return false;
+    LV_GC_ROOT(_lv_anim_val) = val;
+
+    anim_cap = new_cap;
+    return true;
+}
+
+/**
+ * Remove an animation from the array. The slot is cleared and the array is compacted later by `compact()`.
+ * @param id    index of the animation
+ */
+static void remove_at(uint32_t id)
+{
+    LV_GC_ROOT(_lv_anim_arr)[id] = NULL;
+    anim_live_cnt--;
+    has_removed = true;
+}
+
+/**
+ * Drop the cleared slots keeping the order of the animations
+ */
+static void compact(void)
+{
+    if(!has_removed) return;
+
+    lv_anim_t ** arr = LV_GC_ROOT(_lv_anim_arr);
+    uint32_t i;
+    uint32_t j = 0;
+    for(i = 0; i < anim_cnt; i++) {
+        if(arr[i]) arr[j++] = arr[i];
+    }
+    anim_cnt = j;
+    has_removed = false;
+}
+
+static inline int32_t path_linear(const lv_anim_t * a)
+{
+    /*Calculate the current step*/
+    int32_t step = lv_map(a->act_time, 0, a->time, 0, LV_ANIM_RESOLUTION);
+
+    /*Get the new value which will be proportional to `step`
+     *and the `start` and `end` values*/
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_ANIM_RES_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
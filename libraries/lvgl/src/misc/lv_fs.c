@@ -90,6 +90,17 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     file_p->drv = drv;
     file_p->file_d = file_d;
+    file_p->cache = NULL;
+
+#if LV_FS_BLOCK_CACHE
+    file_p->cached = NULL;
+    if(mode & LV_FS_MODE_WR) {
+        _lv_fs_block_cache_invalidate(drv, real_path);
+    }
+    else if(drv->block_cache && _lv_fs_block_cache_open(file_p, real_path) == LV_FS_RES_OK) {
+        return LV_FS_RES_OK;
+    }
+#endif
 
     if(drv->cache_size) {
         file_p->cache = lv_mem_alloc(sizeof(lv_fs_file_cache_t));
@@ -112,6 +123,12 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_BLOCK_CACHE
+    if(file_p->cached) {
+        _lv_fs_block_cache_close(file_p);
+    }
+#endif
+
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
     if(file_p->drv->cache_size && file_p->cache) {
@@ -211,6 +228,14 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     uint32_t br_tmp = 0;
     lv_fs_res_t res;
 
+#if LV_FS_BLOCK_CACHE
+    if(file_p->cached) {
+        res = _lv_fs_block_cache_read(file_p, buf, btr, &br_tmp);
+        if(br != NULL) *br = br_tmp;
+        return res;
+    }
+#endif
+
     if(file_p->drv->cache_size) {
         res = lv_fs_read_cached(file_p, (char *)buf, btr, &br_tmp);
     }
@@ -252,6 +277,12 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_BLOCK_CACHE
+    if(file_p->cached) {
+        return _lv_fs_block_cache_seek(file_p, pos, whence);
+    }
+#endif
+
     lv_fs_res_t res = LV_FS_RES_OK;
     if(file_p->drv->cache_size) {
         switch(whence) {
@@ -309,6 +340,13 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
         return LV_FS_RES_NOT_IMP;
     }
 
+#if LV_FS_BLOCK_CACHE
+    if(file_p->cached) {
+        *pos = file_p->cached_pos;
+        return LV_FS_RES_OK;
+    }
+#endif
+
     lv_fs_res_t res;
     if(file_p->drv->cache_size) {
         *pos = file_p->cache->file_position;
@@ -69,6 +69,11 @@ typedef enum {
 typedef struct _lv_fs_drv_t {
     char letter;
     uint16_t cache_size;
+#if LV_FS_BLOCK_CACHE
+    uint8_t block_cache;    /**< 1: read the files opened for reading only through the shared block cache*/
+    uint8_t thread_safe;    /**< 1: the callbacks can be called from an other thread on an other file at the same time.
+                             *   Only these drivers are read ahead by the block cache.*/
+#endif
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     void * (*open_cb)(struct _lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
@@ -94,12 +99,29 @@ typedef struct {
     void * buffer;
 } lv_fs_file_cache_t;
 
+struct _lv_fs_cached_file_t;
+
 typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
     lv_fs_file_cache_t * cache;
+#if LV_FS_BLOCK_CACHE
+    struct _lv_fs_cached_file_t * cached;   /**< The file in the shared block cache or NULL*/
+    uint32_t cached_pos;                    /**< Read position if `cached` is set*/
+    uint32_t cached_next_block;             /**< The block after the last read one, to detect sequential reads*/
+#endif
 } lv_fs_file_t;
 
+typedef struct {
+    uint32_t hit_cnt;       /**< Blocks found in the cache*/
+    uint32_t miss_cnt;      /**< Blocks read by the caller of `lv_fs_read()`*/
+    uint32_t direct_cnt;    /**< Blocks read by `lv_fs_read()` directly into the caller's buffer without caching*/
+    uint32_t ahead_cnt;     /**< Blocks read ahead*/
+    uint32_t ahead_hit_cnt; /**< Blocks read ahead and used later*/
+    uint32_t wait_cnt;      /**< Reads which waited for a block being read ahead*/
+    uint32_t evict_cnt;     /**< Blocks dropped to make place for an other one*/
+} lv_fs_block_cache_stat_t;
+
 typedef struct {
     void * dir_d;
     lv_fs_drv_t * drv;
@@ -250,6 +272,73 @@ char * lv_fs_up(char * path);
  */
 const char * lv_fs_get_last(const char * path);
 
+#if LV_FS_BLOCK_CACHE
+
+/**
+ * Set how many blocks to read ahead when a file is read sequentially.
+ * @param block_cnt     number of blocks, at most `LV_FS_BLOCK_CACHE_READ_AHEAD`. 0: don't read ahead
+ */
+void lv_fs_block_cache_set_read_ahead(uint32_t block_cnt);
+
+/**
+ * Drop the cached blocks, e.g. after the files were modified not through `lv_fs`.
+ * The blocks of the open files are dropped too and the block buffers are freed.
+ */
+void lv_fs_block_cache_clear(void);
+
+/**
+ * Get the counters of the block cache.
+ * @param stat      store the result here
+ */
+void lv_fs_block_cache_get_stat(lv_fs_block_cache_stat_t * stat);
+
+/**
+ * Zero the counters of the block cache.
+ */
+void lv_fs_block_cache_reset_stat(void);
+
+/**
+ * Read a file opened for reading through the block cache.
+ * @param file_p    pointer to a file opened by the driver
+ * @param path      the path of the file without the driver letter
+ * @return          LV_FS_RES_OK: the file is read through the cache; other values: read it directly
+ */
+lv_fs_res_t _lv_fs_block_cache_open(lv_fs_file_t * file_p, const char * path);
+
+/**
+ * Detach a file from the block cache before closing it. Its blocks are kept for the next opening.
+ * @param file_p    pointer to a file attached by `_lv_fs_block_cache_open()`
+ */
+void _lv_fs_block_cache_close(lv_fs_file_t * file_p);
+
+/**
+ * Drop the blocks of a file, e.g. because it is opened for writing.
+ * @param drv       pointer to the driver of the file
+ * @param path      the path of the file without the driver letter
+ */
+void _lv_fs_block_cache_invalidate(lv_fs_drv_t * drv, const char * path);
+
+/**
+ * Read from a file attached to the block cache.
+ * @param file_p    pointer to a file attached by `_lv_fs_block_cache_open()`
+ * @param buf       pointer to a buffer where the read bytes are stored
+ * @param btr       bytes to read
+ * @param br        the number of real read bytes is stored here
+ * @return          LV_FS_RES_OK or any error from the driver
+ */
+lv_fs_res_t _lv_fs_block_cache_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+
+/**
+ * Set the read position of a file attached to the block cache.
+ * @param file_p    pointer to a file attached by `_lv_fs_block_cache_open()`
+ * @param pos       the new position
+ * @param whence    tells from where to interpret the `pos`. See @lv_fs_whence_t
+ * @return          LV_FS_RES_OK
+ */
+lv_fs_res_t _lv_fs_block_cache_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+
+#endif /*LV_FS_BLOCK_CACHE*/
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,668 @@
+/**
+ * @file lv_fs_block_cache.c
+ * A cache of fixed size blocks shared by the read-only files of the drivers with `block_cache` set.
+ * The blocks are identified by the driver, the path and the block index, so they are reused when a file
+ * (e.g. a font or a GIF) is opened again. Blocks are dropped in least recently used order.
+ *
+ * With `LV_FS_BLOCK_CACHE_READ_AHEAD` a helper thread reads the next blocks of the sequentially read files
+ * with an own file handle, so decoders reading a file from start to end rarely wait for the storage.
+ * Only the thread calling `lv_fs` allocates memory, evicts blocks and frees files;
+ * the helper thread only fills the blocks it was asked to read.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_fs.h"
+#if LV_FS_BLOCK_CACHE
+
+#include <string.h>
+#include "lv_assert.h"
+#include "lv_mem.h"
+#include "lv_log.h"
+#include "lv_math.h"
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    #include <pthread.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_FS_BLOCK_CACHE_BLOCK_CNT < 2
+    #error "LV_FS_BLOCK_CACHE_BLOCK_CNT must be at least 2"
+#endif
+
+#define BLOCK_SIZE  LV_FS_BLOCK_CACHE_BLOCK_SIZE
+#define BLOCK_CNT   LV_FS_BLOCK_CACHE_BLOCK_CNT
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    #define CACHE_LOCK()    pthread_mutex_lock(&cache.lock)
+    #define CACHE_UNLOCK()  pthread_mutex_unlock(&cache.lock)
+#else
+    #define CACHE_LOCK()
+    #define CACHE_UNLOCK()
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_fs_cached_file_t {
+    struct _lv_fs_cached_file_t * next;
+    lv_fs_drv_t * drv;
+    char * path;
+    uint32_t size;
+    uint32_t ref_cnt;           /*Open files using it*/
+    uint32_t block_cnt;         /*Blocks assigned to it in any state*/
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    void * ahead_file_d;        /*File handle of the helper thread, open while `ref_cnt > 0`*/
+#endif
+} lv_fs_cached_file_t;
+
+typedef enum {
+    BLOCK_FREE,
+    BLOCK_QUEUED,               /*Waiting for the helper thread*/
+    BLOCK_LOADING,              /*Being read by the helper thread or by `lv_fs_read()`*/
+    BLOCK_READY,
+} block_state_t;
+
+typedef struct {
+    lv_fs_cached_file_t * file; /*NULL if free*/
+    uint8_t * buf;
+    uint32_t index;             /*Index of the block in the file*/
+    uint32_t len;               /*Valid bytes in `buf`*/
+    uint32_t life;              /*Value of `life_cnt` at the last use or when queued*/
+    uint8_t state;
+    uint8_t ahead : 1;          /*Read ahead and not used yet*/
+} block_t;
+
+typedef struct {
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    pthread_mutex_t lock;
+    pthread_cond_t job_cond;    /*Signaled when a block is queued*/
+    pthread_cond_t done_cond;   /*Signaled when the helper thread has read a block*/
+    pthread_t thread;
+    bool thread_started;
+    uint32_t read_ahead;
+#endif
+    block_t blocks[BLOCK_CNT];
+    lv_fs_cached_file_t * files;
+    uint32_t life_cnt;
+    lv_fs_block_cache_stat_t stat;
+} block_cache_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_fs_cached_file_t * find_file(lv_fs_drv_t * drv, const char * path);
+static void free_file_if_unused(lv_fs_cached_file_t * file);
+static block_t * find_block(lv_fs_cached_file_t * file, uint32_t index);
+static block_t * get_victim(bool for_ahead);
+static bool assign_block(block_t * block, lv_fs_cached_file_t * file, uint32_t index);
+static void release_block(block_t * block);
+static void drop_blocks(lv_fs_cached_file_t * file);
+static block_t * get_ready_block(lv_fs_file_t * file_p, uint32_t index, lv_fs_res_t * res);
+static lv_fs_res_t read_from_drv(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br);
+static uint32_t get_block_len(lv_fs_cached_file_t * file, uint32_t index);
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    static void queue_read_ahead(lv_fs_cached_file_t * file, uint32_t last_index);
+    static void * helper_main(void * arg);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+static block_cache_t cache = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .job_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER,
+    .read_ahead = LV_FS_BLOCK_CACHE_READ_AHEAD,
+};
+#else
+static block_cache_t cache;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_fs_block_cache_set_read_ahead(uint32_t block_cnt)
+{
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    CACHE_LOCK();
+    cache.read_ahead = LV_MIN(block_cnt, LV_FS_BLOCK_CACHE_READ_AHEAD);
+    CACHE_UNLOCK();
+#else
+    LV_UNUSED(block_cnt);
+#endif
+}
+
+void lv_fs_block_cache_clear(void)
+{
+    CACHE_LOCK();
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        block_t * block = &cache.blocks[i];
+        lv_fs_cached_file_t * file = block->file;
+        if(file) {
+            drop_blocks(file);
+            free_file_if_unused(file);
+        }
+        if(block->buf) {
+            lv_mem_free(block->buf);
+            block->buf = NULL;
+        }
+    }
+    CACHE_UNLOCK();
+}
+
+void lv_fs_block_cache_get_stat(lv_fs_block_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    CACHE_LOCK();
+    *stat = cache.stat;
+    CACHE_UNLOCK();
+}
+
+void lv_fs_block_cache_reset_stat(void)
+{
+    CACHE_LOCK();
+    lv_memset_00(&cache.stat, sizeof(cache.stat));
+    CACHE_UNLOCK();
+}
+
+lv_fs_res_t _lv_fs_block_cache_open(lv_fs_file_t * file_p, const char * path)
+{
+    lv_fs_drv_t * drv = file_p->drv;
+    if(drv->seek_cb == NULL || drv->tell_cb == NULL) return LV_FS_RES_NOT_IMP;
+
+    uint32_t size;
+    lv_fs_res_t res = drv->seek_cb(drv, file_p->file_d, 0, LV_FS_SEEK_END);
+    if(res == LV_FS_RES_OK) res = drv->tell_cb(drv, file_p->file_d, &size);
+    if(res == LV_FS_RES_OK) res = drv->seek_cb(drv, file_p->file_d, 0, LV_FS_SEEK_SET);
+    if(res != LV_FS_RES_OK) return res;
+
+    CACHE_LOCK();
+    lv_fs_cached_file_t * file = find_file(drv, path);
+    if(file == NULL) {
+        file = lv_mem_alloc(sizeof(lv_fs_cached_file_t));
+        char * path_copy = lv_mem_alloc(strlen(path) + 1);
+        if(file == NULL || path_copy == NULL) {
+            CACHE_UNLOCK();
+            lv_mem_free(file);
+            lv_mem_free(path_copy);
+            return LV_FS_RES_OUT_OF_MEM;
+        }
+        lv_memset_00(file, sizeof(lv_fs_cached_file_t));
+        strcpy(path_copy, path);
+        file->drv = drv;
+        file->path = path_copy;
+        file->size = size;
+        file->next = cache.files;
+        cache.files = file;
+    }
+    else if(file->size != size) {
+        /*Modified since it was cached*/
+        drop_blocks(file);
+        file->size = size;
+    }
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    /*The helper thread would call the driver while this thread reads an other file*/
+    if(drv->thread_safe && file->ahead_file_d == NULL) {
+        void * ahead_file_d = drv->open_cb(drv, path, LV_FS_MODE_RD);
+        if(ahead_file_d != NULL && ahead_file_d != (void *)(-1)) file->ahead_file_d = ahead_file_d;
+    }
+
+    if(drv->thread_safe && !cache.thread_started) {
+        if(pthread_create(&cache.thread, NULL, helper_main, NULL) == 0) {
+            cache.thread_started = true;
+        }
+        else {
+            LV_LOG_WARN("couldn't start the read ahead thread");
+        }
+    }
+#endif
+
+    file->ref_cnt++;
+    CACHE_UNLOCK();
+
+    file_p->cached = file;
+    file_p->cached_pos = 0;
+    file_p->cached_next_block = 0;
+
+    return LV_FS_RES_OK;
+}
+
+void _lv_fs_block_cache_close(lv_fs_file_t * file_p)
+{
+    lv_fs_cached_file_t * file = file_p->cached;
+    LV_ASSERT_NULL(file);
+
+    CACHE_LOCK();
+    LV_ASSERT(file->ref_cnt > 0);
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    if(file->ref_cnt == 1 && file->ahead_file_d) {
+        /*Cancel the queued blocks and wait for the one being read to use the helper's handle no more*/
+        uint32_t i;
+        for(i = 0; i < BLOCK_CNT; i++) {
+            if(cache.blocks[i].file == file && cache.blocks[i].state == BLOCK_QUEUED) release_block(&cache.blocks[i]);
+        }
+        for(i = 0; i < BLOCK_CNT; i++) {
+            while(cache.blocks[i].file == file && cache.blocks[i].state == BLOCK_LOADING) {
+                pthread_cond_wait(&cache.done_cond, &cache.lock);
+            }
+        }
+
+        file->drv->close_cb(file->drv, file->ahead_file_d);
+        file->ahead_file_d = NULL;
+    }
+#endif
+
+    file->ref_cnt--;
+    free_file_if_unused(file);
+    CACHE_UNLOCK();
+
+    file_p->cached = NULL;
+}
+
+void _lv_fs_block_cache_invalidate(lv_fs_drv_t * drv, const char * path)
+{
+    CACHE_LOCK();
+    lv_fs_cached_file_t * file = find_file(drv, path);
+    if(file) {
+        drop_blocks(file);
+        free_file_if_unused(file);
+    }
+    CACHE_UNLOCK();
+}
+
+lv_fs_res_t _lv_fs_block_cache_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_cached_file_t * file = file_p->cached;
+    lv_fs_res_t res = LV_FS_RES_OK;
+    uint8_t * out = buf;
+    uint32_t pos = file_p->cached_pos;
+
+    *br = 0;
+    if(pos >= file->size) return LV_FS_RES_OK;
+    btr = LV_MIN(btr, file->size - pos);
+    if(btr == 0) return LV_FS_RES_OK;
+
+    /*Continuing the previous read or reading the next block*/
+    uint32_t first_index = pos / BLOCK_SIZE;
+    bool sequential = first_index == file_p->cached_next_block || first_index + 1 == file_p->cached_next_block;
+
+    CACHE_LOCK();
+    while(btr > 0) {
+        uint32_t index = pos / BLOCK_SIZE;
+        uint32_t ofs = pos % BLOCK_SIZE;
+        block_t * block = find_block(file, index);
+
+        if(block == NULL && ofs == 0 && btr >= BLOCK_SIZE) {
+            /*Whole blocks which are not cached are read directly to the caller's buffer*/
+            uint32_t cnt = 1;
+            while((cnt + 1) * BLOCK_SIZE <= btr && find_block(file, index + cnt) == NULL) cnt++;
+            cache.stat.direct_cnt += cnt;
+            CACHE_UNLOCK();
+
+            uint32_t rn = 0;
+            res = read_from_drv(file_p, pos, out, cnt * BLOCK_SIZE, &rn);
+
+            CACHE_LOCK();
+            if(res != LV_FS_RES_OK) break;
+            rn = LV_MIN(rn, cnt * BLOCK_SIZE);
+            pos += rn;
+            out += rn;
+            btr -= rn;
+            *br += rn;
+            if(rn < cnt * BLOCK_SIZE) break;
+            continue;
+        }
+
+        block = get_ready_block(file_p, index, &res);
+        if(block == NULL) break;
+        block->life = ++cache.life_cnt;
+
+        /*Only this thread evicts blocks so the data can be copied without the lock*/
+        CACHE_UNLOCK();
+        uint32_t n = block->len > ofs ? LV_MIN(btr, block->len - ofs) : 0;
+        lv_memcpy(out, block->buf + ofs, n);
+        CACHE_LOCK();
+
+        pos += n;
+        out += n;
+        btr -= n;
+        *br += n;
+        if(n == 0) break;
+    }
+
+    uint32_t last_index = (pos > 0 ? pos - 1 : 0) / BLOCK_SIZE;
+    file_p->cached_pos = pos;
+    file_p->cached_next_block = last_index + 1;
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    if(sequential && res == LV_FS_RES_OK) queue_read_ahead(file, last_index);
+#else
+    LV_UNUSED(sequential);
+#endif
+    CACHE_UNLOCK();
+
+    return res;
+}
+
+lv_fs_res_t _lv_fs_block_cache_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            file_p->cached_pos = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            file_p->cached_pos += pos;
+            break;
+        case LV_FS_SEEK_END:
+            file_p->cached_pos = file_p->cached->size + pos;
+            break;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_fs_cached_file_t * find_file(lv_fs_drv_t * drv, const char * path)
+{
+    lv_fs_cached_file_t * file;
+    for(file = cache.files; file; file = file->next) {
+        if(file->drv == drv && strcmp(file->path, path) == 0) return file;
+    }
+
+    return NULL;
+}
+
+/**
+ * Free a file if it's not open and has no blocks anymore
+ */
+static void free_file_if_unused(lv_fs_cached_file_t * file)
+{
+    if(file->ref_cnt > 0 || file->block_cnt > 0) return;
+
+    lv_fs_cached_file_t ** prev = &cache.files;
+    while(*prev != file) prev = &(*prev)->next;
+    *prev = file->next;
+
+    lv_mem_free(file->path);
+    lv_mem_free(file);
+}
+
+static block_t * find_block(lv_fs_cached_file_t * file, uint32_t index)
+{
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        if(cache.blocks[i].file == file && cache.blocks[i].index == index) return &cache.blocks[i];
+    }
+
+    return NULL;
+}
+
+/**
+ * Find a block to reuse: a free one or the least recently used ready one.
+ * If all blocks are busy a queued block is taken, the one which would be read last.
+ * @param for_ahead     true: for read ahead, so keep the blocks which were read ahead and not used yet
+ *                      and don't take queued blocks
+ * @return              a free, ready or queued block or NULL if none can be used
+ */
+static block_t * get_victim(bool for_ahead)
+{
+    block_t * victim = NULL;
+    block_t * queued = NULL;
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        block_t * block = &cache.blocks[i];
+        if(block->state == BLOCK_FREE) return block;
+        if(block->state == BLOCK_QUEUED) {
+            if(queued == NULL || (int32_t)(block->life - queued->life) > 0) queued = block;
+            continue;
+        }
+        if(block->state != BLOCK_READY) continue;
+        if(for_ahead && block->ahead) continue;
+        if(victim == NULL || (int32_t)(block->life - victim->life) < 0) victim = block;
+    }
+
+    if(victim == NULL && !for_ahead) victim = queued;
+    return victim;
+}
+
+/**
+ * Assign a block returned by `get_victim()` to a file. Allocate its buffer if needed.
+ * @return      false: out of memory, the block is free
+ */
+static bool assign_block(block_t * block, lv_fs_cached_file_t * file, uint32_t index)
+{
+    if(block->file) {
+        cache.stat.evict_cnt++;
+        release_block(block);
+    }
+
+    if(block->buf == NULL) {
+        block->buf = lv_mem_alloc(BLOCK_SIZE);
+        if(block->buf == NULL) {
+            LV_LOG_WARN("couldn't allocate a block");
+            return false;
+        }
+    }
+
+    block->file = file;
+    block->index = index;
+    block->len = 0;
+    block->ahead = 0;
+    file->block_cnt++;
+
+    return true;
+}
+
+/**
+ * Free a block, and its file if it was the last block of a closed file.
+ * The buffer is kept for the next block.
+ */
+static void release_block(block_t * block)
+{
+    lv_fs_cached_file_t * file = block->file;
+    block->file = NULL;
+    block->state = BLOCK_FREE;
+    block->ahead = 0;
+
+    file->block_cnt--;
+    free_file_if_unused(file);
+}
+
+/**
+ * Release the blocks of a file. Wait for the blocks being read by the helper thread.
+ */
+static void drop_blocks(lv_fs_cached_file_t * file)
+{
+    /*Don't free the file while its blocks are released*/
+    file->ref_cnt++;
+
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        block_t * block = &cache.blocks[i];
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+        while(block->file == file && block->state == BLOCK_LOADING) {
+            pthread_cond_wait(&cache.done_cond, &cache.lock);
+        }
+#endif
+        if(block->file == file) release_block(block);
+    }
+
+    file->ref_cnt--;
+}
+
+/**
+ * Get a block with the data of a file. Wait for it if it's being read ahead, otherwise read it now.
+ * Called with the lock held.
+ * @param file_p    pointer to a file attached to the cache
+ * @param index     index of the block in the file
+ * @param res       store the result of the reading here
+ * @return          the block or NULL on error
+ */
+static block_t * get_ready_block(lv_fs_file_t * file_p, uint32_t index, lv_fs_res_t * res)
+{
+    lv_fs_cached_file_t * file = file_p->cached;
+    uint32_t len = get_block_len(file, index);
+    block_t * block = find_block(file, index);
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+    if(block && block->state == BLOCK_LOADING) {
+        cache.stat.wait_cnt++;
+        while(block->state == BLOCK_LOADING) {
+            pthread_cond_wait(&cache.done_cond, &cache.lock);
+        }
+    }
+#endif
+
+    if(block && block->state == BLOCK_READY && block->len >= len) {
+        cache.stat.hit_cnt++;
+        if(block->ahead) {
+            cache.stat.ahead_hit_cnt++;
+            block->ahead = 0;
+        }
+        return block;
+    }
+
+    /*Read it now. A queued block is taken over from the helper thread.*/
+    cache.stat.miss_cnt++;
+    if(block == NULL) {
+        block = get_victim(false);
+        LV_ASSERT_NULL(block);  /*At most one block is loaded by the helper thread*/
+        if(!assign_block(block, file, index)) {
+            *res = LV_FS_RES_OUT_OF_MEM;
+            return NULL;
+        }
+    }
+    block->state = BLOCK_LOADING;
+    block->ahead = 0;
+    CACHE_UNLOCK();
+
+    uint32_t br = 0;
+    *res = read_from_drv(file_p, index * BLOCK_SIZE, block->buf, len, &br);
+
+    CACHE_LOCK();
+    block->len = br;
+    block->state = BLOCK_READY;
+    if(*res != LV_FS_RES_OK) {
+        release_block(block);
+        return NULL;
+    }
+
+    return block;
+}
+
+static lv_fs_res_t read_from_drv(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_drv_t * drv = file_p->drv;
+    *br = 0;
+    lv_fs_res_t res = drv->seek_cb(drv, file_p->file_d, pos, LV_FS_SEEK_SET);
+    if(res != LV_FS_RES_OK) return res;
+
+    return drv->read_cb(drv, file_p->file_d, buf, btr, br);
+}
+
+/**
+ * Get the number of bytes a block should have, smaller than the block size only at the end of the file.
+ */
+static uint32_t get_block_len(lv_fs_cached_file_t * file, uint32_t index)
+{
+    uint32_t start = index * BLOCK_SIZE;
+    if(start >= file->size) return 0;
+    return LV_MIN(BLOCK_SIZE, file->size - start);
+}
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+
+/**
+ * Queue the blocks after a block for the helper thread. Called with the lock held.
+ */
+static void queue_read_ahead(lv_fs_cached_file_t * file, uint32_t last_index)
+{
+    if(!cache.thread_started || file->ahead_file_d == NULL) return;
+
+    bool queued = false;
+    uint32_t i;
+    for(i = 1; i <= cache.read_ahead; i++) {
+        uint32_t index = last_index + i;
+        if(get_block_len(file, index) == 0) break;
+        if(find_block(file, index)) continue;
+
+        block_t * block = get_victim(true);
+        if(block == NULL) break;
+        if(!assign_block(block, file, index)) break;
+
+        block->state = BLOCK_QUEUED;
+        block->ahead = 1;
+        block->life = ++cache.life_cnt;     /*The queue is in `life` order*/
+        queued = true;
+    }
+
+    if(queued) pthread_cond_signal(&cache.job_cond);
+}
+
+static block_t * get_next_queued(void)
+{
+    block_t * next = NULL;
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        block_t * block = &cache.blocks[i];
+        if(block->state != BLOCK_QUEUED) continue;
+        if(next == NULL || (int32_t)(block->life - next->life) < 0) next = block;
+    }
+
+    return next;
+}
+
+static void * helper_main(void * arg)
+{
+    LV_UNUSED(arg);
+
+    CACHE_LOCK();
+    while(1) {
+        block_t * block;
+        while((block = get_next_queued()) == NULL) {
+            pthread_cond_wait(&cache.job_cond, &cache.lock);
+        }
+
+        /*The file and its handle are kept until the block is loading*/
+        lv_fs_cached_file_t * file = block->file;
+        uint32_t len = get_block_len(file, block->index);
+        block->state = BLOCK_LOADING;
+        CACHE_UNLOCK();
+
+        lv_fs_drv_t * drv = file->drv;
+        uint32_t br = 0;
+        lv_fs_res_t res = drv->seek_cb(drv, file->ahead_file_d, block->index * BLOCK_SIZE, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = drv->read_cb(drv, file->ahead_file_d, block->buf, len, &br);
+
+        CACHE_LOCK();
+        /*On error the block stays short and it will be read again by `lv_fs_read()`*/
+        block->len = res == LV_FS_RES_OK ? br : 0;
+        block->state = BLOCK_READY;
+        cache.stat.ahead_cnt++;
+        pthread_cond_broadcast(&cache.done_cond);
+    }
+
+    return NULL;
+}
+
+#endif /*LV_FS_BLOCK_CACHE_READ_AHEAD*/
+
+#endif /*LV_FS_BLOCK_CACHE*/
@@ -8,6 +8,7 @@
  *      INCLUDES
  *********************/
 #include "lv_mem.h"
+#include "lv_mem_slab.h"
 #include "lv_tlsf.h"
 #include "lv_gc.h"
 #include "lv_assert.h"
@@ -100,6 +101,10 @@ void lv_mem_init(void)
 #endif
 #endif
 
+#if LV_MEM_SLAB_SIZE
+    _lv_mem_slab_init();
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -114,6 +119,8 @@ void lv_mem_deinit(void)
 #if LV_MEM_CUSTOM == 0
     lv_tlsf_destroy(tlsf);
     lv_mem_init();
+#elif LV_MEM_SLAB_SIZE
+    _lv_mem_slab_init();
 #endif
 }
 
@@ -130,10 +137,24 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
+#if LV_MEM_SLAB_SIZE == 0
+    void * alloc;
+#else
+    /*The small allocations come from the arena of the slab allocator if there is room*/
+    void * alloc = _lv_mem_slab_alloc(size);
+    if(alloc) {
+#if LV_MEM_ADD_JUNK
+        lv_memset(alloc, 0xaa, size);
+#endif
+        MEM_TRACE("allocated from the slab arena at %p", alloc);
+        return alloc;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    alloc = lv_tlsf_malloc(tlsf, size);
 #else
-    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
+    alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
 
     if(alloc == NULL) {
@@ -172,6 +193,14 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_MEM_SLAB_SIZE
+#  if LV_MEM_ADD_JUNK
+    size_t slab_size = _lv_mem_slab_get_size(data);
+    if(slab_size) lv_memset(data, 0xbb, slab_size);
+#  endif
+    if(_lv_mem_slab_free(data)) return;
+#endif
+
 #if LV_MEM_CUSTOM == 0
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
@@ -202,6 +231,24 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+#if LV_MEM_SLAB_SIZE
+    size_t slab_size = _lv_mem_slab_get_size(data_p);
+    if(slab_size) {
+        /*Growing arrays (e.g. the children of an object) don't need to move until the size class is full*/
+        if(new_size <= slab_size) return data_p;
+
+        void * new_p = lv_mem_alloc(new_size);
+        if(new_p == NULL) {
+            LV_LOG_ERROR("couldn't allocate memory");
+            return NULL;
+        }
+        lv_memcpy(new_p, data_p, slab_size);
+        _lv_mem_slab_free(data_p);
+        MEM_TRACE("allocated at %p", new_p);
+        return new_p;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
@@ -253,6 +300,16 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
 
     mon_p->total_size = LV_MEM_SIZE;
+    mon_p->max_used = max_used;
+#endif
+
+#if LV_MEM_SLAB_SIZE
+    /*With `LV_MEM_CUSTOM` only the arena is known*/
+    _lv_mem_slab_monitor(mon_p);
+#endif
+
+    if(mon_p->total_size == 0) return;
+
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
@@ -262,10 +319,7 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
-    mon_p->max_used = max_used;
-
     MEM_TRACE("finished");
-#endif
 }
 
 /**
@@ -0,0 +1,220 @@
+/**
+ * @file lv_mem_slab.c
+ * Size class (slab) allocator for the small allocations of `lv_mem`.
+ * The arena is divided to pages. A page stores the slots of one size class.
+ * Freed slots are kept in a free list per page and completely free pages can be used by any size class.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_slab.h"
+#if LV_MEM_SLAB_SIZE
+
+#include "lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PAGE_SIZE       1024
+#define PAGE_CNT        (LV_MEM_SLAB_SIZE / PAGE_SIZE)
+#define PAGE_NONE       0xFFFF
+#define CLASS_FREE      0xFF
+#define CLASS_CNT       (sizeof(class_size) / sizeof(class_size[0]))
+
+#if PAGE_CNT == 0 || PAGE_CNT >= PAGE_NONE
+    #error "LV_MEM_SLAB_SIZE must be at least 1024 and less than 64 MB"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    void * free_list;   /*Freed slots, the first bytes of a free slot point to the next one*/
+    uint16_t bump_cnt;  /*The slots from this index were never used*/
+    uint16_t used_cnt;
+    uint16_t prev;      /*In the list of the partially used pages of the size class or of the free pages*/
+    uint16_t next;
+    uint8_t class_id;
+} slab_page_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void list_push(uint16_t * head, uint16_t id);
+static void list_remove(uint16_t * head, uint16_t id);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*The sizes are multiple of 8 to keep the slots aligned for any type*/
+static const uint16_t class_size[] = {8, 16, 24, 32, 48, 64, 80, 96, 128, 160, 192, 256};
+
+/*A normal array to have it in the internal RAM even if `LV_ATTRIBUTE_LARGE_RAM_ARRAY` places the LVGL heap elsewhere*/
+static uint64_t arena[PAGE_CNT * PAGE_SIZE / sizeof(uint64_t)];
+static slab_page_t pages[PAGE_CNT];
+static uint8_t class_of_size[LV_MEM_SLAB_MAX_SIZE / 8 + 1];
+static uint16_t partial_head[CLASS_CNT];
+static uint16_t free_head;
+static uint32_t cur_used;
+static uint32_t max_used;
+
+/**********************
+ *      MACROS
+ **********************/
+#define SLOT_CNT(class_id)  (PAGE_SIZE / class_size[class_id])
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_mem_slab_init(void)
+{
+    uint32_t c = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(class_of_size); i++) {
+        while(class_size[c] < i * 8) c++;
+        class_of_size[i] = (uint8_t)c;
+    }
+
+    for(i = 0; i < CLASS_CNT; i++) partial_head[i] = PAGE_NONE;
+
+    free_head = PAGE_NONE;
+    for(i = PAGE_CNT; i > 0; i--) {
+        pages[i - 1].class_id = CLASS_FREE;
+        list_push(&free_head, (uint16_t)(i - 1));
+    }
+
+    cur_used = 0;
+    max_used = 0;
+}
+
+void * _lv_mem_slab_alloc(size_t size)
+{
+    if(size > LV_MEM_SLAB_MAX_SIZE) return NULL;
+
+    uint32_t c = class_of_size[(size + 7) >> 3];
+    uint16_t id = partial_head[c];
+    slab_page_t * page;
+    if(id == PAGE_NONE) {
+        id = free_head;
+        if(id == PAGE_NONE) return NULL;
+
+        list_remove(&free_head, id);
+        page = &pages[id];
+        page->class_id = (uint8_t)c;
+        page->free_list = NULL;
+        page->bump_cnt = 0;
+        page->used_cnt = 0;
+        list_push(&partial_head[c], id);
+    }
+    else {
+        page = &pages[id];
+    }
+
+    void * slot;
+    if(page->free_list) {
+        slot = page->free_list;
+        page->free_list = *(void **)slot;
+    }
+    else {
+        slot = (uint8_t *)arena + (uint32_t)id * PAGE_SIZE + (uint32_t)page->bump_cnt * class_size[c];
+        page->bump_cnt++;
+    }
+
+    page->used_cnt++;
+    if(page->used_cnt == SLOT_CNT(c)) list_remove(&partial_head[c], id);
+
+    cur_used += class_size[c];
+    max_used = LV_MAX(max_used, cur_used);
+
+    return slot;
+}
+
+bool _lv_mem_slab_free(void * data)
+{
+    if(_lv_mem_slab_get_size(data) == 0) return false;
+
+    uint16_t id = (uint16_t)(((uint8_t *)data - (uint8_t *)arena) / PAGE_SIZE);
+    slab_page_t * page = &pages[id];
+    uint32_t c = page->class_id;
+    bool was_full = page->used_cnt == SLOT_CNT(c);
+
+    *(void **)data = page->free_list;
+    page->free_list = data;
+    page->used_cnt--;
+    cur_used -= class_size[c];
+
+    if(page->used_cnt == 0) {
+        /*Let any size class use the page*/
+        if(!was_full) list_remove(&partial_head[c], id);
+        page->class_id = CLASS_FREE;
+        list_push(&free_head, id);
+    }
+    else if(was_full) {
+        list_push(&partial_head[c], id);
+    }
+
+    return true;
+}
+
+size_t _lv_mem_slab_get_size(const void * data)
+{
+    const uint8_t * p = data;
+    const uint8_t * start = (const uint8_t *)arena;
+    if(p < start || p >= start + sizeof(arena)) return 0;
+
+    const slab_page_t * page = &pages[(p - start) / PAGE_SIZE];
+    if(page->class_id == CLASS_FREE) return 0;
+    return class_size[page->class_id];
+}
+
+void _lv_mem_slab_monitor(lv_mem_monitor_t * mon_p)
+{
+    uint32_t free_page_size = 0;
+    uint32_t free_size = 0;
+    uint32_t i;
+    for(i = 0; i < PAGE_CNT; i++) {
+        const slab_page_t * page = &pages[i];
+        if(page->class_id == CLASS_FREE) {
+            free_page_size += PAGE_SIZE;
+            mon_p->free_cnt++;
+            continue;
+        }
+
+        /*The end of the page which is smaller than a slot is lost*/
+        uint32_t free_slot_cnt = SLOT_CNT(page->class_id) - page->used_cnt;
+        free_size += free_slot_cnt * class_size[page->class_id];
+        mon_p->free_cnt += free_slot_cnt;
+        mon_p->used_cnt += page->used_cnt;
+    }
+
+    mon_p->total_size += sizeof(arena);
+    mon_p->free_size += free_page_size + free_size;
+    mon_p->free_biggest_size = LV_MAX(mon_p->free_biggest_size, free_page_size);
+    mon_p->max_used += max_used;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void list_push(uint16_t * head, uint16_t id)
+{
+    pages[id].prev = PAGE_NONE;
+    pages[id].next = *head;
+    if(*head != PAGE_NONE) pages[*head].prev = id;
+    *head = id;
+}
+
+static void list_remove(uint16_t * head, uint16_t id)
+{
+    slab_page_t * page = &pages[id];
+    if(page->prev != PAGE_NONE) pages[page->prev].next = page->next;
+    else *head = page->next;
+
+    if(page->next != PAGE_NONE) pages[page->next].prev = page->prev;
+}
+
+#endif /*LV_MEM_SLAB_SIZE*/
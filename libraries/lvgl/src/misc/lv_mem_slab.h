@@ -0,0 +1,76 @@
+/**
+ * @file lv_mem_slab.h
+ * Size class (slab) allocator for the small allocations of `lv_mem`
+ */
+
+#ifndef LV_MEM_SLAB_H
+#define LV_MEM_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_mem.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if LV_MEM_SLAB_SIZE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The largest allocation served by the slab allocator*/
+#define LV_MEM_SLAB_MAX_SIZE    256
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the arena. Everything allocated from it earlier is considered to be freed.
+ */
+void _lv_mem_slab_init(void);
+
+/**
+ * Allocate from the size class which fits `size`
+ * @param size size of the memory to allocate in bytes
+ * @return pointer to the allocated memory or NULL if `size` is too large or the arena is full
+ */
+void * _lv_mem_slab_alloc(size_t size);
+
+/**
+ * Free a memory allocated by `_lv_mem_slab_alloc()`
+ * @param data pointer to an allocated memory
+ * @return true: freed; false: `data` is not in the arena
+ */
+bool _lv_mem_slab_free(void * data);
+
+/**
+ * Get the usable size of an allocated memory
+ * @param data pointer to an allocated memory
+ * @return size of the size class of `data`, or 0 if `data` is not in the arena
+ */
+size_t _lv_mem_slab_get_size(const void * data);
+
+/**
+ * Add the state of the arena to a memory monitor.
+ * The memory in the completely free pages can be used by any size class, so it's reported as `free_biggest_size`.
+ * The free slots of the partially used pages can be used only by their size class, they are the fragmentation.
+ * @param mon_p pointer to a memory monitor to add the values of the arena to
+ */
+void _lv_mem_slab_monitor(lv_mem_monitor_t * mon_p);
+
+#endif /*LV_MEM_SLAB_SIZE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SLAB_H*/
@@ -5,13 +5,16 @@ CSRCS += lv_async.c
 CSRCS += lv_bidi.c
 CSRCS += lv_color.c
 CSRCS += lv_fs.c
+CSRCS += lv_fs_block_cache.c
 CSRCS += lv_gc.c
 CSRCS += lv_ll.c
 CSRCS += lv_log.c
 CSRCS += lv_lru.c
 CSRCS += lv_math.c
 CSRCS += lv_mem.c
+CSRCS += lv_mem_slab.c
 CSRCS += lv_printf.c
+CSRCS += lv_profiler.c
 CSRCS += lv_style.c
 CSRCS += lv_style_gen.c
 CSRCS += lv_timer.c
@@ -0,0 +1,266 @@
+/**
+ * @file lv_profiler.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_profiler.h"
+#if LV_USE_PROFILER
+
+#include "lv_mem.h"
+#include "lv_assert.h"
+#include "lv_log.h"
+#include "lv_printf.h"
+#include <stdarg.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TRACK_NAME_MAX  8
+
+/*Reserve a slot in the ring buffer without locking. Without GCC's builtins concurrent recording is not safe*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define FETCH_INC(p)  __atomic_fetch_add(p, 1, __ATOMIC_RELAXED)
+#else
+    #define FETCH_INC(p)  ((*(p))++)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t tick;
+    const char * tag;
+    uint8_t track;
+    char type;
+} profiler_item_t;
+
+typedef struct {
+    uint8_t track;
+    const char * name;
+} track_name_t;
+
+typedef struct {
+    lv_profiler_write_cb_t write_cb;
+    void * user_data;
+    char buf[160];
+    uint32_t cnt;
+} dump_ctx_t;
+
+typedef struct {
+    lv_fs_file_t file;
+    lv_fs_res_t res;
+} file_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void dump_printf(dump_ctx_t * ctx, const char * fmt, ...);
+static void file_write_cb(const char * buf, uint32_t len, void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static profiler_item_t * items;
+static uint32_t write_cnt;
+static volatile bool enabled = true;
+static track_name_t track_names[TRACK_NAME_MAX];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_profiler_init(void)
+{
+    if(items) return;
+
+    items = lv_mem_alloc(LV_PROFILER_BUF_SIZE * sizeof(profiler_item_t));
+    LV_ASSERT_MALLOC(items);
+    if(items == NULL) return;
+
+    write_cnt = 0;
+    lv_profiler_set_track_name(LV_PROFILER_TRACK_FLUSH, "flush");
+}
+
+void _lv_profiler_deinit(void)
+{
+    profiler_item_t * tmp = items;
+    items = NULL;
+    lv_mem_free(tmp);
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_profiler_add(const char * tag, char type, uint8_t track)
+{
+    if(!enabled || items == NULL) return;
+
+    uint32_t tick = (uint32_t)LV_PROFILER_TICK_GET();
+    profiler_item_t * item = &items[FETCH_INC(&write_cnt) % LV_PROFILER_BUF_SIZE];
+    item->tick = tick;
+    item->tag = tag;
+    item->track = track;
+    item->type = type;
+}
+
+void lv_profiler_enable(bool en)
+{
+    enabled = en;
+}
+
+bool lv_profiler_is_enabled(void)
+{
+    return enabled;
+}
+
+void lv_profiler_reset(void)
+{
+    bool en = enabled;
+    enabled = false;
+    write_cnt = 0;
+    enabled = en;
+}
+
+void lv_profiler_get_stat(lv_profiler_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    uint32_t cnt = write_cnt;
+    stat->recorded = cnt;
+    stat->overwritten = cnt > LV_PROFILER_BUF_SIZE ? cnt - LV_PROFILER_BUF_SIZE : 0;
+    stat->size = items ? LV_PROFILER_BUF_SIZE : 0;
+}
+
+void lv_profiler_set_track_name(uint8_t track, const char * name)
+{
+    uint32_t i;
+    track_name_t * free_slot = NULL;
+    for(i = 0; i < TRACK_NAME_MAX; i++) {
+        if(track_names[i].name && track_names[i].track == track) {
+            track_names[i].name = name;
+            return;
+        }
+        if(track_names[i].name == NULL && free_slot == NULL) free_slot = &track_names[i];
+    }
+
+    if(free_slot == NULL) {
+        LV_LOG_WARN("no room for more track names");
+        return;
+    }
+
+    free_slot->track = track;
+    free_slot->name = name;
+}
+
+uint32_t lv_profiler_dump(lv_profiler_write_cb_t write_cb, void * user_data)
+{
+    LV_ASSERT_NULL(write_cb);
+
+    bool en = enabled;
+    enabled = false;
+
+    dump_ctx_t ctx;
+    ctx.write_cb = write_cb;
+    ctx.user_data = user_data;
+    ctx.cnt = 0;
+
+    write_cb("[", 1, user_data);
+
+    uint32_t i;
+    for(i = 0; i < TRACK_NAME_MAX; i++) {
+        if(track_names[i].name == NULL) continue;
+        dump_printf(&ctx, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                    track_names[i].track, track_names[i].name);
+    }
+
+    uint32_t cnt = items ? write_cnt : 0;
+    uint32_t num = cnt < LV_PROFILER_BUF_SIZE ? cnt : LV_PROFILER_BUF_SIZE;
+    uint32_t first = cnt < LV_PROFILER_BUF_SIZE ? 0 : cnt % LV_PROFILER_BUF_SIZE;
+
+    /*The ticks can wrap around and the threads' events can be slightly out of order,
+     *so walk through the events by the signed differences and find the earliest one first*/
+    int64_t t = 0;
+    int64_t t_min = 0;
+    uint32_t prev_tick = num ? items[first].tick : 0;
+    for(i = 0; i < num; i++) {
+        const profiler_item_t * item = &items[(first + i) % LV_PROFILER_BUF_SIZE];
+        t += (int32_t)(item->tick - prev_tick);
+        prev_tick = item->tick;
+        if(t < t_min) t_min = t;
+    }
+
+    uint32_t event_cnt = ctx.cnt;
+    t = 0;
+    prev_tick = num ? items[first].tick : 0;
+    for(i = 0; i < num; i++) {
+        const profiler_item_t * item = &items[(first + i) % LV_PROFILER_BUF_SIZE];
+        t += (int32_t)(item->tick - prev_tick);
+        prev_tick = item->tick;
+
+        /*Convert to microseconds without overflowing the 64 bit intermediate values*/
+        uint64_t tick_rel = (uint64_t)(t - t_min);
+        uint64_t rem = tick_rel % LV_PROFILER_TICK_PER_SEC;
+        uint32_t us = (uint32_t)((tick_rel / LV_PROFILER_TICK_PER_SEC) * 1000000 +
+                                 (rem * 1000000) / LV_PROFILER_TICK_PER_SEC);
+        uint32_t ns = (uint32_t)((((rem * 1000000) % LV_PROFILER_TICK_PER_SEC) * 1000) / LV_PROFILER_TICK_PER_SEC);
+
+        dump_printf(&ctx, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%"LV_PRIu32".%03"LV_PRIu32",\"pid\":0,\"tid\":%d}",
+                    item->tag, item->type, us, ns, item->track);
+    }
+
+    write_cb("\n]\n", 3, user_data);
+
+    enabled = en;
+
+    return ctx.cnt - event_cnt;
+}
+
+lv_fs_res_t lv_profiler_dump_to_file(const char * path)
+{
+    file_ctx_t ctx;
+    lv_fs_res_t res = lv_fs_open(&ctx.file, path, LV_FS_MODE_WR);
+    if(res != LV_FS_RES_OK) return res;
+
+    ctx.res = LV_FS_RES_OK;
+    lv_profiler_dump(file_write_cb, &ctx);
+
+    res = lv_fs_close(&ctx.file);
+    return ctx.res != LV_FS_RES_OK ? ctx.res : res;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void dump_printf(dump_ctx_t * ctx, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int len = lv_vsnprintf(ctx->buf, sizeof(ctx->buf), fmt, args);
+    va_end(args);
+    if(len < 0) return;
+    if(len > (int)sizeof(ctx->buf) - 1) len = sizeof(ctx->buf) - 1;
+
+    /*Separate the items*/
+    if(ctx->cnt) ctx->write_cb(",\n", 2, ctx->user_data);
+    else ctx->write_cb("\n", 1, ctx->user_data);
+
+    ctx->write_cb(ctx->buf, len, ctx->user_data);
+    ctx->cnt++;
+}
+
+static void file_write_cb(const char * buf, uint32_t len, void * user_data)
+{
+    file_ctx_t * ctx = user_data;
+    if(ctx->res != LV_FS_RES_OK) return;
+
+    uint32_t bw;
+    ctx->res = lv_fs_write(&ctx->file, buf, len, &bw);
+    if(ctx->res == LV_FS_RES_OK && bw != len) ctx->res = LV_FS_RES_FULL;
+}
+
+#endif /*LV_USE_PROFILER*/
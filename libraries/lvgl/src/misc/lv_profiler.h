@@ -0,0 +1,157 @@
+/**
+ * @file lv_profiler.h
+ *
+ */
+
+#ifndef LV_PROFILER_H
+#define LV_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lv_fs.h"
+
+#if LV_USE_PROFILER
+#include LV_PROFILER_INCLUDE
+#include "../hal/lv_hal_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Track IDs from here are not used by threads but by the spans which end in an other context (e.g. in an interrupt)*/
+#define LV_PROFILER_TRACK_FIRST 240
+
+/*Track of the flushing, from calling `flush_cb` until `lv_disp_flush_ready()`*/
+#define LV_PROFILER_TRACK_FLUSH LV_PROFILER_TRACK_FIRST
+
+/*First track ID the application can use for its own asynchronous spans*/
+#define LV_PROFILER_TRACK_USER  (LV_PROFILER_TRACK_FIRST + 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Write the next piece of the exported trace
+ * @param buf       the text to write (not '\0' terminated)
+ * @param len       length of the text in bytes
+ * @param user_data the `user_data` passed to `lv_profiler_dump()`
+ */
+typedef void (*lv_profiler_write_cb_t)(const char * buf, uint32_t len, void * user_data);
+
+typedef struct {
+    uint32_t recorded;      /**< Number of events recorded since the last reset*/
+    uint32_t overwritten;   /**< Number of the oldest events overwritten because the buffer was full*/
+    uint32_t size;          /**< Number of events the buffer can store*/
+} lv_profiler_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate the ring buffer of the profiler. Called by `lv_init()`.
+ */
+void _lv_profiler_init(void);
+
+/**
+ * Free the ring buffer of the profiler. Called by `lv_deinit()`.
+ */
+void _lv_profiler_deinit(void);
+
+/**
+ * Record an event. Lock-free, so it can be called from any thread or interrupt.
+ * Usually it's called by the `LV_PROFILER_...` macros.
+ * @param tag       name of the span. Must be a static string without `"` and `\` characters.
+ * @param type      'B': the span begins, 'E': the span ends
+ * @param track     ID of the thread or track (0..255) on which the span should be shown
+ */
+void lv_profiler_add(const char * tag, char type, uint8_t track);
+
+/**
+ * Enable or disable recording the events. Enabled by default.
+ * @param en        true: enable; false: disable
+ */
+void lv_profiler_enable(bool en);
+
+/**
+ * Tell whether the events are being recorded
+ * @return          true: enabled
+ */
+bool lv_profiler_is_enabled(void);
+
+/**
+ * Drop the recorded events and clear the statistics
+ */
+void lv_profiler_reset(void);
+
+/**
+ * Get the statistics of the profiler
+ * @param stat      store the statistics here
+ */
+void lv_profiler_get_stat(lv_profiler_stat_t * stat);
+
+/**
+ * Give a name to a track to show it instead of the ID in the trace viewer
+ * @param track     ID of the track
+ * @param name      name of the track. Must be a static string without `"` and `\` characters.
+ */
+void lv_profiler_set_track_name(uint8_t track, const char * name);
+
+/**
+ * Export the recorded events as Chrome trace JSON (open it with `chrome://tracing` or https://ui.perfetto.dev).
+ * Recording is paused while exporting.
+ * @param write_cb  called with the consecutive pieces of the JSON text, e.g. to print them to a serial console
+ * @param user_data passed to `write_cb`
+ * @return          number of events written
+ */
+uint32_t lv_profiler_dump(lv_profiler_write_cb_t write_cb, void * user_data);
+
+/**
+ * Export the recorded events as Chrome trace JSON into a file
+ * @param path      path of the file to (over)write, e.g. "S:/trace.json"
+ * @return          LV_FS_RES_OK or any error from ::lv_fs_res_t
+ */
+lv_fs_res_t lv_profiler_dump_to_file(const char * path);
+
+/**********************
+ *      MACROS
+ **********************/
+
+/*Begin/end a span named as the current function on the current thread's track*/
+#define LV_PROFILER_BEGIN                       lv_profiler_add(__func__, 'B', LV_PROFILER_TID_GET())
+#define LV_PROFILER_END                         lv_profiler_add(__func__, 'E', LV_PROFILER_TID_GET())
+
+/*Begin/end a span with a custom name on the current thread's track*/
+#define LV_PROFILER_BEGIN_TAG(tag)              lv_profiler_add(tag, 'B', LV_PROFILER_TID_GET())
+#define LV_PROFILER_END_TAG(tag)                lv_profiler_add(tag, 'E', LV_PROFILER_TID_GET())
+
+/*Begin/end a span on a given track, e.g. which begins on a thread and ends in an interrupt*/
+#define LV_PROFILER_BEGIN_TRACK(tag, track)     lv_profiler_add(tag, 'B', track)
+#define LV_PROFILER_END_TRACK(tag, track)       lv_profiler_add(tag, 'E', track)
+
+#else /*LV_USE_PROFILER*/
+
+#define LV_PROFILER_BEGIN
+#define LV_PROFILER_END
+#define LV_PROFILER_BEGIN_TAG(tag)
+#define LV_PROFILER_END_TAG(tag)
+#define LV_PROFILER_BEGIN_TRACK(tag, track)
+#define LV_PROFILER_END_TRACK(tag, track)
+
+#endif /*LV_USE_PROFILER*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PROFILER_H*/
@@ -26,6 +26,7 @@
 
 static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_and_meta, lv_style_value_t value,
                                        void (*value_adjustment_helper)(lv_style_prop_t, lv_style_value_t, uint16_t *, lv_style_value_t *));
+static void style_changed(void);
 static void lv_style_set_prop_helper(lv_style_prop_t prop, lv_style_value_t value, uint16_t * prop_storage,
                                      lv_style_value_t * value_storage);
 static void lv_style_set_prop_meta_helper(lv_style_prop_t prop, lv_style_value_t value, uint16_t * prop_storage,
@@ -139,6 +140,7 @@ uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
 static uint16_t last_custom_prop_id = (uint16_t)_LV_STYLE_LAST_BUILT_IN_PROP;
 static const lv_style_value_t null_style_value = { .num = 0 };
+static uint32_t change_cnt = 1;
 
 /**********************
  *      MACROS
@@ -160,6 +162,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    style_changed();
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -176,6 +179,7 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    style_changed();
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -230,6 +234,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    style_changed();
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -371,6 +377,11 @@ bool lv_style_is_empty(const lv_style_t * style)
     return style->prop_cnt == 0 ? true : false;
 }
 
+uint32_t _lv_style_get_change_cnt(void)
+{
+    return change_cnt;
+}
+
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
 {
     uint16_t group = (prop & 0x1FF) >> 4;
@@ -397,6 +408,12 @@ uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
  *   STATIC FUNCTIONS
  **********************/
 
+static void style_changed(void)
+{
+    change_cnt++;
+    if(change_cnt == 0) change_cnt = 1;   /*0 is never a valid counter value*/
+}
+
 static void lv_style_set_prop_helper(lv_style_prop_t prop, lv_style_value_t value, uint16_t * prop_storage,
                                      lv_style_value_t * value_storage)
 {
@@ -422,6 +439,8 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         return;
     }
 
+    style_changed();
+
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
     if(style->prop_cnt > 1) {
@@ -502,6 +502,13 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
  */
 bool lv_style_is_empty(const lv_style_t * style);
 
+/**
+ * Get a counter which is changed whenever a property is set or removed in any style.
+ * Used to know when the cached style properties of the objects are outdated.
+ * @return the counter, never 0
+ */
+uint32_t _lv_style_get_change_cnt(void);
+
 /**
  * Tell the group of a property. If the a property from a group is set in a style the (1 << group) bit of style->has_group is set.
  * It allows early skipping the style if the property is not exists in the style at all.
@@ -11,6 +11,8 @@
 #include "lv_mem.h"
 #include "lv_ll.h"
 #include "lv_gc.h"
+#include "lv_math.h"
+#include "lv_profiler.h"
 
 /*********************
  *      DEFINES
@@ -18,6 +20,11 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+/*`heap_id` of the timers which are not in the heap*/
+#define HEAP_ID_NONE    0xFFFFFFFF      /*Paused*/
+#define HEAP_ID_RAN     0xFFFFFFFE      /*Executed in the current `lv_timer_handler()` call*/
+#define IS_IN_HEAP(t)   ((t)->heap_id < HEAP_ID_RAN)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +34,14 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static bool reserve(uint32_t cnt);
+static bool is_earlier(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static uint32_t heap_sift_up(uint32_t id);
+static void heap_sift_down(uint32_t id);
+static void ran_remove(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -34,7 +49,11 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
-static bool timer_created;
+static uint32_t timer_cnt;
+static uint32_t timer_cap;      /*Size of the heap and the ran arrays*/
+static uint32_t heap_cnt;
+static uint32_t ran_cnt;
+static uint32_t seq_cnt;
 
 /**********************
  *      MACROS
@@ -55,6 +74,12 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    LV_GC_ROOT(_lv_timer_ran) = NULL;
+    timer_cnt = 0;
+    timer_cap = 0;
+    heap_cnt = 0;
+    ran_cnt = 0;
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -81,6 +106,8 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         return 1;
     }
 
+    LV_PROFILER_BEGIN;
+
     static uint32_t idle_period_start = 0;
     static uint32_t busy_time         = 0;
 
@@ -95,40 +122,34 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
+    /*Run the due timers in the order of their deadline.
+     *The executed timers are kept out of the heap until the end to run them only once in a call*/
+    while(heap_cnt) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(lv_timer_time_remaining(timer) != 0) break;
 
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
+        heap_remove(timer);
+        timer->heap_id = HEAP_ID_RAN;
+        LV_GC_ROOT(_lv_timer_ran)[ran_cnt] = timer;
+        ran_cnt++;
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+        timer_deleted = false;
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    /*The deleted timers were removed from the array, the paused ones stay out of the heap*/
+    uint32_t i;
+    for(i = 0; i < ran_cnt; i++) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_ran)[i];
+        timer->heap_id = HEAP_ID_NONE;
+        if(!timer->paused) heap_insert(timer);
     }
+    ran_cnt = 0;
+
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt) time_till_next = lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0]);
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -141,6 +162,8 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
 
     already_running = false; /*Release the mutex*/
 
+    LV_PROFILER_END;
+
     TIMER_TRACE("finished (%d ms until the next timer call)", time_till_next);
     return time_till_next;
 }
@@ -168,9 +191,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    /*Inserting to the heap can't fail later*/
+    if(!reserve(timer_cnt + 1)) return NULL;
+
     new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
+    timer_cnt++;
 
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
@@ -178,8 +205,9 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
-
-    timer_created = true;
+    new_timer->seq = seq_cnt++;
+    new_timer->heap_id = HEAP_ID_NONE;
+    heap_insert(new_timer);
 
     return new_timer;
 }
@@ -200,8 +228,14 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+    if(timer->heap_id == HEAP_ID_RAN) ran_remove(timer);
+    else if(IS_IN_HEAP(timer)) heap_remove(timer);
+
+    /*Tell `lv_timer_exec()` that the timer deleted itself*/
+    if(timer == LV_GC_ROOT(_lv_timer_act)) timer_deleted = true;
+
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
+    timer_cnt--;
 
     lv_mem_free(timer);
 }
@@ -213,11 +247,14 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+    if(IS_IN_HEAP(timer)) heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+    /*If it's running now it will be added back at the end of `lv_timer_handler()`*/
+    if(timer->heap_id == HEAP_ID_NONE) heap_insert(timer);
 }
 
 /**
@@ -228,6 +265,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    if(IS_IN_HEAP(timer)) heap_update(timer);
 }
 
 /**
@@ -237,6 +275,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    if(IS_IN_HEAP(timer)) heap_update(timer);
 }
 
 /**
@@ -247,6 +286,9 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+
+    /*Let the next `lv_timer_handler()` delete it*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 /**
@@ -257,6 +299,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    if(IS_IN_HEAP(timer)) heap_update(timer);
 }
 
 /**
@@ -304,8 +347,7 @@ static bool lv_timer_exec(lv_timer_t * timer)
     bool exec = false;
     if(lv_timer_time_remaining(timer) == 0) {
         /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
+         * If the timer deletes itself `if(timer->repeat_count == 0)` is not executed below*/
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
@@ -339,3 +381,126 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+/**
+ * Make sure the heap and the ran arrays can store `cnt` timers
+ * @param cnt number of timers
+ * @return true: success; false: out of memory
+ */
+static bool reserve(uint32_t cnt)
+{
+    if(cnt <= timer_cap) return true;
+
+    uint32_t new_cap = timer_cap ? timer_cap * 2 : 8;
+    lv_timer_t ** heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_cap * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(heap);
+    if(heap == NULL) return false;
+    LV_GC_ROOT(_lv_timer_heap) = heap;
+
+    lv_timer_t ** ran = lv_mem_realloc(LV_GC_ROOT(_lv_timer_ran), new_cap * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(ran);
+    if(ran == NULL) return false;
+    LV_GC_ROOT(_lv_timer_ran) = ran;
+
+    timer_cap = new_cap;
+    return true;
+}
+
+/**
+ * Compare the deadline of two timers.
+ * Periods longer than `INT32_MAX` ms are ordered as `INT32_MAX` to compare the ticks with overflow.
+ * The timers with the same deadline run from the newest to the oldest as they were in the timer list.
+ * @param a pointer to a timer
+ * @param b pointer to an other timer
+ * @return true: `a` needs to run before `b`
+ */
+static bool is_earlier(const lv_timer_t * a, const lv_timer_t * b)
+{
+    uint32_t deadline_a = a->last_run + LV_MIN(a->period, INT32_MAX);
+    uint32_t deadline_b = b->last_run + LV_MIN(b->period, INT32_MAX);
+    int32_t diff = (int32_t)(deadline_a - deadline_b);
+    if(diff != 0) return diff < 0;
+    return (int32_t)(a->seq - b->seq) > 0;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    uint32_t id = heap_cnt;
+    heap_cnt++;
+    LV_GC_ROOT(_lv_timer_heap)[id] = timer;
+    timer->heap_id = id;
+    heap_sift_up(id);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    uint32_t id = timer->heap_id;
+    timer->heap_id = HEAP_ID_NONE;
+
+    heap_cnt--;
+    if(id == heap_cnt) return;
+
+    heap[id] = heap[heap_cnt];
+    heap[id]->heap_id = id;
+    heap_update(heap[id]);
+}
+
+/**
+ * Move a timer to its place after its deadline has changed
+ * @param timer pointer to a timer in the heap
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t id = heap_sift_up(timer->heap_id);
+    heap_sift_down(id);
+}
+
+static uint32_t heap_sift_up(uint32_t id)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[id];
+    while(id > 0) {
+        uint32_t parent = (id - 1) / 2;
+        if(!is_earlier(timer, heap[parent])) break;
+        heap[id] = heap[parent];
+        heap[id]->heap_id = id;
+        id = parent;
+    }
+
+    heap[id] = timer;
+    timer->heap_id = id;
+    return id;
+}
+
+static void heap_sift_down(uint32_t id)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[id];
+    while(1) {
+        uint32_t child = id * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && is_earlier(heap[child + 1], heap[child])) child++;
+        if(!is_earlier(heap[child], timer)) break;
+        heap[id] = heap[child];
+        heap[id]->heap_id = id;
+        id = child;
+    }
+
+    heap[id] = timer;
+    timer->heap_id = id;
+}
+
+static void ran_remove(lv_timer_t * timer)
+{
+    lv_timer_t ** ran = LV_GC_ROOT(_lv_timer_ran);
+    uint32_t i;
+    for(i = 0; i < ran_cnt; i++) {
+        if(ran[i] == timer) {
+            ran_cnt--;
+            ran[i] = ran[ran_cnt];
+            break;
+        }
+    }
+    timer->heap_id = HEAP_ID_NONE;
+}
@@ -48,6 +48,8 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+    uint32_t heap_id; /**< Index in the heap of the waiting timers (internal)*/
+    uint32_t seq;     /**< Creation order to run the timers due at the same time in a fixed order (internal)*/
 } lv_timer_t;
 
 /**********************
@@ -63,7 +65,7 @@ void _lv_timer_core_init(void);
 
 /**
  * Call it periodically to handle lv_timers.
- * @return time till it needs to be run next (in ms)
+ * @return time till it needs to be run next (in ms), `LV_NO_TIMER_READY` if there is no running timer
  */
 uint32_t /* LV_ATTRIBUTE_TIMER_HANDLER */ lv_timer_handler(void);
 
@@ -135,6 +137,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period);
 
 /**
  * Make a lv_timer ready. It will not wait its period.
+ * It's cheap, can be called often e.g. to request a refresh.
  * @param timer pointer to a lv_timer.
  */
 void lv_timer_ready(lv_timer_t * timer);
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include <stdarg.h>
+#include <string.h>
 #include "lv_txt.h"
 #include "lv_txt_ap.h"
 #include "lv_math.h"
@@ -46,9 +47,13 @@
     static uint32_t lv_txt_iso8859_1_get_char_id(const char * txt, uint32_t byte_id);
     static uint32_t lv_txt_iso8859_1_get_length(const char * txt);
 #endif
+static void layout_normalize_key(lv_coord_t * max_width, lv_text_flag_t * flag);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_txt_layout_stat_t layout_stat;
+static uint32_t layout_font_gen;
 
 /**********************
  *  GLOBAL VARIABLES
@@ -496,6 +501,182 @@ void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t
     *letter_next = *letter != '\0' ? _lv_txt_encoded_next(&txt[*ofs], NULL) : 0;
 }
 
+void _lv_txt_layout_init(lv_txt_layout_t * layout)
+{
+    lv_memset_00(layout, sizeof(lv_txt_layout_t));
+}
+
+bool _lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(txt == NULL || font == NULL) return false;
+
+    if(_lv_txt_layout_is_for(layout, font, letter_space, max_width, flag) && strcmp(layout->txt, txt) == 0) {
+        layout_stat.hit_cnt++;
+        return true;
+    }
+
+    layout_normalize_key(&max_width, &flag);
+
+    layout_stat.miss_cnt++;
+    layout->valid = 0;
+
+    uint32_t len = strlen(txt);
+    if(layout->txt_size < len + 1) {
+        char * txt_copy = lv_mem_realloc(layout->txt, len + 1);
+        if(txt_copy == NULL) return false;
+        layout->txt = txt_copy;
+        layout->txt_size = len + 1;
+    }
+
+    /*There are at most as many letters as bytes*/
+    if(layout->letter_w_size < len + 1) {
+        uint16_t * letter_w = lv_mem_realloc(layout->letter_w, (len + 1) * sizeof(uint16_t));
+        if(letter_w == NULL) return false;
+        layout->letter_w = letter_w;
+        layout->letter_w_size = len + 1;
+    }
+
+    /*Without word wrapping it's enough to look for the new lines*/
+    lv_text_flag_t line_flag = flag;
+    if(max_width == LV_COORD_MAX) line_flag |= LV_TEXT_FLAG_FIT;
+
+    uint32_t line_cnt = 0;
+    uint32_t letter_id = 0;
+    uint32_t line_start = 0;
+    lv_coord_t width = 0;
+    while(1) {
+        /*Keep a place for the end of the text too*/
+        if(line_cnt >= layout->lines_size) {
+            uint32_t new_size = layout->lines_size ? layout->lines_size * 2 : 4;
+            lv_txt_layout_line_t * lines = lv_mem_realloc(layout->lines, new_size * sizeof(lv_txt_layout_line_t));
+            if(lines == NULL) return false;
+            layout->lines = lines;
+            layout->lines_size = new_size;
+        }
+
+        lv_txt_layout_line_t * line = &layout->lines[line_cnt];
+        line->start = line_start;
+        line->letter_id = letter_id;
+        line->width = 0;
+        if(txt[line_start] == '\0') break;
+
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_width, NULL,
+                                                               line_flag);
+
+        /*Measure the line like lv_txt_get_width() but save the letter widths too*/
+        lv_text_cmd_state_t cmd_state = LV_TEXT_CMD_STATE_WAIT;
+        uint32_t i = line_start;
+        while(i < line_end) {
+            uint32_t letter;
+            uint32_t letter_next;
+            _lv_txt_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+
+            uint16_t letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+            layout->letter_w[letter_id++] = letter_w;
+
+            if((flag & LV_TEXT_FLAG_RECOLOR) != 0) {
+                if(_lv_txt_is_cmd(&cmd_state, letter) != false) {
+                    continue;
+                }
+            }
+
+            if(letter_w > 0) {
+                line->width += letter_w;
+                line->width += letter_space;
+            }
+        }
+        if(line->width > 0) line->width -= letter_space;
+
+        width = LV_MAX(width, line->width);
+        line_start = line_end;
+        line_cnt++;
+    }
+
+    lv_memcpy(layout->txt, txt, len + 1);
+    layout->txt_len = len;
+    layout->font = font;
+    layout->font_gen = layout_font_gen;
+    layout->letter_space = letter_space;
+    layout->max_width = max_width;
+    layout->flag = flag;
+    layout->line_cnt = line_cnt;
+    layout->width = width;
+    layout->last_new_line = len > 0 && (txt[len - 1] == '\n' || txt[len - 1] == '\r');
+    layout->valid = 1;
+
+    return true;
+}
+
+bool _lv_txt_layout_reuse(const lv_txt_layout_t * layout, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(!_lv_txt_layout_is_for(layout, font, letter_space, max_width, flag)) return false;
+
+    layout_stat.hit_cnt++;
+    return true;
+}
+
+bool _lv_txt_layout_is_for(const lv_txt_layout_t * layout, const lv_font_t * font, lv_coord_t letter_space,
+                           lv_coord_t max_width, lv_text_flag_t flag)
+{
+    layout_normalize_key(&max_width, &flag);
+    return layout->valid && layout->font == font && layout->font_gen == layout_font_gen &&
+           layout->letter_space == letter_space && layout->max_width == max_width && layout->flag == flag;
+}
+
+void _lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_coord_t line_space, lv_point_t * size_res)
+{
+    lv_coord_t letter_height = lv_font_get_line_height(layout->font);
+    uint32_t line_cnt = layout->line_cnt + layout->last_new_line;
+
+    size_res->x = layout->width;
+    if(line_cnt == 0) size_res->y = letter_height;
+    else size_res->y = (int32_t)line_cnt * (letter_height + line_space) - line_space;
+}
+
+void _lv_txt_layout_free(lv_txt_layout_t * layout)
+{
+    lv_mem_free(layout->lines);
+    lv_mem_free(layout->letter_w);
+    lv_mem_free(layout->txt);
+    _lv_txt_layout_init(layout);
+}
+
+void lv_txt_layout_invalidate_font(const lv_font_t * font)
+{
+    /*The layouts aren't registered anywhere so all of them are invalidated*/
+    LV_UNUSED(font);
+    layout_font_gen++;
+}
+
+void lv_txt_layout_get_stat(lv_txt_layout_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+    *stat = layout_stat;
+}
+
+void lv_txt_layout_reset_stat(void)
+{
+    lv_memset_00(&layout_stat, sizeof(layout_stat));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Bring the parameters of a layout to a common form.
+ * Without word wrapping the max. width doesn't matter and only the recolor flag changes the measured widths.
+ * @param max_width pointer to the max. width
+ * @param flag pointer to the text flags
+ */
+static void layout_normalize_key(lv_coord_t * max_width, lv_text_flag_t * flag)
+{
+    if(*flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) *max_width = LV_COORD_MAX;
+    *flag &= LV_TEXT_FLAG_RECOLOR;
+}
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
 /*******************************
  *   UTF-8 ENCODER/DECODER
@@ -65,6 +65,40 @@ enum {
 };
 typedef uint8_t lv_text_align_t;
 
+/** A line of a measured text*/
+typedef struct {
+    uint32_t start;         /**< Byte index of the first character of the line*/
+    uint32_t letter_id;     /**< Index of the first letter of the line in `letter_w`*/
+    lv_coord_t width;       /**< Width of the line as `lv_txt_get_width()` returns it*/
+} lv_txt_layout_line_t;
+
+/**
+ * Line breaks and letter widths of a text measured once and reused while the text,
+ * the font, the letter space, the max. width and the flags are the same.*/
+typedef struct {
+    char * txt;                     /**< Copy of the measured text*/
+    uint32_t txt_len;               /**< Length of the measured text in bytes*/
+    const lv_font_t * font;
+    uint32_t font_gen;              /**< Value of the font generation counter when the text was measured*/
+    lv_coord_t letter_space;
+    lv_coord_t max_width;           /**< LV_COORD_MAX if the lines are broken only at new line characters*/
+    lv_text_flag_t flag;            /**< Only ::LV_TEXT_FLAG_RECOLOR matters, the others are part of `max_width`*/
+    uint8_t valid : 1;
+    uint8_t last_new_line : 1;      /**< The text ends with a new line so it's one line taller*/
+    uint32_t line_cnt;
+    lv_coord_t width;               /**< Width of the longest line*/
+    lv_txt_layout_line_t * lines;   /**< `line_cnt + 1` lines. The last is the end of the text.*/
+    uint16_t * letter_w;            /**< Width of every letter (recolor commands and new lines included)*/
+    uint32_t lines_size;            /**< Number of allocated items in `lines`*/
+    uint32_t letter_w_size;         /**< Number of allocated items in `letter_w`*/
+    uint32_t txt_size;              /**< Number of allocated bytes in `txt`*/
+} lv_txt_layout_t;
+
+typedef struct {
+    uint32_t hit_cnt;       /**< The text was already measured with the same parameters*/
+    uint32_t miss_cnt;      /**< The text had to be measured*/
+} lv_txt_layout_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -112,6 +146,83 @@ uint32_t _lv_txt_get_next_line(const char * txt, const lv_font_t * font, lv_coor
 lv_coord_t lv_txt_get_width(const char * txt, uint32_t length, const lv_font_t * font, lv_coord_t letter_space,
                             lv_text_flag_t flag);
 
+/**
+ * Initialize a text layout cache.
+ * @param layout pointer to a layout
+ */
+void _lv_txt_layout_init(lv_txt_layout_t * layout);
+
+/**
+ * Measure a text into a layout cache unless it's already measured with the same parameters.
+ * The text is compared with a saved copy so setting the same text again keeps the layout.
+ * @param layout pointer to an initialized layout
+ * @param txt a '\0' terminated string
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max width of the text (break the lines to fit this size)
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @return true: `layout` describes the text; false: out of memory
+ */
+bool _lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Use a layout again without comparing the text. For callers which know that the text hasn't changed
+ * since the last `_lv_txt_layout_update()`.
+ * @param layout pointer to a layout
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max width of the text (break the lines to fit this size)
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @return true: `layout` can be used; false: it has to be updated
+ */
+bool _lv_txt_layout_reuse(const lv_txt_layout_t * layout, const lv_font_t * font, lv_coord_t letter_space,
+                          lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Check if a layout was measured with the given parameters. The text itself is not checked.
+ * @param layout pointer to a layout
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max width of the text
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @return true: the layout can be used with these parameters
+ */
+bool _lv_txt_layout_is_for(const lv_txt_layout_t * layout, const lv_font_t * font, lv_coord_t letter_space,
+                           lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Get the size of a measured text. Gives the same result as `lv_txt_get_size()`.
+ * @param layout pointer to a valid layout
+ * @param line_space line space of the text
+ * @param size_res pointer to a 'point_t' variable to store the result
+ */
+void _lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_coord_t line_space, lv_point_t * size_res);
+
+/**
+ * Free the buffers of a layout and invalidate it.
+ * @param layout pointer to a layout
+ */
+void _lv_txt_layout_free(lv_txt_layout_t * layout);
+
+/**
+ * Invalidate the text layouts because the glyphs of a font have changed (e.g. its size was set) or
+ * the font is deleted. Every layout is measured again on its next use, not only the ones of `font`.
+ * @param font pointer to the changed font
+ */
+void lv_txt_layout_invalidate_font(const lv_font_t * font);
+
+/**
+ * Get the number of text layout cache hits and misses.
+ * @param stat store the result here
+ */
+void lv_txt_layout_get_stat(lv_txt_layout_stat_t * stat);
+
+/**
+ * Reset the text layout cache statistics.
+ */
+void lv_txt_layout_reset_stat(void);
+
 /**
  * Check next character in a string and decide if the character is part of the command or not
  * @param state pointer to a txt_cmd_state_t variable which stores the current state of command
@@ -42,6 +42,12 @@ static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
 static void lv_label_revert_dots(lv_obj_t * label);
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
+#if LV_LABEL_LAYOUT_CACHE
+    static const lv_txt_layout_t * get_layout(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                              lv_coord_t max_w, lv_text_flag_t flag);
+#endif
 
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
@@ -53,9 +59,13 @@ static void set_ofs_y_anim(void * obj, int32_t v);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_label_class = {
+    .name = "label",
     .constructor_cb = lv_label_constructor,
     .destructor_cb = lv_label_destructor,
     .event_cb = lv_label_event,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_STYLE_CHANGED) | LV_EVENT_MASK(LV_EVENT_REFR_EXT_DRAW_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_SIZE_CHANGED) | LV_EVENT_MASK(LV_EVENT_GET_SELF_SIZE) |
+                  LV_EVENT_MASK(LV_EVENT_DRAW_MAIN),
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_SIZE_CONTENT,
     .instance_size = sizeof(lv_label_t),
@@ -706,6 +716,11 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_init(&label->layout);
+    label->layout_txt_changed = 1;
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -728,6 +743,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_mem_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_free(&label->layout);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -775,7 +794,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
         else w = lv_obj_get_content_width(obj);
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+        get_txt_size(obj, &size, font, letter_space, line_space, w, flag);
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -822,8 +841,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -842,6 +861,12 @@ static void draw_main(lv_event_t * e)
     bool is_common = _lv_area_intersect(&txt_clip, &txt_coords, draw_ctx->clip_area);
     if(!is_common) return;
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Usually the text is already measured when it was set so the layout is just reused here*/
+    label_draw_dsc.layout = get_layout(obj, label_draw_dsc.font, label_draw_dsc.letter_space,
+                                       lv_area_get_width(&txt_coords), flag);
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
         lv_coord_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -862,8 +887,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -897,6 +922,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
+#if LV_LABEL_LAYOUT_CACHE
+    label->layout_txt_changed = 1;
+#endif
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -912,7 +940,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_txt_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1156,6 +1184,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LAYOUT_CACHE
+                label->layout_txt_changed = 1;
+#endif
             }
         }
     }
@@ -1187,6 +1218,9 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+#if LV_LABEL_LAYOUT_CACHE
+    label->layout_txt_changed = 1;
+#endif
 }
 
 /**
@@ -1252,6 +1286,65 @@ static void lv_label_dot_tmp_free(lv_obj_t * obj)
     label->dot.tmp_ptr   = NULL;
 }
 
+/**
+ * Get the size of the label's text like `lv_txt_get_size()` but use the label's layout cache if possible.
+ * @param obj pointer to a label object
+ * @param size_res pointer to a 'point_t' variable to store the result
+ * @param font pointer to font of the text
+ * @param letter_space letter space of the text
+ * @param line_space line space of the text
+ * @param max_w max width of the text
+ * @param flag settings for the text from ::lv_text_flag_t
+ */
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+#if LV_LABEL_LAYOUT_CACHE
+    const lv_txt_layout_t * layout = get_layout(obj, font, letter_space, max_w, flag);
+    if(layout) {
+        _lv_txt_layout_get_size(layout, line_space, size_res);
+        return;
+    }
+#endif
+
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_txt_get_size(size_res, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+#if LV_LABEL_LAYOUT_CACHE
+/**
+ * Measure the label's text into its layout cache unless it's already measured with the same parameters.
+ * @param obj pointer to a label object
+ * @param font pointer to font of the text
+ * @param letter_space letter space of the text
+ * @param max_w max width of the text
+ * @param flag settings for the text from ::lv_text_flag_t
+ * @return pointer to the layout or NULL if the text is too long or there is no memory for it
+ */
+static const lv_txt_layout_t * get_layout(lv_obj_t * obj, const lv_font_t * font, lv_coord_t letter_space,
+                                          lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->text == NULL) return NULL;
+
+    /*Compare the text only if it might have changed since it was measured*/
+    if(!label->layout_txt_changed && _lv_txt_layout_reuse(&label->layout, font, letter_space, max_w, flag)) {
+        return &label->layout;
+    }
+
+    if(strlen(label->text) > LV_LABEL_LAYOUT_CACHE_MAX_LEN) {
+        _lv_txt_layout_free(&label->layout);
+        return NULL;
+    }
+
+    if(!_lv_txt_layout_update(&label->layout, label->text, font, letter_space, max_w, flag)) return NULL;
+
+    /*A static text can be modified by the application at any time so it's always compared*/
+    label->layout_txt_changed = label->static_txt;
+    return &label->layout;
+}
+#endif
+
 static void set_ofs_x_anim(void * obj, int32_t v)
 {
     lv_label_t * label = (lv_label_t *)obj;
@@ -31,6 +31,7 @@ extern "C" {
 #define LV_LABEL_DOT_NUM 3
 #define LV_LABEL_POS_LAST 0xFFFF
 #define LV_LABEL_TEXT_SELECTION_OFF LV_DRAW_LABEL_NO_TXT_SEL
+#define LV_LABEL_LAYOUT_CACHE_MAX_LEN 1024  /*Longer texts are not cached (but the hint still helps)*/
 
 LV_EXPORT_CONST_INT(LV_LABEL_DOT_NUM);
 LV_EXPORT_CONST_INT(LV_LABEL_POS_LAST);
@@ -63,6 +64,10 @@ typedef struct {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_t layout;     /*Line breaks and letter widths of the last measured text*/
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
@@ -74,6 +79,9 @@ typedef struct {
     uint8_t recolor : 1;                /*Enable in-line letter re-coloring*/
     uint8_t expand : 1;                 /*Ignore real width (used by the library with LV_LABEL_LONG_SCROLL)*/
     uint8_t dot_tmp_alloc : 1;         /*1: dot is allocated, 0: dot directly holds up to 4 chars*/
+#if LV_LABEL_LAYOUT_CACHE
+    uint8_t layout_txt_changed : 1;     /*The text might be different from the one measured in `layout`*/
+#endif
 } lv_label_t;
 
 extern const lv_obj_class_t lv_label_class;
@@ -46,6 +46,7 @@ static void set_y_anim(void * obj, int32_t v);
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_roller_class = {
+    .name = "roller",
     .constructor_cb = lv_roller_constructor,
     .event_cb = lv_roller_event,
     .width_def = LV_SIZE_CONTENT,
@@ -57,6 +58,7 @@ const lv_obj_class_t lv_roller_class = {
 };
 
 const lv_obj_class_t lv_roller_label_class  = {
+    .name = "roller_label",
     .event_cb = lv_roller_label_event,
     .instance_size = sizeof(lv_label_t),
     .base_class = &lv_label_class
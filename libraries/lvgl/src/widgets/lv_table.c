@@ -53,6 +53,7 @@ static inline bool is_cell_empty(void * cell)
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_table_class  = {
+    .name = "table",
     .constructor_cb = lv_table_constructor,
     .destructor_cb = lv_table_destructor,
     .event_cb = lv_table_event,
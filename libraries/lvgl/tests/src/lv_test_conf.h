@@ -32,6 +32,13 @@ void lv_test_assert_fail(void);
 uint32_t custom_tick_get(void);
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR custom_tick_get()
 
+/*A nanosecond counter behaves like a fast cycle counter: it wraps around in every 4.3 seconds*/
+uint32_t lv_test_profiler_tick_get(void);
+uint8_t lv_test_profiler_tid_get(void);
+#define LV_PROFILER_TICK_GET() lv_test_profiler_tick_get()
+#define LV_PROFILER_TICK_PER_SEC 1000000000
+#define LV_PROFILER_TID_GET() lv_test_profiler_tid_get()
+
 typedef void * lv_user_data_t;
 
 /**********************
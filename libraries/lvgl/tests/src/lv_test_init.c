@@ -3,6 +3,9 @@
 #include "lv_test_init.h"
 #include "lv_test_indev.h"
 #include <sys/time.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "../unity/unity.h"
@@ -92,6 +95,22 @@ uint32_t custom_tick_get(void)
     return time_ms;
 }
 
+uint32_t lv_test_profiler_tick_get(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+uint8_t lv_test_profiler_tid_get(void)
+{
+    /*The main thread is 0, the other threads get the next IDs when they record their first event*/
+    static __thread int tid = -1;
+    static int tid_next = 1;
+    if(tid < 0) tid = syscall(SYS_gettid) == getpid() ? 0 : __atomic_fetch_add(&tid_next, 1, __ATOMIC_RELAXED);
+    return (uint8_t)tid;
+}
+
 void lv_test_assert_fail(void)
 {
     TEST_FAIL();
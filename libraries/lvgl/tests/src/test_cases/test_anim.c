@@ -0,0 +1,311 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define VAR_CNT     300
+
+static int32_t vars[VAR_CNT];
+static uint32_t ready_cnt;
+static uint32_t deleted_cnt;
+static int32_t exec_order[4];
+static uint32_t exec_order_cnt;
+
+static void exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void set_x_cb(void * var, int32_t v)
+{
+    lv_obj_set_x(var, v);
+}
+
+static void set_y_cb(void * var, int32_t v)
+{
+    lv_obj_set_y(var, v);
+}
+
+static void order_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(v);
+    if(exec_order_cnt < 4) exec_order[exec_order_cnt++] = (int32_t)((int32_t *)var - vars);
+}
+
+static void ready_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    ready_cnt++;
+}
+
+static void deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    deleted_cnt++;
+}
+
+static void start_anim(int32_t * var, int32_t end, uint32_t time, lv_anim_path_cb_t path)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, end);
+    lv_anim_set_time(&a, time);
+    lv_anim_set_path_cb(&a, path);
+    lv_anim_set_ready_cb(&a, ready_cb);
+    lv_anim_set_deleted_cb(&a, deleted_cb);
+    lv_anim_start(&a);
+}
+
+/*Run the animations in 1 ms steps until all of them are ready*/
+static void run_all(void)
+{
+    uint32_t i;
+    for(i = 0; i < 1000 && lv_anim_count_running(); i++) {
+        lv_tick_inc(1);
+        lv_anim_refr_now();
+    }
+}
+
+/*Delete an other animation and start a new one when ready*/
+static void del_and_start_ready_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    ready_cnt++;
+    lv_anim_del(&vars[1], exec_cb);
+    start_anim(&vars[2], 30, 5, lv_anim_path_linear);
+}
+
+/*Delete itself when passed the half*/
+static void del_self_exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+    if(v >= 50) lv_anim_del(var, del_self_exec_cb);
+}
+
+void setUp(void)
+{
+    lv_memset_00(vars, sizeof(vars));
+    ready_cnt = 0;
+    deleted_cnt = 0;
+    exec_order_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_del(NULL, NULL);
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_anim_all_reach_end_value(void)
+{
+    lv_anim_path_cb_t paths[] = {lv_anim_path_linear, lv_anim_path_ease_in_out, lv_anim_path_overshoot,
+                                 lv_anim_path_bounce, lv_anim_path_step
+                                };
+
+    uint32_t i;
+    for(i = 0; i < VAR_CNT; i++) {
+        start_anim(&vars[i], 1000 + i, 5 + i % 20, paths[i % 5]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(VAR_CNT, lv_anim_count_running());
+
+    run_all();
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(VAR_CNT, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(VAR_CNT, deleted_cnt);
+    for(i = 0; i < VAR_CNT; i++) {
+        TEST_ASSERT_EQUAL_INT32(1000 + i, vars[i]);
+    }
+}
+
+void test_anim_get_and_del(void)
+{
+    start_anim(&vars[0], 100, 1000, lv_anim_path_linear);
+    start_anim(&vars[1], 100, 1000, lv_anim_path_linear);
+    start_anim(&vars[2], 100, 1000, lv_anim_path_linear);
+
+    lv_anim_t * a = lv_anim_get(&vars[1], exec_cb);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_EQUAL_PTR(&vars[1], a->var);
+
+    /*Starting an animation with the same var and exec_cb replaces the old one*/
+    start_anim(&vars[1], 200, 1000, lv_anim_path_linear);
+    TEST_ASSERT_EQUAL_UINT16(3, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(1, deleted_cnt);
+    TEST_ASSERT_EQUAL_INT32(200, lv_anim_get(&vars[1], exec_cb)->end_value);
+
+    TEST_ASSERT_TRUE(lv_anim_del(&vars[0], NULL));
+    TEST_ASSERT_FALSE(lv_anim_del(&vars[0], NULL));
+    TEST_ASSERT_NULL(lv_anim_get(&vars[0], NULL));
+    TEST_ASSERT_EQUAL_UINT16(2, lv_anim_count_running());
+
+    lv_anim_del_all();
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&vars[2], NULL));
+}
+
+void test_anim_del_and_start_in_callbacks(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &vars[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 10);
+    lv_anim_set_time(&a, 5);
+    lv_anim_set_ready_cb(&a, del_and_start_ready_cb);
+    lv_anim_start(&a);
+
+    start_anim(&vars[1], 20, 10000, lv_anim_path_linear);
+
+    lv_anim_set_var(&a, &vars[3]);
+    lv_anim_set_exec_cb(&a, del_self_exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 20);
+    lv_anim_set_ready_cb(&a, ready_cb);
+    lv_anim_start(&a);
+
+    run_all();
+
+    TEST_ASSERT_EQUAL_INT32(10, vars[0]);
+    TEST_ASSERT_NOT_EQUAL(20, vars[1]);     /*Deleted before ready*/
+    TEST_ASSERT_EQUAL_INT32(30, vars[2]);   /*Started in the ready_cb*/
+    TEST_ASSERT_GREATER_OR_EQUAL(50, vars[3]);
+    TEST_ASSERT_EQUAL_UINT32(1 + 1, ready_cnt); /*vars[0] and vars[2], vars[3] was deleted in the exec_cb*/
+    TEST_ASSERT_EQUAL_UINT32(2, deleted_cnt);   /*vars[1] and vars[2]*/
+}
+
+void test_anim_repeat_and_playback(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &vars[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 10, 90);
+    lv_anim_set_time(&a, 5);
+    lv_anim_set_playback_time(&a, 5);
+    lv_anim_set_repeat_count(&a, 3);
+    lv_anim_set_ready_cb(&a, ready_cb);
+    lv_anim_start(&a);
+
+    run_all();
+    TEST_ASSERT_EQUAL_INT32(10, vars[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+}
+
+void test_anim_newest_first(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, order_exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 1000);
+    lv_anim_set_early_apply(&a, false);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_start(&a);
+    }
+
+    /*Wait for the first step with a changed value*/
+    for(i = 0; i < 1000 && exec_order_cnt == 0; i++) {
+        lv_tick_inc(1);
+        lv_anim_refr_now();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(4, exec_order_cnt);
+    TEST_ASSERT_EQUAL_INT32(3, exec_order[0]);
+    TEST_ASSERT_EQUAL_INT32(2, exec_order[1]);
+    TEST_ASSERT_EQUAL_INT32(1, exec_order[2]);
+    TEST_ASSERT_EQUAL_INT32(0, exec_order[3]);
+}
+
+void test_anim_moving_object_invalidates_one_area(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 100, 50);
+    lv_refr_now(NULL);
+
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_UINT16(0, disp->inv_p);
+
+    /*The old and the new position overlap*/
+    lv_obj_set_x(obj, 10);
+    lv_obj_update_layout(obj);
+    lv_obj_set_y(obj, 5);
+    lv_obj_update_layout(obj);
+    TEST_ASSERT_EQUAL_UINT16(1, disp->inv_p);
+    TEST_ASSERT_EQUAL_INT32(0, disp->inv_areas[0].x1);
+    TEST_ASSERT_EQUAL_INT32(0, disp->inv_areas[0].y1);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&obj->coords, &disp->inv_areas[0], 0));
+
+    /*Far away, a new area*/
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj2, 10, 10);
+    lv_obj_set_pos(obj2, 300, 300);
+    lv_obj_update_layout(obj2);
+    TEST_ASSERT_EQUAL_UINT16(2, disp->inv_p);
+}
+
+/*Not a check, prints the time of the two-pass animation steps with many concurrent animations*/
+void test_anim_two_pass_benchmark(void)
+{
+    const uint32_t obj_cnt = 200;
+    const uint32_t rep = 100;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 100000);
+    lv_anim_set_time(&a, 100000);
+    uint32_t i;
+    for(i = 0; i < VAR_CNT; i++) {
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_path_cb(&a, i % 2 ? lv_anim_path_linear : lv_anim_path_ease_in_out);
+        lv_anim_start(&a);
+    }
+
+    clock_t t0 = clock();
+    for(i = 0; i < rep * 10; i++) {
+        lv_tick_inc(1);
+        lv_anim_refr_now();
+    }
+    double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("anim: %" LV_PRIu32 " steps of %d variable animations in %.3f s\n", rep * 10, VAR_CNT, t);
+    lv_anim_del(NULL, NULL);
+
+    /*Objects moving back and forth on x and y*/
+    lv_anim_set_time(&a, 200);
+    lv_anim_set_playback_time(&a, 200);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    for(i = 0; i < obj_cnt; i++) {
+        lv_coord_t x = (i * 37) % 760;
+        lv_coord_t y = (i * 53) % 440;
+        lv_obj_t * obj = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(obj, 30, 30);
+        lv_obj_set_pos(obj, x, y);
+        lv_anim_set_var(&a, obj);
+        lv_anim_set_values(&a, x, x + 20);
+        lv_anim_set_exec_cb(&a, set_x_cb);
+        lv_anim_start(&a);
+        lv_anim_set_values(&a, y, y + 20);
+        lv_anim_set_exec_cb(&a, set_y_cb);
+        lv_anim_start(&a);
+    }
+    lv_refr_now(NULL);
+
+    t0 = clock();
+    for(i = 0; i < rep; i++) {
+        lv_tick_inc(10);
+        lv_anim_refr_now();
+        lv_obj_update_layout(lv_scr_act());
+    }
+    t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("anim: %" LV_PRIu32 " steps of %" LV_PRIu32 " animations moving objects in %.3f s\n", rep, obj_cnt * 2, t);
+}
+
+#endif
@@ -0,0 +1,320 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*Created with
+ *scripts/lv_assets_pack.py -o tests/src/test_files/assets.bin --color-depth 32 --large-glyphs
+ *    src/font/lv_font_montserrat_14.c montserrat_28_compr=src/font/lv_font_montserrat_28_compressed.c
+ *    wink=examples/libs/png/wink.png wink_rle=tests/src/test_files/wink.rle*/
+#define ASSETS_PATH     "src/test_files/assets.bin"
+
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+static lv_assets_t assets;
+
+#if LV_USE_PNG
+    LV_IMG_DECLARE(img_wink_png)
+#endif
+
+static bool in_bundle(const void * p)
+{
+    return (const uint8_t *)p >= assets.data && (const uint8_t *)p < assets.data + assets.size;
+}
+
+/*Compare the glyphs of two fonts. The bitmaps are copied because compressed fonts share a buffer.*/
+static void compare_fonts(const lv_font_t * font, const lv_font_t * ref)
+{
+    static const uint32_t next[] = {'A', 'V', 'T', 'y', '.', 0};
+    uint32_t letter;
+    for(letter = 0x20; letter < 0x17F; letter++) {
+        uint32_t i;
+        for(i = 0; i < sizeof(next) / sizeof(next[0]); i++) {
+            lv_font_glyph_dsc_t g;
+            lv_font_glyph_dsc_t g_ref;
+            bool found = lv_font_get_glyph_dsc(font, &g, letter, next[i]);
+            TEST_ASSERT_EQUAL(lv_font_get_glyph_dsc(ref, &g_ref, letter, next[i]), found);
+            if(!found) break;
+            TEST_ASSERT_EQUAL(g_ref.adv_w, g.adv_w);
+            TEST_ASSERT_EQUAL(g_ref.box_w, g.box_w);
+            TEST_ASSERT_EQUAL(g_ref.box_h, g.box_h);
+            TEST_ASSERT_EQUAL(g_ref.ofs_x, g.ofs_x);
+            TEST_ASSERT_EQUAL(g_ref.ofs_y, g.ofs_y);
+            TEST_ASSERT_EQUAL(g_ref.bpp, g.bpp);
+        }
+        if(i == 0) continue;
+
+        lv_font_glyph_dsc_t g;
+        lv_font_get_glyph_dsc(ref, &g, letter, 0);
+        uint32_t size = (g.box_w * g.box_h * g.bpp + 7) / 8;
+        if(size == 0) continue;
+
+        uint8_t * bmp_ref = malloc(size);
+        memcpy(bmp_ref, lv_font_get_glyph_bitmap(ref, letter), size);
+        TEST_ASSERT_EQUAL_MEMORY(bmp_ref, lv_font_get_glyph_bitmap(font, letter), size);
+        free(bmp_ref);
+    }
+
+    TEST_ASSERT_EQUAL(ref->line_height, font->line_height);
+    TEST_ASSERT_EQUAL(ref->base_line, font->base_line);
+    TEST_ASSERT_EQUAL(ref->underline_position, font->underline_position);
+    TEST_ASSERT_EQUAL(ref->underline_thickness, font->underline_thickness);
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_map_file(&assets, ASSETS_PATH));
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    lv_assets_unmap_file(&assets);
+#endif
+}
+
+void test_assets_get(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+    TEST_ASSERT_EQUAL_UINT32(4, assets.entry_cnt);
+    TEST_ASSERT_EQUAL(32, assets.color_depth);
+
+    static const char * names[] = {"lv_font_montserrat_14", "montserrat_28_compr", "wink", "wink_rle"};
+    static const lv_assets_type_t types[] = {
+        LV_ASSETS_TYPE_FONT, LV_ASSETS_TYPE_FONT, LV_ASSETS_TYPE_IMG, LV_ASSETS_TYPE_IMG
+    };
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_assets_type_t type;
+        uint32_t size = 0;
+        const uint8_t * data = lv_assets_get(&assets, names[i], &type, &size);
+        TEST_ASSERT_TRUE(in_bundle(data));
+        TEST_ASSERT_TRUE(in_bundle(data + size - 1));
+        TEST_ASSERT_EQUAL(types[i], type);
+        TEST_ASSERT_EQUAL(0, (lv_uintptr_t)data & 0x3);
+    }
+
+    TEST_ASSERT_NULL(lv_assets_get(&assets, "", NULL, NULL));
+    TEST_ASSERT_NULL(lv_assets_get(&assets, "wink_", NULL, NULL));
+    TEST_ASSERT_NULL(lv_assets_get(&assets, "a", NULL, NULL));
+    TEST_ASSERT_NULL(lv_assets_get(&assets, "zzz", NULL, NULL));
+
+    /*Wrong types*/
+    lv_img_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_get_img(&assets, "lv_font_montserrat_14", &dsc));
+    TEST_ASSERT_NULL(lv_assets_load_font(&assets, "wink"));
+#endif
+}
+
+void test_assets_invalid(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+    uint32_t size = assets.size;
+    uint32_t * data = malloc(size);
+    memcpy(data, assets.data, size);
+
+    lv_assets_t a;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_init(&a, data, size));
+
+    /*Shorter than the bundle*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_init(&a, data, size - 1));
+    TEST_ASSERT_NULL(lv_assets_get(&a, "wink", NULL, NULL));
+
+    /*Not aligned*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_init(&a, (uint8_t *)data + 2, size - 2));
+
+    /*The size of the first entry is too large. The entries are 8 words after the 4 words header.*/
+    uint32_t entry_size = data[4 + 7];
+    data[4 + 7] = size;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_init(&a, data, size));
+    data[4 + 7] = entry_size;
+
+    /*The font's cmap table points out of the font*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_init(&a, data, size));
+    uint8_t * font = (uint8_t *)lv_assets_get(&a, "lv_font_montserrat_14", NULL, NULL);
+    font[28 + 3] = 0x10;
+    TEST_ASSERT_NULL(lv_assets_load_font(&a, "lv_font_montserrat_14"));
+
+    /*So many entries that their size would overflow*/
+    uint32_t entry_cnt = data[2];
+    data[2] = 0x08000001;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_init(&a, data, size));
+    data[2] = entry_cnt;
+
+    /*Bad magic*/
+    data[0] = 0;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_init(&a, data, size));
+
+    free(data);
+#endif
+}
+
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP && LV_FONT_FMT_TXT_LARGE
+/*Change a 32 bit value of a copy of the font and check that the font is refused*/
+static void check_font_invalid(const char * name, uint32_t ofs, uint32_t value)
+{
+    uint32_t size = assets.size;
+    uint32_t * data = malloc(size);
+    memcpy(data, assets.data, size);
+
+    lv_assets_t a;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_init(&a, data, size));
+    uint8_t * font = (uint8_t *)lv_assets_get(&a, name, NULL, NULL);
+    memcpy(font + ofs, &value, sizeof(value));
+    TEST_ASSERT_NULL(lv_assets_load_font(&a, name));
+
+    free(data);
+}
+
+static uint32_t font_u32(const char * name, uint32_t ofs)
+{
+    const uint8_t * font = lv_assets_get(&assets, name, NULL, NULL);
+    uint32_t v;
+    memcpy(&v, font + ofs, sizeof(v));
+    return v;
+}
+#endif
+
+void test_assets_font_invalid(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP && LV_FONT_FMT_TXT_LARGE
+    /*The offsets of the font header and the records. See `font_header_t` and the others in lv_assets.c.*/
+    const char * name = "lv_font_montserrat_14";
+    uint32_t glyph_cnt = font_u32(name, 12) >> 16;
+    uint32_t bitmap_size = font_u32(name, 36);
+    uint32_t glyph_dsc_ofs = font_u32(name, 24);
+    uint32_t cmaps_ofs = font_u32(name, 28);
+    uint32_t kern_ofs = font_u32(name, 32);
+
+    /*The unmodified copy is fine*/
+    lv_font_t * font = lv_assets_load_font(&assets, name);
+    TEST_ASSERT_NOT_NULL(font);
+    lv_assets_free_font(font);
+
+    /*The bitmap table is longer than the font*/
+    check_font_invalid(name, 36, 0x10000000);
+
+    /*The bitmap of the last glyph is out of the bitmap table*/
+    check_font_invalid(name, glyph_dsc_ofs + (glyph_cnt - 1) * 16, bitmap_size);
+
+    /*The glyph ids of the first cmap (range_length, glyph_id_start) are above the glyph count*/
+    check_font_invalid(name, cmaps_ofs + 4, (glyph_cnt << 16) | 1);
+
+    /*The left kerning classes are more than the class pair matrix has (left_class_cnt = 1)*/
+    check_font_invalid(name, kern_ofs + 12, 1);
+
+    /*The other fonts are not affected*/
+    font = lv_assets_load_font(&assets, "montserrat_28_compr");
+    TEST_ASSERT_NOT_NULL(font);
+    lv_assets_free_font(font);
+#endif
+}
+
+void test_assets_font_same_as_builtin(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP
+    lv_font_t * font = lv_assets_load_font(&assets, "lv_font_montserrat_14");
+#if LV_FONT_FMT_TXT_LARGE
+    TEST_ASSERT_NOT_NULL(font);
+    compare_fonts(font, &lv_font_montserrat_14);
+
+    /*The tables are used in place*/
+    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+    TEST_ASSERT_TRUE(in_bundle(dsc->glyph_bitmap));
+    TEST_ASSERT_TRUE(in_bundle(dsc->glyph_dsc));
+    TEST_ASSERT_TRUE(in_bundle(dsc->cmaps[1].unicode_list));
+    TEST_ASSERT_TRUE(in_bundle(lv_font_get_glyph_bitmap(font, 'A')));
+
+    /*The lookup tables work the same way*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_build_lut(font, 0x100));
+    compare_fonts(font, &lv_font_montserrat_14);
+
+    /*The same width with kerning*/
+    const char * txt = "AVATAR Type. Wave";
+    lv_point_t size;
+    lv_point_t size_ref;
+    lv_txt_get_size(&size, txt, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    lv_txt_get_size(&size_ref, txt, &lv_font_montserrat_14, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL(size_ref.x, size.x);
+    TEST_ASSERT_EQUAL(size_ref.y, size.y);
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, txt);
+    lv_refr_now(NULL);
+    lv_obj_del(label);
+
+    lv_assets_free_font(font);
+#else
+    /*The glyph descriptors are stored for LV_FONT_FMT_TXT_LARGE 1*/
+    TEST_ASSERT_NULL(font);
+#endif
+#endif
+}
+
+void test_assets_font_compressed(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP && LV_FONT_FMT_TXT_LARGE && LV_USE_FONT_COMPRESSED && LV_FONT_MONTSERRAT_28_COMPRESSED
+    lv_font_t * font = lv_assets_load_font(&assets, "montserrat_28_compr");
+    TEST_ASSERT_NOT_NULL(font);
+    compare_fonts(font, &lv_font_montserrat_28_compressed);
+    lv_assets_free_font(font);
+#endif
+}
+
+void test_assets_img(void)
+{
+#if LV_USE_ASSETS && LV_ASSETS_POSIX_MMAP && LV_USE_PNG && LV_COLOR_DEPTH == 32
+    lv_img_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_get_img(&assets, "wink", &dsc));
+    TEST_ASSERT_EQUAL(50, dsc.header.w);
+    TEST_ASSERT_EQUAL(50, dsc.header.h);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR_ALPHA, dsc.header.cf);
+    TEST_ASSERT_EQUAL_UINT32(50 * 50 * LV_IMG_PX_SIZE_ALPHA_BYTE, dsc.data_size);
+
+    /*The decoder uses the pixels from the bundle*/
+    lv_img_decoder_dsc_t dec;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dec, &dsc, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL_PTR(dsc.data, dec.img_data);
+    TEST_ASSERT_TRUE(in_bundle(dec.img_data));
+    lv_img_decoder_close(&dec);
+
+    lv_img_decoder_dsc_t png;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&png, &img_wink_png, lv_color_black(), 0));
+    const lv_color32_t * png_px = (const lv_color32_t *)png.img_data;
+    const lv_color32_t * px = (const lv_color32_t *)dsc.data;
+    uint32_t i;
+    for(i = 0; i < 50 * 50; i++) {
+        TEST_ASSERT_EQUAL_UINT8(png_px[i].ch.alpha, px[i].ch.alpha);
+        if(png_px[i].ch.alpha == 0) continue;
+        TEST_ASSERT_EQUAL_UINT32(png_px[i].full, px[i].full);
+    }
+    lv_img_decoder_close(&png);
+
+#if LV_USE_RLE_IMG
+    lv_img_dsc_t rle;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_assets_get_img(&assets, "wink_rle", &rle));
+    TEST_ASSERT_EQUAL(LV_IMG_CF_RAW_ALPHA, rle.header.cf);
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&rle, &header));
+    TEST_ASSERT_EQUAL(50, header.w);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR_ALPHA, header.cf);
+#endif
+
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &dsc);
+    lv_refr_now(NULL);
+
+    /*The true color images of a bundle for an other color format are refused*/
+    assets.color_depth = 16;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_assets_get_img(&assets, "wink", &dsc));
+#endif
+}
+
+#endif
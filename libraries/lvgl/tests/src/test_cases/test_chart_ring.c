@@ -0,0 +1,220 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+extern lv_color_t test_fb[];
+
+static lv_obj_t * chart;
+static lv_chart_series_t * ser;
+static lv_chart_ring_t * ring;
+static uint32_t rnd_state = 1;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) & 0x7fff;
+}
+
+/*A 100x100 px chart on the top left corner without padding, border and background*/
+static void create_chart(uint32_t cap)
+{
+    chart = lv_chart_create(lv_scr_act());
+    lv_obj_remove_style_all(chart);
+    lv_obj_set_size(chart, 100, 100);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_ITEMS);
+    lv_obj_set_style_line_opa(chart, LV_OPA_COVER, LV_PART_ITEMS);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+    ser = lv_chart_add_series(chart, lv_color_hex(0xff0000), LV_CHART_AXIS_PRIMARY_Y);
+
+    ring = lv_chart_ring_create(cap);
+    TEST_ASSERT_NOT_NULL(ring);
+    lv_chart_set_series_ring(chart, ser, ring);
+}
+
+/*The test display copies only full screen refreshes to `test_fb`*/
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static bool is_red(lv_coord_t x, lv_coord_t y)
+{
+    return lv_color_to32(test_fb[y * 800 + x]) == lv_color_to32(lv_color_hex(0xff0000));
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_chart_ring_del(ring);
+    ring = NULL;
+}
+
+
+void test_chart_ring_min_max_same_as_scan(void)
+{
+    lv_chart_ring_t * r = lv_chart_ring_create(1000);
+    lv_coord_t * ref = lv_mem_alloc(3500 * sizeof(lv_coord_t));
+    TEST_ASSERT_NOT_NULL(ref);
+
+    uint32_t i;
+    for(i = 0; i < 3500; i++) {
+        ref[i] = rnd() % 64 == 0 ? LV_CHART_POINT_NONE : (lv_coord_t)(rnd() % 2000) - 1000;
+        lv_chart_ring_push(r, ref[i]);
+
+        /*Random ranges of the kept samples, sometimes reaching out of the ring*/
+        uint32_t k;
+        for(k = 0; k < 4; k++) {
+            uint32_t total = lv_chart_ring_get_total(r);
+            uint32_t first = total > 1100 ? total - 1100 + rnd() % 1100 : rnd() % (total + 10);
+            uint32_t end = first + rnd() % 1100;
+
+            bool found_ref = false;
+            lv_coord_t min_ref = 0;
+            lv_coord_t max_ref = 0;
+            uint32_t id;
+            for(id = LV_MAX(first, lv_chart_ring_get_first(r)); id < LV_MIN(end, total); id++) {
+                if(ref[id] == LV_CHART_POINT_NONE) continue;
+                if(!found_ref || ref[id] < min_ref) min_ref = ref[id];
+                if(!found_ref || ref[id] > max_ref) max_ref = ref[id];
+                found_ref = true;
+            }
+
+            lv_coord_t min;
+            lv_coord_t max;
+            TEST_ASSERT_EQUAL(found_ref, lv_chart_ring_get_min_max(r, first, end, &min, &max));
+            if(found_ref) {
+                TEST_ASSERT_EQUAL_INT32(min_ref, min);
+                TEST_ASSERT_EQUAL_INT32(max_ref, max);
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2500, lv_chart_ring_get_first(r));
+    TEST_ASSERT_EQUAL_INT32(ref[2500], lv_chart_ring_get_value(r, 2500));
+    TEST_ASSERT_EQUAL_INT32(LV_CHART_POINT_NONE, lv_chart_ring_get_value(r, 2499));
+    TEST_ASSERT_EQUAL_INT32(LV_CHART_POINT_NONE, lv_chart_ring_get_value(r, 3500));
+
+    lv_chart_ring_clear(r);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_chart_ring_get_total(r));
+
+    lv_mem_free(ref);
+    lv_chart_ring_del(r);
+}
+
+void test_chart_ring_draw_newest_on_right(void)
+{
+    create_chart(1000);
+
+    /*Half of the ring is filled so only the right half of the chart is drawn*/
+    uint32_t i;
+    for(i = 0; i < 500; i++) lv_chart_set_next_value(chart, ser, 50);
+    render();
+
+    lv_coord_t x;
+    for(x = 0; x < 100; x++) {
+        bool drawn = is_red(x, 49) || is_red(x, 50) || is_red(x, 51);
+        if(x < 49) TEST_ASSERT_FALSE(drawn);
+        else if(x > 50) TEST_ASSERT_TRUE(drawn);
+        TEST_ASSERT_FALSE(is_red(x, 20));
+    }
+
+    /*A spike in the newest sample makes the last column span to the top*/
+    lv_chart_set_next_value(chart, ser, 100);
+    render();
+    TEST_ASSERT_TRUE(is_red(99, 5));
+    TEST_ASSERT_FALSE(is_red(97, 5));
+
+    /*Less samples than pixels: the samples are connected with lines*/
+    lv_chart_set_ring_view_count(chart, 11);
+    render();
+    TEST_ASSERT_TRUE(is_red(0, 50) || is_red(0, 49));
+    TEST_ASSERT_TRUE(is_red(45, 50) || is_red(45, 49));
+    TEST_ASSERT_FALSE(is_red(45, 20));
+}
+
+void test_chart_ring_push_invalidates_newest_column(void)
+{
+    create_chart(1000);
+    lv_disp_t * disp = lv_disp_get_default();
+
+    uint32_t i;
+    for(i = 0; i < 1500; i++) lv_chart_ring_push(ring, (lv_coord_t)(rnd() % 100));
+    lv_chart_refresh(chart);
+    lv_refr_now(NULL);
+
+    /*10 samples/column and the newest column has 0 samples: the columns are shifted*/
+    lv_chart_set_next_value(chart, ser, 30);
+    TEST_ASSERT_EQUAL_UINT16(1, disp->inv_p);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(100, lv_area_get_width(&disp->inv_areas[0]));
+    lv_refr_now(NULL);
+
+    /*The new sample falls into the newest column: only it and the leftmost column (dropped sample) change.
+     *The strips are 3 px wide but `lv_obj_invalidate_area()` adds 5 px on each side*/
+    lv_chart_set_next_value(chart, ser, 70);
+    TEST_ASSERT_EQUAL_UINT16(2, disp->inv_p);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(13, lv_area_get_width(&disp->inv_areas[0]));
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(92, disp->inv_areas[0].x1);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(13, lv_area_get_width(&disp->inv_areas[1]));
+    TEST_ASSERT_EQUAL_INT32(0, disp->inv_areas[1].x1);
+    lv_refr_now(NULL);
+}
+
+/*Not a check, prints the time of drawing and appending to a 100k sample ring and to a plain series*/
+void test_chart_ring_benchmark(void)
+{
+    const uint32_t cnt = 100000;
+    const uint32_t rep = 50;
+    uint32_t i;
+
+    create_chart(cnt);
+    lv_obj_set_size(chart, 400, 200);
+    for(i = 0; i < cnt; i++) lv_chart_ring_push(ring, (lv_coord_t)(rnd() % 100));
+    lv_chart_refresh(chart);
+    lv_refr_now(NULL);
+
+    clock_t t0 = clock();
+    for(i = 0; i < rep; i++) {
+        lv_chart_refresh(chart);
+        lv_refr_now(NULL);
+    }
+    double t_draw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    uint32_t area_sum = 0;
+    t0 = clock();
+    for(i = 0; i < rep * 10; i++) {
+        lv_chart_set_next_value(chart, ser, (lv_coord_t)(rnd() % 100));
+        lv_disp_t * disp = lv_disp_get_default();
+        uint16_t a;
+        for(a = 0; a < disp->inv_p; a++) area_sum += lv_area_get_size(&disp->inv_areas[a]);
+        lv_refr_now(NULL);
+    }
+    double t_push = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("chart ring %" LV_PRIu32 " samples: %" LV_PRIu32 " full redraws in %.3f s, %" LV_PRIu32
+           " append+refresh in %.3f s, %" LV_PRIu32 " px invalidated/append\n", cnt, rep, t_draw, rep * 10, t_push,
+           area_sum / (rep * 10));
+
+    /*The largest plain series for comparison*/
+    lv_chart_set_series_ring(chart, ser, NULL);
+    lv_chart_set_point_count(chart, UINT16_MAX);
+    for(i = 0; i < UINT16_MAX; i++) lv_chart_set_next_value(chart, ser, (lv_coord_t)(rnd() % 100));
+
+    t0 = clock();
+    for(i = 0; i < rep; i++) {
+        lv_chart_refresh(chart);
+        lv_refr_now(NULL);
+    }
+    t_draw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("chart plain series %d points: %" LV_PRIu32 " full redraws in %.3f s\n", UINT16_MAX, rep, t_draw);
+}
+
+#endif
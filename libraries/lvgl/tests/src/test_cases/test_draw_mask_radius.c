@@ -0,0 +1,284 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LINE_LEN    300
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+#if LV_DRAW_COMPLEX
+static lv_opa_t ref_mix(lv_opa_t mask_act, lv_opa_t mask_new)
+{
+    if(mask_new >= LV_OPA_MAX) return mask_act;
+    if(mask_new <= LV_OPA_MIN) return 0;
+    return LV_UDIV255(mask_act * mask_new);
+}
+
+/*The radius mask pixel by pixel, the way it was calculated before the spans*/
+static void ref_radius(lv_opa_t * buf, lv_coord_t abs_x, lv_coord_t abs_y, lv_coord_t len,
+                       const lv_draw_mask_radius_param_t * p)
+{
+    const lv_area_t * rect = &p->cfg.rect;
+    lv_coord_t radius = p->cfg.radius;
+    bool outer = p->cfg.outer;
+    lv_coord_t i;
+
+    for(i = 0; i < len; i++) {
+        lv_coord_t x = abs_x + i;
+        bool in_rect = x >= rect->x1 && x <= rect->x2 && abs_y >= rect->y1 && abs_y <= rect->y2;
+        bool corner_row = abs_y < rect->y1 + radius || abs_y > rect->y2 - radius;
+        if(abs_y < rect->y1 || abs_y > rect->y2 || !corner_row) {
+            if(in_rect == outer) buf[i] = 0;
+            continue;
+        }
+
+        /*On the rows of the corners the AA part can be out of the rectangle by a pixel*/
+        bool corner_col = x < rect->x1 + radius || x > rect->x2 - radius;
+        if(!corner_col) {
+            if(outer) buf[i] = 0;
+            continue;
+        }
+
+        const _lv_draw_mask_radius_circle_dsc_t * c = p->circle;
+        lv_coord_t h = lv_area_get_height(rect);
+        lv_coord_t w = lv_area_get_width(rect);
+        lv_coord_t y = abs_y - rect->y1;
+        lv_coord_t cir_y = y < radius ? radius - y - 1 : y - (h - radius);
+        lv_coord_t aa_len = c->opa_start_on_y[cir_y + 1] - c->opa_start_on_y[cir_y];
+        const lv_opa_t * aa_opa = &c->cir_opa[c->opa_start_on_y[cir_y]];
+        lv_coord_t x_start = c->x_start_on_y[cir_y];
+
+        /*Distance from the start of the AA part towards the outside*/
+        lv_coord_t rx = x - rect->x1;
+        lv_coord_t d = rx < radius ? (radius - x_start - 1) - rx : rx - (w - radius + x_start);
+
+        /*Inside the AA part the pixels are kept or cleared, outside of it cleared or kept*/
+        if(d < 0) {
+            if(outer) buf[i] = 0;
+        }
+        else if(d >= aa_len) {
+            if(!outer) buf[i] = 0;
+        }
+        else {
+            lv_opa_t opa = aa_opa[aa_len - d - 1];
+            buf[i] = ref_mix(outer ? 255 - opa : opa, buf[i]);
+        }
+    }
+}
+
+static void check_radius(const lv_area_t * rect, lv_coord_t radius, bool inv)
+{
+    lv_draw_mask_radius_param_t p;
+    lv_draw_mask_radius_init(&p, rect, radius, inv);
+
+    static lv_opa_t buf[LINE_LEN];
+    static lv_opa_t ref[LINE_LEN];
+
+    /*Full lines, lines clipped on the left/right and lines starting on an already masked buffer*/
+    const lv_coord_t starts[] = {0, rect->x1 + 3, rect->x2 - 4, rect->x1 - 2};
+    const lv_coord_t lens[] = {LINE_LEN, 40, 60, 7};
+    uint32_t s;
+    lv_coord_t y;
+    for(s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+        for(y = rect->y1 - 1; y <= rect->y2 + 1; y++) {
+            lv_coord_t i;
+            for(i = 0; i < lens[s]; i++) {
+                buf[i] = s == 3 ? (lv_opa_t)rand() : LV_OPA_COVER;
+                ref[i] = buf[i];
+            }
+
+            lv_draw_mask_res_t res = p.dsc.cb(buf, starts[s], y, lens[s], &p);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(buf, lens[s]);
+            ref_radius(ref, starts[s], y, lens[s], &p);
+            TEST_ASSERT_EQUAL_MEMORY(ref, buf, lens[s]);
+        }
+    }
+
+    lv_draw_mask_free_param(&p);
+}
+#endif
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_draw_mask_radius_same_as_per_pixel(void)
+{
+#if LV_DRAW_COMPLEX
+    const lv_coord_t radii[] = {1, 2, 5, 15, 55, 75, LV_RADIUS_CIRCLE};
+    uint32_t i;
+    for(i = 0; i < sizeof(radii) / sizeof(radii[0]); i++) {
+        lv_area_t circle = {20, 10, 20 + 149, 10 + 149};
+        check_radius(&circle, radii[i], false);
+        check_radius(&circle, radii[i], true);
+
+        lv_area_t bar = {5, 3, 5 + 109, 3 + 349};
+        check_radius(&bar, radii[i], false);
+        check_radius(&bar, radii[i], true);
+
+        lv_area_t btn = {100, 40, 100 + 119, 40 + 49};
+        check_radius(&btn, radii[i], false);
+        check_radius(&btn, radii[i], true);
+    }
+#endif
+}
+
+void test_draw_mask_radius_circle_cache(void)
+{
+#if LV_DRAW_COMPLEX && LV_CIRCLE_CACHE_SIZE >= 2
+    lv_draw_mask_circle_cache_stat_t stat;
+
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj1, 150, 150);
+    lv_obj_set_style_radius(obj1, 75, 0);
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(obj2, 150, 150);
+    lv_obj_set_pos(obj2, 200, 0);
+    lv_obj_set_style_radius(obj2, 75, 0);
+
+    _lv_draw_mask_cleanup();
+    lv_draw_mask_circle_cache_reset_stat();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_draw_mask_circle_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.miss);
+    TEST_ASSERT_GREATER_THAN(0, stat.hit);
+    TEST_ASSERT_GREATER_THAN(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.evict);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(75 * 12, stat.size);
+
+    /*The circles are kept between the refreshes*/
+    uint32_t miss_first = stat.miss;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_draw_mask_circle_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(miss_first, stat.miss);
+
+    _lv_draw_mask_cleanup();
+    lv_draw_mask_circle_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+#endif
+}
+
+void test_draw_mask_radius_corner_spans_same_as_masked(void)
+{
+#if LV_DRAW_COMPLEX
+    const lv_coord_t radii[] = {3, 15, 55, LV_RADIUS_CIRCLE};
+    const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_50};
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_scr_act());
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 150 - i * 7, 110 + i * 5);
+        lv_obj_set_pos(obj, (i % 4) * 190 + 7, (i / 4) * 200 - 30);
+        lv_obj_set_style_radius(obj, radii[i % 4], 0);
+        lv_obj_set_style_bg_opa(obj, opas[i / 4], 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED + i), 0);
+        if(i == 5) {
+            lv_obj_set_style_bg_grad_color(obj, lv_color_white(), 0);
+            lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+        }
+    }
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    static lv_color_t ref_fb[FB_SIZE];
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*An other mask which doesn't hide anything makes the rectangles apply the masks on whole lines*/
+    lv_draw_mask_radius_param_t p;
+    lv_area_t a = {-1000, -1000, 2000, 2000};
+    lv_draw_mask_radius_init(&p, &a, 0, false);
+    int16_t id = lv_draw_mask_add(&p, NULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_draw_mask_remove_id(id);
+    lv_draw_mask_free_param(&p);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+#endif
+}
+
+/*Not a check, prints the time to redraw the circle, the bar, the buttons and the popup of the main screen*/
+void test_draw_mask_radius_benchmark(void)
+{
+#if LV_DRAW_COMPLEX
+    lv_obj_t * bar = lv_bar_create(lv_scr_act());
+    lv_obj_set_size(bar, 110, 350);
+    lv_obj_set_pos(bar, 40, 40);
+    lv_obj_set_style_radius(bar, 55, LV_PART_MAIN);
+    lv_obj_set_style_clip_corner(bar, true, LV_PART_MAIN);
+    lv_obj_set_style_radius(bar, 0, LV_PART_INDICATOR);
+    lv_bar_set_value(bar, 60, LV_ANIM_OFF);
+
+    lv_obj_t * circle = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(circle, 150, 150);
+    lv_obj_set_pos(circle, 20, 320);
+    lv_obj_set_style_radius(circle, 75, 0);
+    lv_obj_set_style_border_width(circle, 0, 0);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * btn = lv_btn_create(lv_scr_act());
+        lv_obj_set_size(btn, 120, 50);
+        lv_obj_set_pos(btn, 200, 40 + i * 80);
+    }
+
+    lv_obj_t * popup = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(popup, 250, 120);
+    lv_obj_set_pos(popup, 400, 100);
+    lv_obj_set_style_radius(popup, 15, 0);
+
+    const uint32_t rep = 200;
+    const char * names[] = {"recalculated per frame", "kept in the cache"};
+    uint32_t m;
+    for(m = 0; m < 2; m++) {
+        _lv_draw_mask_cleanup();
+        clock_t t0 = clock();
+        for(i = 0; i < rep; i++) {
+            /*Emulate the former behavior: the cache was cleaned after each refresh*/
+            if(m == 0) _lv_draw_mask_cleanup();
+            uint32_t c;
+            for(c = 0; c < lv_obj_get_child_cnt(lv_scr_act()); c++) {
+                lv_obj_invalidate(lv_obj_get_child(lv_scr_act(), c));
+            }
+            lv_refr_now(NULL);
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("Radius masks, %-24s: %.1f us per redraw of the widgets\n", names[m], t * 1000000 / rep);
+    }
+
+    /*Only the masks of the circle, row by row, as the rectangle drawing applies them*/
+    lv_area_t circle_area;
+    lv_obj_get_coords(circle, &circle_area);
+    lv_draw_mask_radius_param_t p;
+    lv_draw_mask_radius_init(&p, &circle_area, 75, false);
+    static lv_opa_t buf[150];
+    clock_t t0 = clock();
+    for(i = 0; i < rep * 20; i++) {
+        lv_coord_t y;
+        for(y = circle_area.y1; y <= circle_area.y2; y++) {
+            lv_memset_ff(buf, sizeof(buf));
+            p.dsc.cb(buf, circle_area.x1, y, sizeof(buf), &p);
+        }
+    }
+    double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    printf("Radius masks, %-24s: %.2f us per 150x150 circle\n", "mask only", t * 1000000 / (rep * 20));
+    lv_draw_mask_free_param(&p);
+#endif
+}
+
+#endif
@@ -0,0 +1,305 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../../src/draw/sw/lv_draw_sw_blend_rgb565.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BUF_W       67
+#define BUF_H       9
+#define BUF_SIZE    (BUF_W * BUF_H + 8)
+#define ROUNDS      300
+
+static uint16_t dest_ref[BUF_SIZE];
+static uint16_t dest_act[BUF_SIZE];
+static uint16_t src_buf[BUF_SIZE];
+static lv_opa_t mask_buf[BUF_SIZE];
+static uint32_t seed;
+
+static const lv_opa_t opa_list[] = {0, 1, 2, 7, 8, 64, 127, 128, 200, 252, 253, 254, 255};
+
+static uint32_t rnd(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+/*A few colors only, so the "same as the last pixel" shortcuts are exercised too*/
+static void fill_random_px(uint16_t * buf, uint32_t len)
+{
+    uint32_t i;
+    uint16_t palette[4] = {0x0000, (uint16_t)rnd(), (uint16_t)rnd(), 0xFFFF};
+    for(i = 0; i < len; i++) {
+        buf[i] = (rnd() & 0x3) ? palette[rnd() & 0x3] : (uint16_t)rnd();
+    }
+}
+
+/*Runs of 0x00 and 0xFF with anti-aliased edges between them, like a real shape mask*/
+static void fill_random_mask(lv_opa_t * buf, uint32_t len)
+{
+    uint32_t i = 0;
+    while(i < len) {
+        uint32_t run = (rnd() % 12) + 1;
+        uint32_t kind = rnd() % 3;
+        while(run-- && i < len) {
+            buf[i++] = kind == 0 ? LV_OPA_TRANSP : kind == 1 ? LV_OPA_COVER : (lv_opa_t)rnd();
+        }
+    }
+}
+
+typedef struct {
+    int32_t w;
+    int32_t h;
+    int32_t dest_stride;
+    int32_t src_stride;
+    int32_t mask_stride;
+    uint32_t dest_ofs;
+    uint32_t src_ofs;
+    uint32_t mask_ofs;
+} area_t;
+
+static area_t random_area(void)
+{
+    area_t a;
+    a.w = (rnd() % (BUF_W - 4)) + 1;
+    a.h = (rnd() % BUF_H) + 1;
+    a.dest_stride = a.w + (rnd() % (BUF_W - a.w + 1));
+    a.src_stride = a.w + (rnd() % (BUF_W - a.w + 1));
+    a.mask_stride = a.w + (rnd() % (BUF_W - a.w + 1));
+    a.dest_ofs = rnd() % 4;
+    a.src_ofs = rnd() % 4;
+    a.mask_ofs = rnd() % 4;
+    return a;
+}
+
+static void prepare(void)
+{
+    fill_random_px(dest_ref, BUF_SIZE);
+    lv_memcpy(dest_act, dest_ref, sizeof(dest_ref));
+    fill_random_px(src_buf, BUF_SIZE);
+    fill_random_mask(mask_buf, BUF_SIZE);
+}
+
+/*The kernels that are used for `backend`: its own or the SWAR ones where it has NULL*/
+static lv_draw_sw_blend_rgb565_backend_t resolve(const lv_draw_sw_blend_rgb565_backend_t * backend)
+{
+    const lv_draw_sw_blend_rgb565_backend_t * swar = &lv_draw_sw_blend_rgb565_swar;
+    lv_draw_sw_blend_rgb565_backend_t b = *backend;
+    if(b.fill_opa == NULL) b.fill_opa = swar->fill_opa;
+    if(b.fill_mask == NULL) b.fill_mask = swar->fill_mask;
+    if(b.copy_opa == NULL) b.copy_opa = swar->copy_opa;
+    if(b.copy_mask == NULL) b.copy_mask = swar->copy_mask;
+    if(b.fill_opa_swap == NULL) b.fill_opa_swap = swar->fill_opa_swap;
+    if(b.fill_mask_swap == NULL) b.fill_mask_swap = swar->fill_mask_swap;
+    if(b.copy_opa_swap == NULL) b.copy_opa_swap = swar->copy_opa_swap;
+    if(b.copy_mask_swap == NULL) b.copy_mask_swap = swar->copy_mask_swap;
+    return b;
+}
+
+static void check_backend(const lv_draw_sw_blend_rgb565_backend_t * backend)
+{
+    const lv_draw_sw_blend_rgb565_backend_t * ref = &lv_draw_sw_blend_rgb565_ref;
+    lv_draw_sw_blend_rgb565_backend_t resolved = resolve(backend);
+    const lv_draw_sw_blend_rgb565_backend_t * act = &resolved;
+    uint32_t round;
+
+    for(round = 0; round < ROUNDS; round++) {
+        area_t a = random_area();
+        lv_opa_t opa = opa_list[rnd() % (sizeof(opa_list) / sizeof(opa_list[0]))];
+        uint16_t color = (uint16_t)rnd();
+        bool swap = rnd() & 0x1;
+        uint16_t * dr = dest_ref + a.dest_ofs;
+        uint16_t * da = dest_act + a.dest_ofs;
+        const uint16_t * s = src_buf + a.src_ofs;
+        const lv_opa_t * m = mask_buf + a.mask_ofs;
+
+        prepare();
+        ref->fill(dr, a.dest_stride, a.w, a.h, color);
+        act->fill(da, a.dest_stride, a.w, a.h, color);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+
+        prepare();
+        (swap ? ref->fill_opa_swap : ref->fill_opa)(dr, a.dest_stride, a.w, a.h, color, opa);
+        (swap ? act->fill_opa_swap : act->fill_opa)(da, a.dest_stride, a.w, a.h, color, opa);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+
+        prepare();
+        (swap ? ref->fill_mask_swap : ref->fill_mask)(dr, a.dest_stride, a.w, a.h, color, opa, m, a.mask_stride);
+        (swap ? act->fill_mask_swap : act->fill_mask)(da, a.dest_stride, a.w, a.h, color, opa, m, a.mask_stride);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+
+        prepare();
+        ref->copy(dr, a.dest_stride, s, a.src_stride, a.w, a.h);
+        act->copy(da, a.dest_stride, s, a.src_stride, a.w, a.h);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+
+        prepare();
+        (swap ? ref->copy_opa_swap : ref->copy_opa)(dr, a.dest_stride, s, a.src_stride, a.w, a.h, opa);
+        (swap ? act->copy_opa_swap : act->copy_opa)(da, a.dest_stride, s, a.src_stride, a.w, a.h, opa);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+
+        prepare();
+        (swap ? ref->copy_mask_swap : ref->copy_mask)(dr, a.dest_stride, s, a.src_stride, a.w, a.h, opa, m,
+                                                      a.mask_stride);
+        (swap ? act->copy_mask_swap : act->copy_mask)(da, a.dest_stride, s, a.src_stride, a.w, a.h, opa, m,
+                                                      a.mask_stride);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+    }
+}
+
+void setUp(void)
+{
+    seed = 0x1234;
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_blend_rgb565_set_backend(NULL);
+}
+
+void test_draw_sw_blend_rgb565_swar_is_bit_exact(void)
+{
+    check_backend(&lv_draw_sw_blend_rgb565_swar);
+}
+
+void test_draw_sw_blend_rgb565_default_is_bit_exact(void)
+{
+    check_backend(lv_draw_sw_blend_rgb565_get_backend());
+}
+
+void test_draw_sw_blend_rgb565_pie_is_bit_exact(void)
+{
+#if defined(__XTENSA__)
+    const lv_draw_sw_blend_rgb565_backend_t * pie = lv_draw_sw_blend_rgb565_pie();
+    if(pie) {
+        check_backend(pie);
+        return;
+    }
+#endif
+    TEST_PASS_MESSAGE("No PIE unit");
+}
+
+void test_draw_sw_blend_rgb565_default(void)
+{
+#if !LV_DRAW_SW_BLEND_RGB565_PIE
+    /*The PIE kernels are opt-in until verified on the hardware*/
+    TEST_ASSERT_EQUAL_PTR(&lv_draw_sw_blend_rgb565_swar, lv_draw_sw_blend_rgb565_get_backend());
+#endif
+    TEST_ASSERT_NOT_NULL(lv_draw_sw_blend_rgb565_get_backend()->fill);
+    TEST_ASSERT_NOT_NULL(lv_draw_sw_blend_rgb565_get_backend()->copy);
+}
+
+/*A backend with only `fill` and `copy` blends with the SWAR kernels*/
+void test_draw_sw_blend_rgb565_partial_backend(void)
+{
+    lv_draw_sw_blend_rgb565_backend_t b;
+    lv_memset_00(&b, sizeof(b));
+    b.name = "partial";
+    b.fill = lv_draw_sw_blend_rgb565_ref.fill;
+    b.copy = lv_draw_sw_blend_rgb565_ref.copy;
+    lv_draw_sw_blend_rgb565_set_backend(&b);
+
+    uint32_t round;
+    for(round = 0; round < ROUNDS; round++) {
+        area_t a = random_area();
+        lv_opa_t opa = opa_list[rnd() % (sizeof(opa_list) / sizeof(opa_list[0]))];
+        uint16_t color = (uint16_t)rnd();
+        const lv_opa_t * m = (rnd() & 0x1) ? mask_buf + a.mask_ofs : NULL;
+        const uint16_t * s = src_buf + a.src_ofs;
+
+        prepare();
+        lv_draw_sw_blend_rgb565_set_backend(&lv_draw_sw_blend_rgb565_ref);
+        lv_draw_sw_blend_rgb565_fill(dest_ref + a.dest_ofs, a.dest_stride, a.w, a.h, color, opa, m, a.mask_stride);
+        lv_draw_sw_blend_rgb565_map(dest_ref + a.dest_ofs, a.dest_stride, s, a.src_stride, a.w, a.h, opa, m,
+                                    a.mask_stride);
+        lv_draw_sw_blend_rgb565_set_backend(&b);
+        lv_draw_sw_blend_rgb565_fill(dest_act + a.dest_ofs, a.dest_stride, a.w, a.h, color, opa, m, a.mask_stride);
+        lv_draw_sw_blend_rgb565_map(dest_act + a.dest_ofs, a.dest_stride, s, a.src_stride, a.w, a.h, opa, m,
+                                    a.mask_stride);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(dest_ref, dest_act, BUF_SIZE);
+    }
+}
+
+void test_draw_sw_blend_rgb565_set_backend(void)
+{
+    lv_draw_sw_blend_rgb565_set_backend(&lv_draw_sw_blend_rgb565_ref);
+    TEST_ASSERT_EQUAL_PTR(&lv_draw_sw_blend_rgb565_ref, lv_draw_sw_blend_rgb565_get_backend());
+
+    lv_draw_sw_blend_rgb565_set_backend(NULL);
+    TEST_ASSERT_NOT_NULL(lv_draw_sw_blend_rgb565_get_backend());
+    TEST_ASSERT_NOT_EQUAL(&lv_draw_sw_blend_rgb565_ref, lv_draw_sw_blend_rgb565_get_backend());
+}
+
+void test_draw_sw_blend_rgb565_swap(void)
+{
+    /*Blending byte swapped pixels gives the byte swapped result*/
+    uint16_t d[2] = {0x1234, 0xF0F0};
+    uint16_t d_swap[2] = {0x3412, 0xF0F0};
+    lv_draw_sw_blend_rgb565_ref.fill_opa(d, 2, 2, 1, 0xABCD, LV_OPA_50);
+    lv_draw_sw_blend_rgb565_ref.fill_opa_swap(d_swap, 2, 2, 1, 0xCDAB, LV_OPA_50);
+    TEST_ASSERT_EQUAL_HEX16((uint16_t)((d[0] << 8) | (d[0] >> 8)), d_swap[0]);
+    TEST_ASSERT_EQUAL_HEX16((uint16_t)((d[1] << 8) | (d[1] >> 8)), d_swap[1]);
+}
+
+void test_draw_sw_blend_rgb565_ref_matches_color_mix(void)
+{
+#if LV_COLOR_DEPTH == 16
+    uint32_t i;
+    for(i = 0; i < 10000; i++) {
+        lv_color_t fg;
+        lv_color_t bg;
+        fg.full = (uint16_t)rnd();
+        bg.full = (uint16_t)rnd();
+        lv_opa_t opa = (lv_opa_t)rnd();
+        uint16_t d = bg.full;
+        if(opa < LV_OPA_MAX) {
+            if(LV_COLOR_16_SWAP) lv_draw_sw_blend_rgb565_ref.copy_opa_swap(&d, 1, &fg.full, 1, 1, 1, opa);
+            else lv_draw_sw_blend_rgb565_ref.copy_opa(&d, 1, &fg.full, 1, 1, 1, opa);
+            TEST_ASSERT_EQUAL_HEX16(lv_color_mix(fg, bg, opa).full, d);
+        }
+    }
+#endif
+}
+
+/*Not a check, prints the speed of the kernels on the machine running the tests*/
+void test_draw_sw_blend_rgb565_benchmark(void)
+{
+    static uint16_t dest[320 * 40];
+    static uint16_t src[320 * 40];
+    static lv_opa_t mask[320 * 40];
+    lv_draw_sw_blend_rgb565_backend_t backends[] = {lv_draw_sw_blend_rgb565_ref, resolve(lv_draw_sw_blend_rgb565_get_backend())};
+    const char * kernels[] = {"fill", "fill_opa", "fill_mask", "copy", "copy_opa", "copy_mask"};
+    const int32_t w = 320;
+    const int32_t h = 40;
+    const uint32_t rep = 20;
+
+    fill_random_px(src, w * h);
+    fill_random_mask(mask, w * h);
+
+    uint32_t b;
+    for(b = 0; b < 2; b++) {
+        const lv_draw_sw_blend_rgb565_backend_t * be = &backends[b];
+        uint32_t k;
+        for(k = 0; k < 6; k++) {
+            lv_memset_00(dest, sizeof(dest));
+            clock_t t0 = clock();
+            uint32_t r;
+            for(r = 0; r < rep; r++) {
+                switch(k) {
+                    case 0: be->fill(dest, w, w, h, 0x1234); break;
+                    case 1: be->fill_opa(dest, w, w, h, 0x1234, LV_OPA_50); break;
+                    case 2: be->fill_mask(dest, w, w, h, 0x1234, LV_OPA_COVER, mask, w); break;
+                    case 3: be->copy(dest, w, src, w, w, h); break;
+                    case 4: be->copy_opa(dest, w, src, w, w, h, LV_OPA_50); break;
+                    default: be->copy_mask(dest, w, src, w, w, h, LV_OPA_COVER, mask, w); break;
+                }
+            }
+            double s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            if(s <= 0) s = 1e-9;
+            printf("rgb565 %-5s %-9s %8.1f MPix/s\n", be->name, kernels[k], (double)w * h * rep / s / 1e6);
+        }
+    }
+}
+
+#endif
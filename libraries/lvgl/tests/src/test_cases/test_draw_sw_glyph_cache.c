@@ -0,0 +1,253 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../../src/draw/sw/lv_draw_sw_glyph_cache.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+static lv_obj_t * label;
+static lv_color_t ref_fb[FB_SIZE];
+
+static const lv_font_t * get_font(void)
+{
+#if LV_FONT_MONTSERRAT_28_COMPRESSED
+    return &lv_font_montserrat_28_compressed;
+#else
+    return LV_FONT_DEFAULT;
+#endif
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Render the screen without and with the cache (twice to draw from the cache too) and compare*/
+static void check_same_as_uncached(void)
+{
+    lv_draw_sw_glyph_cache_stat_t stat;
+
+    lv_draw_sw_glyph_cache_set_size(0);
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_draw_sw_glyph_cache_set_size(64 * 1024);
+    lv_draw_sw_glyph_cache_reset_stat();
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.hit);
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, get_font(), 0);
+    lv_label_set_text(label, "-12:34 -56:78 90");
+    lv_obj_set_pos(label, 13, 17);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_draw_sw_glyph_cache_set_size(LV_GLYPH_CACHE_DEF_SIZE);
+    lv_draw_sw_glyph_cache_reset_stat();
+}
+
+void test_draw_sw_glyph_cache_hit_and_miss(void)
+{
+    lv_draw_sw_glyph_cache_stat_t stat;
+
+    lv_draw_sw_glyph_cache_set_size(64 * 1024);
+    lv_draw_sw_glyph_cache_invalidate_font(NULL);
+    lv_draw_sw_glyph_cache_reset_stat();
+
+    /*"-12:34 -56:78 90" has 14 visible letters using 12 different glyphs*/
+    render();
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(12, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(12, stat.entry_cnt);
+
+    render();
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(12, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2 + 14, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.evict);
+
+    lv_draw_sw_glyph_cache_invalidate_font(get_font());
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+}
+
+void test_draw_sw_glyph_cache_evicts_least_recently_used(void)
+{
+    lv_draw_sw_glyph_cache_stat_t stat;
+
+    lv_draw_sw_glyph_cache_set_size(64 * 1024);
+    render();
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    uint32_t full_size = stat.size;
+
+    /*Room for about the half of the glyphs*/
+    lv_draw_sw_glyph_cache_set_size(full_size / 2);
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(full_size / 2, stat.size);
+    TEST_ASSERT_GREATER_THAN(0, stat.evict);
+
+    lv_draw_sw_glyph_cache_reset_stat();
+    render();
+    lv_draw_sw_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(full_size / 2, stat.size);
+    TEST_ASSERT_GREATER_THAN(0, stat.miss);
+    TEST_ASSERT_GREATER_THAN(0, stat.evict);
+}
+
+void test_draw_sw_glyph_cache_same_result(void)
+{
+    check_same_as_uncached();
+}
+
+void test_draw_sw_glyph_cache_same_result_opa_and_clip(void)
+{
+    /*Letters cut by the screen edge and drawn with opacity*/
+    lv_obj_set_pos(label, -7, -9);
+    lv_obj_set_style_text_opa(label, LV_OPA_70, 0);
+    check_same_as_uncached();
+}
+
+void test_draw_sw_glyph_cache_same_result_with_mask(void)
+{
+    /*The rounded corner of the parent adds a radius mask*/
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 200, 60);
+    lv_obj_set_style_radius(cont, 25, 0);
+    lv_obj_set_style_clip_corner(cont, true, 0);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_parent(label, cont);
+    lv_obj_set_pos(label, 0, 0);
+    check_same_as_uncached();
+}
+
+/*Not a check, prints the gain of the cache on the machine running the tests*/
+void test_draw_sw_glyph_cache_benchmark(void)
+{
+    lv_draw_sw_glyph_cache_stat_t stat;
+    const uint32_t rep = 1000;
+    uint32_t sizes[2] = {0, 64 * 1024};
+
+    lv_label_set_text(label, "-12:34");
+
+    uint32_t s;
+    for(s = 0; s < 2; s++) {
+        lv_draw_sw_glyph_cache_set_size(sizes[s]);
+        lv_draw_sw_glyph_cache_reset_stat();
+        clock_t t0 = clock();
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            lv_obj_invalidate(label);
+            lv_refr_now(NULL);
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        lv_draw_sw_glyph_cache_get_stat(&stat);
+        printf("glyph cache %6" LV_PRIu32 " bytes: %" LV_PRIu32 " label redraws in %.3f s, hit: %" LV_PRIu32 ", miss: %"
+               LV_PRIu32 "\n", sizes[s], rep, t, stat.hit, stat.miss);
+    }
+}
+
+#if LV_USE_FONT_COMPRESSED
+
+#define BENCH_BUF_SIZE  (320 * 48)
+
+LV_FONT_DECLARE(ekstra)
+
+static uint32_t flush_hash;
+
+static void bench_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(color_p);
+    lv_disp_flush_ready(disp_drv);
+}
+
+/*FNV-1a of the flushed areas and their pixels*/
+static void hash_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    const uint8_t * p = (const uint8_t *)color_p;
+    uint32_t size = lv_area_get_size(area) * sizeof(lv_color_t);
+    uint32_t i;
+    flush_hash = (flush_hash ^ (uint32_t)area->y1) * 16777619;
+    for(i = 0; i < size; i++) flush_hash = (flush_hash ^ p[i]) * 16777619;
+    lv_disp_flush_ready(disp_drv);
+}
+
+#endif /*LV_USE_FONT_COMPRESSED*/
+
+/*Not a check, prints the gain of the cache with the 100 px, 3 bpp compressed clock font of the app.
+ *The draw buffer has the size of the device's one (320 x 48 pixels), so the large letters are drawn in several bands.*/
+void test_draw_sw_glyph_cache_benchmark_large_font(void)
+{
+#if LV_USE_FONT_COMPRESSED
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_color_t buf[BENCH_BUF_SIZE];
+    lv_draw_sw_glyph_cache_stat_t stat;
+    const uint32_t rep = 1000;
+    uint32_t sizes[2] = {0, 64 * 1024};
+    uint32_t hash[2];
+
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_draw_buf_t * draw_buf_ori = disp->driver->draw_buf;
+    void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver->flush_cb;
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, BENCH_BUF_SIZE);
+    disp->driver->draw_buf = &draw_buf;
+
+    /*The font has only digits, like the temperature label of the app*/
+    lv_obj_set_style_text_font(label, &ekstra, 0);
+    lv_label_set_text(label, "1234");
+    lv_refr_now(NULL);
+
+    uint32_t s;
+    for(s = 0; s < 2; s++) {
+        lv_draw_sw_glyph_cache_set_size(sizes[s]);
+        lv_draw_sw_glyph_cache_reset_stat();
+        disp->driver->flush_cb = bench_flush_cb;
+        clock_t t0 = clock();
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            lv_obj_invalidate(label);
+            lv_refr_now(NULL);
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        lv_draw_sw_glyph_cache_get_stat(&stat);
+
+        /*One more redraw to compare the result*/
+        disp->driver->flush_cb = hash_flush_cb;
+        flush_hash = 2166136261;
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+        hash[s] = flush_hash;
+
+        printf("glyph cache %6" LV_PRIu32 " bytes: %" LV_PRIu32 " redraws of 100 px letters in %.3f s, hit: %" LV_PRIu32
+               ", miss: %" LV_PRIu32 ", frame hash: %08" LV_PRIx32 "\n", sizes[s], rep, t, stat.hit, stat.miss, hash[s]);
+    }
+
+    disp->driver->flush_cb = flush_cb_ori;
+    disp->driver->draw_buf = draw_buf_ori;
+
+    TEST_ASSERT_EQUAL_HEX32(hash[0], hash[1]);
+#else
+    TEST_PASS_MESSAGE("No compressed fonts");
+#endif
+}
+
+#endif
@@ -0,0 +1,163 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../../src/draw/sw/lv_draw_sw_mt.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_MT
+#include <stdio.h>
+#include <time.h>
+
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[FB_SIZE];
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Large fills, gradients, shadows, rounded and clipped corners, an image with opacity and text*/
+static void create_screen(void)
+{
+    LV_IMG_DECLARE(img_cogwheel_argb)
+
+    lv_obj_t * scr = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(scr);
+    lv_obj_set_size(scr, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0xa0c0e0), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 500, 300);
+    lv_obj_set_pos(cont, 23, 31);
+    lv_obj_set_style_radius(cont, 40, 0);
+    lv_obj_set_style_clip_corner(cont, true, 0);
+    lv_obj_set_style_shadow_width(cont, 30, 0);
+    lv_obj_set_style_shadow_spread(cont, 5, 0);
+    lv_obj_set_style_bg_opa(cont, LV_OPA_70, 0);
+
+    lv_obj_t * img = lv_img_create(cont);
+    lv_img_set_src(img, &img_cogwheel_argb);
+    lv_obj_set_style_img_opa(img, LV_OPA_80, 0);
+    lv_obj_set_pos(img, -20, 50);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, "Band parallel\nrendering");
+    lv_obj_align(label, LV_ALIGN_TOP_RIGHT, 0, 0);
+
+    lv_obj_t * bar = lv_bar_create(scr);
+    lv_obj_set_size(bar, 700, 40);
+    lv_obj_set_pos(bar, 50, 400);
+    lv_bar_set_value(bar, 70, LV_ANIM_OFF);
+    lv_obj_set_style_bg_grad_color(bar, lv_color_hex(0xff0000), LV_PART_INDICATOR);
+    lv_obj_set_style_bg_grad_dir(bar, LV_GRAD_DIR_HOR, LV_PART_INDICATOR);
+
+    lv_obj_t * arc = lv_arc_create(scr);
+    lv_obj_set_size(arc, 200, 200);
+    lv_obj_set_pos(arc, 570, 80);
+    lv_obj_set_style_arc_width(arc, 30, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_width(arc, 30, LV_PART_MAIN);
+}
+#endif
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+#if LV_USE_DRAW_SW_MT
+    lv_obj_clean(lv_scr_act());
+    lv_draw_sw_mt_set_min_px(LV_DRAW_SW_MT_MIN_PX);
+    lv_draw_sw_mt_reset_stat();
+#endif
+}
+
+void test_draw_sw_mt_same_as_serial(void)
+{
+#if LV_USE_DRAW_SW_MT
+    lv_draw_sw_mt_stat_t stat;
+    create_screen();
+
+    lv_draw_sw_mt_set_min_px(UINT32_MAX);
+    lv_draw_sw_mt_reset_stat();
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_draw_sw_mt_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.split);
+    TEST_ASSERT_GREATER_THAN(0, stat.serial);
+
+    /*Split every blend which has at least 2 rows. Render a few times as the threads run in a different order*/
+    lv_draw_sw_mt_set_min_px(0);
+    lv_draw_sw_mt_reset_stat();
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_memset_00(test_fb, sizeof(ref_fb));
+        render();
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    }
+
+    lv_draw_sw_mt_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_MT_THREAD_CNT, stat.thread_cnt);
+    TEST_ASSERT_GREATER_THAN(0, stat.split);
+#endif
+}
+
+void test_draw_sw_mt_min_px(void)
+{
+#if LV_USE_DRAW_SW_MT
+    lv_draw_sw_mt_stat_t stat;
+
+    /*Only the full screen background is large enough*/
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 20, 20);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+
+    lv_draw_sw_mt_set_min_px(20 * 20 + 1);
+    lv_draw_sw_mt_reset_stat();
+    render();
+    lv_draw_sw_mt_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.split);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.serial);
+#endif
+}
+
+/*Not a check, prints the wall clock time of the serial and the band parallel rendering*/
+void test_draw_sw_mt_benchmark(void)
+{
+#if LV_USE_DRAW_SW_MT
+    lv_draw_sw_mt_stat_t stat;
+    const uint32_t rep = 50;
+    uint32_t min_px[2] = {UINT32_MAX, LV_DRAW_SW_MT_MIN_PX};
+
+    create_screen();
+
+    uint32_t m;
+    for(m = 0; m < 2; m++) {
+        lv_draw_sw_mt_set_min_px(min_px[m]);
+        lv_draw_sw_mt_reset_stat();
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            render();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double t = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+        lv_draw_sw_mt_get_stat(&stat);
+        printf("draw sw mt %s: %" LV_PRIu32 " full screen redraws in %.3f s, split: %" LV_PRIu32 ", serial: %" LV_PRIu32
+               ", helper bands: %" LV_PRIu32 "\n", m == 0 ? "serial" : "bands", rep, t, stat.split, stat.serial,
+               stat.helper_bands);
+    }
+#endif
+}
+
+#endif
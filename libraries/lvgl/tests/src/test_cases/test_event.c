@@ -2,6 +2,11 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+static uint32_t cb_cnt;
+static uint32_t class_cb_cnt;
 
 static void event_object_deletion_cb(const lv_obj_class_t * cls, lv_event_t * e)
 {
@@ -23,4 +28,168 @@ void test_event_object_deletion(void)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+static void count_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    cb_cnt++;
+}
+
+static void hit_test_cb(lv_event_t * e)
+{
+    if(lv_event_get_code(e) == LV_EVENT_HIT_TEST) {
+        lv_hit_test_info_t * info = lv_event_get_hit_test_info(e);
+        info->res = false;
+    }
+}
+
+static void masked_class_event_cb(const lv_obj_class_t * cls, lv_event_t * e)
+{
+    LV_UNUSED(cls);
+    if(lv_obj_event_base(cls, e) != LV_RES_OK) return;
+    class_cb_cnt++;
+}
+
+static const lv_obj_class_t masked_class = {
+    .event_cb = masked_class_event_cb,
+    .event_mask = LV_EVENT_MASK(LV_EVENT_VALUE_CHANGED),
+    .base_class = &lv_obj_class
+};
+
+void test_event_object_mask(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_event_stat_t stat;
+    cb_cnt = 0;
+
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_CLICKED | LV_EVENT_PREPROCESS, NULL);
+
+    lv_event_reset_stat();
+    lv_event_send(obj, LV_EVENT_REFRESH, NULL);
+    lv_event_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, cb_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.dispatched);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.skipped);
+
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cb_cnt);
+
+    /*The removed callback's code is not in the mask anymore*/
+    lv_obj_remove_event_cb_with_user_data(obj, count_cb, NULL);
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, cb_cnt);
+
+    /*`LV_EVENT_ALL` receives everything*/
+    lv_obj_add_event_cb(obj, count_cb, LV_EVENT_ALL, NULL);
+    lv_event_send(obj, LV_EVENT_REFRESH, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, cb_cnt);
+
+    lv_obj_del(obj);
+}
+
+void test_event_object_mask_custom_code(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    uint32_t id1 = lv_event_register_id();
+    uint32_t i;
+    for(i = 0; i < 64; i++) lv_event_register_id();
+    uint32_t id2 = lv_event_register_id();
+    uint32_t id3 = lv_event_register_id();
+    cb_cnt = 0;
+
+    lv_obj_add_event_cb(obj, count_cb, id1, NULL);
+    lv_obj_add_event_cb(obj, count_cb, id2, NULL);
+    lv_event_send(obj, id1, NULL);
+    lv_event_send(obj, id2, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cb_cnt);
+
+    /*Shares the bit of `id2` but is filtered by the callback*/
+    lv_event_send(obj, id3, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, cb_cnt);
+
+    lv_obj_del(obj);
+}
+
+void test_event_class_mask(void)
+{
+    lv_obj_t * obj = lv_obj_class_create_obj(&masked_class, lv_scr_act());
+    lv_obj_class_init_obj(obj);
+    lv_event_stat_t stat;
+    class_cb_cnt = 0;
+
+    lv_event_reset_stat();
+    lv_event_send(obj, LV_EVENT_REFR_EXT_DRAW_SIZE, &(lv_coord_t) {
+        0
+    });
+    lv_event_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, class_cb_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.skipped);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.delivered);   /*Only `lv_obj_class`*/
+
+    /*The base class still handles the skipped events*/
+    lv_obj_set_style_shadow_width(obj, 10, 0);
+    lv_obj_refresh_ext_draw_size(obj);
+    TEST_ASSERT_GREATER_THAN(0, _lv_obj_get_ext_draw_size(obj));
+
+    lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, class_cb_cnt);
+
+    lv_obj_del(obj);
+}
+
+/*Not a check, prints the events of redrawing a screen of labels with hit test callbacks*/
+void test_event_benchmark(void)
+{
+    const uint32_t rep = 300;
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Value %d", (int)i);
+        lv_obj_add_event_cb(label, hit_test_cb, LV_EVENT_HIT_TEST, NULL);
+    }
+    static lv_point_t points[] = {{0, 0}, {100, 0}};
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * line = lv_line_create(cont);
+        lv_line_set_points(line, points, 2);
+        lv_obj_add_event_cb(line, hit_test_cb, LV_EVENT_HIT_TEST, NULL);
+    }
+    lv_refr_now(NULL);
+
+    lv_event_reset_stat();
+    clock_t t0 = clock();
+    uint32_t r;
+    for(r = 0; r < rep; r++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    double t_redraw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    lv_event_stat_t stat;
+    lv_event_get_stat(&stat);
+
+    /*Only the events of the redraws which don't draw*/
+    t0 = clock();
+    for(r = 0; r < rep * 10; r++) {
+        for(i = 0; i < lv_obj_get_child_cnt(cont); i++) {
+            lv_obj_t * child = lv_obj_get_child(cont, i);
+            lv_cover_check_info_t info = {.res = LV_COVER_RES_COVER, .area = &child->coords};
+            lv_event_send(child, LV_EVENT_COVER_CHECK, &info);
+            lv_coord_t s = 0;
+            lv_event_send(child, LV_EVENT_REFR_EXT_DRAW_SIZE, &s);
+        }
+    }
+    double t_events = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("event: %" LV_PRIu32 " full screen redraws in %.3f s, per frame dispatched: %" LV_PRIu32 ", delivered: %"
+           LV_PRIu32 ", skipped: %" LV_PRIu32 "; %" LV_PRIu32 " cover check and ext. draw size rounds in %.3f s\n",
+           rep, t_redraw, stat.dispatched / rep, stat.delivered / rep, stat.skipped / rep, rep * 10, t_events);
+
+    lv_obj_del(cont);
+}
+
 #endif
@@ -0,0 +1,164 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define LAST_LETTER     0x180
+#define PAIR_CNT        400
+
+extern lv_font_t font_1;
+extern lv_font_t font_3;
+
+static lv_font_fmt_txt_glyph_cache_t pair_font_cache;
+static lv_font_fmt_txt_dsc_t pair_font_dsc;
+static lv_font_t pair_font;
+static lv_font_fmt_txt_glyph_cache_t font_1_copy_cache;
+static lv_font_fmt_txt_dsc_t font_1_copy_dsc;
+static lv_font_t font_1_copy;
+static uint8_t pair_ids[PAIR_CNT * 2];
+static int8_t pair_values[PAIR_CNT];
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+
+static lv_font_glyph_dsc_t ref_dsc[LAST_LETTER];
+
+/*The test fonts have no glyph cache, add one to a copy of them*/
+static void copy_font(lv_font_t * dst, lv_font_fmt_txt_dsc_t * dst_dsc, lv_font_fmt_txt_glyph_cache_t * dst_cache,
+                      const lv_font_t * src)
+{
+    *dst = *src;
+    *dst_dsc = *(const lv_font_fmt_txt_dsc_t *)src->dsc;
+    lv_memset_00(dst_cache, sizeof(*dst_cache));
+    dst_dsc->cache = dst_cache;
+    dst->dsc = dst_dsc;
+}
+
+/*font_3 with kerning pairs of a few repeating patterns, like real fonts have*/
+static void init_pair_font(void)
+{
+    copy_font(&pair_font, &pair_font_dsc, &pair_font_cache, &font_3);
+
+    uint32_t seed = 0x1234;
+    uint32_t n = 0;
+    uint32_t l;
+    uint32_t r;
+    for(l = 1; l < 96 && n < PAIR_CNT; l++) {
+        for(r = 1; r < 96 && n < PAIR_CNT; r++) {
+            seed = seed * 1103515245 + 12345;
+            if(((seed >> 16) & 0x7) != 0) continue;
+            pair_ids[n * 2] = (uint8_t)l;
+            pair_ids[n * 2 + 1] = (uint8_t)r;
+            pair_values[n] = (int8_t)(((l % 5) * 3 - (r % 4) * 7) * 4);
+            n++;
+        }
+    }
+
+    kern_pairs.glyph_ids = pair_ids;
+    kern_pairs.values = pair_values;
+    kern_pairs.pair_cnt = n;
+    kern_pairs.glyph_ids_size = 0;
+    pair_font_dsc.kern_dsc = &kern_pairs;
+    pair_font_dsc.kern_classes = 0;
+    pair_font_dsc.kern_scale = 16;
+}
+
+/*Compare every letter pair with and without the lookup tables*/
+static void check_font(const lv_font_t * font, uint32_t lut_letter_cnt)
+{
+    uint32_t a;
+    uint32_t b;
+
+    for(b = 0; b < LAST_LETTER; b += 7) {
+        for(a = 0; a < LAST_LETTER; a++) {
+            lv_memset_00(&ref_dsc[a], sizeof(ref_dsc[a]));
+            lv_font_get_glyph_dsc(font, &ref_dsc[a], a, b);
+        }
+
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_build_lut(font, lut_letter_cnt));
+
+        for(a = 0; a < LAST_LETTER; a++) {
+            lv_font_glyph_dsc_t dsc;
+            lv_memset_00(&dsc, sizeof(dsc));
+            lv_font_get_glyph_dsc(font, &dsc, a, b);
+            TEST_ASSERT_EQUAL_MEMORY(&ref_dsc[a], &dsc, sizeof(dsc));
+        }
+
+        lv_font_fmt_txt_free_lut(font);
+    }
+}
+
+void setUp(void)
+{
+    init_pair_font();
+    copy_font(&font_1_copy, &font_1_copy_dsc, &font_1_copy_cache, &font_1);
+}
+
+void tearDown(void)
+{
+    lv_font_fmt_txt_free_lut(&pair_font);
+    lv_font_fmt_txt_free_lut(&font_1_copy);
+    lv_font_fmt_txt_free_lut(LV_FONT_DEFAULT);
+}
+
+void test_font_fmt_txt_lut_kern_classes(void)
+{
+    check_font(LV_FONT_DEFAULT, 0x100);
+}
+
+void test_font_fmt_txt_lut_multiple_cmaps(void)
+{
+    /*ASCII, a sparse cmap and symbols above the tables*/
+    check_font(&font_1_copy, 0x100);
+}
+
+void test_font_fmt_txt_lut_kern_pairs(void)
+{
+    check_font(&pair_font, 0x100);
+
+    /*The kerning pairs are converted to classes*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_build_lut(&pair_font, 0x100));
+    TEST_ASSERT_NOT_EQUAL(0, pair_font_cache.kern_glyph_cnt);
+    TEST_ASSERT_LESS_THAN(96, pair_font_cache.kern_right_class_cnt);
+}
+
+void test_font_fmt_txt_lut_partial(void)
+{
+    /*Only a part of the glyphs are in the tables, the others are searched*/
+    check_font(&pair_font, 'M');
+}
+
+void test_font_fmt_txt_lut_needs_cache(void)
+{
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_font_fmt_txt_build_lut(&font_3, 0x100));
+}
+
+/*Not a check, prints the speed of text measurement on the machine running the tests*/
+void test_font_fmt_txt_lut_benchmark(void)
+{
+    const char * txt = "Lorem ipsum dolor sit amet, consectetur adipiscing elit,\n"
+                       "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. 0123456789";
+    const lv_font_t * fonts[] = {LV_FONT_DEFAULT, &pair_font};
+    const uint32_t rep = 2000;
+
+    uint32_t f;
+    for(f = 0; f < 2; f++) {
+        uint32_t lut;
+        for(lut = 0; lut < 2; lut++) {
+            if(lut) lv_font_fmt_txt_build_lut(fonts[f], 0x100);
+            else lv_font_fmt_txt_free_lut(fonts[f]);
+
+            lv_point_t size;
+            clock_t t0 = clock();
+            uint32_t i;
+            for(i = 0; i < rep; i++) {
+                lv_txt_get_size(&size, txt, fonts[f], 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+            }
+            double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            printf("lv_txt_get_size %s font, %s: %.3f s\n", f == 0 ? "class kerned" : "pair kerned",
+                   lut ? "lookup tables" : "search", t);
+        }
+    }
+}
+
+#endif
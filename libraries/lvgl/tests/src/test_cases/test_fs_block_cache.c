@@ -0,0 +1,502 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define FILE_SIZE   20000
+#define BENCH_SIZE  (64 * 1024)
+
+static char path[64];           /*With the 'B' letter*/
+static uint8_t content[BENCH_SIZE];
+static uint32_t rnd_state = 1;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) & 0x7fff;
+}
+
+static void write_file(uint32_t size)
+{
+    uint32_t i;
+    for(i = 0; i < size; i++) content[i] = rnd();
+
+    FILE * f = fopen(path + 2, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL_UINT32(size, fwrite(content, 1, size, f));
+    fclose(f);
+}
+
+static void read_and_check(const char * p, uint32_t size, uint32_t chunk)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, p, LV_FS_MODE_RD));
+
+    static uint8_t buf[BENCH_SIZE];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        uint32_t btr = chunk ? chunk : 1 + rnd() % 700;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, btr, &br));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(btr, br);
+        if(br) TEST_ASSERT_EQUAL_MEMORY(content + cnt, buf, br);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL_UINT32(size, cnt);
+
+    lv_fs_close(&f);
+}
+
+#if LV_FS_BLOCK_CACHE_READ_AHEAD
+
+static uint32_t read_delay_us;  /*Access time of the slow drives*/
+
+/*A drive on the same files with a slow storage*/
+static void * slow_open(lv_fs_drv_t * drv, const char * p, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    FILE * f = fopen(p, mode == LV_FS_MODE_RD ? "rb" : "wb");
+    return f;
+}
+
+static lv_fs_res_t slow_close(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    fclose(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t slow_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    usleep(read_delay_us);
+    *br = fread(buf, 1, btr, file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t slow_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    int w = whence == LV_FS_SEEK_SET ? SEEK_SET : whence == LV_FS_SEEK_CUR ? SEEK_CUR : SEEK_END;
+    return fseek(file_p, pos, w) == 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+
+static lv_fs_res_t slow_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = ftell(file_p);
+    return LV_FS_RES_OK;
+}
+
+static void register_slow_drv(lv_fs_drv_t * drv, char letter, bool block_cache)
+{
+    lv_fs_drv_init(drv);
+    drv->letter = letter;
+    drv->block_cache = block_cache;
+    drv->thread_safe = 1;   /*stdio*/
+    drv->open_cb = slow_open;
+    drv->close_cb = slow_close;
+    drv->read_cb = slow_read;
+    drv->seek_cb = slow_seek;
+    drv->tell_cb = slow_tell;
+    lv_fs_drv_register(drv);
+}
+
+static double now_s(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/*Read like a decoder in small chunks with some work between them*/
+static double decode(const char * p)
+{
+    double t0 = now_s();
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, p, LV_FS_MODE_RD));
+    uint32_t br = 1;
+    volatile uint32_t sum = 0;
+    while(br) {
+        uint8_t buf[64];
+        lv_fs_read(&f, buf, sizeof(buf), &br);
+        uint32_t i;
+        for(i = 0; i < 20000; i++) sum += buf[i % sizeof(buf)];
+    }
+    lv_fs_close(&f);
+    return now_s() - t0;
+}
+
+/*A drive like LittleFS without lock: one state shared by all files, so it can be used only from one thread*/
+static pthread_t single_owner;
+static volatile uint32_t single_busy;
+static volatile uint32_t single_violation_cnt;
+
+static void single_enter(void)
+{
+    if(!pthread_equal(pthread_self(), single_owner)) single_violation_cnt++;
+    if(__atomic_fetch_add(&single_busy, 1, __ATOMIC_SEQ_CST) != 0) single_violation_cnt++;
+    usleep(20);     /*Give the other thread a chance to overlap*/
+}
+
+static void single_leave(void)
+{
+    __atomic_fetch_sub(&single_busy, 1, __ATOMIC_SEQ_CST);
+}
+
+static void * single_open(lv_fs_drv_t * drv, const char * p, lv_fs_mode_t mode)
+{
+    single_enter();
+    void * f = slow_open(drv, p, mode);
+    single_leave();
+    return f;
+}
+
+static lv_fs_res_t single_close(lv_fs_drv_t * drv, void * file_p)
+{
+    single_enter();
+    lv_fs_res_t res = slow_close(drv, file_p);
+    single_leave();
+    return res;
+}
+
+static lv_fs_res_t single_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    single_enter();
+    lv_fs_res_t res = slow_read(drv, file_p, buf, btr, br);
+    single_leave();
+    return res;
+}
+
+static lv_fs_res_t single_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    single_enter();
+    lv_fs_res_t res = slow_seek(drv, file_p, pos, whence);
+    single_leave();
+    return res;
+}
+
+static lv_fs_res_t single_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    single_enter();
+    lv_fs_res_t res = slow_tell(drv, file_p, pos_p);
+    single_leave();
+    return res;
+}
+
+#endif /*LV_FS_BLOCK_CACHE_READ_AHEAD*/
+
+#endif
+
+void setUp(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    lv_snprintf(path, sizeof(path), "B:/tmp/lv_fs_block_cache_%d.bin", (int)getpid());
+    lv_fs_block_cache_clear();
+    lv_fs_block_cache_set_read_ahead(LV_FS_BLOCK_CACHE_READ_AHEAD);
+    lv_fs_block_cache_reset_stat();
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    lv_fs_block_cache_clear();
+    remove(path + 2);
+#endif
+}
+
+void test_fs_block_cache_sequential_read(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    write_file(FILE_SIZE);
+    read_and_check(path, FILE_SIZE, 0);
+    read_and_check(path, FILE_SIZE, 1);
+    read_and_check(path, FILE_SIZE, LV_FS_BLOCK_CACHE_BLOCK_SIZE);
+#endif
+}
+
+void test_fs_block_cache_random_seek(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    write_file(FILE_SIZE);
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+
+    uint32_t pos = 0;
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        switch(rnd() % 3) {
+            case 0:
+                pos = rnd() % (FILE_SIZE + 100);
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, pos, LV_FS_SEEK_SET));
+                break;
+            case 1: {
+                    uint32_t d = rnd() % 300;
+                    pos += d;
+                    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, d, LV_FS_SEEK_CUR));
+                    break;
+                }
+            case 2:
+                pos = FILE_SIZE;
+                TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, 0, LV_FS_SEEK_END));
+                break;
+        }
+
+        uint32_t tell;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_tell(&f, &tell));
+        TEST_ASSERT_EQUAL_UINT32(pos, tell);
+
+        uint8_t buf[1000];
+        uint32_t btr = rnd() % sizeof(buf);
+        uint32_t br;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, btr, &br));
+        uint32_t exp = pos < FILE_SIZE ? LV_MIN(btr, FILE_SIZE - pos) : 0;
+        TEST_ASSERT_EQUAL_UINT32(exp, br);
+        if(br) TEST_ASSERT_EQUAL_MEMORY(content + pos, buf, br);
+        pos += br;
+    }
+
+    lv_fs_close(&f);
+#endif
+}
+
+void test_fs_block_cache_reopen_hits(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    /*Fits to the cache*/
+    uint32_t size = LV_FS_BLOCK_CACHE_BLOCK_SIZE * 2 + 10;
+    write_file(size);
+    read_and_check(path, size, 50);
+
+    lv_fs_block_cache_stat_t stat;
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.miss_cnt + stat.ahead_cnt);
+
+    lv_fs_block_cache_reset_stat();
+    read_and_check(path, size, 50);
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.ahead_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.hit_cnt);
+#endif
+}
+
+void test_fs_block_cache_write_invalidates(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    uint32_t size = 100;
+    write_file(size);
+    read_and_check(path, size, 30);
+
+    /*Write new content through lv_fs: the cached blocks are dropped*/
+    uint32_t i;
+    for(i = 0; i < size; i++) content[i] = rnd();
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_WR));
+    uint32_t bw;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, content, size, &bw));
+    lv_fs_close(&f);
+
+    read_and_check(path, size, 30);
+#endif
+}
+
+void test_fs_block_cache_large_read_is_direct(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    write_file(FILE_SIZE);
+    read_and_check(path, FILE_SIZE, FILE_SIZE);
+
+    lv_fs_block_cache_stat_t stat;
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(FILE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE, stat.direct_cnt);
+#endif
+}
+
+void test_fs_block_cache_many_files(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX
+    /*More files than blocks, read in turns*/
+    static lv_fs_file_t files[LV_FS_BLOCK_CACHE_BLOCK_CNT * 2];
+    uint32_t i;
+    write_file(FILE_SIZE);
+    for(i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&files[i], path, LV_FS_MODE_RD));
+    }
+
+    uint32_t pos;
+    for(pos = 0; pos < FILE_SIZE; pos += 100) {
+        for(i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+            uint8_t buf[100];
+            uint32_t br;
+            TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&files[i], buf, sizeof(buf), &br));
+            if(br) TEST_ASSERT_EQUAL_MEMORY(content + pos, buf, br);
+        }
+    }
+
+    for(i = 0; i < sizeof(files) / sizeof(files[0]); i++) lv_fs_close(&files[i]);
+#endif
+}
+
+void test_fs_block_cache_read_ahead(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX && LV_FS_BLOCK_CACHE_READ_AHEAD
+    static lv_fs_drv_t slow_drv;
+    register_slow_drv(&slow_drv, 'S', true);
+    write_file(FILE_SIZE);
+
+    /*Decode a bit slower than the storage*/
+    read_delay_us = 100;
+    char slow_path[64];
+    lv_snprintf(slow_path, sizeof(slow_path), "S%s", path + 1);
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, slow_path, LV_FS_MODE_RD));
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        uint8_t buf[64];
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        if(br) TEST_ASSERT_EQUAL_MEMORY(content + cnt, buf, br);
+        cnt += br;
+        usleep(50);
+    }
+    lv_fs_close(&f);
+    TEST_ASSERT_EQUAL_UINT32(FILE_SIZE, cnt);
+
+    lv_fs_block_cache_stat_t stat;
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.ahead_hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat.ahead_cnt, stat.ahead_hit_cnt);
+
+    /*Random reads are not read ahead*/
+    lv_fs_block_cache_clear();
+    lv_fs_block_cache_reset_stat();
+    read_delay_us = 0;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, slow_path, LV_FS_MODE_RD));
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        uint8_t buf[10];
+        lv_fs_seek(&f, (30 - i) * LV_FS_BLOCK_CACHE_BLOCK_SIZE * 2, LV_FS_SEEK_SET);
+        lv_fs_read(&f, buf, sizeof(buf), &br);
+    }
+    lv_fs_close(&f);
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.ahead_cnt);
+#endif
+}
+
+void test_fs_block_cache_close_while_reading_ahead(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX && LV_FS_BLOCK_CACHE_READ_AHEAD
+    write_file(FILE_SIZE);
+
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_fs_file_t f;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+        uint32_t pos = (rnd() % 70) * LV_FS_BLOCK_CACHE_BLOCK_SIZE;
+        lv_fs_seek(&f, pos, LV_FS_SEEK_SET);
+        uint8_t buf[20];
+        uint32_t br;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        if(br) TEST_ASSERT_EQUAL_MEMORY(content + pos, buf, br);
+        lv_fs_close(&f);
+        if(i % 50 == 0) lv_fs_block_cache_clear();
+    }
+#endif
+}
+
+void test_fs_block_cache_no_read_ahead_without_thread_safe(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX && LV_FS_BLOCK_CACHE_READ_AHEAD
+    static lv_fs_drv_t single_drv;
+    lv_fs_drv_init(&single_drv);
+    single_drv.letter = 'L';
+    single_drv.block_cache = 1;
+    single_drv.open_cb = single_open;
+    single_drv.close_cb = single_close;
+    single_drv.read_cb = single_read;
+    single_drv.seek_cb = single_seek;
+    single_drv.tell_cb = single_tell;
+    lv_fs_drv_register(&single_drv);
+
+    single_owner = pthread_self();
+    single_violation_cnt = 0;
+    read_delay_us = 50;
+    write_file(FILE_SIZE);
+
+    /*Read sequentially like a decoder, which would start the read ahead on a thread safe drive*/
+    char single_path[64];
+    lv_snprintf(single_path, sizeof(single_path), "L%s", path + 1);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_fs_block_cache_clear();
+        read_and_check(single_path, FILE_SIZE, 64);
+    }
+
+    lv_fs_block_cache_stat_t stat;
+    lv_fs_block_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, single_violation_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.ahead_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.hit_cnt);
+#endif
+}
+
+/*Not a check, prints the time of decoding a file from a slow storage*/
+void test_fs_block_cache_benchmark(void)
+{
+#if LV_FS_BLOCK_CACHE && LV_USE_FS_POSIX && LV_FS_BLOCK_CACHE_READ_AHEAD
+    static lv_fs_drv_t slow_drv;
+    static lv_fs_drv_t uncached_drv;
+    register_slow_drv(&slow_drv, 'S', true);
+    register_slow_drv(&uncached_drv, 'U', false);
+    write_file(BENCH_SIZE);
+
+    char slow_path[64];
+    char uncached_path[64];
+    lv_snprintf(slow_path, sizeof(slow_path), "S%s", path + 1);
+    lv_snprintf(uncached_path, sizeof(uncached_path), "U%s", path + 1);
+
+    /*About a flash page read through a file system*/
+    read_delay_us = 50;
+
+    const uint32_t rep = 3;
+    double t_uncached = 1e9;
+    double t_cached = 1e9;
+    double t_ahead = 1e9;
+    uint32_t r;
+    for(r = 0; r < rep; r++) {
+        double t = decode(uncached_path);
+        t_uncached = LV_MIN(t_uncached, t);
+
+        lv_fs_block_cache_clear();
+        lv_fs_block_cache_set_read_ahead(0);
+        t = decode(slow_path);
+        t_cached = LV_MIN(t_cached, t);
+
+        lv_fs_block_cache_clear();
+        lv_fs_block_cache_set_read_ahead(LV_FS_BLOCK_CACHE_READ_AHEAD);
+        lv_fs_block_cache_reset_stat();
+        t = decode(slow_path);
+        t_ahead = LV_MIN(t_ahead, t);
+    }
+
+    lv_fs_block_cache_stat_t stat;
+    lv_fs_block_cache_get_stat(&stat);
+    printf("fs block cache: decode %d kB in 64 B reads, no cache: %.1f ms, %d B blocks: %.1f ms, "
+           "read ahead %d: %.1f ms (ahead: %" LV_PRIu32 ", used: %" LV_PRIu32 ", waits: %" LV_PRIu32 ", misses: %" LV_PRIu32 ")\n",
+           BENCH_SIZE / 1024, t_uncached * 1000, LV_FS_BLOCK_CACHE_BLOCK_SIZE, t_cached * 1000,
+           LV_FS_BLOCK_CACHE_READ_AHEAD, t_ahead * 1000, stat.ahead_cnt, stat.ahead_hit_cnt, stat.wait_cnt, stat.miss_cnt);
+#endif
+}
+
+#endif
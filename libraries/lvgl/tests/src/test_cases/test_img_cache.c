@@ -0,0 +1,138 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_PNG
+    LV_IMG_DECLARE(img_wink_png)
+#endif
+
+/*Different sources of the same PNG image. The cache compares the variables by address.*/
+static lv_img_dsc_t imgs[4];
+
+#define IMG_SIZE    (50 * 50 * LV_IMG_PX_SIZE_ALPHA_BYTE)
+
+#if LV_USE_PNG && LV_IMG_CACHE_DEF_SIZE
+static bool is_cached(const lv_img_dsc_t * img)
+{
+    lv_img_cache_stat_t stat_before;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_before);
+    _lv_img_cache_open(img, lv_color_black(), 0);
+    lv_img_cache_get_stat(&stat);
+    return stat.hit > stat_before.hit;
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_PNG
+    uint32_t i;
+    for(i = 0; i < 4; i++) imgs[i] = img_wink_png;
+#endif
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_reset_stat();
+}
+
+void tearDown(void)
+{
+    lv_img_cache_set_mem_size(LV_IMG_CACHE_MEM_SIZE);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_img_cache_hit(void)
+{
+#if LV_USE_PNG && LV_IMG_CACHE_DEF_SIZE
+    TEST_ASSERT_NOT_NULL(_lv_img_cache_open(&imgs[0], lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(_lv_img_cache_open(&imgs[0], lv_color_black(), 0));
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(IMG_SIZE, stat.size);
+
+    /*Images drawn from variables directly don't use memory*/
+    static const lv_color_t pixels[4];
+    lv_img_dsc_t raw;
+    lv_memset_00(&raw, sizeof(raw));
+    raw.header.cf = LV_IMG_CF_TRUE_COLOR;
+    raw.header.w = 2;
+    raw.header.h = 2;
+    raw.data_size = sizeof(pixels);
+    raw.data = (const uint8_t *)pixels;
+    TEST_ASSERT_NOT_NULL(_lv_img_cache_open(&raw, lv_color_black(), 0));
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(IMG_SIZE, stat.size);
+
+    lv_img_cache_invalidate_src(&imgs[0]);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+#endif
+}
+
+void test_img_cache_mem_budget_lru(void)
+{
+#if LV_USE_PNG && LV_IMG_CACHE_DEF_SIZE
+    lv_img_cache_set_mem_size(IMG_SIZE * 5 / 2);
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 0);
+    _lv_img_cache_open(&imgs[1], lv_color_black(), 0);
+    _lv_img_cache_open(&imgs[0], lv_color_black(), 0);
+
+    /*1 is the least recently used*/
+    _lv_img_cache_open(&imgs[2], lv_color_black(), 0);
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.evict);
+    TEST_ASSERT_EQUAL_UINT32(2 * IMG_SIZE, stat.size);
+    TEST_ASSERT_TRUE(is_cached(&imgs[0]));
+    TEST_ASSERT_TRUE(is_cached(&imgs[2]));
+    TEST_ASSERT_FALSE(is_cached(&imgs[1]));
+
+    /*Now 0 is the least recently used*/
+    TEST_ASSERT_FALSE(is_cached(&imgs[0]));
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(3, stat.evict);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(stat.max_size, stat.size);
+#endif
+}
+
+void test_img_cache_set_mem_size(void)
+{
+#if LV_USE_PNG && LV_IMG_CACHE_DEF_SIZE
+    lv_img_cache_set_mem_size(0);
+    uint32_t i;
+    for(i = 0; i < 4; i++) _lv_img_cache_open(&imgs[i], lv_color_black(), 0);
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(4 * IMG_SIZE, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.evict);
+
+    /*The most recently used ones are kept*/
+    lv_img_cache_set_mem_size(IMG_SIZE * 2);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2 * IMG_SIZE, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.entry_cnt);
+    TEST_ASSERT_TRUE(is_cached(&imgs[3]));
+    TEST_ASSERT_TRUE(is_cached(&imgs[2]));
+
+    /*An image larger than the budget is kept open alone to draw it*/
+    lv_img_cache_set_mem_size(IMG_SIZE / 2);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+    TEST_ASSERT_NOT_NULL(_lv_img_cache_open(&imgs[0], lv_color_black(), 0));
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(IMG_SIZE, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.entry_cnt);
+    _lv_img_cache_open(&imgs[1], lv_color_black(), 0);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(IMG_SIZE, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.entry_cnt);
+#endif
+}
+
+#endif
@@ -0,0 +1,329 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+
+static lv_obj_t * label;
+static lv_obj_t * ref;
+static lv_color_t ref_fb[FB_SIZE];
+static uint32_t rnd_state = 1;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) & 0x7fff;
+}
+
+static const lv_font_t * get_font(void)
+{
+#if LV_FONT_MONTSERRAT_24
+    return &lv_font_montserrat_24;
+#else
+    return LV_FONT_DEFAULT;
+#endif
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Draw the label's text like the label does but without its layout*/
+static void ref_draw_event_cb(lv_event_t * e)
+{
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    lv_label_t * l = (lv_label_t *)label;
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+    if(l->recolor) dsc.flag |= LV_TEXT_FLAG_RECOLOR;
+    if(lv_obj_get_style_width(label, LV_PART_MAIN) == LV_SIZE_CONTENT) dsc.flag |= LV_TEXT_FLAG_FIT;
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(label, &coords);
+    lv_draw_label(draw_ctx, &dsc, &coords, lv_label_get_text(label), NULL);
+}
+
+/*Render the label and the same text drawn without layout and compare them*/
+static void check_same_as_uncached(void)
+{
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(ref, LV_OBJ_FLAG_HIDDEN);
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_obj_clear_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(ref, LV_OBJ_FLAG_HIDDEN);
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void setUp(void)
+{
+    label = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(label, 10, 10);
+
+    ref = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(ref);
+    lv_obj_set_size(ref, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(ref, ref_draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_flag(ref, LV_OBJ_FLAG_HIDDEN);
+
+    lv_txt_layout_reset_stat();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_label_layout_size_same_as_txt_get_size(void)
+{
+    static const char * words[] = {"Lorem", "ipsum", "dolor", "25°C", "#ff0000 red#", "\n", "a", "\n\n", "longwordwithoutspaces"};
+    const lv_font_t * font = LV_FONT_DEFAULT;
+    lv_txt_layout_t layout;
+    _lv_txt_layout_init(&layout);
+
+    uint32_t step;
+    for(step = 0; step < 500; step++) {
+        char txt[256] = "";
+        uint32_t word_cnt = rnd() % 12;
+        uint32_t i;
+        for(i = 0; i < word_cnt; i++) {
+            strcat(txt, words[rnd() % (sizeof(words) / sizeof(words[0]))]);
+            if(rnd() % 2) strcat(txt, " ");
+        }
+
+        lv_coord_t max_w = rnd() % 3 == 0 ? LV_COORD_MAX : 20 + rnd() % 200;
+        lv_coord_t letter_space = rnd() % 4;
+        lv_coord_t line_space = rnd() % 6;
+        lv_text_flag_t flag = (rnd() % 2 ? LV_TEXT_FLAG_RECOLOR : 0) | (rnd() % 4 == 0 ? LV_TEXT_FLAG_EXPAND : 0);
+
+        TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, txt, font, letter_space, max_w, flag));
+
+        lv_point_t size_ref;
+        lv_point_t size;
+        lv_txt_get_size(&size_ref, txt, font, letter_space, line_space, max_w, flag);
+        _lv_txt_layout_get_size(&layout, line_space, &size);
+        TEST_ASSERT_EQUAL_INT32(size_ref.x, size.x);
+        TEST_ASSERT_EQUAL_INT32(size_ref.y, size.y);
+
+        /*The same lines as the draw would find*/
+        uint32_t line_start = 0;
+        uint32_t line_id = 0;
+        while(txt[line_start] != '\0') {
+            uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+            TEST_ASSERT_EQUAL_UINT32(line_start, layout.lines[line_id].start);
+            TEST_ASSERT_EQUAL_INT32(lv_txt_get_width(&txt[line_start], line_end - line_start, font, letter_space, flag),
+                                    layout.lines[line_id].width);
+            line_start = line_end;
+            line_id++;
+        }
+        TEST_ASSERT_EQUAL_UINT32(line_id, layout.line_cnt);
+    }
+
+    _lv_txt_layout_free(&layout);
+}
+
+void test_label_layout_cache_hit(void)
+{
+    lv_txt_layout_stat_t stat;
+
+    lv_label_set_text(label, "Servo Step Interval");
+    render();
+
+    /*Redraws and setting the same text again don't measure the text*/
+    lv_txt_layout_reset_stat();
+    render();
+    lv_label_set_text(label, "Servo Step Interval");
+    render();
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.hit_cnt);
+
+    /*A new text, font or width are measured again*/
+    lv_label_set_text(label, "Servo Offset");
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+
+    lv_obj_set_style_text_font(label, get_font(), 0);
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss_cnt);
+
+    /*The style change refreshes the text with the old width too*/
+    lv_obj_set_width(label, 60);
+    lv_obj_update_layout(label);
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3, stat.miss_cnt);
+
+    lv_txt_layout_reset_stat();
+    render();
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss_cnt);
+}
+
+void test_label_layout_compares_the_text(void)
+{
+    lv_txt_layout_stat_t stat;
+    lv_txt_layout_t layout;
+    _lv_txt_layout_init(&layout);
+
+    /*The layout keeps a copy of the text so a buffer changed in place is noticed*/
+    char buf[] = "Servo 12";
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, buf, get_font(), 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, buf, get_font(), 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    buf[6] = '4';
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, buf, get_font(), 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_TRUE(_lv_txt_layout_update(&layout, "Servo 4", get_font(), 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stat.miss_cnt);
+    _lv_txt_layout_free(&layout);
+
+    /*A static text modified without lv_label_set_text_static() is still drawn correctly.
+     *The label keeps its old size so the new text is made narrower to not to be clipped.*/
+    static char static_buf[] = "WWWW\nWWWW";
+    lv_label_set_text_static(label, static_buf);
+    render();
+    lv_memcpy(static_buf, "iiiiiiiii", 9);
+    lv_txt_layout_reset_stat();
+    check_same_as_uncached();
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+}
+
+void test_label_layout_font_changed(void)
+{
+    lv_txt_layout_stat_t stat;
+
+    lv_label_set_text(label, "Low Temp Timeout: 30 min");
+    render();
+    lv_txt_layout_reset_stat();
+    lv_txt_layout_invalidate_font(get_font());
+    render();
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+
+#if LV_USE_TINY_TTF
+    /*The glyphs of a TTF font change with its size while the font pointer stays the same*/
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 28);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_width(label, 300);
+    render();
+
+    lv_tiny_ttf_set_size(font, 20);
+    lv_txt_layout_reset_stat();
+    check_same_as_uncached();
+    lv_txt_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss_cnt);
+
+    lv_obj_clean(lv_scr_act());
+    lv_tiny_ttf_destroy(font);
+#endif
+}
+
+void test_label_layout_same_result(void)
+{
+    lv_label_set_text(label, "Low Temp Timeout: 30 min");
+    check_same_as_uncached();
+}
+
+void test_label_layout_same_result_wrap_and_align(void)
+{
+    lv_obj_set_width(label, 150);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_label_set_text(label, "A longer text which is wrapped into more lines\nand a new line\n");
+    check_same_as_uncached();
+
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_style_text_letter_space(label, 3, 0);
+    lv_obj_set_style_text_line_space(label, 5, 0);
+    check_same_as_uncached();
+}
+
+void test_label_layout_same_result_recolor_and_utf8(void)
+{
+    lv_obj_set_width(label, 120);
+    lv_obj_set_style_text_font(label, get_font(), 0);
+    lv_label_set_recolor(label, true);
+    lv_label_set_text(label, "Target: #ff0000 85°C# and #0000ff Ā ē ī#");
+    check_same_as_uncached();
+}
+
+void test_label_layout_same_result_clipped(void)
+{
+    /*Only the last lines are visible*/
+    lv_obj_set_width(label, 100);
+    lv_obj_set_y(label, -200);
+    lv_label_set_text(label, "1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n12\n13\n14\n15\n16\n17\n18\n19\n20");
+    check_same_as_uncached();
+}
+
+/*Not a check, prints the cost of redrawing the labels of the settings screen*/
+void test_label_layout_benchmark(void)
+{
+    static const char * names[] = {"Target Temp", "Min Temp", "Read Interval", "kP Value", "tauD Value",
+                                   "End Trigger", "Low Temp Timeout", "Servo Angle", "Servo Offset",
+                                   "Servo Step Interval", "Time Update", "Warning Temp"
+                                  };
+    static const char * values[] = {"85°C", "40°C", "5.0 s", "10", "50", "45", "30 min", "90°", "0°", "20 ms",
+                                    "60 s", "95°C"
+                                   };
+    const uint32_t rep = 1000;
+
+    lv_obj_del(label);
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        lv_obj_t * name = lv_label_create(cont);
+        lv_obj_set_style_text_font(name, get_font(), 0);
+        lv_obj_set_width(name, 280);
+        lv_label_set_text(name, names[i]);
+        lv_obj_t * value = lv_label_create(cont);
+        lv_obj_set_style_text_font(value, get_font(), 0);
+        lv_obj_set_width(value, 80);
+        lv_obj_set_style_text_align(value, LV_TEXT_ALIGN_RIGHT, 0);
+        lv_label_set_text(value, values[i]);
+    }
+
+    render();
+    lv_txt_layout_reset_stat();
+
+    /*Redraw only the labels*/
+    clock_t t0 = clock();
+    uint32_t r;
+    for(r = 0; r < rep; r++) {
+        for(i = 0; i < lv_obj_get_child_cnt(cont); i++) lv_obj_invalidate(lv_obj_get_child(cont, i));
+        lv_refr_now(NULL);
+    }
+    double t_redraw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    /*Set the same values again like the periodic updates do*/
+    t0 = clock();
+    for(r = 0; r < rep; r++) {
+        for(i = 1; i < lv_obj_get_child_cnt(cont); i += 2) lv_label_set_text(lv_obj_get_child(cont, i), values[i / 2]);
+        lv_refr_now(NULL);
+    }
+    double t_update = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    lv_txt_layout_stat_t stat;
+    lv_txt_layout_get_stat(&stat);
+    printf("label layout: %" LV_PRIu32 " redraws of 24 settings labels in %.3f s, %" LV_PRIu32
+           " updates of 12 values in %.3f s, hit: %" LV_PRIu32 ", miss: %" LV_PRIu32 "\n",
+           rep, t_redraw, rep, t_update, stat.hit_cnt, stat.miss_cnt);
+}
+
+#endif
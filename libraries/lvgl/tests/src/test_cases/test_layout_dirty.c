@@ -0,0 +1,279 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+static uint32_t rnd_state = 1;
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 16) & 0x7fff;
+}
+
+/*A flex column of `cnt` rows like the settings screen: a label and a slider in each row*/
+static lv_obj_t * create_list(lv_obj_t * parent, uint32_t cnt)
+{
+    lv_obj_t * list = lv_obj_create(parent);
+    lv_obj_set_size(list, 300, 400);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * row = lv_obj_create(list);
+        lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+        lv_obj_t * slider = lv_slider_create(row);
+        lv_obj_set_flex_grow(slider, 1);
+    }
+
+    return list;
+}
+
+static void mark_all_dirty(lv_obj_t * obj)
+{
+    lv_obj_mark_layout_as_dirty(obj);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) mark_all_dirty(lv_obj_get_child(obj, i));
+}
+
+static uint32_t save_coords(lv_obj_t * obj, lv_area_t * buf, uint32_t id)
+{
+    if(buf) buf[id] = obj->coords;
+    id++;
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) id = save_coords(lv_obj_get_child(obj, i), buf, id);
+    return id;
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_layout_dirty_visits_only_the_changed_path(void)
+{
+    lv_obj_t * list = create_list(lv_scr_act(), 200);
+    lv_obj_t * other = create_list(lv_scr_act(), 50);
+    lv_obj_set_x(other, 400);
+    lv_obj_update_layout(lv_scr_act());
+
+    /*The new text changes the label's size so the row and the list are laid out again*/
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(list, 10), 0);
+    lv_obj_t * row11 = lv_obj_get_child(list, 11);
+    lv_coord_t row11_y = row11->coords.y1;
+    lv_obj_layout_reset_stat();
+    lv_label_set_text(label, "A longer text\nin two lines");
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(20, stat.visit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(4, stat.layout_cnt);
+    TEST_ASSERT_GREATER_THAN_INT32(row11_y, row11->coords.y1);
+
+    /*Nothing is dirty: no walks at all*/
+    lv_obj_layout_reset_stat();
+    lv_obj_update_layout(lv_scr_act());
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.pass_cnt);
+}
+
+void test_layout_dirty_move_skips_the_layout(void)
+{
+    lv_obj_t * list = create_list(lv_scr_act(), 50);
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_t * slider = lv_obj_get_child(lv_obj_get_child(list, 20), 1);
+    lv_coord_t slider_x = slider->coords.x1;
+    lv_coord_t slider_w = lv_obj_get_width(slider);
+
+    lv_obj_layout_reset_stat();
+    lv_obj_set_pos(list, 50, 30);
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_layout_stat_t stat;
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.layout_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.refr_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stat.pos_refr_cnt);
+    TEST_ASSERT_EQUAL_INT32(slider_x + 50, slider->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(slider_w, lv_obj_get_width(slider));
+
+    /*Moving a layout positioned item with x/y does nothing*/
+    lv_obj_t * row = lv_obj_get_child(list, 5);
+    lv_area_t row_coords = row->coords;
+    lv_obj_layout_reset_stat();
+    lv_obj_set_x(row, 100);
+    lv_obj_update_layout(lv_scr_act());
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.layout_cnt);
+    TEST_ASSERT_EQUAL_INT32(row_coords.x1, row->coords.x1);
+
+    /*But the layout applies the translation*/
+    lv_obj_set_style_translate_x(row, 7, 0);
+    lv_obj_update_layout(lv_scr_act());
+    TEST_ASSERT_EQUAL_INT32(row_coords.x1 + 7, row->coords.x1);
+}
+
+void test_layout_dirty_parent_resize(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 200, 200);
+
+    lv_obj_t * pct = lv_obj_create(cont);
+    lv_obj_set_size(pct, lv_pct(50), 20);
+
+    lv_obj_t * fixed = create_list(cont, 10);
+    lv_obj_set_size(fixed, 100, 100);
+    lv_obj_align(fixed, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_layout_reset_stat();
+    lv_obj_set_size(cont, 300, 250);
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_area_t content;
+    lv_obj_get_content_coords(cont, &content);
+    TEST_ASSERT_EQUAL_INT32(lv_area_get_width(&content) / 2, lv_obj_get_width(pct));
+    TEST_ASSERT_EQUAL_INT32(content.x2, fixed->coords.x2);
+    TEST_ASSERT_EQUAL_INT32(content.y2, fixed->coords.y2);
+
+    /*The list kept its size so its rows weren't laid out again*/
+    lv_obj_layout_stat_t stat;
+    lv_obj_layout_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.layout_cnt);
+}
+
+/*Random changes updated incrementally must give the same coordinates as a full update*/
+void test_layout_dirty_same_as_full_update(void)
+{
+    lv_obj_t * list = create_list(lv_scr_act(), 40);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_ROW_WRAP);
+
+    static lv_style_t style_row;
+    lv_style_init(&style_row);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(list); i++) lv_obj_add_style(lv_obj_get_child(list, i), &style_row, 0);
+
+    lv_obj_t * grid = lv_obj_create(lv_scr_act());
+    static lv_coord_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_FR(1), 60, LV_GRID_TEMPLATE_LAST};
+    static lv_coord_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+    lv_obj_set_size(grid, 350, LV_SIZE_CONTENT);
+    lv_obj_set_pos(grid, 420, 10);
+    for(i = 0; i < 9; i++) {
+        lv_obj_t * label = lv_label_create(grid);
+        lv_label_set_text(label, "cell");
+        lv_obj_set_grid_cell(label, LV_GRID_ALIGN_STRETCH, i % 3, 1, LV_GRID_ALIGN_CENTER, i / 3, 1);
+    }
+
+    uint32_t obj_cnt = save_coords(lv_scr_act(), NULL, 0);
+    lv_area_t * incr = lv_mem_alloc(obj_cnt * sizeof(lv_area_t));
+    lv_area_t * full = lv_mem_alloc(obj_cnt * sizeof(lv_area_t));
+    TEST_ASSERT_NOT_NULL(incr);
+    TEST_ASSERT_NOT_NULL(full);
+
+    uint32_t step;
+    for(step = 0; step < 300; step++) {
+        lv_obj_t * parent = rnd() % 2 ? list : grid;
+        lv_obj_t * obj = lv_obj_get_child(parent, rnd() % lv_obj_get_child_cnt(parent));
+        if(parent == list && rnd() % 2) obj = lv_obj_get_child(obj, 0);     /*The label of a row*/
+
+        switch(rnd() % 8) {
+            case 0:
+                if(lv_obj_check_type(obj, &lv_label_class)) lv_label_set_text(obj, rnd() % 2 ? "x" : "longer text");
+                break;
+            case 1:
+                lv_obj_set_width(obj, 20 + rnd() % 100);
+                break;
+            case 2:
+                lv_obj_set_pos(obj, rnd() % 50, rnd() % 50);
+                break;
+            case 3:
+                if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+                else lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+                break;
+            case 4:
+                lv_obj_set_style_translate_y(obj, rnd() % 10, 0);
+                break;
+            case 5:
+                lv_obj_set_size(parent, 300 + rnd() % 100, rnd() % 2 ? LV_SIZE_CONTENT : 300 + rnd() % 100);
+                break;
+            case 6:
+                lv_obj_set_style_pad_all(parent, rnd() % 10, 0);
+                break;
+            case 7:
+                /*Shared style of the rows*/
+                lv_style_set_pad_all(&style_row, rnd() % 10);
+                lv_obj_report_style_change(&style_row);
+                break;
+        }
+
+        lv_obj_update_layout(lv_scr_act());
+        save_coords(lv_scr_act(), incr, 0);
+
+        mark_all_dirty(lv_scr_act());
+        lv_obj_update_layout(lv_scr_act());
+        save_coords(lv_scr_act(), full, 0);
+
+        for(i = 0; i < obj_cnt; i++) {
+            if(!_lv_area_is_equal(&incr[i], &full[i])) {
+                char msg[64];
+                lv_snprintf(msg, sizeof(msg), "step %" LV_PRIu32 ", object %" LV_PRIu32, step, i);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+
+    lv_mem_free(incr);
+    lv_mem_free(full);
+    lv_style_reset(&style_row);
+}
+
+/*Not a check, prints the cost of changing a label and moving the list in a 200 item list*/
+void test_layout_dirty_benchmark(void)
+{
+    const uint32_t rep = 2000;
+    lv_obj_t * list = create_list(lv_scr_act(), 200);
+    lv_obj_update_layout(lv_scr_act());
+
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(list, 100), 0);
+    lv_obj_layout_reset_stat();
+    clock_t t0 = clock();
+    uint32_t i;
+    for(i = 0; i < rep; i++) {
+        lv_label_set_text(label, i % 2 ? "Value: 10" : "Value: 100");
+        lv_obj_update_layout(lv_scr_act());
+    }
+    double t_text = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    lv_obj_layout_stat_t stat_text;
+    lv_obj_layout_get_stat(&stat_text);
+
+    lv_obj_layout_reset_stat();
+    t0 = clock();
+    for(i = 0; i < rep; i++) {
+        lv_obj_set_y(list, i % 2 ? 10 : 0);
+        lv_obj_update_layout(lv_scr_act());
+    }
+    double t_move = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    lv_obj_layout_stat_t stat_move;
+    lv_obj_layout_get_stat(&stat_move);
+
+    printf("layout 200 rows: %" LV_PRIu32 " label changes in %.3f s (%" LV_PRIu32 " passes, %" LV_PRIu32
+           " visits, %" LV_PRIu32 " layouts / change), %" LV_PRIu32 " list moves in %.3f s (%" LV_PRIu32 " visits, %"
+           LV_PRIu32 " layouts / move)\n",
+           rep, t_text, stat_text.pass_cnt / rep, stat_text.visit_cnt / rep, stat_text.layout_cnt / rep,
+           rep, t_move, stat_move.visit_cnt / rep, stat_move.layout_cnt / rep);
+}
+
+#endif
@@ -0,0 +1,232 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../../src/misc/lv_mem_slab.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SLOT_CNT    2000
+
+static void * slots[SLOT_CNT];
+
+/*Sizes like the allocations of LVGL: event descriptors, styles, objects, children arrays and some larger buffers*/
+static size_t get_size(uint32_t * seed)
+{
+    static const uint16_t sizes[] = {12, 16, 24, 40, 56, 64, 88, 96, 120, 180, 240, 600};
+    *seed = *seed * 1103515245 + 12345;
+    return sizes[(*seed >> 16) % (sizeof(sizes) / sizeof(sizes[0]))];
+}
+
+static void dummy_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+void setUp(void)
+{
+    lv_memset_00(slots, sizeof(slots));
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < SLOT_CNT; i++) lv_mem_free(slots[i]);
+}
+
+void test_mem_slab_size_classes(void)
+{
+#if LV_MEM_SLAB_SIZE
+    slots[0] = lv_mem_alloc(1);
+    slots[1] = lv_mem_alloc(100);
+    slots[2] = lv_mem_alloc(LV_MEM_SLAB_MAX_SIZE);
+    slots[3] = lv_mem_alloc(LV_MEM_SLAB_MAX_SIZE + 1);
+    TEST_ASSERT_EQUAL(8, _lv_mem_slab_get_size(slots[0]));
+    TEST_ASSERT_EQUAL(128, _lv_mem_slab_get_size(slots[1]));
+    TEST_ASSERT_EQUAL(LV_MEM_SLAB_MAX_SIZE, _lv_mem_slab_get_size(slots[2]));
+    TEST_ASSERT_EQUAL(0, _lv_mem_slab_get_size(slots[3]));
+    TEST_ASSERT_EQUAL(0, (lv_uintptr_t)slots[1] & 0x7);
+
+    /*The freed slot is used again*/
+    void * p = slots[1];
+    lv_mem_free(slots[1]);
+    slots[1] = lv_mem_alloc(97);
+    TEST_ASSERT_EQUAL_PTR(p, slots[1]);
+#endif
+}
+
+void test_mem_slab_realloc(void)
+{
+#if LV_MEM_SLAB_SIZE
+    uint8_t * p = lv_mem_alloc(20);
+    uint32_t i;
+    for(i = 0; i < 20; i++) p[i] = (uint8_t)i;
+
+    /*Stays in the slot while it fits*/
+    TEST_ASSERT_EQUAL_PTR(p, lv_mem_realloc(p, 24));
+
+    p = lv_mem_realloc(p, 60);
+    TEST_ASSERT_EQUAL(64, _lv_mem_slab_get_size(p));
+    for(i = 0; i < 20; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+
+    /*Out of the arena*/
+    p = lv_mem_realloc(p, 1000);
+    TEST_ASSERT_EQUAL(0, _lv_mem_slab_get_size(p));
+    for(i = 0; i < 20; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+    slots[0] = p;
+#endif
+}
+
+void test_mem_slab_full_arena(void)
+{
+#if LV_MEM_SLAB_SIZE
+    lv_mem_monitor_t mon_start;
+    lv_memset_00(&mon_start, sizeof(mon_start));
+    _lv_mem_slab_monitor(&mon_start);
+
+    /*Fill the arena, the rest goes to the other allocator*/
+    uint32_t in_arena = 0;
+    uint32_t i;
+    for(i = 0; i < SLOT_CNT; i++) {
+        slots[i] = lv_mem_alloc(64);
+        TEST_ASSERT_NOT_NULL(slots[i]);
+        if(_lv_mem_slab_get_size(slots[i])) in_arena++;
+    }
+    TEST_ASSERT_LESS_THAN(SLOT_CNT, in_arena);
+    TEST_ASSERT_GREATER_OR_EQUAL(mon_start.free_biggest_size / 64, in_arena);
+
+    lv_mem_monitor_t mon;
+    lv_memset_00(&mon, sizeof(mon));
+    _lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.free_biggest_size);
+
+    /*Every second slot is freed: only 64 byte allocations can use them*/
+    for(i = 0; i < SLOT_CNT; i += 2) {
+        lv_mem_free(slots[i]);
+        slots[i] = NULL;
+    }
+    lv_memset_00(&mon, sizeof(mon));
+    _lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(0, mon.free_biggest_size);
+    TEST_ASSERT_GREATER_OR_EQUAL(in_arena / 2 * 64, mon.free_size);
+
+    for(i = 1; i < SLOT_CNT; i += 2) {
+        lv_mem_free(slots[i]);
+        slots[i] = NULL;
+    }
+    lv_memset_00(&mon, sizeof(mon));
+    _lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(in_arena * 64, mon.max_used);
+#endif
+}
+
+void test_mem_slab_random(void)
+{
+    uint32_t seed = 0x1234;
+    uint32_t i;
+    for(i = 0; i < 100000; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t id = (seed >> 8) % SLOT_CNT;
+        if(slots[id]) {
+            /*Check that nobody overwrote it*/
+            uint8_t * p = slots[id];
+            TEST_ASSERT_EQUAL_UINT8((uint8_t)id, p[0]);
+            TEST_ASSERT_EQUAL_UINT8((uint8_t)(id >> 8), p[11]);
+            lv_mem_free(slots[id]);
+            slots[id] = NULL;
+        }
+        else {
+            uint8_t * p = lv_mem_alloc(get_size(&seed));
+            TEST_ASSERT_NOT_NULL(p);
+            p[0] = (uint8_t)id;
+            p[11] = (uint8_t)(id >> 8);
+            slots[id] = p;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+/*Not a check, prints the speed of the allocations compared to the system heap on the machine running the tests*/
+void test_mem_slab_benchmark_latency(void)
+{
+    const uint32_t rep = 2000000;
+    uint32_t a;
+    for(a = 0; a < 2; a++) {
+        uint32_t seed = 0x1234;
+        clock_t t0 = clock();
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            seed = seed * 1103515245 + 12345;
+            uint32_t id = (seed >> 8) % SLOT_CNT;
+            if(slots[id]) {
+                if(a) free(slots[id]);
+                else lv_mem_free(slots[id]);
+                slots[id] = NULL;
+            }
+            else {
+                size_t size = get_size(&seed);
+                slots[id] = a ? malloc(size) : lv_mem_alloc(size);
+            }
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        for(i = 0; i < SLOT_CNT; i++) {
+            if(a) free(slots[i]);
+            else lv_mem_free(slots[i]);
+            slots[i] = NULL;
+        }
+
+        printf("%s: %" LV_PRIu32 " allocations and frees in %.3f s\n", a ? "malloc/free" : "lv_mem_alloc/lv_mem_free",
+               rep, t);
+    }
+}
+
+/*Not a check, prints the state of the memory after creating and deleting widgets for a while*/
+void test_mem_slab_benchmark_fragmentation(void)
+{
+    lv_obj_t * conts[16];
+    lv_memset_00(conts, sizeof(conts));
+
+    uint32_t seed = 0x1234;
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t id = (seed >> 16) % 16;
+        if(conts[id]) {
+            lv_obj_del(conts[id]);
+            conts[id] = NULL;
+        }
+        else {
+            conts[id] = lv_obj_create(lv_scr_act());
+            uint32_t j;
+            for(j = 0; j < 8; j++) {
+                lv_obj_t * label = lv_label_create(conts[id]);
+                lv_label_set_text_fmt(label, "Label %" LV_PRIu32, j);
+                lv_obj_t * slider = lv_slider_create(conts[id]);
+                lv_obj_add_event_cb(slider, dummy_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+            }
+        }
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("all lv_mem: used: %" LV_PRIu32 " bytes (%d %%), peak: %" LV_PRIu32 " bytes, frag: %d %%\n",
+           mon.total_size - mon.free_size, mon.used_pct, mon.max_used, mon.frag_pct);
+
+#if LV_MEM_SLAB_SIZE
+    lv_memset_00(&mon, sizeof(mon));
+    _lv_mem_slab_monitor(&mon);
+    printf("slab arena: used: %" LV_PRIu32 " of %" LV_PRIu32 " bytes in %" LV_PRIu32 " slots, peak: %" LV_PRIu32
+           " bytes, free in partially used pages: %" LV_PRIu32 " bytes\n",
+           mon.total_size - mon.free_size, mon.total_size, mon.used_cnt, mon.max_used,
+           mon.free_size - mon.free_biggest_size);
+#endif
+
+    lv_obj_clean(lv_scr_act());
+}
+
+#endif
@@ -0,0 +1,200 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+static lv_style_t style_shared;
+static lv_style_t style_pressed;
+
+/*Read every property of some parts with and without the cache and compare them*/
+static void check_same_as_uncached(lv_obj_t * obj)
+{
+    const lv_part_t parts[] = {LV_PART_MAIN, LV_PART_INDICATOR, LV_PART_KNOB, LV_PART_SCROLLBAR};
+    uint32_t p;
+    uint32_t prop;
+    for(p = 0; p < sizeof(parts) / sizeof(parts[0]); p++) {
+        for(prop = 1; prop < _LV_STYLE_NUM_BUILT_IN_PROPS; prop++) {
+            lv_obj_enable_style_cache(false);
+            lv_style_value_t ref = lv_obj_get_style_prop(obj, parts[p], prop);
+            lv_obj_enable_style_cache(true);
+            lv_style_value_t v = lv_obj_get_style_prop(obj, parts[p], prop);
+            TEST_ASSERT_EQUAL_INT32(ref.num, v.num);
+
+            /*From the cache*/
+            v = lv_obj_get_style_prop(obj, parts[p], prop);
+            TEST_ASSERT_EQUAL_INT32(ref.num, v.num);
+        }
+    }
+}
+
+void setUp(void)
+{
+    lv_style_init(&style_shared);
+    lv_style_set_bg_color(&style_shared, lv_palette_main(LV_PALETTE_RED));
+    lv_style_set_radius(&style_shared, 7);
+
+    lv_style_init(&style_pressed);
+    lv_style_set_bg_color(&style_pressed, lv_palette_main(LV_PALETTE_BLUE));
+    lv_style_set_border_width(&style_pressed, 3);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_style_reset(&style_shared);
+    lv_style_reset(&style_pressed);
+    lv_obj_enable_style_cache(true);
+    lv_obj_style_cache_reset_stat();
+}
+
+void test_obj_style_cache_hit(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_style_cache_stat_t stat;
+
+    lv_coord_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_obj_style_cache_reset_stat();
+    TEST_ASSERT_EQUAL(radius, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss);
+
+    /*Not cached while disabled*/
+    lv_obj_enable_style_cache(false);
+    lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_obj_style_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss);
+#endif
+}
+
+void test_obj_style_cache_state_change(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_add_style(obj, &style_shared, 0);
+    lv_obj_add_style(obj, &style_pressed, LV_STATE_PRESSED);
+    check_same_as_uncached(obj);
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_palette_main(LV_PALETTE_BLUE), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj, LV_PART_MAIN));
+    check_same_as_uncached(obj);
+
+    lv_obj_clear_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_palette_main(LV_PALETTE_RED), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    check_same_as_uncached(obj);
+}
+
+void test_obj_style_cache_style_change(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    TEST_ASSERT_NOT_EQUAL(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_add_style(obj, &style_shared, 0);
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Changing a shared style without reporting it is visible too*/
+    lv_style_set_radius(&style_shared, 11);
+    TEST_ASSERT_EQUAL(11, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_set_style_radius(obj, 13, 0);
+    TEST_ASSERT_EQUAL(13, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    check_same_as_uncached(obj);
+
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_RADIUS, 0);
+    TEST_ASSERT_EQUAL(11, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style(obj, &style_shared, 0);
+    TEST_ASSERT_NOT_EQUAL(11, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    check_same_as_uncached(obj);
+}
+
+void test_obj_style_cache_inherit(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * label = lv_label_create(parent);
+    lv_obj_get_style_text_color(label, LV_PART_MAIN);
+
+    lv_obj_set_style_text_color(parent, lv_palette_main(LV_PALETTE_GREEN), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_palette_main(LV_PALETTE_GREEN), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    check_same_as_uncached(label);
+}
+
+void test_obj_style_cache_widgets(void)
+{
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_set_style_bg_color(slider, lv_color_hex(0x0088FF), LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+    check_same_as_uncached(slider);
+
+    lv_obj_add_state(slider, LV_STATE_FOCUSED | LV_STATE_PRESSED);
+    check_same_as_uncached(slider);
+}
+
+/*Not a check, prints the gain of the cache on the machine running the tests.
+ *The objects are like on the settings screen of the thermostat: a tabview with sliders and labels.*/
+void test_obj_style_cache_benchmark(void)
+{
+    lv_obj_t * tabview = lv_tabview_create(lv_scr_act(), LV_DIR_LEFT, 80);
+    lv_obj_set_size(tabview, 290, 380);
+    lv_obj_set_pos(tabview, 0, 70);
+
+    uint32_t t;
+    for(t = 0; t < 6; t++) {
+        lv_obj_t * tab = lv_tabview_add_tab(tabview, "Tab");
+        uint32_t i;
+        for(i = 0; i < 4; i++) {
+            lv_obj_t * label = lv_label_create(tab);
+            lv_label_set_text(label, "Target Temp");
+            lv_obj_align(label, LV_ALIGN_TOP_LEFT, 10, 10 + i * 70);
+
+            lv_obj_t * slider = lv_slider_create(tab);
+            lv_obj_set_size(slider, 120, 20);
+            lv_obj_align(slider, LV_ALIGN_TOP_LEFT, 10, 40 + i * 70);
+            lv_slider_set_value(slider, 30 + i * 10, LV_ANIM_OFF);
+            lv_obj_set_style_bg_color(slider, lv_color_hex(0x0088FF), LV_PART_INDICATOR);
+
+            lv_obj_t * value = lv_label_create(tab);
+            lv_label_set_text_fmt(value, "%d", (int)i);
+            lv_obj_align(value, LV_ALIGN_TOP_LEFT, 140, 40 + i * 70);
+        }
+    }
+
+    /*A small area is dominated by the walking of the objects and the style lookups in `refr_obj()`*/
+    lv_area_t small_area = {150, 120, 153, 123};
+    const uint32_t rep = 200;
+    uint32_t en;
+    for(en = 0; en < 2; en++) {
+        lv_obj_enable_style_cache(en);
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+        lv_obj_style_cache_reset_stat();
+
+        clock_t t0 = clock();
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        double time_full = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        t0 = clock();
+        for(i = 0; i < rep * 10; i++) {
+            _lv_inv_area(lv_disp_get_default(), &small_area);
+            lv_refr_now(NULL);
+        }
+        double time_small = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        lv_obj_style_cache_stat_t stat;
+        lv_obj_style_cache_get_stat(&stat);
+        uint32_t total = stat.hit + stat.miss;
+        printf("style cache %s: %" LV_PRIu32 " full screen redraws in %.3f s, %" LV_PRIu32 " small redraws in %.3f s, "
+               "hit rate: %" LV_PRIu32 "%%\n", en ? "on" : "off", rep, time_full, rep * 10, time_small,
+               total ? (uint32_t)((uint64_t)stat.hit * 100 / total) : 0);
+    }
+}
+
+#endif
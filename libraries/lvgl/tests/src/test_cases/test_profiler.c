@@ -0,0 +1,303 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_PROFILER
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TRACE_MAX   (LV_PROFILER_BUF_SIZE * 96 + 1024)
+
+static char trace[TRACE_MAX];
+static uint32_t trace_len;
+
+static void trace_write_cb(const char * buf, uint32_t len, void * user_data)
+{
+    LV_UNUSED(user_data);
+    TEST_ASSERT_LESS_THAN_UINT32(TRACE_MAX, trace_len + len);
+    memcpy(trace + trace_len, buf, len);
+    trace_len += len;
+    trace[trace_len] = '\0';
+}
+
+static uint32_t dump(void)
+{
+    trace_len = 0;
+    trace[0] = '\0';
+    return lv_profiler_dump(trace_write_cb, NULL);
+}
+
+static void create_widgets(void)
+{
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Profiled");
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_align(slider, LV_ALIGN_CENTER, 0, 50);
+}
+
+/*Check that every span is closed on its track and the time stamps grow on the main thread*/
+static void check_balanced(void)
+{
+    int depth[256] = {0};
+    uint32_t last_us = 0;
+    uint32_t last_ns = 0;
+    const char * p = strstr(trace, "{\"name\":");
+    while(p) {
+        char name[64];
+        char ph;
+        unsigned int us;
+        unsigned int ns;
+        int tid;
+        if(sscanf(p, "{\"name\":\"%63[^\"]\",\"ph\":\"%c\",\"ts\":%u.%u,\"pid\":0,\"tid\":%d}",
+                  name, &ph, &us, &ns, &tid) == 5) {
+            TEST_ASSERT_TRUE(tid >= 0 && tid < 256);
+            if(ph == 'B') depth[tid]++;
+            else if(ph == 'E') depth[tid]--;
+            else TEST_FAIL_MESSAGE("unknown phase");
+            TEST_ASSERT_GREATER_OR_EQUAL_INT(0, depth[tid]);
+
+            if(tid == 0) {
+                TEST_ASSERT_TRUE(us > last_us || (us == last_us && ns >= last_ns));
+                last_us = us;
+                last_ns = ns;
+            }
+        }
+        p = strstr(p + 1, "{\"name\":");
+    }
+
+    uint32_t i;
+    for(i = 0; i < 256; i++) TEST_ASSERT_EQUAL_INT(0, depth[i]);
+}
+
+#endif
+
+void setUp(void)
+{
+#if LV_USE_PROFILER
+    lv_profiler_enable(true);
+    lv_profiler_reset();
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_PROFILER
+    lv_profiler_enable(true);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_profiler_redraw_trace(void)
+{
+#if LV_USE_PROFILER
+    create_widgets();
+    lv_refr_now(NULL);
+
+    lv_profiler_reset();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_profiler_stat_t stat;
+    lv_profiler_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(LV_PROFILER_BUF_SIZE, stat.size);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.overwritten);
+    TEST_ASSERT_GREATER_THAN_UINT32(10, stat.recorded);
+
+    TEST_ASSERT_EQUAL_UINT32(stat.recorded, dump());
+    TEST_ASSERT_EQUAL_CHAR('[', trace[0]);
+    TEST_ASSERT_EQUAL_STRING("\n]\n", trace + trace_len - 3);
+
+    /*The stages of the rendering*/
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"_lv_disp_refr_timer\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"layout\",\"ph\":\"E\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"refr_invalid_areas\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"lv_draw_sw_blend\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"flush_cb\",\"ph\":\"B\""));
+
+    /*The widgets by their types*/
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"obj\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"btn\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"label\",\"ph\":\"B\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"slider\",\"ph\":\"E\""));
+
+    /*The flushing on its own named track*/
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"flush\",\"ph\":\"E\""));
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "\"tid\":%d,\"args\":{\"name\":\"flush\"}}", LV_PROFILER_TRACK_FLUSH);
+    TEST_ASSERT_NOT_NULL(strstr(trace, buf));
+
+    check_balanced();
+#endif
+}
+
+void test_profiler_timer_handler(void)
+{
+#if LV_USE_PROFILER
+    create_widgets();
+    lv_obj_invalidate(lv_scr_act());
+    lv_profiler_reset();
+
+    /*The display refresh timer runs inside lv_timer_handler()*/
+    lv_timer_t * refr_timer = lv_disp_get_default()->refr_timer;
+    lv_timer_ready(refr_timer);
+    lv_timer_handler();
+
+    dump();
+    const char * handler = strstr(trace, "{\"name\":\"lv_timer_handler\",\"ph\":\"B\"");
+    const char * refr = strstr(trace, "{\"name\":\"_lv_disp_refr_timer\",\"ph\":\"B\"");
+    TEST_ASSERT_NOT_NULL(handler);
+    TEST_ASSERT_NOT_NULL(refr);
+    TEST_ASSERT_TRUE(handler < refr);
+    TEST_ASSERT_NOT_NULL(strstr(refr, "{\"name\":\"lv_timer_handler\",\"ph\":\"E\""));
+
+    check_balanced();
+#endif
+}
+
+void test_profiler_disable(void)
+{
+#if LV_USE_PROFILER
+    create_widgets();
+    lv_profiler_enable(false);
+    TEST_ASSERT_FALSE(lv_profiler_is_enabled());
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_profiler_stat_t stat;
+    lv_profiler_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.recorded);
+    TEST_ASSERT_EQUAL_UINT32(0, dump());
+    TEST_ASSERT_NOT_NULL(strstr(trace, "[\n{\"name\":\"thread_name\""));
+
+    /*Dumping doesn't enable the recording*/
+    TEST_ASSERT_FALSE(lv_profiler_is_enabled());
+#endif
+}
+
+void test_profiler_overwrite_oldest(void)
+{
+#if LV_USE_PROFILER
+    uint32_t i;
+    for(i = 0; i < LV_PROFILER_BUF_SIZE + 10; i++) {
+        lv_profiler_add(i < 10 ? "old" : "new", i % 2 ? 'E' : 'B', 0);
+    }
+
+    lv_profiler_stat_t stat;
+    lv_profiler_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(LV_PROFILER_BUF_SIZE + 10, stat.recorded);
+    TEST_ASSERT_EQUAL_UINT32(10, stat.overwritten);
+
+    TEST_ASSERT_EQUAL_UINT32(LV_PROFILER_BUF_SIZE, dump());
+    TEST_ASSERT_NULL(strstr(trace, "\"old\""));
+    TEST_ASSERT_NOT_NULL(strstr(trace, "{\"name\":\"new\",\"ph\":\"B\",\"ts\":0."));
+
+    check_balanced();
+#endif
+}
+
+void test_profiler_track_name(void)
+{
+#if LV_USE_PROFILER
+    lv_profiler_set_track_name(LV_PROFILER_TRACK_USER, "panel");
+    LV_PROFILER_BEGIN_TRACK("transfer", LV_PROFILER_TRACK_USER);
+    LV_PROFILER_END_TRACK("transfer", LV_PROFILER_TRACK_USER);
+
+    TEST_ASSERT_EQUAL_UINT32(2, dump());
+
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "\"tid\":%d,\"args\":{\"name\":\"panel\"}}", LV_PROFILER_TRACK_USER);
+    TEST_ASSERT_NOT_NULL(strstr(trace, buf));
+    lv_snprintf(buf, sizeof(buf), "{\"name\":\"transfer\",\"ph\":\"B\",\"ts\":0.000,\"pid\":0,\"tid\":%d}",
+                LV_PROFILER_TRACK_USER);
+    TEST_ASSERT_NOT_NULL(strstr(trace, buf));
+#endif
+}
+
+void test_profiler_dump_to_file(void)
+{
+#if LV_USE_PROFILER && LV_USE_FS_POSIX
+    create_widgets();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    dump();
+
+    char path[64];
+    lv_snprintf(path, sizeof(path), "%c:/tmp/lv_profiler_%d.json", LV_FS_POSIX_LETTER, (int)getpid());
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_profiler_dump_to_file(path));
+
+    FILE * f = fopen(path + 2, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    static char file_trace[TRACE_MAX];
+    size_t len = fread(file_trace, 1, sizeof(file_trace), f);
+    fclose(f);
+    remove(path + 2);
+
+    TEST_ASSERT_EQUAL_UINT32(trace_len, len);
+    TEST_ASSERT_EQUAL_MEMORY(trace, file_trace, len);
+
+    TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, lv_profiler_dump_to_file("Z:/no/such/drive.json"));
+#endif
+}
+
+/*Not a check, prints the cost of recording the events*/
+void test_profiler_benchmark(void)
+{
+#if LV_USE_PROFILER
+    const uint32_t rep = 200;
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Value %d", (int)i);
+    }
+    lv_refr_now(NULL);
+
+    double t_on = 1e9;
+    double t_off = 1e9;
+    uint32_t events = 0;
+    uint32_t r;
+    for(r = 0; r < 3; r++) {
+        lv_profiler_enable(false);
+        clock_t t0 = clock();
+        for(i = 0; i < rep; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        if(t < t_off) t_off = t;
+
+        lv_profiler_enable(true);
+        lv_profiler_reset();
+        t0 = clock();
+        for(i = 0; i < rep; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        if(t < t_on) t_on = t;
+
+        lv_profiler_stat_t stat;
+        lv_profiler_get_stat(&stat);
+        events = stat.recorded / rep;
+    }
+
+    const uint32_t add_cnt = 1000000;
+    clock_t t0 = clock();
+    for(i = 0; i < add_cnt; i++) lv_profiler_add("bench", i % 2 ? 'E' : 'B', 0);
+    double t_add = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("profiler: %" LV_PRIu32 " full screen redraws, not recording: %.3f s, recording %" LV_PRIu32
+           " events/frame: %.3f s; %.1f ns/event\n", rep, t_off, events, t_on, t_add * 1e9 / add_cnt);
+
+    lv_obj_del(cont);
+#endif
+}
+
+#endif
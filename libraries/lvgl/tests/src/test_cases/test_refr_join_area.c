@@ -0,0 +1,189 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*About the command setup and the tearing sync of a QSPI panel*/
+#define FLUSH_COST      40000
+#define MAX_FLUSH       LV_INV_BUF_SIZE
+#define TRACE_END       {-1, -1, -1, -1}
+
+typedef struct {
+    uint32_t flush_cnt;
+    uint32_t px_cnt;
+    lv_area_t flushed[MAX_FLUSH];
+} flush_log_t;
+
+/*Invalidated areas of typical refreshes of a 320x480 thermostat screen (clock, sensor values, status icons).
+ *Every trace is one refresh, the list ends with `TRACE_END`*/
+static const lv_area_t trace_clock_tick[] = {
+    {180, 25, 291, 55},         /*time_label*/
+    TRACE_END
+};
+
+static const lv_area_t trace_sensor_update[] = {
+    {180, 25, 291, 55},         /*time_label*/
+    {45, 360, 141, 447},        /*temp_label*/
+    {200, 290, 276, 323},       /*damper_label*/
+    {200, 330, 300, 345},       /*damper bar*/
+    TRACE_END
+};
+
+static const lv_area_t trace_status_icons[] = {
+    {10, 5, 25, 20},
+    {30, 5, 45, 20},
+    {280, 5, 295, 20},
+    {300, 5, 315, 20},
+    {180, 25, 291, 55},
+    TRACE_END
+};
+
+static const lv_area_t trace_far_apart[] = {
+    {0, 0, 15, 15},
+    {300, 460, 319, 479},
+    TRACE_END
+};
+
+static const lv_area_t * traces[] = {
+    trace_clock_tick,
+    trace_sensor_update,
+    trace_status_icons,
+    trace_far_apart,
+};
+
+static flush_log_t flush_log;
+static void (*orig_flush_cb)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+static void log_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    if(flush_log.flush_cnt < MAX_FLUSH) lv_area_copy(&flush_log.flushed[flush_log.flush_cnt], area);
+    flush_log.flush_cnt++;
+    flush_log.px_cnt += lv_area_get_size(area);
+    orig_flush_cb(disp_drv, area, color_p);
+}
+
+/*A panel which can be written only from its first row*/
+static void row_0_rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area)
+{
+    LV_UNUSED(disp_drv);
+    area->y1 = 0;
+}
+
+/*Refresh a trace and check that everything was flushed. Returns the refresh cost.*/
+static uint32_t replay(const lv_area_t * trace)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+
+    /*Nothing else is invalid*/
+    lv_refr_now(NULL);
+    lv_memset_00(&flush_log, sizeof(flush_log));
+
+    uint32_t i;
+    for(i = 0; trace[i].x1 >= 0; i++) {
+        _lv_inv_area(disp, &trace[i]);
+    }
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(MAX_FLUSH, flush_log.flush_cnt);
+    for(i = 0; trace[i].x1 >= 0; i++) {
+        lv_area_t a;
+        lv_area_copy(&a, &trace[i]);
+        if(disp->driver->rounder_cb) disp->driver->rounder_cb(disp->driver, &a);
+
+        bool flushed = false;
+        uint32_t f;
+        for(f = 0; f < flush_log.flush_cnt; f++) {
+            if(_lv_area_is_in(&a, &flush_log.flushed[f], 0)) flushed = true;
+        }
+        TEST_ASSERT_TRUE(flushed);
+    }
+
+    return flush_log.flush_cnt * FLUSH_COST + flush_log.px_cnt;
+}
+
+static void compare_traces(const char * name)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    uint32_t old_sum = 0;
+    uint32_t new_sum = 0;
+    uint32_t t;
+    for(t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        drv->flush_cost = 0;
+        uint32_t old_cost = replay(traces[t]);
+        uint32_t old_flush_cnt = flush_log.flush_cnt;
+
+        drv->flush_cost = FLUSH_COST;
+        uint32_t new_cost = replay(traces[t]);
+
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(old_cost, new_cost);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(old_flush_cnt, flush_log.flush_cnt);
+        old_sum += old_cost;
+        new_sum += new_cost;
+    }
+
+    printf("%s: refresh cost of the traces %" LV_PRIu32 " -> %" LV_PRIu32 " px\n", name, old_sum, new_sum);
+}
+
+void setUp(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    orig_flush_cb = drv->flush_cb;
+    drv->flush_cb = log_flush_cb;
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(label, 180, 25);
+    lv_label_set_text(label, "12:34");
+}
+
+void tearDown(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    drv->flush_cb = orig_flush_cb;
+    drv->rounder_cb = NULL;
+    drv->flush_cost = 0;
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_refr_join_area_nearby_areas_are_joined(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+    drv->flush_cost = FLUSH_COST;
+
+    /*The labels at the top and the damper are joined, the temperature at the bottom left is far*/
+    replay(trace_sensor_update);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_log.flush_cnt);
+
+    replay(trace_status_icons);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_log.flush_cnt);
+}
+
+void test_refr_join_area_far_areas_are_kept(void)
+{
+    lv_disp_drv_t * drv = lv_disp_get_default()->driver;
+
+    /*The bounding box would be the whole 320x480 region*/
+    drv->flush_cost = 1000;
+    replay(trace_far_apart);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_log.flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(16 * 16 + 20 * 20, flush_log.px_cnt);
+}
+
+void test_refr_join_area_without_cost_joins_overlapping_only(void)
+{
+    replay(trace_sensor_update);
+    TEST_ASSERT_EQUAL_UINT32(4, flush_log.flush_cnt);
+}
+
+void test_refr_join_area_traces(void)
+{
+    compare_traces("any rectangle");
+}
+
+void test_refr_join_area_traces_row_0(void)
+{
+    lv_disp_get_default()->driver->rounder_cb = row_0_rounder_cb;
+    compare_traces("from the first row");
+}
+
+#endif
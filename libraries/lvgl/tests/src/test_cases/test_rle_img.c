@@ -0,0 +1,220 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*Created from examples/libs/png/wink.png with scripts/png_to_rle.py*/
+#define RLE_PATH    "A:src/test_files/wink.rle"
+
+static uint8_t * rle_data;
+static lv_img_dsc_t rle_var;
+
+#if LV_USE_PNG
+    LV_IMG_DECLARE(img_wink_png)
+#endif
+
+/*Load the RLE file to the RAM to use it like a C array*/
+static void load_rle_var(void)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, RLE_PATH, LV_FS_MODE_RD));
+    uint32_t size = 0;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+    rle_data = malloc(size);
+    uint32_t rn = 0;
+    lv_fs_read(&f, rle_data, size, &rn);
+    lv_fs_close(&f);
+    TEST_ASSERT_EQUAL_UINT32(size, rn);
+
+    lv_memset_00(&rle_var, sizeof(rle_var));
+    rle_var.header.cf = LV_IMG_CF_RAW_ALPHA;
+    rle_var.header.w = 50;
+    rle_var.header.h = 50;
+    rle_var.data_size = size;
+    rle_var.data = rle_data;
+}
+
+void setUp(void)
+{
+#if LV_USE_RLE_IMG
+    load_rle_var();
+#endif
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+    free(rle_data);
+    rle_data = NULL;
+}
+
+void test_rle_img_info(void)
+{
+#if LV_USE_RLE_IMG
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&rle_var, &header));
+    TEST_ASSERT_EQUAL(50, header.w);
+    TEST_ASSERT_EQUAL(50, header.h);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR_ALPHA, header.cf);
+
+    lv_memset_00(&header, sizeof(header));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(RLE_PATH, &header));
+    TEST_ASSERT_EQUAL(50, header.w);
+    TEST_ASSERT_EQUAL(50, header.h);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR_ALPHA, header.cf);
+
+    /*The row offset table doesn't fit*/
+    rle_var.data_size = 100;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&rle_var, &header));
+#endif
+}
+
+void test_rle_img_same_as_png(void)
+{
+#if LV_USE_RLE_IMG && LV_USE_PNG && LV_COLOR_DEPTH == 32
+    lv_img_decoder_dsc_t png;
+    lv_img_decoder_dsc_t rle;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&png, &img_wink_png, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&rle, RLE_PATH, lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(rle.img_data);
+
+    const lv_color32_t * png_px = (const lv_color32_t *)png.img_data;
+    const lv_color32_t * rle_px = (const lv_color32_t *)rle.img_data;
+    uint32_t i;
+    for(i = 0; i < 50 * 50; i++) {
+        TEST_ASSERT_EQUAL_UINT8(png_px[i].ch.alpha, rle_px[i].ch.alpha);
+        if(png_px[i].ch.alpha == 0) continue;
+
+        /*The difference of RGB565*/
+        TEST_ASSERT_UINT8_WITHIN(8, png_px[i].ch.red, rle_px[i].ch.red);
+        TEST_ASSERT_UINT8_WITHIN(4, png_px[i].ch.green, rle_px[i].ch.green);
+        TEST_ASSERT_UINT8_WITHIN(8, png_px[i].ch.blue, rle_px[i].ch.blue);
+    }
+
+    lv_img_decoder_close(&png);
+    lv_img_decoder_close(&rle);
+#endif
+}
+
+void test_rle_img_stream_same_as_decoded(void)
+{
+#if LV_USE_RLE_IMG
+    lv_img_decoder_dsc_t stream;
+    lv_img_decoder_dsc_t decoded;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&stream, &rle_var, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&decoded, RLE_PATH, lv_color_black(), 0));
+    TEST_ASSERT_NULL(stream.img_data);
+
+    uint8_t buf[50 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    lv_coord_t y;
+    for(y = 0; y < 50; y++) {
+        const uint8_t * row = decoded.img_data + y * 50 * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&stream, 0, y, 50, buf));
+        TEST_ASSERT_EQUAL_MEMORY(row, buf, sizeof(buf));
+
+        /*A part of the same row and then of an other row*/
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&stream, 13, y, 20, buf));
+        TEST_ASSERT_EQUAL_MEMORY(row + 13 * LV_IMG_PX_SIZE_ALPHA_BYTE, buf, 20 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+        lv_coord_t y2 = 49 - y;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&stream, 40, y2, 10, buf));
+        TEST_ASSERT_EQUAL_MEMORY(decoded.img_data + (y2 * 50 + 40) * LV_IMG_PX_SIZE_ALPHA_BYTE, buf,
+                                 10 * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    }
+
+    lv_img_decoder_close(&stream);
+    lv_img_decoder_close(&decoded);
+#endif
+}
+
+void test_rle_img_corrupt(void)
+{
+#if LV_USE_RLE_IMG
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &rle_var, lv_color_black(), 0));
+
+    uint8_t buf[50 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    uint32_t row_start = rle_data[12 + 4] | (rle_data[12 + 5] << 8);
+
+    /*A packet longer than the row*/
+    rle_data[row_start] = 0xFF;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dsc, 0, 1, 50, buf));
+
+    /*The offset of the last row points out of the data*/
+    rle_data[12 + 50 * 4 + 1] = 0xFF;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dsc, 0, 49, 50, buf));
+
+    /*The other rows are still fine*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 0, 50, buf));
+    lv_img_decoder_close(&dsc);
+#endif
+}
+
+void test_rle_img_draw(void)
+{
+#if LV_USE_RLE_IMG
+    lv_obj_t * img_var = lv_img_create(lv_scr_act());
+    lv_img_set_src(img_var, &rle_var);
+    lv_obj_t * img_file = lv_img_create(lv_scr_act());
+    lv_img_set_src(img_file, RLE_PATH);
+    lv_obj_set_pos(img_file, 100, 0);
+
+    lv_img_cache_reset_stat();
+    lv_refr_now(NULL);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+#if LV_IMG_CACHE_DEF_SIZE
+    /*Only the decoded file uses memory in the cache*/
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50 * 50 * LV_IMG_PX_SIZE_ALPHA_BYTE, stat.size);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, stat.hit);
+#endif
+#endif
+}
+
+/*Not a check, prints the time to open (decode) the image and the memory the decoded image uses while open*/
+void test_rle_img_benchmark(void)
+{
+#if LV_USE_RLE_IMG && LV_USE_PNG
+    const uint32_t rep = 500;
+    const void * srcs[] = {&img_wink_png, RLE_PATH, &rle_var};
+    const char * names[] = {"PNG C array (lodepng)", "RLE file", "RLE C array, row by row"};
+    uint8_t buf[50 * LV_IMG_PX_SIZE_ALPHA_BYTE];
+
+    uint32_t s;
+    for(s = 0; s < 3; s++) {
+        lv_img_decoder_dsc_t dsc;
+        uint32_t mem_size = 0;
+        clock_t t0 = clock();
+        uint32_t i;
+        for(i = 0; i < rep; i++) {
+            TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, srcs[s], lv_color_black(), 0));
+            if(dsc.img_data == NULL) {
+                /*Read all the rows like a full redraw*/
+                lv_coord_t y;
+                for(y = 0; y < 50; y++) lv_img_decoder_read_line(&dsc, 0, y, 50, buf);
+                mem_size = 50 * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+            else {
+                mem_size = 50 * 50 * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+            lv_img_decoder_close(&dsc);
+        }
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        printf("%-24s: %.1f us per open and decode of 50x50 px, %" LV_PRIu32 " bytes while open\n", names[s],
+               t * 1000000 / rep, mem_size);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,297 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <stdio.h>
+#include <time.h>
+
+/*Long enough to never elapse during a test*/
+#define LONG_PERIOD     1000000
+
+static lv_timer_t * sys_timers[8];
+static uint32_t sys_timer_cnt;
+static uint32_t run_cnt;
+static lv_timer_t * other_timer;
+
+static void count_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+static void del_self_cb(lv_timer_t * timer)
+{
+    run_cnt++;
+    lv_timer_del(timer);
+}
+
+static void del_other_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+    if(other_timer) lv_timer_del(other_timer);
+    other_timer = NULL;
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+    other_timer = lv_timer_create(count_cb, 0, NULL);
+}
+
+static void pause_self_cb(lv_timer_t * timer)
+{
+    run_cnt++;
+    lv_timer_pause(timer);
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(t == timer) return true;
+        t = lv_timer_get_next(t);
+    }
+    return false;
+}
+
+/*The next deadline with scanning all the timers like `lv_timer_handler()` used to*/
+static uint32_t scan_next_deadline(void)
+{
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        if(!timer->paused) {
+            uint32_t elp = lv_tick_elaps(timer->last_run);
+            uint32_t delay = elp >= timer->period ? 0 : timer->period - elp;
+            if(delay < time_till_next) time_till_next = delay;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+    return time_till_next;
+}
+
+void setUp(void)
+{
+    /*Keep only the timers of the test running*/
+    sys_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer && sys_timer_cnt < 8) {
+        if(!timer->paused) {
+            lv_timer_pause(timer);
+            sys_timers[sys_timer_cnt] = timer;
+            sys_timer_cnt++;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    run_cnt = 0;
+    other_timer = NULL;
+}
+
+void tearDown(void)
+{
+    /*Delete the timers of the test*/
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        lv_timer_t * next = lv_timer_get_next(timer);
+        uint32_t i;
+        bool sys = false;
+        for(i = 0; i < sys_timer_cnt; i++) {
+            if(sys_timers[i] == timer) sys = true;
+        }
+        if(!sys) lv_timer_del(timer);
+        timer = next;
+    }
+
+    uint32_t i;
+    for(i = 0; i < sys_timer_cnt; i++) lv_timer_resume(sys_timers[i]);
+}
+
+void test_timer_next_deadline(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    lv_timer_t * t1 = lv_timer_create(count_cb, 5000, NULL);
+    lv_timer_create(count_cb, 9000, NULL);
+    TEST_ASSERT_UINT32_WITHIN(10, 4995, lv_timer_handler());
+
+    lv_timer_set_period(t1, 20000);
+    TEST_ASSERT_UINT32_WITHIN(10, 8995, lv_timer_handler());
+
+    lv_timer_pause(t1);
+    lv_timer_set_period(t1, 100);
+    TEST_ASSERT_UINT32_WITHIN(10, 8995, lv_timer_handler());
+
+    lv_timer_resume(t1);
+    TEST_ASSERT_UINT32_WITHIN(100, 50, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+}
+
+void test_timer_ready(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, LONG_PERIOD, NULL);
+    lv_timer_create(count_cb, LONG_PERIOD, NULL);
+
+    lv_timer_ready(t1);
+    lv_timer_ready(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    /*Waits its period again*/
+    TEST_ASSERT_UINT32_WITHIN(10, LONG_PERIOD - 5, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_timer_ready(t1);
+    lv_timer_reset(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+}
+
+void test_timer_zero_period_runs_once_per_call(void)
+{
+    lv_timer_create(count_cb, 0, NULL);
+    lv_timer_create(count_cb, 0, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, run_cnt);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 0, NULL);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_handler();
+    lv_timer_handler();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+
+    /*Deleted by the next call without waiting its period or running*/
+    lv_timer_t * t2 = lv_timer_create(count_cb, LONG_PERIOD, NULL);
+    lv_timer_set_repeat_count(t2, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t2));
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_del_in_cb(void)
+{
+    lv_timer_create(del_self_cb, 0, NULL);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    /*The other timer is due too. It's deleted before or after it has run in this call.*/
+    run_cnt = 0;
+    other_timer = lv_timer_create(count_cb, LONG_PERIOD, NULL);
+    lv_timer_t * t1 = lv_timer_create(del_other_cb, LONG_PERIOD, NULL);
+    lv_timer_ready(other_timer);
+    lv_timer_ready(t1);
+    lv_timer_handler();
+    TEST_ASSERT_NULL(other_timer);
+    TEST_ASSERT_UINT32_WITHIN(1, 1, run_cnt);
+    TEST_ASSERT_UINT32_WITHIN(10, LONG_PERIOD - 5, lv_timer_handler());
+}
+
+void test_timer_create_and_pause_in_cb(void)
+{
+    lv_timer_t * t1 = lv_timer_create(create_cb, LONG_PERIOD, NULL);
+    lv_timer_ready(t1);
+    lv_timer_handler();
+    TEST_ASSERT_NOT_NULL(other_timer);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_timer_del(other_timer);
+    lv_timer_t * t2 = lv_timer_create(pause_self_cb, 0, NULL);
+    lv_timer_handler();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, t2->paused);
+
+    lv_timer_resume(t2);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, run_cnt);
+}
+
+void test_timer_same_as_scan(void)
+{
+    lv_timer_t * timers[300];
+    uint32_t seed = 0x1234;
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        seed = seed * 1103515245 + 12345;
+        timers[i] = lv_timer_create(count_cb, 100 + (seed >> 16) % 5000, NULL);
+    }
+
+    for(i = 0; i < 3000; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_timer_t * t = timers[(seed >> 16) % 300];
+        switch((seed >> 8) % 6) {
+            case 0:
+                lv_timer_ready(t);
+                break;
+            case 1:
+                lv_timer_reset(t);
+                break;
+            case 2:
+                lv_timer_set_period(t, 100 + (seed >> 4) % 5000);
+                break;
+            case 3:
+                lv_timer_pause(t);
+                break;
+            default:
+                lv_timer_resume(t);
+                break;
+        }
+
+        uint32_t time_till_next = lv_timer_handler();
+        TEST_ASSERT_UINT32_WITHIN(2, scan_next_deadline(), time_till_next);
+    }
+}
+
+/*Not a check, prints the cost of the timer handling with hundreds of timers on the machine running the tests*/
+void test_timer_benchmark(void)
+{
+    const uint32_t cnts[] = {10, 100, 500, 1000};
+    const uint32_t rep = 20000;
+    static lv_timer_t * timers[1000];
+
+    uint32_t c;
+    for(c = 0; c < sizeof(cnts) / sizeof(cnts[0]); c++) {
+        uint32_t seed = 0x1234;
+        uint32_t i;
+        for(i = 0; i < cnts[c]; i++) {
+            seed = seed * 1103515245 + 12345;
+            timers[i] = lv_timer_create(count_cb, 10000 + (seed >> 16) % LONG_PERIOD, NULL);
+        }
+
+        /*A refresh request and a handler call like `display_manager` does*/
+        run_cnt = 0;
+        clock_t t0 = clock();
+        for(i = 0; i < rep; i++) {
+            seed = seed * 1103515245 + 12345;
+            lv_timer_ready(timers[(seed >> 16) % cnts[c]]);
+            lv_timer_handler();
+        }
+        double t_heap = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        TEST_ASSERT_EQUAL_UINT32(rep, run_cnt);
+
+        /*Only the search of the next deadline of the previous implementation*/
+        volatile uint32_t sum = 0;
+        t0 = clock();
+        for(i = 0; i < rep; i++) sum += scan_next_deadline();
+        double t_scan = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        printf("%4" LV_PRIu32 " timers: %" LV_PRIu32 " ready + handler calls in %.3f s, "
+               "the list scan alone would take %.3f s\n", cnts[c], rep, t_heap, t_scan);
+
+        for(i = 0; i < cnts[c]; i++) lv_timer_del(timers[i]);
+    }
+}
+
+#endif
@@ -0,0 +1,269 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_TINY_TTF
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FB_SIZE     (800 * 480)
+
+extern lv_color_t test_fb[];
+extern const uint8_t ubuntu_font[];
+extern size_t ubuntu_font_size;
+
+static lv_obj_t * label;
+static lv_font_t * font;
+static lv_font_t * font2;
+static lv_color_t ref_fb[FB_SIZE];
+
+static void render(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Render the label with the given cache size and compare it to the rendering without cache*/
+static void check_same_as_uncached(uint32_t cache_size)
+{
+    lv_tiny_ttf_cache_set_size(0);
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_tiny_ttf_cache_set_size(cache_size);
+    lv_tiny_ttf_cache_reset_stat();
+    render();   /*Fill the cache*/
+    render();   /*Draw from the cache*/
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+#endif
+
+void setUp(void)
+{
+#if LV_USE_TINY_TTF
+    font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 30);
+    label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_width(label, 600);
+    lv_label_set_text(label, "Target: 85°C, Servo Angle: 90°\nAccents: ÁÉÍÓÖŐÜŰ áéíóöőüű\nKerning: AVAWAYTo Ty");
+    lv_obj_center(label);
+    lv_tiny_ttf_cache_reset_stat();
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_TINY_TTF
+    lv_obj_clean(lv_scr_act());
+    lv_tiny_ttf_destroy(font);
+    if(font2) lv_tiny_ttf_destroy(font2);
+    font2 = NULL;
+    lv_tiny_ttf_cache_set_size(LV_TINY_TTF_CACHE_SIZE);
+
+    lv_tiny_ttf_cache_stat_t stat;
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+#endif
+}
+
+void test_tiny_ttf_cache_same_result(void)
+{
+#if LV_USE_TINY_TTF
+    /*All the glyphs fit*/
+    check_same_as_uncached(256 * 1024);
+
+    lv_tiny_ttf_cache_stat_t stat;
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.bitmap_hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.evict);
+#endif
+}
+
+void test_tiny_ttf_cache_same_result_evicting(void)
+{
+#if LV_USE_TINY_TTF
+    /*Only a few glyphs fit*/
+    check_same_as_uncached(4096);
+
+    lv_tiny_ttf_cache_stat_t stat;
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.evict);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(4096, stat.size);
+#endif
+}
+
+void test_tiny_ttf_cache_hit(void)
+{
+#if LV_USE_TINY_TTF
+    lv_font_glyph_dsc_t g;
+    lv_tiny_ttf_cache_stat_t stat;
+
+    /*Not in the label's text*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'Q', 0));
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, 'Q'));
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.bitmap_miss);
+
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'Q', 0));
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, 'Q'));
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.bitmap_miss);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.bitmap_hit);
+
+    /*Missing glyphs are cached too*/
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font, &g, 0x4e2d, 0));
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font, &g, 0x4e2d, 0));
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss);
+#endif
+}
+
+void test_tiny_ttf_cache_shared_by_sizes(void)
+{
+#if LV_USE_TINY_TTF
+    lv_font_glyph_dsc_t g30;
+    lv_font_glyph_dsc_t g20;
+    lv_tiny_ttf_cache_stat_t stat;
+
+    /*The same data at an other size uses the same face*/
+    font2 = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 20);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g30, 'Q', 0));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font2, &g20, 'Q', 0));
+    TEST_ASSERT_LESS_THAN_INT(g30.box_h, g20.box_h);
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss);
+
+    /*Switching back to a size finds its glyphs*/
+    lv_font_glyph_dsc_t g;
+    lv_tiny_ttf_set_size(font2, 30);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font2, &g, 'Q', 0));
+    lv_tiny_ttf_set_size(font2, 20);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font2, &g, 'Q', 0));
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.hit);
+    TEST_ASSERT_EQUAL_INT(g20.box_h, g.box_h);
+    TEST_ASSERT_EQUAL_INT(g20.adv_w, g.adv_w);
+
+    /*The glyphs of a face are kept until its last font is destroyed*/
+    uint32_t entry_cnt = stat.entry_cnt;
+    lv_tiny_ttf_destroy(font2);
+    font2 = NULL;
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(entry_cnt, stat.entry_cnt);
+#endif
+}
+
+void test_tiny_ttf_cache_prewarm(void)
+{
+#if LV_USE_TINY_TTF
+    lv_tiny_ttf_cache_stat_t stat;
+
+    TEST_ASSERT_EQUAL_UINT32(11, lv_tiny_ttf_prewarm(font, "0123456789°"));
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(11, stat.bitmap_miss);
+
+    /*Nothing is rendered or looked up on the first draw*/
+    lv_tiny_ttf_cache_reset_stat();
+    lv_label_set_text(label, "1024°");
+    render();
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.bitmap_miss);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.miss);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(5, stat.bitmap_hit);
+#endif
+}
+
+void test_tiny_ttf_cache_disabled(void)
+{
+#if LV_USE_TINY_TTF
+    lv_tiny_ttf_cache_stat_t stat;
+
+    render();
+    lv_tiny_ttf_cache_set_size(0);
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.size);
+
+    lv_tiny_ttf_cache_reset_stat();
+    render();
+    lv_tiny_ttf_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.hit);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stat.bitmap_miss);
+#endif
+}
+
+void test_tiny_ttf_cache_file(void)
+{
+#if LV_USE_TINY_TTF && LV_TINY_TTF_FILE_SUPPORT && LV_USE_FS_POSIX
+    char path[64];
+    lv_snprintf(path, sizeof(path), "B:/tmp/lv_tiny_ttf_%d.ttf", (int)getpid());
+    FILE * f = fopen(path + 2, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL_UINT32(ubuntu_font_size, fwrite(ubuntu_font, 1, ubuntu_font_size, f));
+    fclose(f);
+
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    font2 = lv_tiny_ttf_create_file(path, 30);
+    TEST_ASSERT_NOT_NULL(font2);
+    lv_obj_set_style_text_font(label, font2, 0);
+    render();
+    remove(path + 2);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*A second font of the file opens it only once*/
+    lv_font_t * font3 = lv_tiny_ttf_create_file(path, 20);
+    TEST_ASSERT_NOT_NULL(font3);
+    lv_tiny_ttf_destroy(font3);
+#endif
+}
+
+/*Not a check, prints the cost of measuring and drawing labels with a compiled and a TTF font*/
+void test_tiny_ttf_cache_benchmark(void)
+{
+#if LV_USE_TINY_TTF && LV_FONT_MONTSERRAT_24
+    static const char * txt = "Target Temp 85°C Min Temp 40°C Read Interval 5.0 s Servo Angle 90°";
+    const uint32_t rep = 300;
+    const lv_font_t * fonts[] = {&lv_font_montserrat_24, font, font};
+    const uint32_t cache_sizes[] = {0, 0, LV_TINY_TTF_CACHE_SIZE};
+    const char * names[] = {"compiled montserrat_24", "tiny_ttf no cache", "tiny_ttf cache"};
+
+    lv_tiny_ttf_set_size(font, 24);
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        lv_tiny_ttf_cache_set_size(cache_sizes[i]);
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        render();
+        lv_tiny_ttf_cache_reset_stat();
+
+        clock_t t0 = clock();
+        uint32_t r;
+        for(r = 0; r < rep; r++) lv_txt_get_width(txt, strlen(txt), fonts[i], 0, LV_TEXT_FLAG_NONE);
+        double t_measure = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        lv_label_set_text_static(label, txt);
+        t0 = clock();
+        for(r = 0; r < rep; r++) render();
+        double t_draw = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        printf("%s: %" LV_PRIu32 " measures in %.3f s, %" LV_PRIu32 " redraws in %.3f s\n", names[i], rep, t_measure, rep,
+               t_draw);
+    }
+
+    lv_tiny_ttf_cache_stat_t stat;
+    lv_tiny_ttf_cache_get_stat(&stat);
+    printf("tiny_ttf cache: hit: %" LV_PRIu32 ", miss: %" LV_PRIu32 ", bitmap hit: %" LV_PRIu32 ", bitmap miss: %" LV_PRIu32
+           ", size: %" LV_PRIu32 "\n", stat.hit, stat.miss, stat.bitmap_hit, stat.bitmap_miss, stat.size);
+#endif
+}
+
+#endif
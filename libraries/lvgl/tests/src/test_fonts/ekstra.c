@@ -0,0 +1,1125 @@
+#if LV_BUILD_TEST
+/*******************************************************************************
+ * Size: 100 px
+ * Bpp: 3
+ * Opts: --bpp 3 --size 100 --font 28 Days Later.ttf --symbols  1234567890:- --format lvgl -o ekstra.c
+ ******************************************************************************/
+
+#include "../../lvgl.h"
+
+#ifndef EKSTRA
+#define EKSTRA 1
+#endif
+
+#if EKSTRA
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0030 "0" */
+    0x3, 0xfe, 0x20, 0x7f, 0xf7, 0x88, 0x11, 0x71,
+    0x83, 0x3f, 0xea, 0xc0, 0xff, 0xe6, 0xcf, 0xec,
+    0x2, 0xc8, 0x2c, 0x98, 0x29, 0xe0, 0x1f, 0xfc,
+    0xa8, 0xc0, 0xd1, 0xab, 0xd3, 0x24, 0x7, 0x3e,
+    0x7, 0xff, 0x22, 0xb2, 0x7, 0x9e, 0x80, 0x8,
+    0x20, 0x71, 0x6c, 0x7, 0xff, 0x11, 0xc6, 0x8,
+    0x1e, 0x20, 0x80, 0x20, 0x79, 0x19, 0xf9, 0x1,
+    0xff, 0xc1, 0x50, 0x22, 0x80, 0xf1, 0x3, 0xfe,
+    0x40, 0xb1, 0x50, 0x1f, 0xf1, 0xa1, 0xe0, 0x80,
+    0xff, 0xe3, 0xa2, 0xc5, 0xa2, 0x7, 0xfb, 0x81,
+    0x13, 0xc0, 0x7f, 0xf1, 0x5a, 0x41, 0x47, 0x3,
+    0xf8, 0x81, 0x90, 0x21, 0x81, 0x22, 0x7, 0xff,
+    0x5, 0x10, 0x24, 0x7, 0xf4, 0x3, 0x88, 0x24,
+    0x5, 0x8b, 0x3, 0xfe, 0x20, 0x75, 0x20, 0x7c,
+    0xd1, 0x0, 0x90, 0x80, 0x20, 0x50, 0x30, 0x89,
+    0x1, 0xfd, 0x3c, 0xcc, 0x90, 0x1e, 0x20, 0x66,
+    0x80, 0x90, 0x1c, 0xc2, 0x24, 0x7, 0xa6, 0x9b,
+    0x26, 0x90, 0x80, 0xe7, 0xc0, 0xc4, 0x1, 0x3,
+    0xd7, 0x81, 0xfe, 0xde, 0x22, 0x40, 0x86, 0x7,
+    0x54, 0x7, 0x20, 0x41, 0x0, 0xe3, 0xc0, 0x7f,
+    0x89, 0x1, 0xb0, 0xec, 0xc, 0x48, 0xf, 0x70,
+    0x6, 0xbd, 0xf7, 0xdf, 0xd0, 0xf, 0xe3, 0x72,
+    0xc5, 0x1, 0x90, 0x1f, 0x20, 0xda, 0x62, 0x14,
+    0x60, 0x4f, 0x1, 0xfa, 0x5f, 0x55, 0x20, 0x6c,
+    0x1, 0x0, 0x44, 0x83, 0x36, 0x68, 0x90, 0xe,
+    0x28, 0x1, 0x30, 0x31, 0x99, 0x1, 0x1, 0x90,
+    0x6, 0x1, 0x0, 0x21, 0x52, 0x43, 0x1, 0xf7,
+    0x0, 0x5b, 0x14, 0x5d, 0xe5, 0x10, 0x3e, 0x20,
+    0x71, 0x64, 0xc, 0x80, 0xf9, 0x82, 0x73, 0xcd,
+    0x16, 0x15, 0x2, 0x40, 0x7f, 0xa2, 0x3, 0x10,
+    0x3e, 0x20, 0x90, 0x61, 0xa9, 0x49, 0x2, 0x80,
+    0x10, 0x4, 0x8, 0x92, 0x1, 0x0, 0x88, 0x1f,
+    0xc4, 0x20, 0xd4, 0x5d, 0x0, 0x49, 0xc0, 0x70,
+    0x4, 0x8, 0x80, 0x22, 0xaa, 0x7, 0xff, 0x9,
+    0x90, 0x81, 0x40, 0x12, 0x30, 0x1c, 0xf, 0xc9,
+    0x0, 0x1e, 0x18, 0x1f, 0xcc, 0x10, 0x40, 0x22,
+    0x6, 0x64, 0x2, 0x3, 0xf2, 0x42, 0x32, 0x3,
+    0xff, 0x80, 0x49, 0x81, 0x52, 0x5, 0x10, 0x11,
+    0x80, 0x78, 0xe1, 0xfa, 0x80, 0x20, 0x7f, 0x6a,
+    0xa2, 0x1, 0x0, 0xdc, 0x81, 0x8a, 0x3, 0xb2,
+    0x4, 0xf, 0xfe, 0x13, 0xc6, 0x80, 0x20, 0x71,
+    0xc0, 0x80, 0xcc, 0xe, 0x24, 0x10, 0x1f, 0xfc,
+    0x23, 0xa1, 0x68, 0x81, 0xd2, 0xa, 0x4, 0xf,
+    0x99, 0x68, 0xf, 0xfe, 0x1b, 0x6e, 0x98, 0x1e,
+    0xe8, 0xe0, 0x4a, 0xd0, 0x3, 0x51, 0x1, 0xc0,
+    0xff, 0xe1, 0x20, 0x5, 0xa0, 0x39, 0x80, 0x40,
+    0x21, 0xc8, 0x84, 0x49, 0x4, 0x7, 0xff, 0x4,
+    0x90, 0x44, 0x20, 0x39, 0x1, 0x35, 0xc3, 0x44,
+    0x3e, 0xc0, 0x10, 0x3f, 0xf8, 0x2c, 0x96, 0x8,
+    0xf, 0xf7, 0xf, 0x32, 0xd5, 0x1c, 0xc, 0x47,
+    0x3, 0xfb, 0xc8, 0x58, 0x81, 0xe2, 0x4, 0x46,
+    0x91, 0xa8, 0x24, 0x80, 0xe2, 0xc0, 0xfe, 0x23,
+    0x38, 0x40, 0xf1, 0x2, 0x3a, 0x6f, 0xd9, 0x81,
+    0xf1, 0x26, 0x7, 0xfd, 0x49, 0x1, 0xfe, 0x3b,
+    0xdf, 0x60, 0x1a, 0x1, 0xd1, 0x1, 0xfe, 0x64,
+    0x10, 0x3f, 0xc5, 0xf2, 0xc6, 0x3, 0x50, 0x3a,
+    0xa0, 0x3f, 0x98, 0x26, 0x3, 0xfe, 0x22, 0x5a,
+    0x40, 0x62, 0x7, 0x18, 0x7, 0xf1, 0x40, 0x81,
+    0xff, 0x11, 0x0, 0xff, 0xe2, 0x10, 0x3f, 0xf9,
+    0x64, 0xc0, 0x7f, 0xf0, 0xd3, 0x3, 0xf2, 0x3,
+    0xff, 0x86, 0xc8, 0x1f, 0xfc, 0x36, 0x7, 0xf3,
+    0x3, 0xff, 0x8a, 0x40, 0xff, 0xe1, 0x16, 0x7,
+    0xff, 0x33, 0x6, 0x7, 0xfc, 0x41, 0x4, 0xf,
+    0xc8, 0xf, 0xfe, 0x1a, 0x8, 0xf, 0xf8, 0x81,
+    0xff, 0xc0, 0x94, 0xf, 0xfe, 0x13, 0x3, 0xff,
+    0x86, 0xc0, 0xff, 0x1a, 0x7, 0xff, 0x9, 0x90,
+    0x3f, 0xf8, 0x24, 0xf, 0xf8, 0xa0, 0x3f, 0xf8,
+    0x4d, 0x1, 0xff, 0x18, 0x7, 0xff, 0x5, 0x90,
+    0x3f, 0xf8, 0x44, 0xf, 0xfa, 0x55, 0x98, 0x1f,
+    0xc4, 0xc0, 0x7f, 0xf0, 0x98, 0x1f, 0xf5, 0x70,
+    0x50, 0x3f, 0xf8, 0x4, 0x8, 0x81, 0xcb, 0xb8,
+    0x40, 0x88, 0x1c, 0x6c, 0xe0, 0x7f, 0xf0, 0x18,
+    0x2, 0x7, 0xf6, 0x3c, 0x84, 0x4, 0x40, 0xc6,
+    0xe8, 0x5b, 0x1, 0xff, 0xc4, 0x60, 0x75, 0x1c,
+    0x8e, 0x2, 0x1, 0xe8, 0xc2, 0x18, 0xf, 0xe6,
+    0x7, 0xff, 0x0, 0xf4, 0x42, 0x11, 0x90, 0x3a,
+    0x80, 0xd3, 0x81, 0xff, 0xcb, 0x28, 0x8, 0xc8,
+    0x20, 0x71, 0x51, 0x94, 0x7, 0xff, 0x33, 0x81,
+    0xdc, 0x81, 0x20, 0xf, 0x80, 0x80, 0x7f, 0x30,
+    0x10, 0xf, 0xfa, 0x20, 0xc, 0xf0, 0x31, 0x2,
+    0x4c, 0x20, 0x3f, 0xe4, 0x45, 0xa6, 0x7, 0xc7,
+    0x80, 0x24, 0x80, 0xc9, 0x0, 0x9a, 0x3, 0xfc,
+    0x44, 0xc5, 0x60, 0x3f, 0x16, 0x3, 0x88, 0x0,
+    0x8a, 0xc0, 0x2a, 0x7, 0xff, 0x7, 0x3a, 0x13,
+    0x3, 0xc4, 0xc, 0xc4, 0x0, 0x65, 0x86, 0x98,
+    0x0, 0x81, 0xfb, 0x1, 0x60, 0x8, 0xf, 0x10,
+    0x80, 0x90, 0x24, 0xfb, 0x47, 0x90, 0x82, 0x3,
+    0xf3, 0x2, 0x54, 0x82, 0x7, 0xdc, 0xa, 0x26,
+    0x72, 0x46, 0x10, 0x4, 0x30, 0x1f, 0x89, 0x0,
+    0x28, 0x10, 0x48, 0xe, 0x40, 0x45, 0x25, 0xe0,
+    0x38, 0x12, 0x0, 0x80, 0xf9, 0x81, 0x3a, 0x0,
+    0x9c, 0x10, 0x11, 0x2, 0x29, 0x32, 0x28, 0x82,
+    0xd0, 0x13, 0x3, 0xd1, 0x4c, 0xaa, 0x8, 0xc,
+    0x80, 0x20, 0x3a, 0x71, 0xf1, 0x41, 0x90, 0x34,
+    0xa4, 0x1, 0xc6, 0x5, 0x4a, 0x4, 0x80, 0xf6,
+    0x3, 0x27, 0x75, 0xc8, 0x1, 0x3, 0xcb, 0x7e,
+    0xde, 0xa9, 0x20, 0x8f, 0x3, 0xe6, 0x6, 0x60,
+    0x23, 0x4, 0x14, 0x7, 0xf9, 0x19, 0x4, 0x9,
+    0x14, 0x7, 0x36, 0x3, 0x8f, 0x84, 0xc9, 0xfe,
+    0x20, 0x7f, 0x3c, 0x7, 0xea, 0xc0, 0xde, 0x1,
+    0xc6, 0x8a, 0xfe, 0x5b, 0x8, 0x1c, 0x42, 0x4,
+    0x80, 0xe2, 0x0, 0xe0, 0x35, 0x3, 0xf3, 0x86,
+    0x41, 0x20, 0x3e, 0x21, 0x86, 0x4c, 0x0, 0xb0,
+    0x7, 0x10, 0x2c, 0x7, 0xe2, 0x49, 0x0, 0x10,
+    0x3f, 0x88, 0x66, 0x90, 0x22, 0x3, 0x2, 0x1,
+    0x81, 0xfd, 0x40, 0x89, 0x22, 0x7, 0xff, 0x2,
+    0x1, 0x12, 0x1, 0x0, 0xd0, 0xf, 0xe8, 0x20,
+    0x40, 0x8, 0x1f, 0xfc, 0x54, 0xa, 0x2, 0x80,
+    0x7f, 0xda, 0x6, 0x10, 0x1f, 0xfc, 0x52, 0xa,
+    0x48, 0x1b, 0x1, 0xff, 0x1c, 0x10, 0x2, 0x7,
+    0xc4, 0x9, 0x4, 0x0, 0x82, 0xca, 0x48, 0x7,
+    0xff, 0x4, 0xf3, 0x1, 0x3, 0xe2, 0x9, 0x20,
+    0x80, 0xf1, 0x74, 0xf, 0xfe, 0x24, 0x44, 0xf,
+    0xf2, 0xd0, 0x81, 0xe5, 0x80, 0xff, 0xe4, 0x6a,
+    0x40, 0xc4, 0x2, 0x47, 0x1d, 0x40, 0xa9, 0x40,
+    0xff, 0xe5, 0x2d, 0x8c, 0x82, 0x1, 0xc7, 0x89,
+    0x4f, 0xab, 0x3, 0xff, 0x9a, 0x66, 0xfd, 0xa7,
+    0x40, 0xc6, 0x40, 0xff, 0xe1, 0x80,
+
+    /* U+0031 "1" */
+    0x3, 0xff, 0xad, 0xff, 0xfd, 0x38, 0x1f, 0xfc,
+    0xa6, 0x7, 0xfc, 0x80, 0xf8, 0x81, 0xff, 0xc3,
+    0x80, 0x48, 0x8, 0x81, 0xff, 0xc2, 0xc4, 0x9,
+    0x1, 0xff, 0x7f, 0xd1, 0x90, 0x3f, 0xf8, 0x4,
+    0x80, 0x12, 0x4, 0x10, 0x4, 0xc, 0x78, 0xa0,
+    0x62, 0x2, 0x14, 0x44, 0x60, 0x78, 0x83, 0x40,
+    0x88, 0x11, 0x60, 0x95, 0x10, 0xf, 0x12, 0x3,
+    0xf3, 0x90, 0xad, 0x7, 0xb9, 0x0, 0x50, 0x1f,
+    0xca, 0xba, 0x88, 0x16, 0xa0, 0xc, 0x24, 0x12,
+    0x1, 0x89, 0x32, 0x40, 0xb, 0x30, 0xd, 0x3e,
+    0xf9, 0x81, 0x92, 0x19, 0x4e, 0x80, 0x7a, 0xee,
+    0x1c, 0xe0, 0x9, 0x45, 0x6, 0x34, 0xf, 0xc7,
+    0xeb, 0x80, 0x2d, 0x88, 0x5f, 0x80, 0xfe, 0xa1,
+    0x1, 0xc4, 0xc0, 0x66, 0x7, 0xd4, 0x3e, 0x8,
+    0x1f, 0xfc, 0x24, 0xc3, 0x51, 0x40, 0x3f, 0xf8,
+    0xc, 0x9, 0x35, 0xb2, 0x30, 0x80, 0xff, 0xe1,
+    0x10, 0x75, 0x9d, 0x1, 0xff, 0xc4, 0x22, 0x43,
+    0x24, 0x80, 0xff, 0xe2, 0xc8, 0x1, 0x98, 0x1f,
+    0xfc, 0x57, 0x8c, 0xa0, 0x7f, 0xf1, 0xf2, 0x4b,
+    0x90, 0x1f, 0xfc, 0x6a, 0xd1, 0x3, 0xff, 0x90,
+    0xb8, 0x1f, 0xfc, 0x93, 0xa0, 0x1f, 0xfc, 0x72,
+    0x2c, 0x3, 0xff, 0x90, 0x5c, 0x3, 0xfc, 0x40,
+    0xff, 0x22, 0x7, 0xfc, 0x40, 0xff, 0xeb, 0xf0,
+    0x3f, 0x88, 0x1f, 0xfc, 0x2, 0x50, 0xf, 0x20,
+    0x3f, 0xf8, 0x4a, 0x40, 0x1e, 0x40, 0x81, 0xff,
+    0xc0, 0xe0, 0x7f, 0xf2, 0xf2, 0x80, 0x7f, 0xf2,
+    0x54, 0xa0, 0x7f, 0xf2, 0x99, 0x3, 0xff, 0x96,
+    0x40, 0xff, 0xe5, 0x42, 0x6, 0x4c, 0xf, 0xfe,
+    0x22, 0x20, 0x64, 0xc0, 0xff, 0xe1, 0xa6, 0x48,
+    0xf, 0xfe, 0x47, 0x0, 0x40, 0xfe, 0x80, 0x7f,
+    0xba, 0x29, 0xcb, 0xb6, 0x67, 0x1, 0xfe, 0x28,
+    0xb6, 0x97, 0x6c, 0xd8, 0xf, 0xf9, 0x80, 0x20,
+    0x62, 0xc0, 0x24, 0x3, 0xff, 0x82, 0x90, 0xc,
+    0xc0, 0x88, 0x1f, 0xe2, 0x1, 0x20, 0x19, 0x5a,
+    0x48, 0x7, 0xf9, 0x81, 0xe6, 0x19, 0x56, 0x1,
+    0xff, 0xc0, 0x37, 0x7, 0xad, 0x4, 0xc8, 0x1f,
+    0xe6, 0xd, 0x48, 0xe4, 0xad, 0x62, 0x7, 0xf8,
+    0x83, 0x9e, 0x4, 0x1, 0x55, 0x1, 0xfe, 0x21,
+    0xa7, 0x80, 0x14, 0x53, 0x20, 0x7f, 0x88, 0x5e,
+    0xa6, 0xa, 0x22, 0x50, 0x3f, 0xc5, 0x6, 0x40,
+    0xfc, 0x40, 0xff, 0xb0, 0x19, 0x81, 0xe2, 0x7,
+    0xfa, 0xc0, 0x3f, 0xe4, 0x7, 0xff, 0x2d, 0x1,
+    0xfe, 0xcc, 0xf, 0xf8, 0x81, 0xfe, 0x3c, 0xf,
+    0xfe, 0x52, 0x80, 0x7f, 0xf8, 0xa0, 0x1f, 0xff,
+    0xf0, 0x3f, 0xf9, 0xc, 0xf, 0xff, 0xf8, 0x1f,
+    0xfc, 0x86, 0x7, 0xff, 0x8,
+
+    /* U+0032 "2" */
+    0x3, 0xff, 0x86, 0x5c, 0xb4, 0xd8, 0x8, 0x81,
+    0xc4, 0xf, 0xfe, 0x59, 0x77, 0xe8, 0xc0, 0x8a,
+    0xbf, 0xa5, 0x71, 0x90, 0x3f, 0xf9, 0x5, 0xec,
+    0x88, 0x14, 0xb4, 0x80, 0x62, 0x6a, 0x39, 0xe0,
+    0x1f, 0xfc, 0x64, 0x9c, 0x81, 0x8a, 0x40, 0x27,
+    0x94, 0x60, 0x62, 0x4f, 0x1, 0xff, 0xc3, 0x9c,
+    0xd4, 0x80, 0x7f, 0x93, 0x20, 0x71, 0x30, 0x2f,
+    0x20, 0x3f, 0xec, 0xc5, 0x0, 0xc0, 0xff, 0xe3,
+    0x10, 0xc, 0x1, 0xa4, 0xf, 0xea, 0x20, 0x65,
+    0x90, 0x3f, 0xf9, 0x2c, 0x81, 0x64, 0x7, 0xcd,
+    0x1a, 0x11, 0x64, 0xf, 0xfe, 0xa, 0x3, 0x98,
+    0x25, 0xc0, 0xa0, 0x1f, 0x26, 0x0, 0x82, 0x60,
+    0x3f, 0xf8, 0x8, 0xa0, 0x22, 0x81, 0x60, 0x8,
+    0x6, 0x7, 0x24, 0xce, 0xd0, 0x1f, 0xe2, 0x48,
+    0x9, 0x34, 0x6, 0x20, 0x10, 0x2, 0xc, 0x80,
+    0x25, 0x7d, 0x34, 0x15, 0x18, 0x1e, 0x21, 0x1,
+    0x10, 0x38, 0x81, 0x1e, 0x7, 0x60, 0x26, 0xdc,
+    0xa3, 0x82, 0xec, 0xe, 0x28, 0x90, 0x1e, 0x40,
+    0x64, 0x2, 0x1, 0xd2, 0x0, 0x36, 0x84, 0x83,
+    0x2d, 0x80, 0xf2, 0xb3, 0x7e, 0xc8, 0x2, 0x3,
+    0x62, 0x7, 0x20, 0x58, 0x1c, 0xd0, 0x21, 0x81,
+    0xf6, 0xc, 0x8, 0xca, 0x10, 0x19, 0xd2, 0xa,
+    0x8, 0x8, 0x80, 0x3f, 0x80, 0xff, 0x92, 0x1,
+    0xf2, 0xa0, 0x76, 0x84, 0x3, 0x34, 0xa, 0x80,
+    0x37, 0x90, 0x50, 0x80, 0x77, 0x3, 0xf9, 0x42,
+    0x4, 0x40, 0x89, 0x80, 0xc4, 0x9, 0xc, 0x7,
+    0xf9, 0x1, 0xfe, 0x6c, 0x7, 0xf8, 0x81, 0x20,
+    0x6, 0x70, 0xd, 0x88, 0x1d, 0x40, 0xff, 0x88,
+    0x1f, 0xca, 0x20, 0x3e, 0x48, 0x3, 0x91, 0xc0,
+    0xff, 0xe2, 0x20, 0x3e, 0x95, 0xc4, 0x6, 0x20,
+    0xb9, 0x41, 0xf, 0x81, 0xb0, 0x1f, 0xf2, 0x40,
+    0x2c, 0xd, 0xa2, 0x20, 0x1c, 0xc4, 0x28, 0x52,
+    0xf0, 0x1b, 0x81, 0xff, 0xc1, 0x21, 0x0, 0x24,
+    0x7, 0xf9, 0xd7, 0x83, 0x5, 0x81, 0x88, 0x1f,
+    0xf3, 0x4c, 0xa8, 0x7, 0xff, 0x1, 0xb4, 0x4c,
+    0x12, 0xc, 0xc, 0x80, 0xff, 0xa2, 0x42, 0x12,
+    0x80, 0xff, 0xe0, 0xbb, 0x11, 0x8, 0x9, 0x1,
+    0xff, 0xc0, 0x64, 0x8, 0xb4, 0x7, 0x10, 0x41,
+    0x0, 0x86, 0x3, 0xf7, 0x3, 0xff, 0x82, 0x40,
+    0x14, 0x7, 0xc4, 0x10, 0xd, 0x93, 0x4f, 0x55,
+    0x98, 0x48, 0x7, 0xff, 0x10, 0xa2, 0x20, 0x1f,
+    0x20, 0x67, 0xa0, 0x4e, 0x99, 0xe0, 0x1f, 0xfc,
+    0x4, 0x0, 0x80, 0x60, 0xd4, 0x7, 0xb0, 0x1f,
+    0xfc, 0x12, 0x7, 0xfc, 0xf1, 0x35, 0x8, 0x12,
+    0x44, 0x8, 0x84, 0x7, 0xff, 0x36, 0x90, 0xcc,
+    0x3, 0x20, 0x52, 0x3, 0x48, 0x1f, 0xfc, 0xe6,
+    0x19, 0x20, 0x38, 0xc3, 0x5c, 0x20, 0x7f, 0xf3,
+    0x7b, 0xc, 0x40, 0x31, 0x75, 0xa, 0xab, 0x3,
+    0xff, 0x99, 0x0, 0x10, 0x10, 0xf, 0x23, 0xae,
+    0xe0, 0x7f, 0xf3, 0x10, 0x11, 0x20, 0x3c, 0x69,
+    0xc, 0x82, 0x7, 0xff, 0x2d, 0x74, 0x11, 0x8,
+    0x8, 0xc2, 0xd0, 0x20, 0x7f, 0xf3, 0xaa, 0x20,
+    0x48, 0x9, 0x18, 0x82, 0x0, 0x40, 0xff, 0xe6,
+    0x40, 0x3c, 0x40, 0x24, 0x0, 0x59, 0x4, 0xf,
+    0xfe, 0x62, 0x60, 0x7c, 0x42, 0x3, 0x4e, 0xc8,
+    0x1f, 0xfc, 0xb5, 0x40, 0xfc, 0x80, 0xe2, 0xe,
+    0x20, 0x7f, 0xf2, 0xf8, 0x1f, 0xfc, 0x36, 0x0,
+    0x90, 0x1f, 0xfc, 0xa6, 0xc0, 0x78, 0x80, 0x20,
+    0x7c, 0x60, 0x1f, 0xfc, 0xb6, 0x7, 0xf8, 0x81,
+    0xf7, 0x3, 0xff, 0x96, 0x69, 0x3, 0xc5, 0x1,
+    0xfa, 0x10, 0x3f, 0xf9, 0x47, 0xa0, 0x3f, 0x20,
+    0x3e, 0x8c, 0xf, 0xfe, 0x49, 0x5c, 0x81, 0xfc,
+    0x40, 0xf3, 0x60, 0x3f, 0xf9, 0x53, 0x81, 0xff,
+    0x10, 0x39, 0xc0, 0x3f, 0xf9, 0x51, 0x3a, 0x7,
+    0xff, 0xc, 0xc0, 0x3f, 0xf9, 0x49, 0x80, 0xc0,
+    0x7f, 0x88, 0x12, 0xc0, 0x7f, 0xf2, 0x95, 0x0,
+    0x40, 0xff, 0xe0, 0x9b, 0x40, 0x7f, 0xf2, 0x95,
+    0x3, 0xff, 0x86, 0x43, 0x40, 0x7f, 0xf2, 0xe0,
+    0x6, 0x43, 0x3, 0xfc, 0x8d, 0x3, 0xff, 0x97,
+    0x88, 0xe, 0x45, 0x60, 0x7f, 0x7c, 0x7, 0xff,
+    0x30, 0x81, 0x70, 0x14, 0xf, 0xe6, 0xc0, 0x7f,
+    0xf2, 0xce, 0x3, 0xe4, 0x48, 0xf, 0x58, 0x40,
+    0xff, 0xe5, 0xb2, 0x0, 0x81, 0xbb, 0xa0, 0x74,
+    0x60, 0x7f, 0xf3, 0x17, 0x2, 0x20, 0x80, 0x25,
+    0x0, 0xd1, 0x50, 0x3f, 0xf9, 0x6a, 0xa0, 0x24,
+    0x2, 0x8c, 0x7, 0x46, 0xd0, 0xf, 0xfe, 0x56,
+    0xa4, 0xc, 0x40, 0x20, 0x2a, 0x4a, 0x90, 0x80,
+    0xff, 0xe5, 0x52, 0x8, 0x19, 0x86, 0xc0, 0x51,
+    0xd6, 0x7, 0xff, 0x31, 0x20, 0x1f, 0xc4, 0x87,
+    0xa, 0x36, 0x40, 0x7f, 0xf2, 0xd0, 0x20, 0x7f,
+    0x64, 0x83, 0x12, 0x40, 0x7f, 0xf3, 0x51, 0x3,
+    0xca, 0x4a, 0x9c, 0x81, 0x3, 0xff, 0x9d, 0x0,
+    0xeb, 0x58, 0x8b, 0xe7, 0xd7, 0x7f, 0xac, 0xb4,
+    0xef, 0x44, 0x18, 0x8, 0x1f, 0x8e, 0x2, 0x7a,
+    0xcf, 0x50, 0x26, 0x44, 0xc, 0x96, 0x8c, 0x5f,
+    0xd9, 0xcd, 0x93, 0x81, 0x91, 0x62, 0x37, 0x0,
+    0x44, 0xe, 0x28, 0x3, 0xd, 0x90, 0x2, 0x0,
+    0x81, 0x30, 0x58, 0x1e, 0x99, 0x56, 0x7, 0xe6,
+    0x41, 0x2, 0xd6, 0x40, 0x1f, 0xfc, 0x38, 0x7,
+    0x24, 0x20, 0x7f, 0x16, 0x1, 0x0, 0x97, 0x74,
+    0x40, 0xff, 0xe0, 0xbb, 0x41, 0x16, 0x0, 0x81,
+    0x88, 0x1f, 0xd2, 0x1, 0x4, 0xf, 0xfe, 0x23,
+    0x4, 0x90, 0x2, 0x7, 0x20, 0x39, 0x0, 0xf8,
+    0x1, 0x30, 0x1f, 0xfc, 0x24, 0x4d, 0xa0, 0x1f,
+    0x14, 0x7, 0x60, 0x89, 0x0, 0x20, 0x7f, 0xf0,
+    0x9b, 0x44, 0x4e, 0x3, 0xff, 0x80, 0xc4, 0x1b,
+    0x90, 0x4, 0xf, 0xfe, 0x13, 0x2a, 0x80, 0xa0,
+    0x81, 0xf8, 0x80, 0x60, 0x65, 0xc5, 0x40, 0x7f,
+    0xf0, 0x5c, 0x24, 0x0, 0xad, 0xc0, 0xfc, 0x43,
+    0xc0, 0x58, 0x1c, 0x70, 0x2, 0x40, 0x78, 0x85,
+    0x1c, 0x3, 0x74, 0x4a, 0x2, 0x88, 0x4e, 0xc7,
+    0x6d, 0x2, 0x29, 0x23, 0x49, 0x2b, 0xb1, 0x24,
+    0x20, 0x7c, 0xb0, 0xcf, 0xeb, 0xbd, 0x88, 0x2,
+    0x51, 0x2, 0x24, 0xe4, 0x9a, 0x89, 0xd8, 0xe0,
+    0x1e,
+
+    /* U+0033 "3" */
+    0x3, 0xff, 0x84, 0x53, 0x89, 0x0, 0xfe, 0x20,
+    0x7f, 0xf2, 0x93, 0xbf, 0x5a, 0x58, 0x4, 0xbe,
+    0xc4, 0x84, 0x80, 0xff, 0xe3, 0xbd, 0xec, 0x41,
+    0x20, 0x5, 0x58, 0xd0, 0xbb, 0x5b, 0xc0, 0x3f,
+    0xf8, 0x84, 0xb1, 0x3, 0x92, 0x10, 0x50, 0x9,
+    0x58, 0x1c, 0xe9, 0x3, 0xff, 0x80, 0xba, 0xe1,
+    0x1, 0xfe, 0x51, 0x82, 0x4, 0x40, 0x95, 0xa2,
+    0x7, 0xf4, 0xa2, 0x86, 0x80, 0xfc, 0x40, 0xfe,
+    0x20, 0x19, 0xef, 0x30, 0x3e, 0xad, 0x80, 0x16,
+    0x7, 0xff, 0x20, 0x86, 0x4c, 0x24, 0x1, 0xc5,
+    0x86, 0x9, 0x34, 0x7, 0xfc, 0x43, 0x3, 0x90,
+    0x43, 0x81, 0x22, 0x6, 0x30, 0x12, 0x4, 0x90,
+    0x1f, 0xf1, 0x65, 0x1, 0x88, 0x68, 0x1, 0x6,
+    0x81, 0x96, 0xab, 0xa0, 0x40, 0xfc, 0x43, 0x0,
+    0xd2, 0x1, 0x16, 0xa, 0x20, 0x80, 0x74, 0x9,
+    0xaa, 0xf3, 0x32, 0x3, 0x3, 0x88, 0x60, 0xb0,
+    0x38, 0x90, 0x3, 0xc0, 0xee, 0x4, 0xc1, 0x0,
+    0x4a, 0xd0, 0x60, 0x7f, 0x19, 0x50, 0x1e, 0x2c,
+    0xf, 0x6c, 0x0, 0xc5, 0xa2, 0x6, 0x60, 0x78,
+    0xb9, 0xe, 0x69, 0x48, 0x60, 0xa, 0xe0, 0x72,
+    0x2c, 0x39, 0x78, 0x28, 0x1e, 0x7, 0x3d, 0x1b,
+    0x48, 0x1c, 0xba, 0x80, 0x14, 0x80, 0x71, 0x18,
+    0x5, 0x48, 0x49, 0x0, 0xe0, 0x65, 0x0, 0xf4,
+    0x11, 0xd4, 0x0, 0xa2, 0xc0, 0xf3, 0xd, 0x32,
+    0x6, 0x2c, 0xd, 0x80, 0xfd, 0x41, 0xc, 0x8,
+    0x82, 0x7, 0x98, 0x4a, 0xd0, 0x62, 0x40, 0x72,
+    0x3, 0xf2, 0x3, 0xe2, 0x8, 0x19, 0x2, 0x13,
+    0x6f, 0x7, 0x20, 0x78, 0x81, 0xff, 0xc6, 0xe0,
+    0x64, 0x8, 0x37, 0xed, 0x7d, 0xbe, 0x3, 0xf8,
+    0x90, 0x1f, 0x12, 0x0, 0x49, 0x4, 0x0, 0x9f,
+    0xfe, 0x8, 0x1f, 0xe4, 0x40, 0xed, 0x58, 0x2,
+    0x90, 0xf, 0xfe, 0x79, 0x60, 0x63, 0x62, 0x2,
+    0x64, 0x1, 0x3, 0xff, 0x96, 0x53, 0x3, 0x14,
+    0x7, 0x88, 0x1f, 0xfc, 0xe6, 0x8, 0x18, 0xb1,
+    0xc0, 0xf8, 0x81, 0xff, 0xd2, 0x60, 0x8, 0x11,
+    0x20, 0x3f, 0xfa, 0xc8, 0x1, 0x2, 0x20, 0x81,
+    0xff, 0xcc, 0x44, 0x80, 0xcc, 0x3, 0x20, 0x8,
+    0x4, 0x7, 0xff, 0x32, 0xa4, 0x3, 0x90, 0x1f,
+    0xa8, 0x1f, 0xfc, 0xb2, 0x8a, 0x2, 0x47, 0x86,
+    0x7, 0x12, 0x3, 0xff, 0x94, 0x69, 0x44, 0x9,
+    0x2, 0x40, 0x79, 0x1, 0xff, 0xc7, 0xb6, 0xdd,
+    0x30, 0x48, 0xc, 0x80, 0xfa, 0x81, 0xff, 0xc7,
+    0x4a, 0xc, 0xa2, 0x28, 0x19, 0x2, 0x6, 0x64,
+    0xf, 0xfe, 0x51, 0x44, 0x31, 0xc0, 0xc8, 0xe0,
+    0x25, 0x0, 0xff, 0xe6, 0x10, 0x4, 0x20, 0x31,
+    0xac, 0x1, 0xa0, 0x7f, 0xf2, 0xc8, 0x45, 0xa,
+    0x4c, 0x8, 0xf4, 0x1e, 0x7, 0xff, 0x30, 0x82,
+    0x9, 0x0, 0x20, 0x92, 0x60, 0x21, 0x3, 0xff,
+    0x9c, 0x88, 0xa, 0x0, 0x9e, 0xc2, 0xb0, 0x3f,
+    0xf9, 0x44, 0xe, 0x29, 0x81, 0x98, 0x2, 0x2,
+    0x10, 0x3f, 0xf9, 0x24, 0xf, 0xb1, 0x2, 0x60,
+    0x30, 0x17, 0x20, 0x7f, 0xf4, 0x38, 0x18, 0xf2,
+    0x60, 0x7, 0x1, 0xff, 0xcd, 0x60, 0xa2, 0x8,
+    0x7e, 0x40, 0x1d, 0x0, 0xff, 0xe3, 0x92, 0x48,
+    0x18, 0xa, 0x0, 0x87, 0x24, 0x40, 0xcc, 0xf,
+    0xfe, 0x3e, 0xcb, 0x19, 0x34, 0x20, 0x71, 0x60,
+    0x79, 0x81, 0xff, 0xc9, 0x32, 0x11, 0x4, 0xc,
+    0x88, 0x1f, 0x50, 0x3f, 0xf9, 0x6c, 0x9, 0x2,
+    0x3, 0x2, 0x80, 0xe2, 0x7, 0xff, 0x32, 0x80,
+    0x40, 0x80, 0xa4, 0x20, 0x3c, 0x40, 0xff, 0xe5,
+    0xb2, 0x7, 0xa1, 0x60, 0x62, 0x82, 0x3, 0xff,
+    0x99, 0x50, 0x6, 0xc0, 0xa4, 0x4, 0x5a, 0x94,
+    0x81, 0xff, 0xcc, 0xe8, 0x26, 0xc2, 0x30, 0x4,
+    0xa6, 0x94, 0x81, 0xff, 0xcc, 0x80, 0x10, 0x2,
+    0xc9, 0x69, 0xf4, 0x86, 0x40, 0xff, 0xe6, 0x40,
+    0x32, 0x22, 0x9, 0x1b, 0xe4, 0xc0, 0xff, 0xe6,
+    0xb0, 0x3d, 0x96, 0xa5, 0x24, 0xf1, 0x1, 0xff,
+    0xd0, 0x40, 0x10, 0x4c, 0x26, 0x4b, 0x10, 0x3f,
+    0xfa, 0x5, 0xa4, 0x16, 0x10, 0x6a, 0x3, 0xff,
+    0xa6, 0xc6, 0x2c, 0xe, 0x44, 0x80, 0xff, 0xe6,
+    0x10, 0x81, 0x8, 0x86, 0x7, 0x2e, 0x7, 0xff,
+    0x3d, 0x51, 0x60, 0xc0, 0x7d, 0x10, 0x1f, 0xfc,
+    0xec, 0x18, 0x40, 0x7c, 0x40, 0x60, 0x88, 0x11,
+    0x4, 0x80, 0x10, 0x3f, 0xf8, 0x3e, 0xa1, 0x10,
+    0x4, 0x8, 0x24, 0x1, 0xdd, 0xe7, 0x52, 0xcb,
+    0xf7, 0x3, 0xff, 0x80, 0x40, 0xf9, 0x82, 0x0,
+    0x80, 0x40, 0xa2, 0xb, 0xd, 0x20, 0x2, 0x7,
+    0xe2, 0x10, 0x6, 0x90, 0x80, 0x20, 0x7b, 0xb0,
+    0x88, 0x38, 0x34, 0x50, 0xa, 0x7, 0xea, 0x10,
+    0x6d, 0xc3, 0x8, 0x9, 0x1, 0x23, 0xb, 0x4,
+    0x80, 0x72, 0x4, 0xc8, 0x1e, 0x4c, 0xa8, 0x51,
+    0x26, 0x11, 0x3, 0x89, 0x34, 0x2e, 0x68, 0x7,
+    0x3, 0xb2, 0x3, 0x3a, 0xe7, 0x1c, 0xb2, 0x18,
+    0x20, 0x10, 0xa, 0x17, 0xf4, 0x40, 0x8, 0x1f,
+    0x5f, 0xb3, 0x89, 0x8d, 0x9c, 0x24, 0x20, 0x78,
+    0x86, 0x0, 0xd4, 0x8, 0x4d, 0x80, 0xfc, 0x4c,
+    0xad, 0x40, 0x8, 0x25, 0x70, 0x3b, 0xb0, 0x22,
+    0x8c, 0x47, 0xe0, 0x3e, 0x40, 0x47, 0x90, 0x32,
+    0x20, 0x10, 0x1e, 0xb0, 0x3, 0xd8, 0x83, 0x32,
+    0x0, 0xf9, 0x12, 0x3, 0xf3, 0x3, 0x70, 0x4,
+    0x87, 0x2, 0x32, 0x1c, 0x20, 0x8, 0x1f, 0x89,
+    0x0, 0x2d, 0x1, 0x14, 0xb, 0x0, 0x4d, 0x18,
+    0x12, 0x60, 0x82, 0x4c, 0x81, 0xff, 0xc1, 0x68,
+    0xd, 0xc1, 0x60, 0x8, 0x2c, 0xc, 0xa0, 0xa1,
+    0x36, 0x3, 0xff, 0x8e, 0x60, 0x3, 0xc0, 0xb8,
+    0x1e, 0x72, 0x3, 0x45, 0x1, 0xff, 0xc2, 0x20,
+    0x44, 0x13, 0xc3, 0x10, 0x3e, 0x79, 0x56, 0xc0,
+    0x7f, 0x30, 0x22, 0x8, 0x1c, 0x48, 0x15, 0xc8,
+    0x1f, 0xc6, 0xa8, 0x90, 0xf, 0xcc, 0x2b, 0x40,
+    0x7f, 0x47, 0x0, 0xff, 0xe1, 0xe6, 0x40, 0xc5,
+    0x37, 0x8d, 0x2d, 0x80, 0x8b, 0xac, 0xf, 0xfe,
+    0x34, 0xde, 0x32, 0x49, 0xb2, 0xae, 0x50, 0x17,
+    0xf6, 0x88, 0xf, 0xfe, 0x53, 0x9b, 0xfb, 0x63,
+    0x9, 0xc8, 0x40, 0x44, 0x80, 0xff, 0x80,
+
+    /* U+0034 "4" */
+    0x3, 0xff, 0xdd, 0xbc, 0x9f, 0xc0, 0xa4, 0x3,
+    0xff, 0x98, 0x82, 0x65, 0xbe, 0x0, 0x50, 0x1f,
+    0xfc, 0xca, 0x81, 0x2e, 0x4, 0xa1, 0x2, 0x40,
+    0x7f, 0xf2, 0x9a, 0x20, 0x8, 0x14, 0x33, 0x1,
+    0xff, 0xcd, 0x30, 0xe, 0xc1, 0x56, 0x7, 0x10,
+    0x3f, 0xfa, 0x48, 0x80, 0x9a, 0x82, 0x7, 0xff,
+    0x27, 0x81, 0xe4, 0x7, 0x43, 0xa8, 0x1f, 0xfc,
+    0x98, 0x40, 0xf1, 0x3, 0xa0, 0x9c, 0xf, 0xfe,
+    0x4a, 0x3, 0xff, 0x86, 0x50, 0x1f, 0xfc, 0x86,
+    0x40, 0xe4, 0x7, 0xf4, 0x3, 0xff, 0x92, 0xe8,
+    0x1c, 0x40, 0xfc, 0x90, 0xf, 0xfe, 0x4d, 0xa0,
+    0x39, 0x81, 0xfa, 0x1, 0xff, 0xc9, 0xa8, 0xf,
+    0x88, 0x1e, 0x84, 0xf, 0xfe, 0x44, 0x40, 0x7e,
+    0x20, 0x71, 0x60, 0x7f, 0xf1, 0xcd, 0xc0, 0x7f,
+    0x10, 0x3b, 0x81, 0xff, 0xc8, 0xa8, 0x81, 0xfc,
+    0x40, 0xd0, 0x81, 0xff, 0xc8, 0x60, 0x7f, 0xf0,
+    0xdb, 0x1, 0xff, 0xc8, 0xc0, 0x7f, 0x10, 0x38,
+    0xc0, 0x3f, 0xf9, 0xc, 0x81, 0xfc, 0x40, 0x21,
+    0x30, 0x1f, 0xfc, 0x83, 0x0, 0xff, 0xe0, 0xb0,
+    0x40, 0xff, 0xe4, 0xd0, 0xc, 0x60, 0x3f, 0x91,
+    0x40, 0x7f, 0xf2, 0x1b, 0x0, 0xe3, 0x1, 0xfc,
+    0xb0, 0x1f, 0xfc, 0x9a, 0x7, 0x6e, 0x7, 0xec,
+    0x7, 0xff, 0x28, 0x80, 0x3c, 0x38, 0x7, 0xd8,
+    0x81, 0xe6, 0x7, 0xff, 0xa, 0x81, 0x10, 0x10,
+    0x81, 0xea, 0x48, 0xf, 0x5a, 0x40, 0x7f, 0xf0,
+    0x10, 0x2, 0x4, 0xd3, 0x3, 0x34, 0x7, 0xd4,
+    0xa8, 0x7, 0xf8, 0x90, 0x11, 0x2, 0x61, 0x81,
+    0xa4, 0x1, 0xec, 0x80, 0x30, 0x3f, 0xd7, 0x1,
+    0xd4, 0x81, 0xec, 0xa0, 0x1a, 0xb2, 0x4, 0xa8,
+    0x1f, 0xa8, 0x1a, 0xb0, 0xd8, 0x93, 0x1, 0x4a,
+    0x3, 0xd0, 0xa, 0x4, 0xa0, 0x3a, 0x26, 0x5,
+    0x58, 0x4f, 0x9f, 0x20, 0x20, 0x3c, 0x80, 0xd0,
+    0x1, 0x41, 0x10, 0x40, 0xfe, 0x47, 0x89, 0xda,
+    0x40, 0x39, 0x81, 0xfa, 0x83, 0x68, 0x26, 0x7,
+    0xec, 0x40, 0x38, 0x40, 0xf9, 0x20, 0x1f, 0x54,
+    0x82, 0x82, 0x8, 0x1f, 0x2a, 0x85, 0x3, 0xf9,
+    0x30, 0x3e, 0x96, 0x43, 0x8, 0x10, 0x39, 0x4e,
+    0xcf, 0x20, 0x81, 0xf6, 0x20, 0x7f, 0x2d, 0x80,
+    0x28, 0x19, 0xea, 0x5e, 0x96, 0x9b, 0x4b, 0x4d,
+    0xd1, 0x81, 0xfe, 0x6b, 0x0, 0x48, 0x0, 0xdf,
+    0xbf, 0x14, 0x14, 0x86, 0x92, 0x48, 0xb0, 0x3f,
+    0xc4, 0x10, 0x46, 0x4e, 0xf2, 0x49, 0x9, 0x1,
+    0xe2, 0x20, 0x48, 0x7, 0xff, 0x2, 0x8, 0xcf,
+    0x70, 0x81, 0x89, 0x0, 0x40, 0x1a, 0xfc, 0x7,
+    0xff, 0x14, 0xd3, 0x40, 0xfc, 0x48, 0x20, 0x7,
+    0x1c, 0x40, 0xff, 0xe1, 0x11, 0x5d, 0x3, 0xc4,
+    0xf, 0xeb, 0xa8, 0x1f, 0xfc, 0x32, 0x0, 0x90,
+    0x1e, 0x60, 0x44, 0xd, 0x8, 0x11, 0x3, 0xff,
+    0x88, 0x40, 0x10, 0x31, 0x3, 0x88, 0x28, 0x80,
+    0x24, 0x7, 0xff, 0xc, 0xd0, 0x4, 0xc, 0xc0,
+    0x98, 0x61, 0x1, 0x10, 0x3f, 0xf8, 0x85, 0x8,
+    0x7, 0xf9, 0x86, 0xd4, 0x81, 0xff, 0xc6, 0x44,
+    0x60, 0x3f, 0xf8, 0x25, 0x16, 0x9, 0x1, 0xff,
+    0xc3, 0x60, 0x9, 0x1, 0xf8, 0x82, 0x0, 0x99,
+    0x64, 0x7, 0xff, 0x5, 0x6, 0x10, 0x2c, 0xf,
+    0x11, 0xb8, 0x4, 0xc5, 0x40, 0x81, 0xff, 0xc0,
+    0x7e, 0x0, 0xab, 0xb4, 0x99, 0xb4, 0xc5, 0xfe,
+    0xa8, 0x2, 0xb9, 0x4, 0xe2, 0x3, 0xc5, 0x90,
+    0x8, 0xb9, 0x68, 0xc8, 0x40, 0x7f, 0xf0, 0x38,
+    0x48, 0x58, 0x72, 0x6b, 0xc0, 0xff, 0xe6, 0xb0,
+    0x6, 0x90, 0x17, 0x16, 0xa0, 0x1f, 0xfc, 0xf2,
+    0x60, 0xa, 0x64, 0x12, 0x1, 0xff, 0xcf, 0x21,
+    0x44, 0x34, 0xba, 0xf0, 0x3f, 0xf9, 0xa4, 0x5,
+    0xf9, 0x79, 0x81, 0x1c, 0x81, 0xff, 0xcd, 0x40,
+    0x38, 0x33, 0xf2, 0xa, 0x81, 0xff, 0xcd, 0x84,
+    0x6e, 0xca, 0x4, 0x96, 0xa0, 0x7f, 0xf3, 0x70,
+    0x98, 0xcb, 0xb2, 0xcd, 0xa0, 0x3f, 0xf9, 0xc6,
+    0xd4, 0xb5, 0xf5, 0xa8, 0xa9, 0x3, 0xff, 0x99,
+    0x93, 0x24, 0x9, 0x1, 0xdd, 0x1, 0xff, 0xcc,
+    0x81, 0xe0, 0x22, 0x80, 0x17, 0x8, 0x1f, 0xfc,
+    0xdb, 0x38, 0x2, 0x4c, 0x1, 0x44, 0xf, 0xfe,
+    0x76, 0xa4, 0x39, 0xa4, 0x1, 0x72, 0x7, 0xff,
+    0x36, 0xb0, 0xa, 0xeb, 0x0, 0x17, 0xc0, 0xff,
+    0xe6, 0xa6, 0x0, 0x90, 0x1f, 0x10, 0x3f, 0xf9,
+    0xac, 0xf, 0xfe, 0x6, 0x3, 0xff, 0x9c, 0xc0,
+    0xff, 0x88, 0x1f, 0xfc, 0xc4, 0xe0, 0x1f, 0xf3,
+    0x3, 0xff, 0x99, 0xab, 0x60, 0x24, 0x7, 0x88,
+    0x1f, 0xfc, 0xd2, 0x28, 0x19, 0x81, 0xc4, 0xf,
+    0xfe, 0x73, 0x34, 0x3, 0x60, 0x6, 0x90, 0x3f,
+    0xf9, 0xfe, 0xa4, 0x2, 0x26, 0xdc, 0xf, 0xfe,
+    0x6c, 0xde, 0x8c, 0xa8, 0xbf, 0xa2, 0x3, 0xff,
+    0x9c, 0x40, 0x95, 0x7d, 0x96, 0x88, 0x1f, 0xfd,
+    0x7, 0x20, 0x98, 0x3, 0xe0, 0x40,
+
+    /* U+0035 "5" */
+    0x2, 0x21, 0x5f, 0x64, 0x56, 0xb5, 0x60, 0x44,
+    0xe, 0x20, 0xa4, 0x69, 0x92, 0x70, 0xd0, 0x3e,
+    0x4f, 0xc, 0x47, 0x40, 0x14, 0xb3, 0xec, 0x27,
+    0x7b, 0xbd, 0xf6, 0x6c, 0xa7, 0x32, 0x7, 0x69,
+    0x19, 0xc4, 0xee, 0xea, 0xd9, 0x1, 0x11, 0x95,
+    0x41, 0x6, 0x6, 0x2c, 0x95, 0x60, 0x44, 0x11,
+    0xc8, 0x1c, 0x9d, 0x90, 0xc0, 0x30, 0xc4, 0x80,
+    0x3f, 0xc4, 0x17, 0x28, 0x1c, 0x62, 0x3, 0xf1,
+    0x68, 0x87, 0x48, 0x6, 0x7, 0xfc, 0x48, 0x12,
+    0x3, 0x1e, 0x40, 0xff, 0x30, 0x59, 0x5c, 0x3,
+    0x3, 0xff, 0x84, 0x50, 0x12, 0xf4, 0xf, 0xfe,
+    0x13, 0x6, 0x80, 0x21, 0x1, 0xff, 0xc4, 0x33,
+    0x90, 0x3f, 0xec, 0x6, 0x30, 0xc, 0x80, 0xff,
+    0xe2, 0xb2, 0x7, 0xff, 0x3, 0x20, 0x80, 0xae,
+    0xc4, 0x7, 0xff, 0x18, 0x90, 0x11, 0x3, 0xf3,
+    0x26, 0x0, 0x7b, 0x48, 0x7, 0xff, 0xa, 0x81,
+    0x62, 0x4, 0x43, 0x20, 0x7b, 0x16, 0x1, 0x8b,
+    0xc8, 0x1f, 0xc8, 0x1, 0x3, 0xb1, 0x3, 0x99,
+    0x3, 0x12, 0x60, 0x72, 0x8, 0x87, 0x2, 0xd5,
+    0x92, 0x9b, 0xe4, 0x5, 0x9, 0x1, 0xfe, 0x28,
+    0xff, 0xfd, 0xab, 0xb0, 0xa9, 0xa3, 0x27, 0x1,
+    0xc4, 0xf, 0xf3, 0x80, 0x7f, 0x89, 0x4, 0x40,
+    0xff, 0xe0, 0xfd, 0x96, 0x36, 0x44, 0xf, 0xfe,
+    0xb7, 0xd9, 0x63, 0x64, 0x40, 0x98, 0x1f, 0xfd,
+    0x42, 0x0, 0x81, 0xe6, 0xc4, 0xf, 0xfe, 0x81,
+    0x0, 0xc1, 0x1, 0x8, 0x18, 0x81, 0xff, 0xd0,
+    0x20, 0xb0, 0x34, 0x20, 0x48, 0xf, 0xfe, 0xc1,
+    0x92, 0xfd, 0x80, 0xff, 0xea, 0x20, 0x17, 0x12,
+    0x60, 0x90, 0x1f, 0xfd, 0x2, 0x1, 0x98, 0x2c,
+    0xb5, 0xfc, 0x80, 0xff, 0xe8, 0x10, 0xf, 0x20,
+    0xc, 0x1, 0x10, 0xf, 0xfe, 0x99, 0x88, 0x10,
+    0x3a, 0x8e, 0x7, 0xff, 0x48, 0xdf, 0x88, 0x18,
+    0xfd, 0x80, 0x7f, 0xf4, 0xc8, 0x1f, 0x91, 0x54,
+    0xe8, 0x7, 0xff, 0x36, 0x1, 0x30, 0x3e, 0x2d,
+    0x52, 0xb7, 0xa4, 0xf, 0xfe, 0x4b, 0xc4, 0x34,
+    0x6, 0x23, 0xf0, 0x11, 0x20, 0xb3, 0x3, 0xff,
+    0x92, 0x73, 0x8, 0xc, 0x41, 0x0, 0x60, 0x1d,
+    0x33, 0x3, 0xff, 0x93, 0x10, 0x12, 0x2, 0x20,
+    0x8, 0x1f, 0x19, 0xd8, 0x1f, 0xfc, 0x8b, 0x0,
+    0x20, 0x45, 0x0, 0x60, 0x1f, 0xdb, 0x8, 0x1f,
+    0xfc, 0x77, 0x90, 0x4, 0x8, 0x2c, 0xf, 0xf3,
+    0x3e, 0x1, 0xff, 0xc7, 0x36, 0x87, 0x2, 0x24,
+    0x7, 0xf8, 0x82, 0xf0, 0x1f, 0xfc, 0x85, 0x91,
+    0x3, 0xff, 0x8c, 0x68, 0x1f, 0xfc, 0x82, 0x5a,
+    0x90, 0x3f, 0xf8, 0x4, 0xc, 0x98, 0x1f, 0xfc,
+    0xa5, 0x80, 0xff, 0x89, 0x1, 0xd4, 0x81, 0xff,
+    0xcb, 0x80, 0x7f, 0x88, 0x1e, 0x3c, 0xf, 0xfe,
+    0x5b, 0xa0, 0x7e, 0x20, 0x4c, 0xc, 0x58, 0x1f,
+    0xfc, 0xb5, 0x40, 0xf2, 0x60, 0xc6, 0x2d, 0x7e,
+    0x60, 0x7f, 0xf3, 0x14, 0x44, 0x1, 0xc0, 0xc,
+    0x6d, 0xd2, 0x1, 0xff, 0xcf, 0x65, 0x82, 0x5d,
+    0x1, 0x37, 0x10, 0x22, 0x7, 0xff, 0x36, 0xa0,
+    0x87, 0x3, 0xc5, 0x21, 0x44, 0xf, 0xfe, 0x69,
+    0xc0, 0x64, 0xc0, 0xc7, 0x27, 0xdc, 0xc0, 0x7f,
+    0xf3, 0xe, 0x43, 0xa6, 0x6, 0x2f, 0xe2, 0xbd,
+    0x40, 0x7f, 0xf3, 0x8, 0x2, 0x40, 0x7c, 0xd1,
+    0x91, 0x58, 0x1f, 0xfc, 0xd4, 0x8c, 0x94, 0x3,
+    0x13, 0x34, 0x3, 0x1, 0xff, 0xcd, 0x98, 0x83,
+    0x2, 0x4, 0x10, 0x40, 0x10, 0x63, 0xcc, 0x11,
+    0x20, 0x4b, 0x40, 0x7f, 0xf0, 0x18, 0x1c, 0xc1,
+    0x84, 0xf, 0x51, 0x1e, 0x36, 0x9b, 0x76, 0x94,
+    0x7, 0xfc, 0x40, 0xc9, 0x0, 0x40, 0x3e, 0x40,
+    0x18, 0x40, 0x7e, 0x20, 0x7f, 0xc4, 0x10, 0x9,
+    0x0, 0xff, 0xe0, 0x92, 0x4c, 0x80, 0x40, 0x54,
+    0xf, 0xfe, 0x1, 0x20, 0x22, 0x80, 0xfe, 0x3d,
+    0xc4, 0xc7, 0x0, 0xc0, 0x8a, 0x3, 0xfe, 0xea,
+    0x20, 0x90, 0xf, 0xf7, 0x5d, 0x71, 0xc1, 0x60,
+    0x64, 0x7, 0xfd, 0x54, 0x6d, 0x0, 0xff, 0xe0,
+    0x1c, 0x98, 0xe1, 0x90, 0x32, 0x3, 0xff, 0x84,
+    0x49, 0x82, 0x40, 0x44, 0xe, 0x4e, 0xd0, 0x41,
+    0x1, 0xc8, 0xf, 0xfa, 0x90, 0xa, 0x83, 0x68,
+    0x16, 0x7, 0x1a, 0x38, 0xa0, 0xf0, 0x31, 0x3,
+    0xfe, 0x64, 0xf, 0x4a, 0xaf, 0x2, 0x21, 0xb2,
+    0x24, 0x0, 0xf0, 0x36, 0x3, 0xff, 0x92, 0xa1,
+    0x2, 0x60, 0xa, 0x7, 0x85, 0xc0, 0xff, 0xe2,
+    0x20, 0x3f, 0xc4, 0xc, 0x43, 0xc3, 0x8, 0x14,
+    0x3, 0xa0, 0x1f, 0xcd, 0x80, 0xc4, 0x8, 0x86,
+    0x8, 0xe, 0x1f, 0xe0, 0x32, 0x3, 0xcc, 0xf,
+    0xce, 0x60, 0x23, 0x1a, 0xd, 0x25, 0x20, 0x10,
+    0x13, 0x81, 0x2, 0x7, 0xc9, 0x40, 0x46, 0x40,
+    0x60, 0x44, 0x9a, 0x9, 0x1, 0x0, 0x8e, 0x88,
+    0x8, 0x86, 0xc0, 0x7b, 0xcb, 0xfd, 0x90, 0x6,
+    0x6, 0xa0, 0x7e, 0x24, 0xc, 0x21, 0xc, 0xe,
+    0x60, 0x72, 0x8, 0xf, 0x90, 0x18, 0x84, 0x80,
+    0x77, 0x81, 0xdf, 0x34, 0x0, 0x63, 0x3, 0xc5,
+    0xa0, 0x22, 0x7, 0x10, 0x26, 0x7, 0x90, 0x12,
+    0x16, 0x6a, 0x9, 0x1, 0xf8, 0xa0, 0x33, 0x20,
+    0x48, 0x9, 0x2, 0x0, 0xe6, 0x7, 0x10, 0xc0,
+    0xff, 0xe3, 0x22, 0x4, 0x90, 0x3, 0x24, 0x4,
+    0x40, 0xe4, 0x52, 0x6, 0xc8, 0xf, 0xfe, 0x11,
+    0x3, 0x14, 0x1, 0x1, 0xb8, 0x1e, 0x3d, 0xb0,
+    0x2d, 0x1, 0xff, 0xc7, 0x20, 0x1b, 0x60, 0x14,
+    0x81, 0xf1, 0xc8, 0x10, 0x48, 0xf, 0xc8, 0x9,
+    0x4, 0x4, 0x41, 0x65, 0x8a, 0x80, 0xff, 0x5d,
+    0x2b, 0x20, 0x7e, 0x41, 0xb2, 0x8, 0xe, 0x20,
+    0x97, 0x40, 0x7f, 0xf0, 0x8, 0x64, 0xe, 0x48,
+    0x40, 0x95, 0x89, 0x0, 0xf3, 0xc0, 0x7f, 0xf1,
+    0xa7, 0xa8, 0x2, 0x40, 0xe5, 0x8e, 0xa5, 0x18,
+    0xe7, 0x80, 0x7f, 0xf2, 0x55, 0xfd, 0x62, 0x38,
+    0x85, 0xbe, 0xb9, 0xc6, 0x40, 0xff, 0x80,
+
+    /* U+0036 "6" */
+    0x3, 0xff, 0x98, 0x40, 0xfc, 0x40, 0xff, 0xe8,
+    0xa7, 0x7f, 0x68, 0xc2, 0xbe, 0x34, 0x48, 0xf,
+    0xfe, 0x61, 0x77, 0x7b, 0x4, 0x29, 0x2b, 0xd9,
+    0xc, 0xbb, 0xc0, 0x3f, 0xf9, 0x57, 0x44, 0x40,
+    0x24, 0x85, 0xb0, 0x8a, 0x42, 0x3, 0x38, 0x7,
+    0xff, 0x19, 0xbb, 0x10, 0x39, 0x1, 0x90, 0x2,
+    0x7, 0xe6, 0xd0, 0xf, 0xfe, 0x1e, 0x96, 0x50,
+    0x3f, 0xf9, 0x48, 0x2, 0xc0, 0x7f, 0xf0, 0x17,
+    0x20, 0x82, 0x40, 0x7f, 0xf2, 0x50, 0x26, 0xa0,
+    0x7f, 0x95, 0x3, 0xff, 0x9c, 0x80, 0xa0, 0x5,
+    0x40, 0xfe, 0xa0, 0x7f, 0xf2, 0x88, 0x19, 0x81,
+    0x10, 0x24, 0x7, 0xea, 0x48, 0xf, 0xfe, 0x49,
+    0x3, 0x10, 0x3f, 0x60, 0x3c, 0x51, 0x20, 0x3f,
+    0xfa, 0xf4, 0x81, 0xc5, 0x81, 0xff, 0xca, 0xb4,
+    0x80, 0xff, 0xe0, 0x4c, 0x80, 0xc8, 0x81, 0xff,
+    0xc5, 0x2d, 0x80, 0x48, 0x20, 0x7f, 0xf0, 0xb0,
+    0x1b, 0xa0, 0x3f, 0xf8, 0x67, 0x64, 0x8f, 0xd9,
+    0xa6, 0x7, 0xff, 0x5, 0x1, 0x98, 0x1f, 0xfc,
+    0x4c, 0x40, 0xf5, 0x2c, 0xf, 0xfe, 0xa, 0x3,
+    0x10, 0x3f, 0xf8, 0x6c, 0xf, 0xe4, 0x7, 0xff,
+    0x8, 0x81, 0x40, 0x3f, 0xf8, 0x98, 0xf, 0xec,
+    0x7, 0xff, 0x8, 0x81, 0x20, 0x3f, 0xf8, 0x8c,
+    0xf, 0xfe, 0x63, 0x2, 0x20, 0x7f, 0xf3, 0x98,
+    0x1f, 0x88, 0x1f, 0xfd, 0x92, 0x7, 0x18, 0x4,
+    0x80, 0x88, 0x1f, 0xfd, 0x12, 0x7, 0x9c, 0x2,
+    0x44, 0x3, 0x3, 0xff, 0xa5, 0x27, 0x5f, 0x34,
+    0x95, 0x90, 0x80, 0xff, 0xe3, 0xb0, 0x3f, 0x8a,
+    0x6f, 0x24, 0x61, 0xbf, 0x1, 0xff, 0xff, 0x3,
+    0xff, 0x8e, 0x80, 0xe2, 0x7, 0xff, 0x6d, 0x90,
+    0x31, 0x3, 0xfe, 0x20, 0x7f, 0xf3, 0xc9, 0x1,
+    0xf8, 0x81, 0xf5, 0x3, 0xff, 0xa1, 0x40, 0xfc,
+    0x40, 0xf8, 0xd0, 0x3f, 0xf9, 0xe4, 0x9b, 0x49,
+    0x2, 0x7, 0xf2, 0xc8, 0x81, 0xff, 0xcc, 0xa5,
+    0xb4, 0x90, 0x20, 0x7f, 0x8d, 0xd0, 0xf, 0xfe,
+    0x59, 0x0, 0x50, 0x1f, 0xfc, 0x57, 0xb3, 0xe6,
+    0x80, 0xff, 0xe4, 0x16, 0x7, 0xff, 0x18, 0x82,
+    0x3d, 0xc8, 0xf, 0xfe, 0x1c, 0x76, 0x1, 0xff,
+    0xc6, 0x24, 0x88, 0xf4, 0x59, 0x4, 0xf, 0xfe,
+    0x3, 0xac, 0x36, 0x20, 0x7f, 0xf1, 0xa, 0xb,
+    0x60, 0x4, 0xf8, 0x44, 0x80, 0xfe, 0xb2, 0xbe,
+    0x9, 0x1, 0xff, 0xc1, 0x20, 0xf, 0x1c, 0x1,
+    0x20, 0xeb, 0xd4, 0xf, 0xe4, 0x4a, 0x16, 0xc0,
+    0x7f, 0x10, 0x38, 0x90, 0x74, 0x80, 0x26, 0x4,
+    0x2e, 0x40, 0xed, 0x80, 0x81, 0x66, 0x40, 0xfc,
+    0x40, 0xf1, 0xa6, 0x90, 0x22, 0x43, 0x81, 0x62,
+    0x6, 0xb4, 0x8, 0x14, 0x24, 0x7, 0xff, 0x1b,
+    0x1, 0x88, 0x20, 0x76, 0x2, 0x34, 0xc, 0x40,
+    0xff, 0x88, 0x1f, 0x26, 0x11, 0x2, 0x62, 0xe2,
+    0x6, 0xa0, 0xb, 0x3, 0xff, 0x8a, 0x48, 0x12,
+    0x40, 0x80, 0x60, 0x67, 0x46, 0x20, 0x64, 0x4,
+    0x80, 0xc4, 0xf, 0xf4, 0xba, 0x7d, 0xf9, 0x26,
+    0x9, 0x0, 0xc6, 0x10, 0x3c, 0xc0, 0x20, 0x3f,
+    0xe3, 0x5d, 0x6c, 0x10, 0x2, 0xab, 0xc5, 0xa0,
+    0x31, 0x24, 0x7, 0xa8, 0x4, 0x7, 0xfd, 0x77,
+    0xcc, 0xf, 0xd0, 0x24, 0x3, 0xa0, 0x28, 0xe,
+    0x20, 0x81, 0xff, 0xc0, 0xce, 0xb8, 0x7, 0xf1,
+    0x60, 0x82, 0xc, 0x21, 0x1, 0xc4, 0x10, 0x3f,
+    0xf8, 0x9, 0xb, 0x60, 0x3f, 0xa2, 0x4, 0x10,
+    0x61, 0x20, 0x38, 0x93, 0x40, 0x7f, 0xf0, 0x48,
+    0x2, 0x7, 0xfa, 0x30, 0xa, 0x0, 0x44, 0xa,
+    0xd7, 0xa7, 0x1, 0xff, 0xc1, 0x69, 0x8, 0x1f,
+    0xea, 0xc0, 0x28, 0x2b, 0x20, 0x89, 0xed, 0x62,
+    0x7, 0xff, 0x2, 0x1c, 0x40, 0xff, 0xa9, 0x24,
+    0x0, 0xa2, 0x52, 0x2e, 0xb5, 0x30, 0x1f, 0xfc,
+    0x6, 0x42, 0x40, 0x3f, 0xe8, 0x49, 0x2, 0x42,
+    0x9f, 0x6b, 0xf2, 0x80, 0x81, 0xfe, 0x26, 0xcf,
+    0x50, 0x3f, 0xcc, 0xc, 0x87, 0x5a, 0x82, 0xa2,
+    0xab, 0x81, 0x22, 0x7, 0x21, 0x48, 0x2c, 0xf,
+    0xfe, 0x13, 0x24, 0xc8, 0xa8, 0xb5, 0x39, 0x44,
+    0x6, 0x20, 0x71, 0x61, 0x34, 0x7, 0xff, 0x11,
+    0xb0, 0xe, 0x90, 0x1c, 0x80, 0x1a, 0x30, 0x1f,
+    0x16, 0x35, 0xc8, 0xf, 0xf1, 0x3, 0x31, 0x42,
+    0x20, 0x64, 0x48, 0xa, 0x70, 0x3c, 0xc0, 0x72,
+    0x88, 0x1f, 0xfc, 0x2, 0x8, 0x44, 0x98, 0x1c,
+    0xb8, 0xe, 0x7, 0xc8, 0x2, 0x38, 0xba, 0x7,
+    0xff, 0x0, 0xd1, 0x20, 0x60, 0x3e, 0x84, 0x60,
+    0xc, 0xc, 0xc9, 0x0, 0x60, 0x8, 0x1f, 0xfc,
+    0xc, 0x19, 0x48, 0x7, 0x88, 0xa, 0x10, 0x28,
+    0xc, 0x9b, 0x0, 0x44, 0x30, 0x3f, 0xf8, 0x1a,
+    0xa1, 0x10, 0x6, 0x8, 0x20, 0x72, 0x68, 0x1,
+    0x7f, 0xa, 0xc2, 0x4, 0xf, 0xfe, 0x22, 0x40,
+    0xc, 0x10, 0x3e, 0xe1, 0x82, 0xce, 0x4f, 0x14,
+    0x80, 0x8, 0x1f, 0x90, 0x19, 0xa2, 0x40, 0x7f,
+    0x70, 0x9, 0x8, 0x44, 0x34, 0x5e, 0x8, 0x2,
+    0x3, 0xf6, 0x4, 0x35, 0xcb, 0x4, 0x9, 0x1,
+    0x20, 0x2e, 0xa1, 0x60, 0xe0, 0x22, 0x5, 0x40,
+    0xf8, 0xb2, 0xa1, 0x60, 0x10, 0x20, 0x78, 0x90,
+    0x13, 0x64, 0x68, 0x68, 0x10, 0x40, 0x8f, 0x40,
+    0x67, 0xa7, 0xa7, 0x14, 0xb, 0x3, 0x20, 0x14,
+    0xc, 0xcf, 0xe8, 0x98, 0x16, 0x3, 0xd7, 0xfc,
+    0x20, 0xba, 0xd0, 0x26, 0x3, 0xc4, 0x30, 0x38,
+    0x94, 0x3, 0x10, 0x80, 0xff, 0x17, 0x63, 0x0,
+    0x41, 0x25, 0xc0, 0xe8, 0xc0, 0xc7, 0x22, 0x9b,
+    0x94, 0x40, 0x81, 0xc8, 0x8, 0xe2, 0x6, 0x24,
+    0x1, 0x1, 0xef, 0x0, 0xc6, 0x6e, 0xf, 0x6a,
+    0xb0, 0x40, 0xe4, 0x50, 0x1f, 0xf1, 0x2e, 0x7,
+    0x10, 0x3e, 0x69, 0x1c, 0x0, 0x40, 0xfe, 0x28,
+    0x1, 0x6c, 0x4, 0x68, 0x2c, 0x82, 0xc, 0x80,
+    0x3f, 0x40, 0x22, 0x4c, 0x81, 0xff, 0xc1, 0x4c,
+    0xd, 0xc1, 0x44, 0x10, 0xc, 0xf, 0xcd, 0x82,
+    0x9, 0x92, 0x3, 0xff, 0x82, 0x40, 0xe6, 0x0,
+    0xf0, 0x7, 0x1, 0xfe, 0x90, 0x82, 0x46, 0x80,
+    0xff, 0xe5, 0x10, 0x47, 0x3, 0xff, 0x80, 0xf2,
+    0xee, 0x30, 0x3f, 0xf8, 0x4, 0x10, 0x3c, 0x40,
+    0x7e, 0x20, 0x7f, 0xf0, 0x4d, 0x37, 0x10, 0x3f,
+    0xcb, 0x42, 0x40, 0x7d, 0x59, 0x3, 0xff, 0x8c,
+    0x6b, 0x20, 0x62, 0x9b, 0x40, 0xe8, 0x6c, 0x40,
+    0x17, 0x90, 0x1f, 0xfc, 0xa9, 0xb2, 0x22, 0x49,
+    0xb4, 0xcb, 0x50, 0x13, 0xf6, 0x84, 0xf, 0xfe,
+    0x69, 0x77, 0x7f, 0x6e, 0xc1, 0x72, 0x10, 0x11,
+    0x20, 0x3f, 0xe0,
+
+    /* U+0037 "7" */
+    0x3, 0xfe, 0xa5, 0xb1, 0xd, 0x92, 0xc0, 0x81,
+    0xc4, 0x80, 0x8b, 0x6d, 0x16, 0xee, 0xc, 0x40,
+    0xff, 0xe0, 0x3d, 0xe6, 0xf2, 0x3c, 0xb7, 0x30,
+    0x45, 0xd9, 0xe4, 0x69, 0x4b, 0xa4, 0x46, 0x47,
+    0x3, 0xf8, 0xb6, 0x21, 0x81, 0xc8, 0x80, 0x41,
+    0x76, 0x8, 0x11, 0x60, 0x90, 0x1f, 0x44, 0x40,
+    0xf1, 0x7, 0x48, 0x3, 0xff, 0x82, 0xf0, 0x24,
+    0x7, 0xc4, 0xf, 0xcb, 0xa4, 0x3, 0xe3, 0x10,
+    0x1f, 0xfc, 0x24, 0x3, 0xd0, 0x4, 0xf, 0xfe,
+    0x12, 0xc8, 0xe, 0xbf, 0x54, 0x7, 0xff, 0x9,
+    0x1, 0x34, 0x18, 0x20, 0x48, 0xf, 0xd4, 0x81,
+    0xec, 0x0, 0x81, 0xff, 0xc1, 0x20, 0x6a, 0xc8,
+    0x40, 0x78, 0x81, 0x90, 0x2, 0x40, 0x79, 0x82,
+    0x7, 0xff, 0x9, 0x90, 0x2a, 0xc0, 0xdc, 0x9,
+    0x10, 0x32, 0x2, 0xa0, 0x78, 0xd6, 0x7, 0xff,
+    0x9, 0x1b, 0x12, 0x1, 0xfe, 0x20, 0x78, 0x90,
+    0x40, 0x79, 0x48, 0x3, 0xff, 0x84, 0x9b, 0x1e,
+    0x1, 0x80, 0xe4, 0x8, 0x81, 0xd4, 0x76, 0x40,
+    0xfc, 0x80, 0xff, 0xe1, 0x39, 0x9f, 0x0, 0x80,
+    0x10, 0x3e, 0x2d, 0xb9, 0x74, 0x81, 0xfc, 0xed,
+    0x18, 0x91, 0xc4, 0x11, 0x5, 0x10, 0x41, 0x60,
+    0x4c, 0x12, 0x60, 0x2b, 0x64, 0x18, 0x40, 0x7e,
+    0x31, 0x26, 0x76, 0xa3, 0xbe, 0xef, 0xfe, 0xd7,
+    0xec, 0xf7, 0x7b, 0x52, 0x81, 0xa1, 0x3, 0xff,
+    0xaa, 0x42, 0x6, 0x6b, 0x8, 0x19, 0x10, 0x3f,
+    0xfa, 0xaa, 0x4c, 0xc0, 0xfd, 0x80, 0xff, 0xea,
+    0x9a, 0x18, 0x5c, 0xf, 0xdc, 0xf, 0xfe, 0xad,
+    0x64, 0x30, 0xe0, 0x1f, 0x40, 0x3f, 0xfa, 0xad,
+    0xc8, 0xa2, 0x1, 0x30, 0x22, 0x7, 0xff, 0x55,
+    0x0, 0x48, 0xfc, 0xe5, 0x30, 0x24, 0x7, 0xff,
+    0x57, 0x81, 0xe2, 0xe8, 0x1d, 0x40, 0xff, 0xea,
+    0x14, 0x4, 0x67, 0x43, 0xa0, 0x22, 0x40, 0x7f,
+    0xf5, 0x28, 0x18, 0xc0, 0x27, 0x80, 0xa8, 0x1f,
+    0xfd, 0x56, 0x7, 0xbf, 0x1, 0xe6, 0x7, 0xff,
+    0x51, 0x81, 0xf5, 0x8c, 0x10, 0x8, 0xf, 0xfe,
+    0xad, 0x3, 0xf9, 0xe, 0x47, 0x3, 0xff, 0xaa,
+    0x40, 0xff, 0x34, 0x42, 0x3, 0xff, 0xbe, 0x70,
+    0x8, 0x7, 0xff, 0x57, 0x1, 0xff, 0x74, 0x10,
+    0x1f, 0xfd, 0x44, 0x40, 0xff, 0x96, 0x44, 0xf,
+    0xfe, 0xa7, 0x4, 0xf, 0xfb, 0xd0, 0x3f, 0xfa,
+    0xa8, 0x10, 0x3f, 0xfc, 0x28, 0xf, 0xfe, 0x14,
+    0x3, 0xff, 0xab, 0xc0, 0xff, 0xe0, 0xd2, 0x7,
+    0xff, 0x55, 0x1, 0xc8, 0xf, 0xa8, 0x1f, 0xfd,
+    0x54, 0x7, 0x90, 0x1f, 0x12, 0x3, 0xff, 0xc7,
+    0x40, 0xff, 0xea, 0xe0, 0x3f, 0xf8, 0x15, 0xa0,
+    0x3f, 0xfa, 0xa4, 0xf, 0xfe, 0xc, 0x20, 0x7f,
+    0xf5, 0xa, 0x3, 0xff, 0x80, 0x40, 0xff, 0xeb,
+    0x20, 0x3f, 0xf8, 0xd, 0x80, 0xff, 0xeb, 0x70,
+    0x39, 0x20, 0x1c, 0x40, 0xff, 0xeb, 0x90, 0x39,
+    0x20, 0x18, 0x90, 0x1f, 0xfd, 0x74, 0x7, 0xfc,
+    0x58, 0x1f, 0xfd, 0x62, 0xc0, 0xff, 0x8c, 0x3,
+    0xff, 0xad, 0x40, 0xff, 0xe0, 0x14, 0x7, 0xff,
+    0x59, 0xb0, 0x1f, 0xf6, 0x20, 0x7f, 0xf5, 0x58,
+    0x19, 0xa0, 0x26, 0x42, 0x20, 0x7f, 0xf5, 0xb8,
+    0x19, 0xa0, 0x5, 0x90, 0x40, 0xff, 0xeb, 0xff,
+    0x68, 0xc0, 0x88, 0x15, 0x3, 0xff, 0xae, 0x40,
+    0xd7, 0x90, 0x38, 0x81, 0xff, 0xd7, 0x3b, 0xe9,
+    0x60, 0xb0, 0x84, 0x7, 0xff, 0x64, 0x81, 0x36,
+    0xa, 0x11, 0xc0, 0xff, 0xeb, 0x2c, 0x80, 0xe3,
+    0xc3, 0x5, 0x1, 0xff, 0xd7, 0x5c, 0x24, 0x2,
+    0x53, 0x8a, 0x7, 0xff, 0x58, 0xc6, 0x42, 0x40,
+    0x4b, 0x98, 0x18, 0x1f, 0xfd, 0x66, 0x40, 0xe6,
+    0x43, 0x41, 0x81, 0xff, 0xd7, 0xc0, 0x79, 0x81,
+    0x98, 0x1f, 0xfd, 0x74, 0xc0, 0xff, 0x9e, 0x3,
+    0xff, 0xae, 0x40, 0xff, 0xe0, 0x30, 0x3f, 0xfa,
+    0xd4, 0x81, 0xfe, 0x30, 0x81, 0xff, 0xd5, 0xa0,
+    0x7f, 0xf0, 0x2f, 0x3, 0xff, 0xaa, 0x90, 0xf,
+    0xfe, 0x2, 0x80, 0x7f, 0xf5, 0xc, 0x3, 0xff,
+    0x82, 0x40, 0xff, 0xea, 0x6c, 0x20, 0x7f, 0xf0,
+    0x50, 0x1f, 0xfd, 0x36, 0x40, 0xff, 0xe1, 0xb0,
+    0x3f, 0xfa, 0x74, 0xf, 0xfe, 0x21, 0x3, 0xff,
+    0xa4, 0x88, 0x1f, 0xfc, 0x36, 0x7, 0xff, 0x4f,
+    0x81, 0xff, 0xc4, 0xc0, 0x7f, 0xf4, 0xd0, 0x1f,
+    0xfc, 0x44, 0x7, 0xff, 0x48, 0x81, 0xff, 0xc4,
+    0x20, 0x7f, 0xf4, 0xe0, 0x1f, 0xfc, 0x48, 0x7,
+    0xff, 0x4d, 0x1, 0xff, 0xc3, 0x28, 0xf, 0xfe,
+    0x92, 0x20, 0x7f, 0xf0, 0xe0, 0x1f, 0xfd, 0x35,
+    0xbf, 0xff, 0xe1, 0xa0, 0x3f, 0xff, 0xe0, 0x7f,
+    0xff, 0xc0, 0xff, 0xff, 0x81, 0xff, 0xff, 0x3,
+    0xff, 0xfe, 0x7, 0xff, 0xfc, 0xf, 0xff, 0xf8,
+    0x1f, 0xff, 0xf0, 0x3f, 0xff, 0xe0, 0x7f, 0xf5,
+    0x40,
+
+    /* U+0038 "8" */
+    0x3, 0xff, 0x8c, 0x5c, 0x84, 0x80, 0x7f, 0x10,
+    0x3f, 0xf9, 0xa5, 0xcd, 0xf5, 0x26, 0x66, 0xfd,
+    0x69, 0xb1, 0x20, 0x3f, 0xf9, 0x46, 0xfd, 0x19,
+    0x30, 0x49, 0x3b, 0x2d, 0x35, 0x23, 0x78, 0x7,
+    0xff, 0x1c, 0xa4, 0x3, 0xc4, 0xc0, 0x4b, 0x26,
+    0xc0, 0x79, 0xd0, 0x3f, 0xf8, 0xbb, 0xd, 0x4,
+    0xf, 0xf3, 0x62, 0x9, 0x1, 0xe4, 0x98, 0xf,
+    0xfe, 0x9, 0xc4, 0x60, 0xc8, 0x1f, 0xfc, 0x22,
+    0x4, 0x40, 0x32, 0x6e, 0x40, 0xff, 0x2c, 0x8,
+    0x2, 0x40, 0x7f, 0xf1, 0xc8, 0x6, 0xdc, 0x6,
+    0x20, 0x7f, 0x10, 0x48, 0x22, 0x60, 0x3f, 0xe2,
+    0x20, 0x18, 0xa2, 0x19, 0x2, 0x80, 0x7f, 0x24,
+    0x24, 0x0, 0x98, 0xf, 0xfe, 0x2, 0xe4, 0x9,
+    0x21, 0x9, 0x90, 0x9, 0x0, 0xf2, 0xe, 0x5d,
+    0x80, 0x7f, 0xcd, 0x20, 0x29, 0x90, 0x3e, 0x2c,
+    0x81, 0x54, 0x7, 0x19, 0xb2, 0x7c, 0x1e, 0x64,
+    0xf, 0x34, 0x81, 0x10, 0x39, 0x1, 0x10, 0x38,
+    0xb0, 0x39, 0x66, 0x40, 0xcf, 0xa2, 0x40, 0x7f,
+    0xb3, 0x3, 0x10, 0x46, 0x4, 0x8, 0xa8, 0x6,
+    0x41, 0x8c, 0x80, 0x8a, 0x4, 0xe, 0x2e, 0x41,
+    0x63, 0x32, 0x10, 0x23, 0x32, 0x6, 0xe8, 0xc,
+    0xa2, 0x9c, 0x93, 0x5, 0x10, 0x3a, 0xe8, 0xda,
+    0x27, 0x75, 0x8c, 0xb, 0x90, 0x39, 0x94, 0x5,
+    0x89, 0x66, 0xc5, 0x82, 0x54, 0xd, 0x10, 0x1c,
+    0x6b, 0xb3, 0x20, 0x28, 0x10, 0x1e, 0x20, 0xa,
+    0x2d, 0x80, 0xfa, 0x81, 0x98, 0x1f, 0x22, 0x1,
+    0x30, 0x22, 0x40, 0x7c, 0x80, 0x64, 0x50, 0xc,
+    0x4a, 0x0, 0x20, 0x44, 0xf, 0xe4, 0x7, 0xc4,
+    0x80, 0xc4, 0x80, 0xe2, 0x55, 0x9e, 0x1d, 0x3,
+    0xff, 0x9c, 0x40, 0x89, 0x2, 0x8, 0x2e, 0xb6,
+    0x24, 0x88, 0x1f, 0xfc, 0x4a, 0x7, 0xe6, 0x40,
+    0x88, 0x6, 0x18, 0x4, 0x40, 0xf3, 0x3, 0xff,
+    0x97, 0x39, 0x0, 0x60, 0xc, 0x7, 0xff, 0x1,
+    0x81, 0xff, 0xc3, 0x29, 0x8, 0x13, 0xd7, 0x80,
+    0x34, 0x3, 0x3, 0xff, 0x80, 0xc8, 0x1f, 0xfc,
+    0x26, 0x99, 0x2, 0x28, 0x81, 0xc4, 0x10, 0xc0,
+    0xff, 0x32, 0x7, 0xff, 0xb, 0x82, 0x7, 0xff,
+    0x0, 0x82, 0x7, 0x89, 0x0, 0x26, 0x3, 0xff,
+    0x86, 0x48, 0xe, 0xc0, 0x28, 0x1e, 0x60, 0x81,
+    0x89, 0x1, 0x12, 0x3, 0xff, 0x86, 0x48, 0xe,
+    0xe0, 0xb0, 0x26, 0x3, 0x0, 0x20, 0x7c, 0x40,
+    0xf8, 0x81, 0xfd, 0x81, 0x3, 0x20, 0x58, 0x13,
+    0x0, 0x80, 0x20, 0x3f, 0xf8, 0x84, 0xf, 0xe2,
+    0x80, 0xd4, 0xf, 0xc4, 0x80, 0x62, 0x7, 0x88,
+    0x1f, 0xa8, 0x1f, 0x38, 0xd0, 0x12, 0xe8, 0x30,
+    0x39, 0x1, 0x20, 0x81, 0x40, 0x8, 0x1f, 0x9b,
+    0x1, 0xec, 0x40, 0xe4, 0x18, 0x1f, 0x50, 0x36,
+    0xe0, 0xe2, 0x7, 0xfd, 0x2a, 0x2a, 0xe4, 0x50,
+    0x1e, 0x44, 0xe, 0x24, 0x6, 0x26, 0x11, 0x1,
+    0xff, 0xc0, 0x57, 0x56, 0xc0, 0x95, 0x20, 0x78,
+    0x81, 0xa0, 0x1c, 0x41, 0x0, 0xc0, 0xff, 0xe2,
+    0x14, 0x1, 0xe0, 0x31, 0x7, 0x1, 0x34, 0x7,
+    0x9c, 0x3, 0x10, 0x3f, 0xf8, 0x64, 0x81, 0x4c,
+    0xd, 0x6b, 0x0, 0x70, 0xf, 0xcd, 0x80, 0x88,
+    0x1f, 0xfc, 0x12, 0x28, 0x3d, 0xb1, 0x21, 0x8d,
+    0xe1, 0xc0, 0x3f, 0xd2, 0x90, 0x3f, 0xf8, 0x64,
+    0x70, 0x1c, 0x12, 0x1, 0x91, 0xe2, 0x1, 0xff,
+    0x4a, 0x7, 0xff, 0x18, 0x93, 0x8, 0x1, 0x1a,
+    0x8e, 0x30, 0x1f, 0xe6, 0xc0, 0x80, 0x20, 0x7f,
+    0xf0, 0x98, 0x26, 0x3, 0x88, 0xe0, 0xd0, 0x3f,
+    0x48, 0x3, 0x98, 0x1f, 0xfc, 0x22, 0x60, 0x50,
+    0x1c, 0x40, 0x95, 0x3, 0xc5, 0x81, 0xe4, 0x7,
+    0xff, 0xc, 0x81, 0x30, 0x2e, 0x3, 0x81, 0x2a,
+    0x7, 0x70, 0x26, 0x7, 0xfc, 0x40, 0xf2, 0x5,
+    0x2, 0x5, 0x5d, 0x20, 0x64, 0xc0, 0x89, 0x1,
+    0x30, 0x3f, 0xe2, 0x40, 0x92, 0x51, 0x21, 0x40,
+    0xd9, 0xde, 0x7, 0x60, 0x2a, 0x7, 0xff, 0x9,
+    0x6d, 0xeb, 0xb, 0x61, 0x80, 0xe2, 0x7, 0xc8,
+    0x9, 0x1, 0xff, 0x3a, 0xa9, 0x20, 0x40, 0x8e,
+    0xc2, 0x48, 0xe, 0x61, 0x1, 0xe6, 0x9, 0x1,
+    0xfc, 0x47, 0x39, 0x1, 0xfc, 0xc1, 0x20, 0x31,
+    0xe1, 0x81, 0xec, 0x10, 0x1f, 0xe2, 0x24, 0xac,
+    0x3, 0xf8, 0x82, 0x40, 0x46, 0x82, 0x7, 0x88,
+    0xe0, 0x7f, 0xf0, 0x49, 0xb8, 0x1f, 0xd0, 0x1,
+    0x2, 0x38, 0x20, 0x3c, 0xc1, 0x3, 0xff, 0x84,
+    0xc8, 0x1f, 0xe4, 0xd0, 0x6, 0x9a, 0x20, 0x9,
+    0x67, 0xa0, 0x60, 0x7f, 0xf0, 0x4e, 0x4, 0xf,
+    0xf3, 0x40, 0xb4, 0x94, 0x80, 0x22, 0x19, 0x0,
+    0x81, 0x10, 0x3f, 0x42, 0x1, 0x81, 0xfe, 0xa8,
+    0x81, 0x26, 0x65, 0xde, 0x58, 0x40, 0xff, 0xe0,
+    0xde, 0x94, 0x7, 0xfd, 0x51, 0x24, 0x15, 0x7b,
+    0xed, 0xa9, 0x3, 0x88, 0x1e, 0x5c, 0x4b, 0x88,
+    0x1f, 0xc4, 0x1, 0x4, 0x1, 0x97, 0x82, 0xe6,
+    0xc0, 0x40, 0x88, 0x1c, 0x41, 0x21, 0x80, 0xff,
+    0xe1, 0x11, 0xc3, 0x0, 0xb8, 0x28, 0xfa, 0x20,
+    0x24, 0x80, 0xe2, 0x49, 0x94, 0x7, 0xfc, 0xc0,
+    0xe2, 0x8b, 0x88, 0x1, 0x8b, 0x84, 0x1f, 0x20,
+    0x71, 0x4c, 0x59, 0xc0, 0xff, 0xe1, 0x90, 0x5a,
+    0x3, 0xd3, 0x80, 0x49, 0x88, 0x1c, 0x48, 0x50,
+    0x81, 0x3, 0xff, 0x80, 0x40, 0x15, 0xa1, 0x3,
+    0xae, 0x0, 0xc4, 0x40, 0x45, 0x0, 0x51, 0x37,
+    0x1, 0xff, 0xc0, 0x70, 0x66, 0x58, 0x1e, 0x30,
+    0x3, 0x38, 0x81, 0x16, 0x80, 0x10, 0x3f, 0xf8,
+    0x24, 0x2b, 0xf1, 0x48, 0x7, 0x88, 0x24, 0x31,
+    0x20, 0x39, 0x2, 0xa, 0x40, 0x40, 0xff, 0x97,
+    0x78, 0xb4, 0x1, 0x1, 0xf9, 0x84, 0x4, 0x99,
+    0x82, 0x36, 0x1, 0xc0, 0xff, 0xe0, 0x90, 0x24,
+    0x1, 0x1, 0x10, 0x4, 0x3, 0x2c, 0x7, 0x46,
+    0x88, 0x1, 0x4, 0x7, 0xf7, 0x4, 0x1a, 0xc0,
+    0x10, 0x3f, 0xe8, 0x88, 0xb1, 0x93, 0x0, 0x48,
+    0x8, 0x1f, 0xcc, 0x10, 0xe4, 0x13, 0x80, 0x12,
+    0x0, 0x40, 0xcd, 0xad, 0x6, 0x50, 0x24, 0x80,
+    0xa0, 0x1f, 0x30, 0xa4, 0x2a, 0xc8, 0x1e, 0x20,
+    0x28, 0x12, 0xb0, 0xba, 0xf8, 0x6, 0x80, 0xce,
+    0x1, 0x95, 0x92, 0x24, 0x82, 0x8, 0x10, 0x4,
+    0x9, 0x1, 0x94, 0xe2, 0x2a, 0x0, 0x81, 0xe7,
+    0xfe, 0xb2, 0x7, 0xb4, 0x49, 0x80, 0x20, 0x71,
+    0x30, 0x13, 0x60, 0x98, 0x2, 0x13, 0x3, 0xfe,
+    0x49, 0x20, 0x80, 0x41, 0x8c, 0x7, 0x1f, 0x0,
+    0xc8, 0xb0, 0xd4, 0x49, 0x90, 0x1f, 0x20, 0x25,
+    0x0, 0xe6, 0x5, 0xd8, 0x1c, 0x90, 0xc, 0x9c,
+    0xe7, 0xe4, 0xe2, 0x3, 0xe4, 0xa0, 0x3f, 0xf8,
+    0xc, 0xf, 0x30, 0x38, 0x87, 0x95, 0x40, 0x81,
+    0xfe, 0x48, 0x5, 0x48, 0x1c, 0x42, 0x4, 0xb,
+    0x1, 0xfb, 0x81, 0x8b, 0x3, 0xff, 0x87, 0x8,
+    0x11, 0x30, 0x60, 0x80, 0x60, 0x7f, 0x52, 0x90,
+    0x54, 0x80, 0x7f, 0xf0, 0x88, 0x19, 0x10, 0x50,
+    0x12, 0x80, 0x7f, 0xb1, 0x42, 0x94, 0x40, 0xff,
+    0xe1, 0x10, 0x22, 0x8, 0x7c, 0x2a, 0x7, 0xff,
+    0x2, 0x55, 0xcb, 0x3, 0xf8, 0x81, 0x10, 0x38,
+    0x80, 0x24, 0xe5, 0x3, 0xff, 0x84, 0xa9, 0x8c,
+    0x81, 0xf8, 0x89, 0x90, 0x20, 0x71, 0x14, 0xb0,
+    0x3f, 0xf8, 0xcb, 0x32, 0x6, 0x45, 0x35, 0x92,
+    0x36, 0x40, 0x65, 0x90, 0x1f, 0xfc, 0x93, 0x36,
+    0x44, 0x11, 0x4c, 0x75, 0x1, 0x2d, 0xfd, 0x48,
+    0x1f, 0xfc, 0xd2, 0xef, 0xf6, 0xca, 0x8a, 0x96,
+    0x10, 0x22, 0x7, 0xff, 0x0,
+
+    /* U+0039 "9" */
+    0x3, 0xff, 0x80, 0x40, 0xff, 0x10, 0x3f, 0xfa,
+    0x84, 0x1, 0x29, 0x4, 0x29, 0xbf, 0x6a, 0xd0,
+    0x1f, 0xfc, 0xd7, 0xbf, 0x68, 0x3d, 0x55, 0x81,
+    0x15, 0x2f, 0xac, 0xf, 0xfe, 0x4d, 0x84, 0x9,
+    0x38, 0xb2, 0x3, 0xf9, 0x54, 0x80, 0x7f, 0xf1,
+    0xd, 0x48, 0x7, 0xe2, 0xd0, 0x1f, 0xc8, 0xcb,
+    0x88, 0x1f, 0xfc, 0x13, 0x93, 0x2c, 0xf, 0xfe,
+    0x3a, 0xc, 0x7, 0x40, 0x7f, 0xc7, 0x0, 0xa5,
+    0x82, 0x6, 0x20, 0x7f, 0xf0, 0x50, 0x11, 0xa4,
+    0xf, 0xf4, 0x0, 0x7b, 0x1, 0x40, 0xd4, 0xf,
+    0xfe, 0xa, 0x40, 0x40, 0xff, 0xe0, 0x34, 0x0,
+    0x84, 0x3, 0x1, 0x18, 0x41, 0x60, 0x7f, 0xf0,
+    0x21, 0xa4, 0xf, 0xea, 0x6, 0x20, 0x4c, 0x8,
+    0x82, 0xb, 0x3, 0xe2, 0x9b, 0x50, 0xb5, 0x80,
+    0x7c, 0xd8, 0xc, 0x50, 0x2, 0x6, 0x38, 0xf,
+    0xf8, 0x93, 0xb1, 0xbb, 0x1, 0xe5, 0x10, 0x1b,
+    0xa2, 0x0, 0x84, 0xe3, 0x4, 0xf, 0xcd, 0x20,
+    0x13, 0x78, 0xf, 0x70, 0x3c, 0x41, 0x6, 0x6a,
+    0x69, 0xfb, 0xe6, 0x7, 0x12, 0xd, 0xa0, 0xfc,
+    0xc0, 0xf2, 0x0, 0x40, 0x90, 0x24, 0xf4, 0xe9,
+    0xb0, 0x11, 0x90, 0x7, 0xe7, 0x9, 0x5e, 0x7,
+    0x30, 0x3c, 0xc3, 0x21, 0xb2, 0x1, 0x0, 0xf3,
+    0x3, 0x10, 0x22, 0x52, 0xa6, 0x7, 0x60, 0x22,
+    0x1, 0x84, 0x19, 0x2, 0x60, 0x7e, 0x40, 0x64,
+    0x91, 0xfc, 0x19, 0x60, 0x64, 0x7, 0x10, 0x27,
+    0x8, 0x17, 0x3, 0xf6, 0x3, 0x8e, 0xf0, 0x1,
+    0x10, 0xf, 0xc4, 0x10, 0xf, 0x90, 0xc8, 0x20,
+    0x7e, 0x20, 0x12, 0xee, 0x80, 0xa0, 0x20, 0x7c,
+    0x40, 0xcd, 0x81, 0xa0, 0x18, 0x1f, 0x98, 0x68,
+    0x1, 0x40, 0x76, 0x8, 0xa, 0x1, 0xf3, 0x31,
+    0x1a, 0x41, 0x3, 0xfe, 0x64, 0x1, 0x60, 0x48,
+    0x8e, 0x4, 0xd8, 0xc, 0x4a, 0x6, 0x49, 0x81,
+    0xff, 0x1a, 0x49, 0xb0, 0x2, 0x4, 0x89, 0x1,
+    0x92, 0x1, 0x8b, 0x9, 0x38, 0x1f, 0xfc, 0x2d,
+    0x3a, 0x46, 0x7, 0x28, 0x10, 0x11, 0x24, 0x7,
+    0xaa, 0x3, 0xff, 0x87, 0x88, 0x13, 0x3, 0xd8,
+    0x14, 0x1, 0xca, 0xd0, 0xb4, 0x10, 0xe0, 0x7f,
+    0xf0, 0x9d, 0x5a, 0xb0, 0x39, 0x2, 0x20, 0xc,
+    0x63, 0x40, 0xd5, 0x44, 0x3, 0xff, 0x84, 0xb0,
+    0xf5, 0x81, 0xfc, 0x40, 0xb7, 0x4a, 0xc8, 0x90,
+    0x1c, 0x40, 0xfe, 0x30, 0x78, 0xc0, 0xf1, 0x3,
+    0xee, 0x36, 0x14, 0x20, 0x1e, 0x60, 0x7f, 0x30,
+    0x6, 0x20, 0x3c, 0x40, 0xf1, 0x2d, 0xe3, 0x2,
+    0x20, 0x7f, 0xf1, 0x79, 0x20, 0x3f, 0xe4, 0x4,
+    0x7f, 0x10, 0x22, 0x40, 0x7f, 0xf0, 0xc8, 0x40,
+    0x81, 0xff, 0x60, 0x6, 0x58, 0x40, 0x88, 0x1e,
+    0x50, 0xf, 0xf1, 0x4, 0xf, 0xfe, 0x15, 0x3,
+    0xff, 0x86, 0x40, 0xfc, 0xd4, 0x28, 0x10, 0x3f,
+    0xf8, 0x1c, 0xf, 0xfe, 0x11, 0x68, 0xf, 0xd6,
+    0xbb, 0x4, 0xf, 0xe2, 0x3, 0x1, 0xff, 0xc2,
+    0x22, 0xa0, 0x3e, 0x4e, 0x1, 0xff, 0xc0, 0x20,
+    0x10, 0x1e, 0x20, 0x7e, 0x22, 0xea, 0xed, 0x4f,
+    0x52, 0x10, 0x3f, 0xf8, 0x6c, 0xe, 0x80, 0x7f,
+    0xc5, 0x44, 0xd9, 0x1, 0xe2, 0x1, 0x90, 0x3f,
+    0x40, 0x31, 0xc0, 0x7f, 0xf0, 0xc8, 0x40, 0x78,
+    0x80, 0x64, 0xc, 0x40, 0xd4, 0x8, 0x81, 0xff,
+    0xcf, 0x60, 0x48, 0x30, 0x39, 0x40, 0x39, 0x81,
+    0xff, 0xcb, 0x3c, 0x9, 0x18, 0x80, 0xe7, 0x40,
+    0x61, 0x80, 0xfc, 0x40, 0xff, 0xe1, 0x1a, 0x10,
+    0x13, 0x3, 0xe5, 0xe9, 0xb8, 0xf, 0xc4, 0xf,
+    0xfe, 0x19, 0x29, 0x17, 0x20, 0x3f, 0x93, 0x51,
+    0x81, 0xff, 0xcc, 0x3f, 0x12, 0x44, 0xf, 0xfe,
+    0x4, 0xf1, 0x81, 0xff, 0xca, 0x2a, 0x69, 0x40,
+    0xff, 0xe1, 0x39, 0xc, 0xf, 0xfe, 0x49, 0x20,
+    0x8, 0xf, 0xfe, 0x23, 0x9f, 0x44, 0xc0, 0xff,
+    0xe2, 0x12, 0x0, 0xc0, 0xff, 0xe3, 0x97, 0x66,
+    0x80, 0x7f, 0x88, 0x52, 0x1a, 0x7c, 0xf, 0xfe,
+    0x59, 0x78, 0xf, 0xe2, 0x14, 0x86, 0x9b, 0x1,
+    0xff, 0xcd, 0x34, 0xf, 0xfe, 0x27, 0x3, 0xff,
+    0x9c, 0x80, 0xff, 0xe2, 0x10, 0x3f, 0xf9, 0xe8,
+    0xf, 0xf9, 0x1, 0x10, 0x3f, 0xf9, 0xe4, 0xf,
+    0xf9, 0x1, 0x12, 0x3, 0xff, 0x9d, 0xc0, 0xff,
+    0xe2, 0x10, 0x3f, 0xff, 0x44, 0xf, 0xfe, 0x34,
+    0xdb, 0xac, 0x96, 0xdc, 0xc0, 0xfe, 0x60, 0x7f,
+    0xf1, 0x91, 0x3c, 0x9a, 0x27, 0xc8, 0xf, 0xfe,
+    0x83, 0x0, 0x40, 0x89, 0x20, 0x38, 0x81, 0xff,
+    0xd0, 0x20, 0x8, 0x11, 0x3, 0xff, 0x8a, 0xc0,
+    0xff, 0xe3, 0x60, 0x3f, 0xf8, 0x4c, 0xf, 0xfe,
+    0x82, 0x4, 0xf, 0xfe, 0x51, 0x3, 0xff, 0x86,
+    0x40, 0x20, 0x40, 0xff, 0xe0, 0x70, 0x3f, 0xb0,
+    0x1f, 0xfc, 0x38, 0x1, 0x90, 0x3f, 0xf8, 0x2c,
+    0xf, 0xc9, 0x0, 0xff, 0xe3, 0x22, 0x7, 0xff,
+    0xa, 0x1, 0xe5, 0x40, 0xff, 0xe2, 0x30, 0x8,
+    0xf, 0xfe, 0x14, 0x15, 0xd9, 0x16, 0x80, 0xff,
+    0xe2, 0x90, 0x4, 0xf, 0xfe, 0x16, 0xbe, 0x26,
+    0xc8, 0xf, 0xfe, 0x21, 0xa0, 0x69, 0x0, 0x7f,
+    0xf0, 0x16, 0x80, 0x7f, 0xf2, 0x49, 0x1, 0x9f,
+    0x3, 0xff, 0x84, 0x40, 0xe2, 0x7, 0xff, 0x13,
+    0x1, 0xff, 0xce, 0x20, 0x7f, 0xf0, 0x9a, 0xe0,
+    0x74, 0x20, 0x7c, 0x40, 0x8a, 0x3, 0xff, 0x92,
+    0xca, 0x3, 0xd4, 0xf, 0x90, 0x11, 0x40, 0x7f,
+    0xf2, 0xa0, 0x1f, 0x32, 0x2, 0x1, 0x20, 0x3f,
+    0xf9, 0x84, 0x50, 0x3f, 0xb8, 0x4, 0x18, 0x20,
+    0x7f, 0xf1, 0xc8, 0x18, 0xd4, 0x7, 0xf1, 0x81,
+    0x86, 0x7, 0xff, 0x24, 0x9e, 0xc8, 0xf, 0xf9,
+    0xe0, 0x3f, 0xf8, 0x28, 0xf, 0xfe, 0x7, 0xec,
+    0x40, 0xff, 0xe0, 0x95, 0x0, 0xfe, 0x21, 0x1,
+    0x10, 0x3e, 0xa4, 0x80, 0xff, 0xe2, 0xba, 0x40,
+    0x9d, 0x21, 0x96, 0xc1, 0x81, 0xca, 0xf6, 0x7,
+    0xff, 0x21, 0x6f, 0xa0, 0x8e, 0x5d, 0xd0, 0x61,
+    0xcd, 0xea, 0x3, 0xff, 0x94, 0x40, 0x17, 0x35,
+    0x60, 0x1e, 0xfd, 0xa3, 0x20, 0x7f, 0xf0, 0xc0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 391, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 759, .box_w = 43, .box_h = 79, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 942, .adv_w = 464, .box_w = 24, .box_h = 71, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 1307, .adv_w = 794, .box_w = 44, .box_h = 74, .ofs_x = 6, .ofs_y = 10},
+    {.bitmap_index = 2140, .adv_w = 744, .box_w = 42, .box_h = 76, .ofs_x = 3, .ofs_y = 10},
+    {.bitmap_index = 2971, .adv_w = 758, .box_w = 39, .box_h = 74, .ofs_x = 4, .ofs_y = 11},
+    {.bitmap_index = 3633, .adv_w = 807, .box_w = 43, .box_h = 73, .ofs_x = 3, .ofs_y = 12},
+    {.bitmap_index = 4432, .adv_w = 752, .box_w = 46, .box_h = 76, .ofs_x = 4, .ofs_y = 12},
+    {.bitmap_index = 5315, .adv_w = 803, .box_w = 49, .box_h = 88, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5964, .adv_w = 826, .box_w = 46, .box_h = 76, .ofs_x = 4, .ofs_y = 12},
+    {.bitmap_index = 6977, .adv_w = 743, .box_w = 44, .box_h = 77, .ofs_x = 1, .ofs_y = 10}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 1, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 2,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 2,
+    .bpp = 3,
+    .kern_classes = 0,
+    .bitmap_format = 1,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+extern const lv_font_t lv_font_montserrat_42;
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t ekstra = {
+#else
+lv_font_t ekstra = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 89,          /*The maximum line height required by the font*/
+    .base_line = 0,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = 0,
+    .underline_thickness = 0,
+#endif
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_FONT_MONTSERRAT_42
+    .fallback = &lv_font_montserrat_42,
+#endif
+};
+
+
+
+#endif /*#if EKSTRA*/
+#endif
@@ -1,4 +1,5 @@
 #include "telegram_bot.h"
+#include "tg_update_parser.h"
 #include "../damper_control/damper_control.h"
 #include "../temperature/temperature.h"
 #include "../wifi/wifi.h"
@@ -19,11 +20,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-// --- PATCH: konfigurācija un glabājamie ---
-#ifndef MAX_HTTP_RECV_BUFFER
-#define MAX_HTTP_RECV_BUFFER 8192 // bija 2048
-#endif
-
 // STEIDZAMI: izņem BOT_TOKEN fallback no repo un nodod via build_flags vai NVS
 #ifndef BOT_TOKEN
 #warning "BOT_TOKEN nav nodefinēts build laikā. " \
@@ -50,9 +46,8 @@ static esp_http_client_handle_t g_client_post = NULL;
 // Last update id long-pollingam
 static int64_t last_update_id = 0;
 
-// Droša bufera aizpilde (ar pārpildes aizsardzību)
-static char response_buffer[MAX_HTTP_RECV_BUFFER + 1];
-static volatile bool response_overflow = false;
+// getUpdates atbilde tiek parsēta straumē, tāpēc atbildes buferis nav vajadzīgs
+static tg_parser_t g_updates;
 
 // Globālie (no citām bibliotēkām)
 extern int target_temp_c;
@@ -66,21 +61,16 @@ static bool waiting_for_temp = false;
 static bool waiting_for_kp = false;
 static bool waiting_for_temp_min = false;
 
-// HTTP event handler
-static esp_err_t http_event_handler(esp_http_client_event_t *evt) {
-  static int output_len = 0;
+// getUpdates HTTP event handler: katrs saņemtais gabals uzreiz nonāk parsētājā
+static esp_err_t updates_event_handler(esp_http_client_event_t *evt) {
+  tg_parser_t *parser = (tg_parser_t *)evt->user_data;
   switch (evt->event_id) {
-  case HTTP_EVENT_ON_DATA:
-    if (output_len + (int)evt->data_len < MAX_HTTP_RECV_BUFFER) {
-      memcpy(response_buffer + output_len, evt->data, evt->data_len);
-      output_len += evt->data_len;
-      response_buffer[output_len] = '\0';
-    } else {
-      response_overflow = true; // iezīmē, ka pienācis par daudz
-    }
+  case HTTP_EVENT_HEADERS_SENT:
+    // Jauns pieprasījums (arī atkārtots pēc pārtrauta keep-alive savienojuma)
+    tg_parser_reset(parser);
     break;
-  case HTTP_EVENT_ON_FINISH:
-    output_len = 0;
+  case HTTP_EVENT_ON_DATA:
+    tg_parser_feed(parser, (const char *)evt->data, evt->data_len);
     break;
   default:
     break;
@@ -91,8 +81,8 @@ static esp_err_t http_event_handler(esp_http_client_event_t *evt) {
 // Forward decl
 static esp_err_t send_telegram_message(const char *chat_id, const char *text,
                                        const char *reply_markup);
-static void process_message(cJSON *message);
-static void process_callback_query(cJSON *callback_query);
+static void process_message(const tg_update_t *update);
+static void process_callback_query(const tg_update_t *update);
 static esp_err_t ensure_post_client();
 static esp_err_t ensure_get_client();
 static esp_err_t get_telegram_updates();
@@ -118,8 +108,6 @@ static esp_err_t send_telegram_message(const char *chat_id, const char *text,
 static esp_err_t answer_callback_query(const char *callback_query_id) {
   if (ensure_post_client() != ESP_OK)
     return ESP_FAIL;
-  response_overflow = false;
-  memset(response_buffer, 0, sizeof(response_buffer));
 
   cJSON *json = cJSON_CreateObject();
   cJSON_AddStringToObject(json, "callback_query_id", callback_query_id);
@@ -144,8 +132,7 @@ static esp_err_t ensure_post_client() {
     return ESP_OK;
   esp_http_client_config_t cfg = {};
   cfg.url = "https://api.telegram.org"; // pamata; pilno URL iestatīsim runtime
-  cfg.method = HTTP_METHOD_POST;
-  cfg.event_handler = http_event_handler;
+  cfg.method = HTTP_METHOD_POST; // atbildes ķermenis netiek lasīts
   cfg.crt_bundle_attach = esp_crt_bundle_attach;
   cfg.timeout_ms = 40000;       // ≥ getUpdates timeout + rezervē
   cfg.keep_alive_enable = true; // svarīgi
@@ -213,7 +200,8 @@ static esp_err_t ensure_get_client() {
   esp_http_client_config_t cfg = {};
   cfg.url = "https://api.telegram.org"; // pilno URL iestatīsim katru reizi
   cfg.method = HTTP_METHOD_GET;
-  cfg.event_handler = http_event_handler;
+  cfg.event_handler = updates_event_handler;
+  cfg.user_data = &g_updates;
   cfg.crt_bundle_attach = esp_crt_bundle_attach;
   cfg.timeout_ms = 45000; // ≥ BotAPI timeout + 10s
   cfg.keep_alive_enable = true;
@@ -227,17 +215,17 @@ static esp_err_t ensure_get_client() {
 static esp_err_t get_telegram_updates() {
   if (ensure_get_client() != ESP_OK)
     return ESP_FAIL;
-  response_overflow = false;
-  memset(response_buffer, 0, sizeof(response_buffer));
+  tg_parser_reset(&g_updates);
 
   // allowed_updates=["message","callback_query"] URL-enkodēts
   const char *allowed = "%5B%22message%22%2C%22callback_query%22%5D";
-  // timeout=30, limit=1, offset=last_update_id+1
+  // timeout=30, limit=TG_MAX_UPDATES, offset=last_update_id+1
   char url[256];
   snprintf(url, sizeof(url),
            "https://api.telegram.org/bot%s/"
-           "getUpdates?timeout=30&limit=1&allowed_updates=%s&offset=%lld",
-           BOT_TOKEN, allowed, (long long)(last_update_id + 1));
+           "getUpdates?timeout=30&limit=%d&allowed_updates=%s&offset=%lld",
+           BOT_TOKEN, TG_MAX_UPDATES, allowed,
+           (long long)(last_update_id + 1));
 
   esp_http_client_set_url(g_client_get, url);
   esp_http_client_set_method(g_client_get, HTTP_METHOD_GET);
@@ -245,34 +233,33 @@ static esp_err_t get_telegram_updates() {
   esp_err_t err = esp_http_client_perform(g_client_get);
   if (err != ESP_OK)
     return err;
-  if (response_overflow) {
-    ESP_LOGW(TAG, "Telegram response truncated (buffer=%d)",
-             MAX_HTTP_RECV_BUFFER);
+  if (!tg_parser_finish(&g_updates)) {
+    ESP_LOGW(TAG, "Invalid getUpdates response (status=%d, %u B)",
+             esp_http_client_get_status_code(g_client_get),
+             (unsigned)g_updates.bytes);
+    return ESP_FAIL;
   }
-
-  cJSON *json = cJSON_Parse(response_buffer);
-  if (!json)
+  if (!g_updates.ok) {
+    ESP_LOGW(TAG, "getUpdates not ok (status=%d)",
+             esp_http_client_get_status_code(g_client_get));
     return ESP_FAIL;
-  cJSON *ok = cJSON_GetObjectItem(json, "ok");
-  if (cJSON_IsTrue(ok)) {
-    cJSON *result = cJSON_GetObjectItem(json, "result");
-    if (cJSON_IsArray(result)) {
-      cJSON *update = NULL;
-      cJSON_ArrayForEach(update, result) {
-        cJSON *update_id = cJSON_GetObjectItem(update, "update_id");
-        if (update_id && update_id->valuedouble > last_update_id) {
-          last_update_id = (int64_t)update_id->valuedouble;
-          cJSON *message = cJSON_GetObjectItem(update, "message");
-          cJSON *callback_query = cJSON_GetObjectItem(update, "callback_query");
-          if (message)
-            process_message(message);
-          else if (callback_query)
-            process_callback_query(callback_query);
-        }
-      }
-    }
   }
-  cJSON_Delete(json);
+
+  // Nesaglabātos atjauninājumus last_update_id nepārsniedz, tāpēc Telegram
+  // tos atsūtīs nākamajā pieprasījumā
+  for (int i = 0; i < g_updates.update_cnt; i++) {
+    const tg_update_t *update = &g_updates.updates[i];
+    if (!update->has_update_id || update->update_id <= last_update_id)
+      continue;
+    last_update_id = update->update_id;
+    if (update->text_truncated)
+      ESP_LOGW(TAG, "Update %lld: text truncated",
+               (long long)update->update_id);
+    if (update->type == TG_UPDATE_MESSAGE)
+      process_message(update);
+    else if (update->type == TG_UPDATE_CALLBACK)
+      process_callback_query(update);
+  }
   return ESP_OK;
 }
 
@@ -337,43 +324,41 @@ static char *create_main_keyboard() {
   return out;
 }
 
-static void process_message(cJSON *message) {
-  cJSON *chat = cJSON_GetObjectItem(message, "chat");
-  cJSON *chat_id = chat ? cJSON_GetObjectItem(chat, "id") : NULL;
-  cJSON *text = cJSON_GetObjectItem(message, "text");
-  if (!chat_id)
+static void process_message(const tg_update_t *update) {
+  if (!update->has_chat_id)
     return;
 
   char chat_id_str[32];
   snprintf(chat_id_str, sizeof(chat_id_str), "%lld",
-           (long long)chat_id->valuedouble);
+           (long long)update->chat_id);
 
-  if (text && text->valuestring) {
-    ESP_LOGI(TAG, "RX: %s", text->valuestring);
-    if (strcmp(text->valuestring, "/info") == 0) {
+  if (update->has_text) {
+    const char *text = update->text;
+    ESP_LOGI(TAG, "RX: %s", text);
+    if (strcmp(text, "/info") == 0) {
       char *kb = create_main_keyboard();
       send_telegram_message(chat_id_str, "🏠 Izvēlies darbību:", kb);
       free(kb);
-    } else if (strcmp(text->valuestring, "/time") == 0) {
+    } else if (strcmp(text, "/time") == 0) {
       char buf[48];
       snprintf(buf, sizeof(buf), "🕐 Laiks: %s", get_time_str());
       send_telegram_message(chat_id_str, buf, NULL);
     } else if (waiting_for_temp &&
-               isdigit((unsigned char)text->valuestring[0])) {
-      set_target_temperature(atoi(text->valuestring));
+               isdigit((unsigned char)text[0])) {
+      set_target_temperature(atoi(text));
       waiting_for_temp = false;
       char msg[48];
       snprintf(msg, sizeof(msg), "✅ Target: %d°C", target_temp_c);
       send_telegram_message(chat_id_str, msg, NULL);
-    } else if (waiting_for_kp && isdigit((unsigned char)text->valuestring[0])) {
-      kP = atoi(text->valuestring);
+    } else if (waiting_for_kp && isdigit((unsigned char)text[0])) {
+      kP = atoi(text);
       waiting_for_kp = false;
       char msg[32];
       snprintf(msg, sizeof(msg), "✅ kP: %d", kP);
       send_telegram_message(chat_id_str, msg, NULL);
     } else if (waiting_for_temp_min &&
-               isdigit((unsigned char)text->valuestring[0])) {
-      temperature_min = atoi(text->valuestring);
+               isdigit((unsigned char)text[0])) {
+      temperature_min = atoi(text);
       waiting_for_temp_min = false;
       char msg[40];
       snprintf(msg, sizeof(msg), "✅ Min: %d°C", temperature_min);
@@ -384,25 +369,17 @@ static void process_message(cJSON *message) {
   }
 }
 
-static void process_callback_query(cJSON *callback_query) {
-  cJSON *id = cJSON_GetObjectItem(callback_query, "id");
-  cJSON *data = cJSON_GetObjectItem(callback_query, "data");
-  cJSON *message = cJSON_GetObjectItem(callback_query, "message");
-  if (!id || !data || !message)
-    return;
-  cJSON *chat = cJSON_GetObjectItem(message, "chat");
-  cJSON *chat_id = chat ? cJSON_GetObjectItem(chat, "id") : NULL;
-  if (!chat_id)
+static void process_callback_query(const tg_update_t *update) {
+  if (!update->callback_id[0] || !update->has_chat_id)
     return;
 
   char chat_id_str[32];
   snprintf(chat_id_str, sizeof(chat_id_str), "%lld",
-           (long long)chat_id->valuedouble);
-  answer_callback_query(id->valuestring);
+           (long long)update->chat_id);
+  answer_callback_query(update->callback_id);
 
-  if (!data->valuestring)
-    return;
-  if (strcmp(data->valuestring, "refresh") == 0) {
+  const char *data = update->callback_data;
+  if (strcmp(data, "refresh") == 0) {
     char status[256];
     snprintf(status, sizeof(status),
              "🔥 KRĀSNS STATUS 🔥\n\n"
@@ -414,15 +391,15 @@ static void process_callback_query(cJSON *callback_query) {
              temperature, target_temp_c, kP, temperature_min,
              messageDamp.c_str());
     send_telegram_message(chat_id_str, status, NULL);
-  } else if (strcmp(data->valuestring, "change_temp") == 0) {
+  } else if (strcmp(data, "change_temp") == 0) {
     waiting_for_temp = true;
     waiting_for_kp = waiting_for_temp_min = false;
     send_telegram_message(chat_id_str, "🌡️ Ievadi mērķa temperatūru:", NULL);
-  } else if (strcmp(data->valuestring, "change_kp") == 0) {
+  } else if (strcmp(data, "change_kp") == 0) {
     waiting_for_kp = true;
     waiting_for_temp = waiting_for_temp_min = false;
     send_telegram_message(chat_id_str, "⚙️ Ievadi kP vērtību:", NULL);
-  } else if (strcmp(data->valuestring, "change_temp_min") == 0) {
+  } else if (strcmp(data, "change_temp_min") == 0) {
     waiting_for_temp_min = true;
     waiting_for_temp = waiting_for_kp = false;
     send_telegram_message(chat_id_str, "❄️ Ievadi min. temperatūru:", NULL);
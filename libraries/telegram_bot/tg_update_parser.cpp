@@ -0,0 +1,552 @@
+#include "tg_update_parser.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================
+// STĀVOKĻI
+// ============================================
+// Sintakse: ko gaidām nākamo (jsmn/SAX stilā, pa vienam baitam, tāpēc gabala
+// robeža var būt jebkurā vietā, arī atslēgas, skaitļa vai \u vidū).
+// Konteksts: kur JSON kokā atrodas pašreizējais konteiners. Mūs interesē tikai
+//   {"ok":true,"result":[{"update_id":N,
+//     "message":{"chat":{"id":N},"text":"..."},
+//     "callback_query":{"id":"...","data":"...","message":{"chat":{"id":N}}}}]}
+// pārējais tiek izlaists, neko neglabājot.
+
+enum {
+  ST_VALUE = 0,    // Vērtība (pēc ':' vai ',' masīvā, vai dokumenta sākumā)
+  ST_VALUE_OR_END, // Pēc '['
+  ST_KEY_OR_END,   // Pēc '{'
+  ST_KEY,          // Pēc ',' objektā
+  ST_COLON,        // Pēc atslēgas (arī kamēr lasām atslēgas virkni)
+  ST_AFTER_VALUE,  // ',' vai aizverošā iekava
+  ST_DONE,         // Dokuments beidzies; atļautas tikai atstarpes
+  ST_ERROR,
+};
+
+enum {
+  LEX_NONE = 0,
+  LEX_STR,
+  LEX_STR_ESC, // Pēc '\'
+  LEX_STR_HEX, // \uXXXX cipari
+  LEX_NUM,
+  LEX_LIT,     // true / false / null
+};
+
+typedef enum {
+  CTX_NONE = 0, // Mums nevajadzīgs konteiners
+  CTX_ROOT,
+  CTX_RESULT,
+  CTX_UPDATE,
+  CTX_MESSAGE,
+  CTX_CALLBACK,
+  CTX_CB_MESSAGE, // callback_query.message
+  CTX_CHAT,
+} ctx_t;
+
+typedef enum {
+  KEY_OTHER = 0,
+  KEY_OK,
+  KEY_RESULT,
+  KEY_UPDATE_ID,
+  KEY_MESSAGE,
+  KEY_CALLBACK_QUERY,
+  KEY_CHAT,
+  KEY_ID,
+  KEY_TEXT,
+  KEY_DATA,
+} key_id_t;
+
+typedef enum {
+  FIELD_NONE = 0,
+  FIELD_OK,
+  FIELD_UPDATE_ID,
+  FIELD_CHAT_ID,
+  FIELD_TEXT,
+  FIELD_CB_ID,
+  FIELD_CB_DATA,
+} field_t;
+
+static const struct {
+  const char *name;
+  uint8_t key;
+} KEYS[] = {
+    {"ok", KEY_OK},
+    {"result", KEY_RESULT},
+    {"update_id", KEY_UPDATE_ID},
+    {"message", KEY_MESSAGE},
+    {"callback_query", KEY_CALLBACK_QUERY},
+    {"chat", KEY_CHAT},
+    {"id", KEY_ID},
+    {"text", KEY_TEXT},
+    {"data", KEY_DATA},
+};
+
+// ============================================
+// PALĪGFUNKCIJAS
+// ============================================
+
+static bool fail(tg_parser_t *p) {
+  p->error = true;
+  p->state = ST_ERROR;
+  return false;
+}
+
+static inline bool in_array(const tg_parser_t *p) {
+  return p->depth && (p->array_mask & (1u << (p->depth - 1)));
+}
+
+static void after_value(tg_parser_t *p) {
+  p->state = p->depth ? ST_AFTER_VALUE : ST_DONE;
+}
+
+// Kur ierakstīt vērtību, kas sākas pašreizējā pozīcijā
+static uint8_t value_field(const tg_parser_t *p) {
+  if (!p->depth || in_array(p))
+    return FIELD_NONE;
+  uint8_t ctx = p->ctx[p->depth - 1];
+  uint8_t key = p->key[p->depth - 1];
+  if (ctx == CTX_ROOT && key == KEY_OK)
+    return FIELD_OK;
+  if (!p->cur)
+    return FIELD_NONE;
+  if (ctx == CTX_UPDATE && key == KEY_UPDATE_ID)
+    return FIELD_UPDATE_ID;
+  if (ctx == CTX_MESSAGE && key == KEY_TEXT)
+    return FIELD_TEXT;
+  if (ctx == CTX_CHAT && key == KEY_ID)
+    return FIELD_CHAT_ID;
+  if (ctx == CTX_CALLBACK && key == KEY_ID)
+    return FIELD_CB_ID;
+  if (ctx == CTX_CALLBACK && key == KEY_DATA)
+    return FIELD_CB_DATA;
+  return FIELD_NONE;
+}
+
+// Konteksts konteineram, kas sākas pašreizējā pozīcijā
+static uint8_t child_ctx(const tg_parser_t *p, bool array) {
+  if (!p->depth)
+    return array ? CTX_NONE : CTX_ROOT;
+  uint8_t ctx = p->ctx[p->depth - 1];
+  if (in_array(p))
+    return ctx == CTX_RESULT && !array ? CTX_UPDATE : CTX_NONE;
+  uint8_t key = p->key[p->depth - 1];
+  if (ctx == CTX_ROOT && key == KEY_RESULT && array)
+    return CTX_RESULT;
+  if (array)
+    return CTX_NONE;
+  if (ctx == CTX_UPDATE && key == KEY_MESSAGE)
+    return CTX_MESSAGE;
+  if (ctx == CTX_UPDATE && key == KEY_CALLBACK_QUERY)
+    return CTX_CALLBACK;
+  if (ctx == CTX_CALLBACK && key == KEY_MESSAGE)
+    return CTX_CB_MESSAGE;
+  if ((ctx == CTX_MESSAGE || ctx == CTX_CB_MESSAGE) && key == KEY_CHAT)
+    return CTX_CHAT;
+  return CTX_NONE;
+}
+
+static bool container_begin(tg_parser_t *p, bool array) {
+  if (p->depth >= TG_DEPTH_MAX)
+    return fail(p);
+
+  uint8_t ctx = child_ctx(p, array);
+  if (ctx == CTX_UPDATE) {
+    // Atjauninājumi pāri TG_MAX_UPDATES tiek tikai saskaitīti
+    p->update_total++;
+    p->cur = p->update_cnt < TG_MAX_UPDATES ? &p->updates[p->update_cnt] : NULL;
+    if (p->cur)
+      memset(p->cur, 0, sizeof(*p->cur));
+  } else if (p->cur && ctx == CTX_MESSAGE) {
+    p->cur->type = TG_UPDATE_MESSAGE;
+  } else if (p->cur && ctx == CTX_CALLBACK) {
+    p->cur->type = TG_UPDATE_CALLBACK;
+  }
+
+  p->ctx[p->depth] = ctx;
+  p->key[p->depth] = KEY_OTHER;
+  if (array)
+    p->array_mask |= 1u << p->depth;
+  else
+    p->array_mask &= ~(1u << p->depth);
+  p->depth++;
+  p->state = array ? ST_VALUE_OR_END : ST_KEY_OR_END;
+  return true;
+}
+
+static bool container_end(tg_parser_t *p, bool array) {
+  if (!p->depth || in_array(p) != array)
+    return fail(p);
+
+  p->depth--;
+  if (p->ctx[p->depth] == CTX_UPDATE) {
+    if (p->cur)
+      p->update_cnt++;
+    p->cur = NULL;
+  }
+  after_value(p);
+  return true;
+}
+
+static void str_put(tg_parser_t *p, uint8_t c) {
+  if (!p->str)
+    return;
+  if (p->str_len + 1 < p->str_cap)
+    p->str[p->str_len++] = (char)c;
+  else
+    p->str_truncated = true;
+}
+
+static void str_put_cp(tg_parser_t *p, uint32_t cp) {
+  if (cp < 0x80) {
+    str_put(p, cp);
+  } else if (cp < 0x800) {
+    str_put(p, 0xC0 | (cp >> 6));
+    str_put(p, 0x80 | (cp & 0x3F));
+  } else if (cp < 0x10000) {
+    str_put(p, 0xE0 | (cp >> 12));
+    str_put(p, 0x80 | ((cp >> 6) & 0x3F));
+    str_put(p, 0x80 | (cp & 0x3F));
+  } else {
+    str_put(p, 0xF0 | (cp >> 18));
+    str_put(p, 0x80 | ((cp >> 12) & 0x3F));
+    str_put(p, 0x80 | ((cp >> 6) & 0x3F));
+    str_put(p, 0x80 | (cp & 0x3F));
+  }
+}
+
+// Augstais surogāts bez zemā pāra => U+FFFD
+static void str_flush_surrogate(tg_parser_t *p) {
+  if (p->high_surrogate) {
+    str_put_cp(p, 0xFFFD);
+    p->high_surrogate = 0;
+  }
+}
+
+static void str_put_escaped(tg_parser_t *p, uint32_t cp) {
+  if (p->high_surrogate && cp >= 0xDC00 && cp <= 0xDFFF) {
+    cp = 0x10000 + ((p->high_surrogate - 0xD800) << 10) + (cp - 0xDC00);
+    p->high_surrogate = 0;
+    str_put_cp(p, cp);
+    return;
+  }
+  str_flush_surrogate(p);
+  if (cp >= 0xD800 && cp <= 0xDBFF)
+    p->high_surrogate = cp;
+  else if (cp >= 0xDC00 && cp <= 0xDFFF)
+    str_put_cp(p, 0xFFFD);
+  else
+    str_put_cp(p, cp);
+}
+
+static void str_begin(tg_parser_t *p, bool key) {
+  p->str = NULL;
+  if (key) {
+    p->str = p->key_buf;
+    p->str_cap = sizeof(p->key_buf);
+    p->state = ST_COLON; // Pēc virknes beigām tā arī atšķiram atslēgu
+  } else {
+    p->field = value_field(p);
+    if (p->field == FIELD_TEXT) {
+      p->str = p->cur->text;
+      p->str_cap = sizeof(p->cur->text);
+    } else if (p->field == FIELD_CB_ID) {
+      p->str = p->cur->callback_id;
+      p->str_cap = sizeof(p->cur->callback_id);
+    } else if (p->field == FIELD_CB_DATA) {
+      p->str = p->cur->callback_data;
+      p->str_cap = sizeof(p->cur->callback_data);
+    }
+  }
+  p->str_len = 0;
+  p->str_truncated = false;
+  p->high_surrogate = 0;
+  p->lex = LEX_STR;
+}
+
+static void str_end(tg_parser_t *p) {
+  str_flush_surrogate(p);
+  p->lex = LEX_NONE;
+
+  if (p->str) {
+    // Apgriežot nedrīkst pārraut UTF-8 simbolu
+    if (p->str_truncated && p->str_len) {
+      uint16_t start = p->str_len - 1;
+      while (start && ((uint8_t)p->str[start] & 0xC0) == 0x80)
+        start--;
+      uint8_t lead = p->str[start];
+      uint16_t need = lead >= 0xF0   ? 4
+                      : lead >= 0xE0 ? 3
+                      : lead >= 0xC0 ? 2
+                                     : 1;
+      if (p->str_len - start < need)
+        p->str_len = start;
+    }
+    p->str[p->str_len] = '\0';
+  }
+
+  if (p->state == ST_COLON) {
+    uint8_t key = KEY_OTHER;
+    if (!p->str_truncated) {
+      for (size_t i = 0; i < sizeof(KEYS) / sizeof(KEYS[0]); i++) {
+        if (strcmp(p->key_buf, KEYS[i].name) == 0) {
+          key = KEYS[i].key;
+          break;
+        }
+      }
+    }
+    p->key[p->depth - 1] = key;
+    return;
+  }
+
+  if (p->field == FIELD_TEXT) {
+    p->cur->has_text = true;
+    p->cur->text_truncated = p->str_truncated;
+  }
+  after_value(p);
+}
+
+static void num_end(tg_parser_t *p) {
+  p->lex = LEX_NONE;
+  if (p->num_int) {
+    int64_t v = p->num_neg ? -p->num : p->num;
+    if (p->field == FIELD_UPDATE_ID) {
+      p->cur->update_id = v;
+      p->cur->has_update_id = true;
+    } else if (p->field == FIELD_CHAT_ID) {
+      p->cur->chat_id = v;
+      p->cur->has_chat_id = true;
+    }
+  }
+  after_value(p);
+}
+
+static bool value_begin(tg_parser_t *p, char c) {
+  switch (c) {
+  case '{':
+    return container_begin(p, false);
+  case '[':
+    return container_begin(p, true);
+  case '"':
+    str_begin(p, false);
+    return true;
+  case 't':
+  case 'f':
+  case 'n':
+    p->field = value_field(p);
+    p->lit = c == 't' ? "true" : c == 'f' ? "false" : "null";
+    p->lit_pos = 1;
+    p->lex = LEX_LIT;
+    return true;
+  default:
+    break;
+  }
+
+  if (c != '-' && (c < '0' || c > '9'))
+    return fail(p);
+  p->field = value_field(p);
+  p->num = 0;
+  p->num_neg = c == '-';
+  p->num_digits = c != '-';
+  p->num_int = true;
+  if (c != '-')
+    p->num = c - '0';
+  p->lex = LEX_NUM;
+  return true;
+}
+
+// Atgriež false, ja c vairs nepieder skaitlim (tad tas jāapstrādā no jauna)
+static bool num_char(tg_parser_t *p, char c) {
+  if (c >= '0' && c <= '9') {
+    int d = c - '0';
+    if (p->num > (INT64_MAX - d) / 10)
+      p->num_int = false;
+    else if (p->num_int)
+      p->num = p->num * 10 + d;
+    p->num_digits = true;
+    return true;
+  }
+  if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+    p->num_int = false; // Daļskaitļi mūs neinteresē
+    return true;
+  }
+  return false;
+}
+
+static bool hex_digit(char c, uint32_t *v) {
+  if (c >= '0' && c <= '9')
+    *v = c - '0';
+  else if (c >= 'a' && c <= 'f')
+    *v = c - 'a' + 10;
+  else if (c >= 'A' && c <= 'F')
+    *v = c - 'A' + 10;
+  else
+    return false;
+  return true;
+}
+
+// ============================================
+// PUBLISKĀ DAĻA
+// ============================================
+
+void tg_parser_reset(tg_parser_t *p) {
+  p->update_cnt = 0;
+  p->update_total = 0;
+  p->ok = false;
+  p->error = false;
+  p->bytes = 0;
+  p->state = ST_VALUE;
+  p->lex = LEX_NONE;
+  p->depth = 0;
+  p->array_mask = 0;
+  p->cur = NULL;
+  p->str = NULL;
+}
+
+bool tg_parser_feed(tg_parser_t *p, const char *data, size_t len) {
+  if (p->error)
+    return false;
+  p->bytes += len;
+
+  size_t i = 0;
+  while (i < len) {
+    char c = data[i];
+
+    switch (p->lex) {
+    case LEX_STR: {
+      // Parastās rakstzīmes apstrādā vienā piegājienā
+      size_t end = i;
+      while (end < len && data[end] != '"' && data[end] != '\\' &&
+             (uint8_t)data[end] >= 0x20)
+        end++;
+      if (end > i) {
+        str_flush_surrogate(p);
+        if (p->str) {
+          for (; i < end; i++)
+            str_put(p, data[i]);
+        }
+        i = end;
+        continue;
+      }
+      if (c == '"')
+        str_end(p);
+      else if (c == '\\')
+        p->lex = LEX_STR_ESC;
+      else
+        return fail(p);
+      i++;
+      continue;
+    }
+
+    case LEX_STR_ESC: {
+      static const char ESC_IN[] = "\"\\/bfnrt";
+      static const char ESC_OUT[] = "\"\\/\b\f\n\r\t";
+      p->lex = LEX_STR;
+      if (c == 'u') {
+        p->lex = LEX_STR_HEX;
+        p->hex_cnt = 0;
+        p->hex = 0;
+      } else {
+        const char *e = c ? strchr(ESC_IN, c) : NULL;
+        if (!e)
+          return fail(p);
+        str_put_escaped(p, ESC_OUT[e - ESC_IN]);
+      }
+      i++;
+      continue;
+    }
+
+    case LEX_STR_HEX: {
+      uint32_t v;
+      if (!hex_digit(c, &v))
+        return fail(p);
+      p->hex = (p->hex << 4) | v;
+      if (++p->hex_cnt == 4) {
+        p->lex = LEX_STR;
+        str_put_escaped(p, p->hex);
+      }
+      i++;
+      continue;
+    }
+
+    case LEX_LIT:
+      if (c != p->lit[p->lit_pos])
+        return fail(p);
+      if (p->lit[++p->lit_pos] == '\0') {
+        p->lex = LEX_NONE;
+        if (p->field == FIELD_OK)
+          p->ok = p->lit[0] == 't';
+        after_value(p);
+      }
+      i++;
+      continue;
+
+    case LEX_NUM:
+      if (num_char(p, c)) {
+        i++;
+        continue;
+      }
+      if (!p->num_digits)
+        return fail(p);
+      num_end(p);
+      break; // c tiek apstrādāts zemāk
+
+    default:
+      break;
+    }
+
+    i++;
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+      continue;
+
+    bool res = true;
+    switch (p->state) {
+    case ST_VALUE_OR_END:
+      if (c == ']') {
+        res = container_end(p, true);
+        break;
+      }
+      // fallthrough
+    case ST_VALUE:
+      res = value_begin(p, c);
+      break;
+    case ST_KEY_OR_END:
+      if (c == '}') {
+        res = container_end(p, false);
+        break;
+      }
+      // fallthrough
+    case ST_KEY:
+      if (c == '"')
+        str_begin(p, true);
+      else
+        res = fail(p);
+      break;
+    case ST_COLON:
+      if (c == ':')
+        p->state = ST_VALUE;
+      else
+        res = fail(p);
+      break;
+    case ST_AFTER_VALUE:
+      if (c == ',')
+        p->state = in_array(p) ? ST_VALUE : ST_KEY;
+      else if (c == ']' || c == '}')
+        res = container_end(p, c == ']');
+      else
+        res = fail(p);
+      break;
+    default: // ST_DONE, ST_ERROR
+      res = fail(p);
+      break;
+    }
+    if (!res)
+      return false;
+  }
+  return true;
+}
+
+bool tg_parser_finish(tg_parser_t *p) {
+  return !p->error && p->state == ST_DONE && p->lex == LEX_NONE;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Straumējošs getUpdates atbildes parsētājs.
+// JSON tiek padots pa gabaliem tieši no HTTP_EVENT_ON_DATA, un no tā tiek
+// izvilkti tikai vajadzīgie lauki fiksētās struktūrās. Atmiņa netiek
+// izdalīta, un atbildes izmērs nav ierobežots (garākas teksta vērtības tiek
+// apgrieztas, bet parsēšana turpinās). Šis fails nav atkarīgs no ESP-IDF,
+// tāpēc to var kompilēt un mērīt arī uz datora.
+
+#define TG_MAX_UPDATES  4    // Cik atjauninājumus saglabā no vienas atbildes
+#define TG_TEXT_MAX     256  // message.text (ar '\0')
+#define TG_CB_ID_MAX    64   // callback_query.id (ar '\0')
+#define TG_CB_DATA_MAX  65   // callback_query.data ir 1-64 baiti (+ '\0')
+#define TG_DEPTH_MAX    32   // Dziļāka ligzdošana tiek uzskatīta par kļūdu
+#define TG_KEY_MAX      16   // Garākas atslēgas noteikti nav mums vajadzīgās
+
+typedef enum {
+  TG_UPDATE_OTHER = 0,
+  TG_UPDATE_MESSAGE,
+  TG_UPDATE_CALLBACK,
+} tg_update_type_t;
+
+typedef struct {
+  int64_t update_id;
+  uint8_t type;        // tg_update_type_t
+  bool has_update_id;
+  bool has_chat_id;    // message.chat.id vai callback_query.message.chat.id
+  bool has_text;       // message.text
+  bool text_truncated; // Teksts bija garāks par TG_TEXT_MAX - 1 baitiem
+  int64_t chat_id;
+  char text[TG_TEXT_MAX];
+  char callback_id[TG_CB_ID_MAX];
+  char callback_data[TG_CB_DATA_MAX];
+} tg_update_t;
+
+typedef struct {
+  // Rezultāts
+  tg_update_t updates[TG_MAX_UPDATES];
+  uint8_t update_cnt;    // Saglabātie atjauninājumi
+  uint32_t update_total; // Visi atjauninājumi atbildē (arī nesaglabātie)
+  bool ok;               // "ok": true
+  bool error;            // Sintakses kļūda vai pārāk dziļa ligzdošana
+  uint32_t bytes;        // Apstrādātie baiti
+
+  // Iekšējais stāvoklis
+  uint8_t state;
+  uint8_t lex;
+  uint8_t depth;
+  uint32_t array_mask;        // 1 bits = masīvs attiecīgajā dziļumā
+  uint8_t ctx[TG_DEPTH_MAX];  // Konteinera nozīme (ctx_t)
+  uint8_t key[TG_DEPTH_MAX];  // Pēdējā atslēga objektā (key_id_t)
+  uint8_t field;              // Kur ierakstīt pašreizējo vērtību
+  tg_update_t *cur;           // Aizpildāmais atjauninājums vai NULL
+
+  char key_buf[TG_KEY_MAX];
+
+  char *str;                  // Virknes mērķis (NULL = izlaist)
+  uint16_t str_cap;
+  uint16_t str_len;
+  bool str_truncated;
+  uint8_t hex_cnt;
+  uint32_t hex;
+  uint32_t high_surrogate;
+
+  int64_t num;
+  bool num_neg;
+  bool num_digits;
+  bool num_int;               // Vesels skaitlis, kas ietilpst int64_t
+
+  const char *lit;            // Gaidāmais literālis (true/false/null)
+  uint8_t lit_pos;
+} tg_parser_t;
+
+// Sagatavo jaunai atbildei
+void tg_parser_reset(tg_parser_t *p);
+
+// Apstrādā nākamo atbildes gabalu. Atgriež false, ja atrasta kļūda.
+bool tg_parser_feed(tg_parser_t *p, const char *data, size_t len);
+
+// Atgriež true, ja saņemts pilns un korekts JSON dokuments
+bool tg_parser_finish(tg_parser_t *p);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,65 @@
+# PlatformIO papildu skripts: "assets" partīcijas paka (build/assets.bin).
+#
+# PlatformIO būvē ESP-IDF projektu pats, tāpēc CMakeLists.txt `assets` mērķis un
+# `esptool_py_flash_to_partition()` (tie strādā tikai ar idf.py) šeit neizpildās,
+# un `pio run -t upload` ieraksta tikai bootloader, partīciju tabulu un app.
+#
+#   pio run -t assets          uzbūvē .pio/build/<env>/assets.bin
+#   pio run -t upload_assets   uzbūvē un ieraksta to "assets" partīcijā
+#
+# Fontu saraksts ir tāds pats kā ASSETS_SRCS failā CMakeLists.txt.
+
+import csv
+import os
+
+Import("env")  # noqa: F821
+
+PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+ASSETS_BIN = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")  # noqa: F821
+ASSETS_PACKER = os.path.join(PROJECT_DIR, "libraries", "lvgl", "scripts", "lv_assets_pack.py")
+ASSETS_FONT_DIR = os.path.join(PROJECT_DIR, "libraries", "lvgl", "src", "font")
+ASSETS_SRCS = [os.path.join(PROJECT_DIR, "src", f) for f in ("ekstra.c", "ekstra1.c", "eeet.c")] + [
+    os.path.join(ASSETS_FONT_DIR, "lv_font_montserrat_%d.c" % s) for s in (14, 20, 22, 24, 26, 28)
+]
+
+
+def partition(name):
+    """(offset, size) no board_build.partitions tabulas"""
+    table = os.path.join(PROJECT_DIR, env.GetProjectOption("board_build.partitions"))  # noqa: F821
+    with open(table) as f:
+        for row in csv.reader(line for line in f if not line.lstrip().startswith("#")):
+            row = [c.strip() for c in row]
+            if len(row) >= 5 and row[0] == name:
+                return int(row[3], 0), int(row[4], 0)
+    raise ValueError("%s: no \"%s\" partition" % (table, name))
+
+
+ASSETS_OFFSET, ASSETS_SIZE = partition("assets")
+
+# 16 bit krāsas ar LV_COLOR_16_SWAP 1 (src/lv_conf.h)
+assets = env.Command(  # noqa: F821
+    ASSETS_BIN, ASSETS_SRCS + [ASSETS_PACKER],
+    env.VerboseAction(  # noqa: F821
+        '"$PYTHONEXE" "%s" --color-depth 16 --swap --max-size %d -o "$TARGET" %s'
+        % (ASSETS_PACKER, ASSETS_SIZE, " ".join('"%s"' % s for s in ASSETS_SRCS)),
+        "Packing $TARGET"))
+
+env.AddCustomTarget(  # noqa: F821
+    name="assets",
+    dependencies=assets,
+    actions=None,
+    title="Build assets",
+    description="Pack the fonts of the \"assets\" partition")
+
+env.AddCustomTarget(  # noqa: F821
+    name="upload_assets",
+    dependencies=assets,
+    actions=[
+        env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),  # noqa: F821
+        env.VerboseAction(  # noqa: F821
+            '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+            'write_flash 0x%x "%s"' % (ASSETS_OFFSET, ASSETS_BIN),
+            "Writing %s to the \"assets\" partition at 0x%x" % (os.path.basename(ASSETS_BIN), ASSETS_OFFSET)),
+    ],
+    title="Upload assets",
+    description="Write assets.bin to the \"assets\" partition")
@@ -9,6 +9,7 @@
 #include "display_manager.h"  // Pievienojam display manager
 
 #include "damper_control.h"   // Pievienojam damper kontroli
+#include "burn_history.h"     // JAUNS: degšanas vēsture (PSRAM + littlefs)
 #include "../libraries/wifi/wifi.h"  // JAUNS: WiFi bibliotēka
 #include "../libraries/telegram_bot/telegram_bot.h"  // JAUNS: Telegram bots
 
@@ -95,6 +96,11 @@ extern "C" void app_main(void)
     // Startējam damper kontroles task
     startDamperControlTask();
 
+    // JAUNS: Degšanas vēsture - ieraksta 1x sekundē temperatūru, damper, mērķi un fāzi
+    ESP_LOGI(TAG, "5b. Inicializējam degšanas vēsturi...");
+    burn_history_init();
+    burn_history_start();
+
     // ====== 6. OTA INICIALIZĀCIJA ======
     ESP_LOGI(TAG, "6. Inicializējam OTA...");
     ota_setup();
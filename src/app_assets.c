@@ -0,0 +1,93 @@
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "app_assets.h"
+
+static const char *TAG = "ASSETS";
+
+#define ASSETS_PARTITION    "assets"
+#define ASSETS_FONT_MAX     16
+
+static lv_assets_t assets;
+static bool mounted = false;
+static esp_partition_mmap_handle_t map_handle;
+
+// Ielādētie fonti, lai katru ielādētu tikai vienreiz
+static struct {
+    const char *name;
+    lv_font_t *font;
+} fonts[ASSETS_FONT_MAX];
+
+esp_err_t app_assets_mount(void)
+{
+    if (mounted) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           ASSETS_PARTITION);
+    if (part == NULL) {
+        ESP_LOGW(TAG, "No \"%s\" partition", ASSETS_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // Vispirms tikai galvene, lai MMU lapas aizņemtu tikai pašu paku, nevis visu partīciju
+    const uint32_t *header;
+    esp_err_t err = esp_partition_mmap(part, 0, 16, ESP_PARTITION_MMAP_DATA, (const void **)&header, &map_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    uint32_t size = memcmp(header, "LVAB", 4) == 0 ? header[3] : 0;
+    esp_partition_munmap(map_handle);
+    if (size == 0 || size > part->size) {
+        ESP_LOGW(TAG, "The \"%s\" partition is empty", ASSETS_PARTITION);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const void *data;
+    err = esp_partition_mmap(part, 0, size, ESP_PARTITION_MMAP_DATA, &data, &map_handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (lv_assets_init(&assets, data, size) != LV_RES_OK) {
+        esp_partition_munmap(map_handle);
+        ESP_LOGW(TAG, "Invalid asset bundle");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    mounted = true;
+    ESP_LOGI(TAG, "%u assets, %u bytes mapped from 0x%x", (unsigned)assets.entry_cnt, (unsigned)size,
+             (unsigned)part->address);
+    return ESP_OK;
+}
+
+const lv_assets_t *app_assets_get(void)
+{
+    return mounted ? &assets : NULL;
+}
+
+const lv_font_t *app_assets_font(const char *name, const lv_font_t *builtin)
+{
+    if (!mounted) {
+        return builtin;
+    }
+
+    int i;
+    for (i = 0; i < ASSETS_FONT_MAX && fonts[i].name; i++) {
+        if (strcmp(fonts[i].name, name) == 0) {
+            return fonts[i].font;
+        }
+    }
+
+    lv_font_t *font = lv_assets_load_font(&assets, name);
+    if (font == NULL) {
+        ESP_LOGW(TAG, "Font %s not found, using the built-in one", name);
+        return builtin;
+    }
+    if (i < ASSETS_FONT_MAX) {
+        fonts[i].name = name;
+        fonts[i].font = font;
+    }
+    return font;
+}
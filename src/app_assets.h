@@ -0,0 +1,31 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Piesaista (mmap) "assets" partīciju ar fontiem un attēliem, kas izveidota ar lv_assets_pack.py.
+ * Fonti un attēli tiek lietoti tieši no flash, bez kopēšanas uz RAM.
+ * @return ESP_OK vai kļūda, ja partīcijas nav vai tā nav ierakstīta
+ */
+esp_err_t app_assets_mount(void);
+
+/**
+ * @return piesaistītā partīcija vai NULL, ja app_assets_mount() neizdevās
+ */
+const lv_assets_t *app_assets_get(void);
+
+/**
+ * Fonts no assets partīcijas. Ielādēts vienreiz un netiek atbrīvots.
+ * @param name    fonta nosaukums partīcijā (C mainīgā nosaukums, piem. "lv_font_montserrat_28")
+ * @param builtin iebūvētais fonts, ko lietot, ja partīcijā tā nav
+ */
+const lv_font_t *app_assets_font(const char *name, const lv_font_t *builtin);
+
+#ifdef __cplusplus
+}
+#endif
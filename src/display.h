@@ -37,6 +37,17 @@
 #define EXAMPLE_LCD_QSPI_H_RES      (320)
 #define EXAMPLE_LCD_QSPI_V_RES      (480)
 
+/* Send RASET over QSPI so any invalidated rectangle is written as is.
+ * With 0 the panel is written from row 0 with RAMWR/RAMWRC continuation and
+ * LVGL areas are extended up to the first panel row (columns are kept). */
+#define BSP_LCD_QSPI_RASET          (0)
+
+/* Fixed time of one flush in pixel times: the CASET/RAMWR setup and waiting for
+ * the TE signal, on average half of the 16 ms frame. At 40 MHz QSPI plus the
+ * rendering a pixel takes ~0.2 us, so 8 ms is ~40000 pixels. LVGL joins nearby
+ * invalidated areas when one larger flush is cheaper than several small ones. */
+#define BSP_LCD_FLUSH_COST_PX       (40000)
+
 /**
  * @brief Tear configuration structure
  *
@@ -23,6 +23,7 @@
 #include "freertos/task.h"
 #include "lvgl.h"
 #include <stdio.h>
+#include <string.h>
 
 #include "display.h"
 #include "esp_bsp.h"
@@ -42,18 +43,40 @@ typedef struct {
   portMUX_TYPE lock;     /*!< Lock for read/write */
 } bsp_lcd_tear_t;
 
+/* Touch reader task: the controller is read only after an INT edge. While a
+ * finger is down the controller keeps pulsing INT, the timeout only catches a
+ * release whose edge was missed. */
+#define BSP_TOUCH_TASK_PRIORITY (5)
+#define BSP_TOUCH_TASK_STACK (3072)
+#define BSP_TOUCH_RELEASE_TIMEOUT_MS (20)
+#define BSP_TOUCH_POLL_PERIOD_MS (30)
+
 typedef struct {
   SemaphoreHandle_t tp_intr_event; /*!< Semaphore for tp interrupt */
+  TaskHandle_t task;    /*!< Touch reader task */
   lv_disp_rot_t rotate; /*!< Rotation configuration for the display */
 } bsp_touch_int_t;
 
 static lv_disp_t *disp;
+static lv_disp_rot_t disp_rotate = LV_DISP_ROT_NONE;
 static lv_indev_t *disp_indev = NULL;
 static esp_lcd_touch_handle_t tp = NULL; // LCD touch handle
 static esp_lcd_panel_handle_t panel_handle = NULL;
 
 static bool i2c_initialized = false;
 
+typedef struct {
+  bsp_display_idle_cfg_t cfg;
+  SemaphoreHandle_t wake_sem;    /*!< Given by touch interrupt or wake API */
+  volatile bsp_display_idle_state_t state; /*!< Also read by touch interrupt */
+  int64_t state_since_us;        /*!< Timestamp of the last state change */
+  uint64_t residency_us[BSP_DISPLAY_IDLE_STATE_NUM];
+  uint32_t wakeups;
+  portMUX_TYPE lock;             /*!< Lock for statistics */
+} bsp_display_idle_t;
+
+static bsp_display_idle_t *volatile idle_ctx = NULL;
+
 esp_err_t bsp_i2c_init(void) {
   /* I2C was initialized before */
   if (i2c_initialized) {
@@ -213,6 +236,7 @@ esp_err_t bsp_display_new(const bsp_display_config_t *config,
       .flags =
           {
               .use_qspi_interface = 1,
+              .qspi_raset = BSP_LCD_QSPI_RASET,
           },
   };
   const esp_lcd_panel_dev_config_t panel_config = {
@@ -302,6 +326,19 @@ err:
   return ret;
 }
 
+#if !BSP_LCD_QSPI_RASET
+static void bsp_display_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area) {
+  /* Without RASET a transfer has to start at the first panel row */
+  int x1 = area->x1, y1 = area->y1, x2 = area->x2, y2 = area->y2;
+  esp_lcd_axs15231b_qspi_round_area(disp_rotate, drv->hor_res, drv->ver_res,
+                                    &x1, &y1, &x2, &y2);
+  area->x1 = x1;
+  area->y1 = y1;
+  area->x2 = x2;
+  area->y2 = y2;
+}
+#endif
+
 static lv_disp_t *bsp_display_lcd_init(const bsp_display_cfg_t *cfg) {
   assert(cfg != NULL);
   esp_lcd_panel_io_handle_t io_handle = NULL;
@@ -333,12 +370,18 @@ static lv_disp_t *bsp_display_lcd_init(const bsp_display_cfg_t *cfg) {
       .vres = vres,
       .trans_size = hres * vres / 10,
       .draw_wait_cb = bsp_display_sync_cb,
+#if !BSP_LCD_QSPI_RASET
+      .rounder_cb = bsp_display_rounder_cb,
+#endif
+      .flush_cost = BSP_LCD_FLUSH_COST_PX,
       .flags =
           {
               .buff_dma = false,
               .buff_spiram = true,
+              .full_refresh = false,
           },
   };
+  disp_rotate = cfg->rotate;
 
   if (disp_cfg.sw_rotate == LV_DISP_ROT_180 ||
       disp_cfg.sw_rotate == LV_DISP_ROT_NONE) {
@@ -352,20 +395,29 @@ static lv_disp_t *bsp_display_lcd_init(const bsp_display_cfg_t *cfg) {
   return lvgl_port_add_disp(&disp_cfg);
 }
 
-static bool bsp_touch_sync_cb(void *arg) {
-  assert(arg);
-  bool touch_interrupt = false;
-  bsp_touch_int_t *touch_handle = (bsp_touch_int_t *)arg;
+static void bsp_touch_task(void *arg) {
+  esp_lcd_touch_handle_t tp = (esp_lcd_touch_handle_t)arg;
+  bsp_touch_int_t *touch_handle = (bsp_touch_int_t *)tp->config.user_data;
+  bool pressed = false;
+
+  while (1) {
+    if (touch_handle->tp_intr_event) {
+      /* No bus traffic at all until the first edge */
+      TickType_t timeout = pressed
+                               ? pdMS_TO_TICKS(BSP_TOUCH_RELEASE_TIMEOUT_MS)
+                               : portMAX_DELAY;
+      if (xSemaphoreTake(touch_handle->tp_intr_event, timeout) != pdTRUE &&
+          !pressed) {
+        continue;
+      }
+    } else {
+      vTaskDelay(pdMS_TO_TICKS(BSP_TOUCH_POLL_PERIOD_MS));
+    }
 
-  if (touch_handle && touch_handle->tp_intr_event) {
-    if (xSemaphoreTake(touch_handle->tp_intr_event, 0) == pdTRUE) {
-      touch_interrupt = true;
+    if (esp_lcd_touch_read_event(tp, &pressed) != ESP_OK) {
+      pressed = false;
     }
-  } else {
-    touch_interrupt = true;
   }
-
-  return touch_interrupt;
 }
 
 static void bsp_touch_interrupt_cb(esp_lcd_touch_handle_t tp) {
@@ -373,6 +425,9 @@ static void bsp_touch_interrupt_cb(esp_lcd_touch_handle_t tp) {
   bsp_touch_int_t *touch_handle = (bsp_touch_int_t *)tp->config.user_data;
 
   xSemaphoreGiveFromISR(touch_handle->tp_intr_event, &xHigherPriorityTaskWoken);
+  if (idle_ctx && idle_ctx->state != BSP_DISPLAY_IDLE_ACTIVE) {
+    xSemaphoreGiveFromISR(idle_ctx->wake_sem, &xHigherPriorityTaskWoken);
+  }
 
   if (xHigherPriorityTaskWoken) {
     portYIELD_FROM_ISR();
@@ -464,6 +519,16 @@ esp_err_t bsp_touch_new(const bsp_display_cfg_t *config,
   touch_ctx->rotate = config->rotate;
   tp_handle->config.user_data = touch_ctx;
 
+  const esp_lcd_touch_filter_cfg_t filter_cfg =
+      ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+  esp_lcd_touch_set_filter(tp_handle, &filter_cfg);
+
+  ESP_GOTO_ON_FALSE(xTaskCreate(bsp_touch_task, "Touch task",
+                                BSP_TOUCH_TASK_STACK, tp_handle,
+                                BSP_TOUCH_TASK_PRIORITY,
+                                &touch_ctx->task) == pdPASS,
+                    ESP_FAIL, err, TAG, "Create touch task fail!");
+
   *ret_touch = tp_handle;
 
   return ESP_OK;
@@ -492,7 +557,6 @@ static lv_indev_t *bsp_display_indev_init(const bsp_display_cfg_t *config,
   const lvgl_port_touch_cfg_t touch_cfg = {
       .disp = disp,
       .handle = tp,
-      .touch_wait_cb = bsp_touch_sync_cb,
   };
 
   return lvgl_port_add_touch(&touch_cfg);
@@ -517,3 +581,182 @@ bool bsp_display_lock(uint32_t timeout_ms) {
 }
 
 void bsp_display_unlock(void) { lvgl_port_unlock(); }
+
+static void bsp_display_idle_set_state(bsp_display_idle_t *ctx,
+                                       bsp_display_idle_state_t state) {
+  const bsp_display_idle_state_t prev = ctx->state;
+  int64_t now = esp_timer_get_time();
+
+  if (prev == state) {
+    return;
+  }
+
+  /* Leave the previous state */
+  if (prev == BSP_DISPLAY_IDLE_SLEEP) {
+    esp_lcd_panel_disp_sleep(panel_handle, false);
+    esp_lcd_panel_disp_on_off(panel_handle, true);
+    bsp_display_lock(0);
+    lvgl_port_resume();
+    /* The tick was stopped, start counting inactivity from now and swallow
+     * the touch that woke us up so it doesn't click through */
+    lv_disp_trig_activity(disp);
+    if (disp_indev) {
+      lv_indev_wait_release(disp_indev);
+    }
+    bsp_display_unlock();
+  }
+
+  /* Enter the new state */
+  switch (state) {
+  case BSP_DISPLAY_IDLE_ACTIVE:
+  case BSP_DISPLAY_IDLE_DIM: {
+    uint32_t period = LV_DISP_DEF_REFR_PERIOD;
+    if (state == BSP_DISPLAY_IDLE_DIM && ctx->cfg.dim_refr_period_ms) {
+      period = ctx->cfg.dim_refr_period_ms;
+    }
+    bsp_display_lock(0);
+    lv_timer_set_period(_lv_disp_get_refr_timer(disp), period);
+    bsp_display_unlock();
+    /* Don't wait for the deadline of the old period */
+    lvgl_port_wake();
+    bsp_display_brightness_set(state == BSP_DISPLAY_IDLE_DIM
+                                   ? ctx->cfg.dim_brightness
+                                   : ctx->cfg.active_brightness);
+    break;
+  }
+  case BSP_DISPLAY_IDLE_SLEEP:
+    bsp_display_brightness_set(0);
+    bsp_display_lock(0);
+    lvgl_port_stop();
+    bsp_display_unlock();
+    esp_lcd_panel_disp_on_off(panel_handle, false);
+    esp_lcd_panel_disp_sleep(panel_handle, true);
+    break;
+  default:
+    break;
+  }
+
+  portENTER_CRITICAL(&ctx->lock);
+  ctx->residency_us[prev] += now - ctx->state_since_us;
+  ctx->state_since_us = now;
+  ctx->state = state;
+  if (prev == BSP_DISPLAY_IDLE_SLEEP) {
+    ctx->wakeups++;
+  }
+  portEXIT_CRITICAL(&ctx->lock);
+
+  ESP_LOGI(TAG,
+           "Display idle %d -> %d (active %llus, dim %llus, sleep %llus, "
+           "wakeups %u)",
+           prev, state, ctx->residency_us[BSP_DISPLAY_IDLE_ACTIVE] / 1000000,
+           ctx->residency_us[BSP_DISPLAY_IDLE_DIM] / 1000000,
+           ctx->residency_us[BSP_DISPLAY_IDLE_SLEEP] / 1000000,
+           (unsigned)ctx->wakeups);
+}
+
+static void bsp_display_idle_task(void *arg) {
+  bsp_display_idle_t *ctx = (bsp_display_idle_t *)arg;
+  const uint32_t dim_ms = ctx->cfg.dim_timeout_ms;
+  const uint32_t sleep_ms = ctx->cfg.sleep_timeout_ms;
+
+  while (true) {
+    TickType_t wait = portMAX_DELAY;
+
+    if (ctx->state != BSP_DISPLAY_IDLE_SLEEP) {
+      bsp_display_lock(0);
+      uint32_t inactive = lv_disp_get_inactive_time(disp);
+      bsp_display_unlock();
+
+      bsp_display_idle_state_t next = BSP_DISPLAY_IDLE_ACTIVE;
+      /* Inactive time at which the state changes next */
+      uint32_t next_deadline = UINT32_MAX;
+      if (sleep_ms && inactive >= sleep_ms) {
+        next = BSP_DISPLAY_IDLE_SLEEP;
+      } else {
+        if (dim_ms && inactive >= dim_ms) {
+          next = BSP_DISPLAY_IDLE_DIM;
+        } else if (dim_ms) {
+          next_deadline = dim_ms;
+        }
+        if (sleep_ms) {
+          next_deadline = LV_MIN(next_deadline, sleep_ms);
+        }
+      }
+      bsp_display_idle_set_state(ctx, next);
+
+      if (next != BSP_DISPLAY_IDLE_SLEEP && next_deadline != UINT32_MAX) {
+        wait = pdMS_TO_TICKS(next_deadline - inactive);
+        if (wait == 0) {
+          wait = 1;
+        }
+      }
+    }
+
+    if (xSemaphoreTake(ctx->wake_sem, wait) == pdTRUE) {
+      bsp_display_idle_set_state(ctx, BSP_DISPLAY_IDLE_ACTIVE);
+    }
+  }
+}
+
+esp_err_t bsp_display_idle_start(const bsp_display_idle_cfg_t *cfg) {
+  esp_err_t ret = ESP_OK;
+  ESP_RETURN_ON_FALSE(cfg, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+  ESP_RETURN_ON_FALSE(disp && panel_handle && !idle_ctx, ESP_ERR_INVALID_STATE,
+                      TAG, "display not started or idle already running");
+
+  bsp_display_idle_t *ctx = calloc(1, sizeof(bsp_display_idle_t));
+  ESP_RETURN_ON_FALSE(ctx, ESP_ERR_NO_MEM, TAG,
+                      "Not enough memory for idle_ctx allocation!");
+  ctx->cfg = *cfg;
+  ctx->state = BSP_DISPLAY_IDLE_ACTIVE;
+  ctx->state_since_us = esp_timer_get_time();
+  ctx->lock.owner = portMUX_FREE_VAL;
+  ctx->lock.count = 0;
+
+  ctx->wake_sem = xSemaphoreCreateBinary();
+  ESP_GOTO_ON_FALSE(ctx->wake_sem, ESP_ERR_NO_MEM, err, TAG,
+                    "Failed to create idle wake Semaphore");
+
+  idle_ctx = ctx;
+  BaseType_t res = xTaskCreate(bsp_display_idle_task, "Display idle",
+                               cfg->task_stack, ctx, cfg->task_priority, NULL);
+  ESP_GOTO_ON_FALSE(res == pdPASS, ESP_FAIL, err, TAG,
+                    "Create idle task fail!");
+
+  return ESP_OK;
+
+err:
+  idle_ctx = NULL;
+  if (ctx->wake_sem) {
+    vSemaphoreDelete(ctx->wake_sem);
+  }
+  free(ctx);
+  return ret;
+}
+
+void bsp_display_idle_wake(void) {
+  if (idle_ctx && idle_ctx->state != BSP_DISPLAY_IDLE_ACTIVE) {
+    xSemaphoreGive(idle_ctx->wake_sem);
+  }
+}
+
+void bsp_display_idle_get_stats(bsp_display_idle_stats_t *stats) {
+  assert(stats);
+  memset(stats, 0, sizeof(*stats));
+  if (!idle_ctx) {
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&idle_ctx->lock);
+  stats->state = idle_ctx->state;
+  stats->wakeups = idle_ctx->wakeups;
+  for (int i = 0; i < BSP_DISPLAY_IDLE_STATE_NUM; i++) {
+    uint64_t us = idle_ctx->residency_us[i];
+    if (i == idle_ctx->state) {
+      us += now - idle_ctx->state_since_us;
+    }
+    stats->residency_ms[i] = us / 1000;
+  }
+  portEXIT_CRITICAL(&idle_ctx->lock);
+}
@@ -59,6 +59,52 @@ typedef struct {
     lv_disp_rot_t rotate;           /*!< Rotation configuration for the display */
 } bsp_display_cfg_t;
 
+/**
+ * @brief Display idle power manager configuration
+ *
+ */
+typedef struct {
+    uint32_t dim_timeout_ms;        /*!< Inactivity before the backlight is dimmed (0: never) */
+    uint32_t sleep_timeout_ms;      /*!< Inactivity before the panel sleeps and LVGL is suspended (0: never) */
+    int active_brightness;          /*!< Backlight in [%] while active */
+    int dim_brightness;             /*!< Backlight in [%] while dimmed */
+    uint32_t dim_refr_period_ms;    /*!< LVGL refresh period while dimmed (0: keep LV_DISP_DEF_REFR_PERIOD) */
+    int task_priority;              /*!< Idle task priority */
+    int task_stack;                 /*!< Idle task stack size */
+} bsp_display_idle_cfg_t;
+
+#define BSP_DISPLAY_IDLE_DEFAULT_CONFIG()   \
+    {                                       \
+        .dim_timeout_ms = 30000,            \
+        .sleep_timeout_ms = 120000,         \
+        .active_brightness = 100,           \
+        .dim_brightness = 20,               \
+        .dim_refr_period_ms = 100,          \
+        .task_priority = 3,                 \
+        .task_stack = 3072,                 \
+    }
+
+/**
+ * @brief Display idle states
+ *
+ */
+typedef enum {
+    BSP_DISPLAY_IDLE_ACTIVE = 0,    /*!< Full brightness, LVGL running */
+    BSP_DISPLAY_IDLE_DIM,           /*!< Dimmed backlight, slower LVGL refresh */
+    BSP_DISPLAY_IDLE_SLEEP,         /*!< Backlight off, panel in sleep, LVGL suspended */
+    BSP_DISPLAY_IDLE_STATE_NUM,
+} bsp_display_idle_state_t;
+
+/**
+ * @brief Display idle residency statistics
+ *
+ */
+typedef struct {
+    bsp_display_idle_state_t state;                 /*!< Current state */
+    uint64_t residency_ms[BSP_DISPLAY_IDLE_STATE_NUM]; /*!< Time spent in each state, including the current one */
+    uint32_t wakeups;                               /*!< Number of wake-ups from sleep */
+} bsp_display_idle_stats_t;
+
 /**
  * @brief Init I2C driver
  *
@@ -101,6 +147,38 @@ lv_disp_t *bsp_display_start_with_config(const bsp_display_cfg_t *cfg);
  */
 lv_indev_t *bsp_display_get_input_dev(void);
 
+/**
+ * @brief Start the display idle power manager
+ *
+ * After `dim_timeout_ms` without input the backlight is dimmed, after `sleep_timeout_ms` the
+ * backlight is turned off, the panel is put into display-off/sleep-in and the LVGL timer and task are
+ * suspended. A touch interrupt (or bsp_display_idle_wake()) restores the active state.
+ *
+ * @note Must be called after bsp_display_start_with_config()
+ *
+ * @param cfg idle configuration
+ * @return
+ *      - ESP_OK                On success
+ *      - ESP_ERR_INVALID_ARG   Parameter error
+ *      - ESP_ERR_INVALID_STATE Display not started or manager already running
+ *      - ESP_ERR_NO_MEM        Not enough memory
+ */
+esp_err_t bsp_display_idle_start(const bsp_display_idle_cfg_t *cfg);
+
+/**
+ * @brief Wake up the display as if it was touched
+ *
+ * Useful for events that must be seen (e.g. warnings). Can be called from any task.
+ */
+void bsp_display_idle_wake(void);
+
+/**
+ * @brief Get active/dim/sleep residency of the display
+ *
+ * @param[out] stats statistics
+ */
+void bsp_display_idle_get_stats(bsp_display_idle_stats_t *stats);
+
 /**
  * @brief Take LVGL mutex
  *
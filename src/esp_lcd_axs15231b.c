@@ -46,6 +46,7 @@ static esp_err_t panel_axs15231b_swap_xy(esp_lcd_panel_t *panel,
 static esp_err_t panel_axs15231b_set_gap(esp_lcd_panel_t *panel, int x_gap,
                                          int y_gap);
 static esp_err_t panel_axs15231b_disp_off(esp_lcd_panel_t *panel, bool off);
+static esp_err_t panel_axs15231b_sleep(esp_lcd_panel_t *panel, bool sleep);
 
 static esp_err_t touch_axs15231b_read_data(esp_lcd_touch_handle_t tp);
 static bool touch_axs15231b_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x,
@@ -72,8 +73,13 @@ typedef struct {
   uint16_t init_cmds_size;
   struct {
     unsigned int use_qspi_interface : 1;
+    unsigned int qspi_raset : 1;
     unsigned int reset_level : 1;
   } flags;
+  // RAMWRC continuation state, used when RASET isn't sent
+  int cont_x_start;
+  int cont_x_end;
+  int cont_y_next;
 } axs15231b_panel_t;
 
 esp_err_t
@@ -142,7 +148,11 @@ esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io,
     axs15231b->flags.use_qspi_interface =
         ((axs15231b_vendor_config_t *)panel_dev_config->vendor_config)
             ->flags.use_qspi_interface;
+    axs15231b->flags.qspi_raset =
+        ((axs15231b_vendor_config_t *)panel_dev_config->vendor_config)
+            ->flags.qspi_raset;
   }
+  axs15231b->cont_y_next = -1;
   axs15231b->base.del = panel_axs15231b_del;
   axs15231b->base.reset = panel_axs15231b_reset;
   axs15231b->base.init = panel_axs15231b_init;
@@ -152,6 +162,7 @@ esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io,
   axs15231b->base.mirror = panel_axs15231b_mirror;
   axs15231b->base.swap_xy = panel_axs15231b_swap_xy;
   axs15231b->base.disp_on_off = panel_axs15231b_disp_off;
+  axs15231b->base.disp_sleep = panel_axs15231b_sleep;
   *ret_panel = &(axs15231b->base);
   ESP_LOGD(TAG, "new axs15231b panel @%p", axs15231b);
   ESP_LOGI(TAG, "LCD panel create success, vedrsion: %d.%d.%d",
@@ -303,6 +314,22 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel,
   y_start += axs15231b->y_gap;
   y_end += axs15231b->y_gap;
 
+  bool send_raset =
+      !axs15231b->flags.use_qspi_interface || axs15231b->flags.qspi_raset;
+  bool continuation = false;
+  if (!send_raset && y_start != 0) {
+    // Without RASET the write pointer can't be moved, so the only valid
+    // start row other than 0 is the one right after the previous transfer
+    ESP_RETURN_ON_FALSE(y_start == axs15231b->cont_y_next &&
+                            x_start == axs15231b->cont_x_start &&
+                            x_end == axs15231b->cont_x_end,
+                        ESP_ERR_INVALID_STATE, TAG,
+                        "area (%d,%d)-(%d,%d) doesn't continue from row %d",
+                        x_start, y_start, x_end - 1, y_end - 1,
+                        axs15231b->cont_y_next);
+    continuation = true;
+  }
+
   // define an area of frame memory where MCU can access
   tx_param(axs15231b, io, LCD_CMD_CASET,
            (uint8_t[]){
@@ -313,7 +340,7 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel,
            },
            4);
 
-  if (0 == axs15231b->flags.use_qspi_interface) {
+  if (send_raset) {
     tx_param(axs15231b, io, LCD_CMD_RASET,
              (uint8_t[]){
                  (y_start >> 8) & 0xFF,
@@ -327,15 +354,36 @@ static esp_err_t panel_axs15231b_draw_bitmap(esp_lcd_panel_t *panel,
   // transfer frame buffer
   size_t len =
       (x_end - x_start) * (y_end - y_start) * axs15231b->fb_bits_per_pixel / 8;
-  if (y_start == 0) {
-    tx_color(axs15231b, io, LCD_CMD_RAMWR, color_data, len); // 2C
-  } else {
+  if (continuation) {
     tx_color(axs15231b, io, LCD_CMD_RAMWRC, color_data, len); // 3C
+  } else {
+    tx_color(axs15231b, io, LCD_CMD_RAMWR, color_data, len); // 2C
   }
+  axs15231b->cont_x_start = x_start;
+  axs15231b->cont_x_end = x_end;
+  axs15231b->cont_y_next = y_end;
 
   return ESP_OK;
 }
 
+void esp_lcd_axs15231b_qspi_round_area(int rotation, int hor_res, int ver_res,
+                                       int *x1, int *y1, int *x2, int *y2) {
+  switch (rotation) {
+  case 1: // 90
+    *x1 = 0;
+    break;
+  case 2: // 180
+    *y2 = ver_res - 1;
+    break;
+  case 3: // 270
+    *x2 = hor_res - 1;
+    break;
+  default:
+    *y1 = 0;
+    break;
+  }
+}
+
 static esp_err_t panel_axs15231b_invert_color(esp_lcd_panel_t *panel,
                                               bool invert_color_data) {
   axs15231b_panel_t *axs15231b = __containerof(panel, axs15231b_panel_t, base);
@@ -404,6 +452,24 @@ static esp_err_t panel_axs15231b_disp_off(esp_lcd_panel_t *panel, bool off) {
   return ESP_OK;
 }
 
+static esp_err_t panel_axs15231b_sleep(esp_lcd_panel_t *panel, bool sleep) {
+  axs15231b_panel_t *axs15231b = __containerof(panel, axs15231b_panel_t, base);
+  esp_lcd_panel_io_handle_t io = axs15231b->io;
+  int command = 0;
+  if (sleep) {
+    command = LCD_CMD_SLPIN;
+  } else {
+    command = LCD_CMD_SLPOUT;
+  }
+  ESP_RETURN_ON_ERROR(tx_param(axs15231b, io, command, NULL, 0), TAG,
+                      "send command failed");
+  // spec, wait at least 5ms after SLPIN and 120ms after SLPOUT
+  vTaskDelay(pdMS_TO_TICKS(sleep ? 5 : 120));
+  // the write pointer is not kept across sleep
+  axs15231b->cont_y_next = -1;
+  return ESP_OK;
+}
+
 esp_err_t esp_lcd_touch_new_i2c_axs15231b(const esp_lcd_panel_io_handle_t io,
                                           const esp_lcd_touch_config_t *config,
                                           esp_lcd_touch_handle_t *tp) {
@@ -468,6 +534,9 @@ static esp_err_t touch_axs15231b_read_data(esp_lcd_touch_handle_t tp) {
   typedef struct {
     uint8_t gesture; // AXS_TOUCH_GESTURE_POS:0
     uint8_t num;     // AXS_TOUCH_POINT_NUM:1
+  } __attribute__((packed)) touch_header_struct_t;
+
+  typedef struct {
     uint8_t x_h : 4; // AXS_TOUCH_X_H_POS:2
     uint8_t : 2;
     uint8_t event : 2; // AXS_TOUCH_EVENT_POS:2
@@ -475,9 +544,12 @@ static esp_err_t touch_axs15231b_read_data(esp_lcd_touch_handle_t tp) {
     uint8_t y_h : 4;   // AXS_TOUCH_Y_H_POS:4
     uint8_t : 4;
     uint8_t y_l; // AXS_TOUCH_Y_L_POS:5
-  } __attribute__((packed)) touch_record_struct_t;
+    uint8_t weight;
+    uint8_t area;
+  } __attribute__((packed)) touch_point_struct_t;
 
-  touch_record_struct_t *p_touch_data = NULL;
+  touch_header_struct_t *p_touch_header = NULL;
+  touch_point_struct_t *p_touch_point = NULL;
 
   uint8_t data[AXS_MAX_TOUCH_NUMBER * 6 + 2] = {0}; /*1 Point:8;  2 Point: 14 */
   const uint8_t read_cmd[11] = {0xb5,
@@ -497,16 +569,26 @@ static esp_err_t touch_axs15231b_read_data(esp_lcd_touch_handle_t tp) {
   ESP_RETURN_ON_ERROR(i2c_read_bytes(tp, -1, data, sizeof(data)), TAG,
                       "I2C read failed");
 
-  p_touch_data = (touch_record_struct_t *)data;
-  if (p_touch_data->num && (AXS_MAX_TOUCH_NUMBER >= p_touch_data->num)) {
+  p_touch_header = (touch_header_struct_t *)data;
+  p_touch_point = (touch_point_struct_t *)(data + sizeof(touch_header_struct_t));
+  if (p_touch_header->num) {
+    /* More fingers than the read records: keep the ones that were read */
+    uint8_t num = p_touch_header->num;
+    if (num > AXS_MAX_TOUCH_NUMBER) {
+      num = AXS_MAX_TOUCH_NUMBER;
+    }
+    if (num > CONFIG_ESP_LCD_TOUCH_MAX_POINTS) {
+      num = CONFIG_ESP_LCD_TOUCH_MAX_POINTS;
+    }
     portENTER_CRITICAL(&tp->data.lock);
-    tp->data.points = p_touch_data->num;
-    /* Fill all coordinates */
-    for (int i = 0; i < tp->data.points; i++) {
+    tp->data.points = num;
+    /* Fill all coordinates, one 6 byte record per point */
+    for (int i = 0; i < num; i++) {
       tp->data.coords[i].x =
-          ((p_touch_data->x_h & 0x0F) << 8) | p_touch_data->x_l;
+          ((p_touch_point[i].x_h & 0x0F) << 8) | p_touch_point[i].x_l;
       tp->data.coords[i].y =
-          ((p_touch_data->y_h & 0x0F) << 8) | p_touch_data->y_l;
+          ((p_touch_point[i].y_h & 0x0F) << 8) | p_touch_point[i].y_l;
+      tp->data.coords[i].strength = p_touch_point[i].weight;
     }
     portEXIT_CRITICAL(&tp->data.lock);
   }
@@ -48,6 +48,9 @@ typedef struct {
     uint16_t init_cmds_size;                    /*<! Number of commands in above array */
     struct {
         unsigned int use_qspi_interface: 1;     /*<! Set to 1 if use QSPI interface, default is SPI interface */
+        unsigned int qspi_raset: 1;             /*<! Set to 1 to send RASET in QSPI mode too, so any rectangle can be written.
+                                                 *   When 0, a QSPI transfer must start at row 0 (RAMWR) or continue right
+                                                 *   after the previous one with the same columns (RAMWRC) */
     } flags;
 } axs15231b_vendor_config_t;
 
@@ -66,6 +69,23 @@ typedef struct {
  */
 esp_err_t esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Extend an area so that a QSPI transfer without RASET can write it
+ *
+ * @note  Without RASET every transfer starts at panel row 0 (RAMWR) or continues right after the previous one
+ *        (RAMWRC), so the area is stretched towards the edge that is mapped to panel row 0. Columns are kept.
+ *        Meant for the LVGL rounder callback when `qspi_raset` is 0.
+ *
+ * @param[in] rotation Software rotation in clockwise quarter turns (0..3, same values as `LV_DISP_ROT_*`)
+ * @param[in] hor_res Horizontal resolution after rotation
+ * @param[in] ver_res Vertical resolution after rotation
+ * @param[inout] x1 Left column, inclusive
+ * @param[inout] y1 Top row, inclusive
+ * @param[inout] x2 Right column, inclusive
+ * @param[inout] y2 Bottom row, inclusive
+ */
+void esp_lcd_axs15231b_qspi_round_area(int rotation, int hor_res, int ver_res, int *x1, int *y1, int *x2, int *y2);
+
 /**
  * @brief LCD panel bus configuration structure
  *
@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
@@ -12,13 +13,23 @@
 #include "esp_err.h"
 #include "esp_check.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_lcd_touch.h"
 
 static const char *TAG = "TP";
 
+/* Cutoff of the speed estimate used by the One-Euro filter */
+#define TOUCH_FILTER_SPEED_CUTOFF_MHZ   (1000)
+/* Limits of the sample period used by the filter */
+#define TOUCH_FILTER_DT_MIN_MS          (1)
+#define TOUCH_FILTER_DT_MAX_MS          (1000)
+/* Position cutoff limit, above it the filter passes the samples through anyway */
+#define TOUCH_FILTER_CUTOFF_MAX_MHZ     (1000000)
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
+static int32_t touch_filter_axis(esp_lcd_touch_handle_t tp, int point, int axis, uint16_t raw, int32_t dt_ms);
 
 /*******************************************************************************
 * Local variables
@@ -69,7 +80,9 @@ bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint1
 
     touched = tp->get_xy(tp, x, y, strength, point_num, max_point_num);
     if (!touched) {
-        return false;
+        /* Release still goes through the processing (debounce) */
+        esp_lcd_touch_process_sample(tp, x, y, point_num, max_point_num, (uint32_t)(esp_timer_get_time() / 1000));
+        return (*point_num > 0);
     }
 
     /* Process coordinates by user */
@@ -103,7 +116,157 @@ bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint1
         }
     }
 
-    return touched;
+    esp_lcd_touch_process_sample(tp, x, y, point_num, max_point_num, (uint32_t)(esp_timer_get_time() / 1000));
+
+    return (*point_num > 0);
+}
+
+esp_err_t esp_lcd_touch_set_filter(esp_lcd_touch_handle_t tp, const esp_lcd_touch_filter_cfg_t *cfg)
+{
+    assert(tp != NULL);
+
+    if (cfg) {
+        tp->filter_cfg = *cfg;
+    } else {
+        memset(&tp->filter_cfg, 0, sizeof(tp->filter_cfg));
+    }
+    memset(&tp->filter, 0, sizeof(tp->filter));
+
+    return ESP_OK;
+}
+
+void esp_lcd_touch_process_sample(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint8_t *point_num, uint8_t max_point_num, uint32_t time_ms)
+{
+    assert(tp != NULL);
+    assert(x != NULL);
+    assert(y != NULL);
+    assert(point_num != NULL);
+
+    const esp_lcd_touch_filter_cfg_t *cfg = &tp->filter_cfg;
+    esp_lcd_touch_filter_t *f = &tp->filter;
+
+    uint8_t max_points = (max_point_num < CONFIG_ESP_LCD_TOUCH_MAX_POINTS) ? max_point_num : CONFIG_ESP_LCD_TOUCH_MAX_POINTS;
+    uint8_t points = (*point_num < max_points) ? *point_num : max_points;
+
+    /* Debounce: keep the reported state until the new one persists */
+    if ((points > 0) != (f->points > 0)) {
+        uint8_t need = (points > 0) ? cfg->debounce_press : cfg->debounce_release;
+        if (++f->pending < need) {
+            *point_num = (f->points < max_points) ? f->points : max_points;
+            for (int i = 0; i < *point_num; i++) {
+                x[i] = f->x[i];
+                y[i] = f->y[i];
+            }
+            return;
+        }
+    }
+    f->pending = 0;
+
+    if (points == 0) {
+        f->points = 0;
+        *point_num = 0;
+        return;
+    }
+
+    bool restart = (f->points != points);
+
+    /* Signed difference, the millisecond timestamp wraps around */
+    int32_t dt_ms = (int32_t)(time_ms - f->last_ms);
+    if (dt_ms < TOUCH_FILTER_DT_MIN_MS) {
+        dt_ms = TOUCH_FILTER_DT_MIN_MS;
+    } else if (dt_ms > TOUCH_FILTER_DT_MAX_MS) {
+        dt_ms = TOUCH_FILTER_DT_MAX_MS;
+    }
+
+    for (int i = 0; i < points; i++) {
+        if (cfg->min_cutoff_mhz > 0) {
+            if (restart) {
+                /* New press or finger count changed: start from the raw point */
+                f->axis[i][0].pos_q4 = f->axis[i][0].prev_q4 = (int32_t)x[i] << 4;
+                f->axis[i][1].pos_q4 = f->axis[i][1].prev_q4 = (int32_t)y[i] << 4;
+                f->axis[i][0].speed = f->axis[i][1].speed = 0;
+            } else {
+                x[i] = touch_filter_axis(tp, i, 0, x[i], dt_ms);
+                y[i] = touch_filter_axis(tp, i, 1, y[i], dt_ms);
+            }
+        }
+        f->x[i] = x[i];
+        f->y[i] = y[i];
+    }
+    f->points = points;
+    f->last_ms = time_ms;
+    *point_num = points;
+}
+
+esp_err_t esp_lcd_touch_read_event(esp_lcd_touch_handle_t tp, bool *pressed)
+{
+    esp_lcd_touch_event_t event = {0};
+    uint16_t strength = 0;
+
+    assert(tp != NULL);
+
+    ESP_RETURN_ON_ERROR(esp_lcd_touch_read_data(tp), TAG, "read data failed");
+    esp_lcd_touch_get_coordinates(tp, &event.x, &event.y, &strength, &event.points, 1);
+    event.timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    if (pressed) {
+        *pressed = (event.points > 0);
+    }
+
+    esp_lcd_touch_event_queue_t *q = &tp->events;
+    portENTER_CRITICAL(&tp->data.lock);
+    if (event.points == 0 && q->last_points == 0) {
+        /* Already released */
+    } else if (q->count == CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN) {
+        uint8_t newest = (q->head + q->count - 1) % CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN;
+        if (event.points && q->event[newest].points) {
+            /* Merge movement, keep press/release transitions */
+            q->event[newest] = event;
+        } else {
+            /* Drop the oldest event and reuse its slot, which becomes the tail */
+            uint8_t old_head = q->head;
+            q->head = (q->head + 1) % CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN;
+            q->event[(old_head + q->count) % CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN] = event;
+            q->dropped++;
+        }
+    } else {
+        q->event[(q->head + q->count) % CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN] = event;
+        q->count++;
+    }
+    q->last_points = event.points;
+    portEXIT_CRITICAL(&tp->data.lock);
+
+    return ESP_OK;
+}
+
+bool esp_lcd_touch_get_event(esp_lcd_touch_handle_t tp, esp_lcd_touch_event_t *event)
+{
+    bool ret = false;
+
+    assert(tp != NULL);
+    assert(event != NULL);
+
+    portENTER_CRITICAL(&tp->data.lock);
+    if (tp->events.count > 0) {
+        *event = tp->events.event[tp->events.head];
+        tp->events.head = (tp->events.head + 1) % CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN;
+        tp->events.count--;
+        ret = true;
+    }
+    portEXIT_CRITICAL(&tp->data.lock);
+
+    return ret;
+}
+
+uint8_t esp_lcd_touch_get_event_count(esp_lcd_touch_handle_t tp)
+{
+    assert(tp != NULL);
+
+    portENTER_CRITICAL(&tp->data.lock);
+    uint8_t count = tp->events.count;
+    portEXIT_CRITICAL(&tp->data.lock);
+
+    return count;
 }
 
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
@@ -264,3 +427,35 @@ esp_err_t esp_lcd_touch_register_interrupt_callback_with_data(esp_lcd_touch_hand
     tp->config.user_data = user_data;
     return esp_lcd_touch_register_interrupt_callback(tp, callback);
 }
+
+/*******************************************************************************
+* Private API function
+*******************************************************************************/
+
+/* IIR coefficient for the cutoff, alpha = 1 / (1 + 1 / (2 * pi * fc * dt)), in Q16 */
+static uint32_t touch_filter_alpha(uint32_t cutoff_mhz, int32_t dt_ms)
+{
+    uint64_t k = (uint64_t)cutoff_mhz * dt_ms * 6283 / 1000; /* 2 * pi * fc * dt * 10^6 */
+    return (uint32_t)((k << 16) / (k + 1000000));
+}
+
+static int32_t touch_filter_axis(esp_lcd_touch_handle_t tp, int point, int axis, uint16_t raw, int32_t dt_ms)
+{
+    const esp_lcd_touch_filter_cfg_t *cfg = &tp->filter_cfg;
+    esp_lcd_touch_filter_axis_t *a = &tp->filter.axis[point][axis];
+    int32_t raw_q4 = (int32_t)raw << 4;
+
+    /* Speed estimate [px/s], low-passed to keep the cutoff stable */
+    int32_t speed = ((raw_q4 - a->prev_q4) * 1000 / dt_ms) >> 4;
+    a->speed += (int32_t)(((int64_t)(speed - a->speed) * touch_filter_alpha(TOUCH_FILTER_SPEED_CUTOFF_MHZ, dt_ms)) >> 16);
+    a->prev_q4 = raw_q4;
+
+    /* Position, the faster the finger the higher the cutoff */
+    uint64_t cutoff_mhz = cfg->min_cutoff_mhz + (uint64_t)cfg->beta * (uint32_t)abs(a->speed);
+    if (cutoff_mhz > TOUCH_FILTER_CUTOFF_MAX_MHZ) {
+        cutoff_mhz = TOUCH_FILTER_CUTOFF_MAX_MHZ;
+    }
+    a->pos_q4 += (int32_t)(((int64_t)(raw_q4 - a->pos_q4) * touch_filter_alpha((uint32_t)cutoff_mhz, dt_ms)) >> 16);
+
+    return (a->pos_q4 + 8) >> 4;
+}
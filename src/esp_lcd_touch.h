@@ -29,6 +29,7 @@ extern "C" {
 
 #define CONFIG_ESP_LCD_TOUCH_MAX_POINTS     (1)
 #define CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS    (0)
+#define CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN (16)
 
 /**
  * @brief Touch controller type
@@ -95,6 +96,65 @@ typedef struct {
     portMUX_TYPE lock; /*!< Lock for read/write */
 } esp_lcd_touch_data_t;
 
+/**
+ * @brief Touch processing configuration (all zero = raw samples)
+ *
+ * @note The jitter filter is a One-Euro filter: an IIR low-pass whose cutoff rises with the finger speed.
+ *       Slow movement is smoothed, fast movement follows the finger. With `beta` = 0 it is a plain IIR.
+ */
+typedef struct {
+    uint16_t min_cutoff_mhz;    /*!< Cutoff frequency at rest [mHz], 0 disables the filter */
+    uint16_t beta;              /*!< Cutoff increase per speed [mHz per px/s] */
+    uint8_t debounce_press;     /*!< Samples a press must persist before it is reported */
+    uint8_t debounce_release;   /*!< Samples a release must persist, the last point is held meanwhile */
+} esp_lcd_touch_filter_cfg_t;
+
+#define ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG()   \
+    {                                           \
+        .min_cutoff_mhz = 1500,                 \
+        .beta = 20,                             \
+        .debounce_press = 1,                    \
+        .debounce_release = 2,                  \
+    }
+
+typedef struct {
+    int32_t pos_q4;     /*!< Filtered position [px/16] */
+    int32_t prev_q4;    /*!< Previous raw position [px/16] */
+    int32_t speed;      /*!< Filtered speed [px/s] */
+} esp_lcd_touch_filter_axis_t;
+
+/**
+ * @brief Touch processing state
+ *
+ */
+typedef struct {
+    esp_lcd_touch_filter_axis_t axis[CONFIG_ESP_LCD_TOUCH_MAX_POINTS][2]; /*!< Filter state per point, X and Y */
+    uint32_t last_ms;       /*!< Time of the last pressed sample */
+    uint8_t points;         /*!< Count of reported points */
+    uint8_t pending;        /*!< Samples the raw state differs from the reported one */
+    uint16_t x[CONFIG_ESP_LCD_TOUCH_MAX_POINTS]; /*!< Last reported coordinates (held during release debounce) */
+    uint16_t y[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+} esp_lcd_touch_filter_t;
+
+/**
+ * @brief Touch event, one per controller report
+ *
+ */
+typedef struct {
+    uint32_t timestamp_ms;  /*!< Time of the report [ms] (esp_timer based) */
+    uint16_t x;             /*!< X coordinate of the first point */
+    uint16_t y;             /*!< Y coordinate of the first point */
+    uint8_t points;         /*!< Count of touch points, 0 when released */
+} esp_lcd_touch_event_t;
+
+typedef struct {
+    esp_lcd_touch_event_t event[CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN];
+    uint8_t head;           /*!< Index of the oldest event */
+    uint8_t count;          /*!< Count of queued events */
+    uint8_t last_points;    /*!< Points of the last queued event (used to drop repeated releases) */
+    uint32_t dropped;       /*!< Count of events lost because the queue was full */
+} esp_lcd_touch_event_queue_t;
+
 /**
  * @brief Declare of Touch Type
  *
@@ -260,6 +320,17 @@ struct esp_lcd_touch_s {
      * @brief Data structure
      */
     esp_lcd_touch_data_t data;
+
+    /**
+     * @brief Touch processing (filter, debounce), see esp_lcd_touch_set_filter()
+     */
+    esp_lcd_touch_filter_cfg_t filter_cfg;
+    esp_lcd_touch_filter_t filter;
+
+    /**
+     * @brief Queue of timestamped events (protected by data.lock)
+     */
+    esp_lcd_touch_event_queue_t events;
 };
 
 /**
@@ -294,6 +365,72 @@ esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp);
 bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 
 
+/**
+ * @brief Set the touch processing applied by esp_lcd_touch_get_coordinates()
+ *
+ * @note The processing runs in the read path with a fixed cost per point (integer math only).
+ *       It must not be changed while another task is reading the controller.
+ *
+ * @param tp: Touch handler
+ * @param cfg: Processing configuration (NULL or all zero = raw samples)
+ *
+ * @return
+ *     - ESP_OK                 on success
+ */
+esp_err_t esp_lcd_touch_set_filter(esp_lcd_touch_handle_t tp, const esp_lcd_touch_filter_cfg_t *cfg);
+
+/**
+ * @brief Run the touch processing on one sample
+ *
+ * @note Called by esp_lcd_touch_get_coordinates(), exposed for feeding recorded traces.
+ *       On release debounce the last points are returned, so `point_num` can change.
+ *
+ * @param tp: Touch handler
+ * @param x: Array of X coordinates (in/out)
+ * @param y: Array of Y coordinates (in/out)
+ * @param point_num: Count of points (in/out)
+ * @param max_point_num: Size of the arrays
+ * @param time_ms: Time of the sample [ms], may wrap around
+ */
+void esp_lcd_touch_process_sample(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint8_t *point_num, uint8_t max_point_num, uint32_t time_ms);
+
+/**
+ * @brief Read the touch controller and queue the result as an event
+ *
+ * @note This function is blocking (bus transfer). Call it after the touch interrupt, not from the ISR.
+ *       When the queue is full, consecutive pressed samples are merged into the newest one,
+ *       otherwise the oldest event is dropped. Repeated releases are not queued.
+ *
+ * @param tp: Touch handler
+ * @param pressed: Returns whether a touch is reported, including a release still being debounced (can be NULL)
+ *
+ * @return
+ *     - ESP_OK                 on success
+ *     - Else                   error of esp_lcd_touch_read_data()
+ */
+esp_err_t esp_lcd_touch_read_event(esp_lcd_touch_handle_t tp, bool *pressed);
+
+/**
+ * @brief Take the oldest queued touch event
+ *
+ * @param tp: Touch handler
+ * @param event: Returned event
+ *
+ * @return
+ *      - Returns true, when an event was taken. Otherwise returns false.
+ */
+bool esp_lcd_touch_get_event(esp_lcd_touch_handle_t tp, esp_lcd_touch_event_t *event);
+
+/**
+ * @brief Count of queued touch events
+ *
+ * @param tp: Touch handler
+ *
+ * @return
+ *      - Count of events waiting in the queue
+ */
+uint8_t esp_lcd_touch_get_event_count(esp_lcd_touch_handle_t tp);
+
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 /**
  * @brief Get button state
@@ -66,6 +66,13 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Size of the arena of a slab allocator in bytes (multiple of 1024). 0: disable.
+ *The allocations up to 256 bytes (objects, styles, event descriptors, timers, animations) are stored in
+ *size classes in this arena. It's a normal array, so it's in the internal RAM on MCUs with external RAM.
+ *The larger allocations and the ones which don't fit anymore use the allocator above.
+ *With CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL=4096 `malloc` puts the buffers from 4 kB to the PSRAM.*/
+#define LV_MEM_SLAB_SIZE (32U * 1024U)
+
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
  *You will see an error log message if there wasn't enough buffers. */
 #define LV_MEM_BUF_MAX_NUM 16
@@ -117,10 +124,10 @@
     #define LV_SHADOW_CACHE_SIZE 0
 
     /* Set number of maximally cached circle data.
-    * The circumference of 1/4 circle are saved for anti-aliasing
-    * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+    * The circumference of 1/4 circle are saved for anti-aliasing, ordered for the left and right corners
+    * radius * 12 bytes are used per circle (the most often used radiuses are saved and kept between refreshes)
     * 0: to disable caching */
-    #define LV_CIRCLE_CACHE_SIZE 4
+    #define LV_CIRCLE_CACHE_SIZE 8
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -144,7 +151,13 @@
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_IMG_CACHE_DEF_SIZE 16
+
+/*Memory budget of the image cache in bytes.
+ *The least recently used images are closed while the decoded images are larger than this.
+ *The decoders allocate the decoded images with `malloc`, so the ones from 4 kB are in the PSRAM.
+ *0: limit only the number of images with LV_IMG_CACHE_DEF_SIZE*/
+#define LV_IMG_CACHE_MEM_SIZE (256 * 1024)
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -157,6 +170,27 @@
  *0 mean no caching.*/
 #define LV_GRAD_CACHE_DEF_SIZE 0
 
+/*Default glyph cache size in bytes.
+ *The software renderer keeps the recently drawn letters as 8 bit opacity maps,
+ *so the glyphs of compressed or large fonts are not decompressed and converted again on every redraw.
+ *The least recently used glyphs are dropped when the cache is full.
+ *0: to disable caching*/
+#define LV_GLYPH_CACHE_DEF_SIZE (48 * 1024)
+#if LV_GLYPH_CACHE_DEF_SIZE
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #ifdef ESP_PLATFORM
+        #define LV_GLYPH_CACHE_CUSTOM 1
+    #else
+        #define LV_GLYPH_CACHE_CUSTOM 0
+    #endif
+    #if LV_GLYPH_CACHE_CUSTOM
+        #define LV_GLYPH_CACHE_CUSTOM_INCLUDE <esp_heap_caps.h>   /*Header for the allocator*/
+        #define LV_GLYPH_CACHE_CUSTOM_ALLOC(size)   heap_caps_malloc(size, MALLOC_CAP_SPIRAM)
+        #define LV_GLYPH_CACHE_CUSTOM_FREE    heap_caps_free
+    #endif
+#endif
+
 /*Allow dithering the gradients (to achieve visual smooth color gradients on limited color depth display)
  *LV_DITHER_GRADIENT implies allocating one or two more lines of the object's rendering surface
  *The increase in memory consumption is (32 bits * object width) plus 24 bits * object width if using error diffusion */
@@ -172,6 +206,17 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Render the large fills and image blits in horizontal bands on helper threads too (e.g. on the second core).
+ *Requires pthreads. The result is pixel-identical to the single threaded rendering.*/
+#define LV_USE_DRAW_SW_MT 1
+#if LV_USE_DRAW_SW_MT
+    /*Number of helper threads. The drawing thread renders a band too.*/
+    #define LV_DRAW_SW_MT_THREAD_CNT 1
+
+    /*Blends smaller than this many pixels are rendered by the drawing thread only*/
+    #define LV_DRAW_SW_MT_MIN_PX 4096
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -294,6 +339,29 @@
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Record the time spent in the rendering stages into a ring buffer which can be exported
+ *as Chrome trace JSON by `lv_profiler_dump()` or `lvgl_port_profiler_dump()` (serial console)*/
+#define LV_USE_PROFILER 0
+#if LV_USE_PROFILER
+    /*Number of events kept in the ring buffer (12..16 bytes each). The oldest ones are overwritten*/
+    #define LV_PROFILER_BUF_SIZE 8192
+    #ifdef ESP_PLATFORM
+        /*The panel transfers end in the LCD interrupt which can run on the other core and the cycle counters
+         *of the cores are not in sync. So use the 1 MHz esp_timer which is shared and also read in IRAM*/
+        #define LV_PROFILER_INCLUDE <esp_timer.h>
+        #define LV_PROFILER_TICK_GET() esp_timer_get_time()
+        #define LV_PROFILER_TICK_PER_SEC 1000000
+        /*Every task on its own track, see lv_port.c*/
+        uint8_t lvgl_port_profiler_tid_get(void);
+        #define LV_PROFILER_TID_GET() lvgl_port_profiler_tid_get()
+    #else
+        #define LV_PROFILER_INCLUDE <stdint.h>
+        #define LV_PROFILER_TICK_GET() lv_tick_get()
+        #define LV_PROFILER_TICK_PER_SEC 1000
+        #define LV_PROFILER_TID_GET() 0
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -306,6 +374,11 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Cache the resolved style properties of the objects, so the drawing doesn't have to search all the styles
+ *of an object for every property. The cache of an object is dropped when its styles or state change.
+ *Number of properties cached per object part, must be a power of 2. 0: disable caching*/
+#define LV_OBJ_STYLE_CACHE_SIZE 32
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -491,6 +564,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 1   /*Save the line breaks and letter widths of the labels to skip measuring the text on redraw*/
 #endif
 
 #define LV_USE_LINE       1
@@ -617,10 +691,10 @@
 #endif
 
 /*API for open, read, etc*/
-#define LV_USE_FS_POSIX 0
+#define LV_USE_FS_POSIX 1
 #if LV_USE_FS_POSIX
-    #define LV_FS_POSIX_LETTER '\0'     /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
-    #define LV_FS_POSIX_PATH ""         /*Set the working directory. File/directory paths will be appended to it.*/
+    #define LV_FS_POSIX_LETTER 'L'      /*Set an upper cased letter on which the drive will accessible (e.g. 'A')*/
+    #define LV_FS_POSIX_PATH "/littlefs/"   /*Set the working directory. File/directory paths will be appended to it.*/
     #define LV_FS_POSIX_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
 #endif
 
@@ -639,6 +713,19 @@
     #define LV_FS_FATFS_CACHE_SIZE 0    /*>0 to cache this number of bytes in lv_fs_read()*/
 #endif
 
+/*Share a cache of fixed size blocks between the files opened for reading on the POSIX and LittleFS drives
+ *instead of their `*_CACHE_SIZE` buffers. The blocks are kept after closing the files.*/
+#define LV_FS_BLOCK_CACHE 1
+#if LV_FS_BLOCK_CACHE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 4096   /*[bytes]*/
+    #define LV_FS_BLOCK_CACHE_BLOCK_CNT 8       /*Number of blocks, at least 2*/
+
+    /*Read this many blocks ahead on a helper thread when a file is read sequentially (e.g. by a decoder). Requires pthreads.
+     *The driver is called from the helper thread too (with an other file handle), so only the drivers with `thread_safe` set
+     *are read ahead (POSIX, and LittleFS built with LFS_THREADSAFE).*/
+    #define LV_FS_BLOCK_CACHE_READ_AHEAD 2
+#endif
+
 /*PNG decoder library*/
 #define LV_USE_PNG 0
 
@@ -652,6 +739,10 @@
 /*GIF decoder library*/
 #define LV_USE_GIF 0
 
+/*Decoder of pre-decoded RGB565 images compressed with run-length encoding.
+ *Create them with `scripts/png_to_rle.py`*/
+#define LV_USE_RLE_IMG 1
+
 /*QR code library*/
 #define LV_USE_QRCODE 0
 
@@ -672,6 +763,28 @@
     #endif
 #endif
 
+/*Tiny TTF library*/
+#define LV_USE_TINY_TTF 0
+#if LV_USE_TINY_TTF
+    /*Load TTF data from files*/
+    #define LV_TINY_TTF_FILE_SUPPORT 0
+    /*Size of the glyph cache shared by all Tiny TTF fonts and sizes in bytes.
+     *It keeps the metrics and the rendered bitmaps of the recently used letters. 0: don't cache*/
+    #define LV_TINY_TTF_CACHE_SIZE (128 * 1024)
+    /*1: use custom allocator for the cached glyphs (e.g. to keep them in external RAM)
+     *0: use `lv_mem_alloc()`*/
+    #ifdef ESP_PLATFORM
+        #define LV_TINY_TTF_CACHE_CUSTOM 1
+    #else
+        #define LV_TINY_TTF_CACHE_CUSTOM 0
+    #endif
+    #if LV_TINY_TTF_CACHE_CUSTOM
+        #define LV_TINY_TTF_CACHE_CUSTOM_INCLUDE <esp_heap_caps.h>   /*Header for the allocator*/
+        #define LV_TINY_TTF_CACHE_CUSTOM_ALLOC(size)   heap_caps_malloc(size, MALLOC_CAP_SPIRAM)
+        #define LV_TINY_TTF_CACHE_CUSTOM_FREE    heap_caps_free
+    #endif
+#endif
+
 /*Rlottie library*/
 #define LV_USE_RLOTTIE 0
 
@@ -705,6 +818,14 @@
 /*1: Enable a published subscriber based messaging system */
 #define LV_USE_MSG 0
 
+/*1: Enable fonts and images from an asset bundle in memory mapped flash.
+ *Create the bundles with `scripts/lv_assets_pack.py`*/
+#define LV_USE_ASSETS 1
+#if LV_USE_ASSETS
+    /*1: Add `lv_assets_map_file()` to map bundle files with POSIX `mmap()`, e.g. on a PC simulator*/
+    #define LV_ASSETS_POSIX_MMAP 0
+#endif
+
 /*1: Enable Pinyin input method*/
 /*Requires: lv_keyboard*/
 #define LV_USE_IME_PINYIN 0
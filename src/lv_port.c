@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdio.h>
+#include <inttypes.h>
+
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_err.h"
@@ -23,6 +26,10 @@
 #include "esp_lcd_touch.h"
 #endif
 
+#if LV_USE_DRAW_SW_MT
+#include "esp_pthread.h"
+#endif
+
 #if (ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 4, 4)) || (ESP_IDF_VERSION == ESP_IDF_VERSION_VAL(5, 0, 0))
 #define LVGL_PORT_HANDLE_FLUSH_READY 0
 #else
@@ -31,6 +38,14 @@
 
 static const char *TAG = "LVGL";
 
+#if LVGL_PORT_HANDLE_FLUSH_READY
+/* The panel transfers start in the flush callback and end in the "color transfer done" interrupt, show them on their own track */
+#define LVGL_PORT_PROFILER_TRACK_PANEL  LV_PROFILER_TRACK_USER
+#define LVGL_PORT_PROFILER_TRANSFER_BEGIN() LV_PROFILER_BEGIN_TRACK("panel_transfer", LVGL_PORT_PROFILER_TRACK_PANEL)
+#else
+#define LVGL_PORT_PROFILER_TRANSFER_BEGIN()
+#endif
+
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
@@ -38,8 +53,11 @@ static const char *TAG = "LVGL";
 typedef struct lvgl_port_ctx_s {
     SemaphoreHandle_t   lvgl_mux;
     esp_timer_handle_t  tick_timer;
+    TaskHandle_t        task;
     bool                running;
+    volatile bool       paused;
     int                 task_max_sleep_ms;
+    int                 task_affinity;
 } lvgl_port_ctx_t;
 
 typedef struct {
@@ -61,7 +79,8 @@ typedef struct {
 typedef struct {
     esp_lcd_touch_handle_t  handle;        /* LCD touch IO handle */
     lv_indev_drv_t          indev_drv;     /* LVGL input device driver */
-    lvgl_port_wait_cb       touch_wait_cb;  /* Callback function for touch */
+    lv_point_t              last_point;    /* Last reported point, kept while the queue is empty */
+    lv_indev_state_t        last_state;    /* Last reported state, kept while the queue is empty */
 } lvgl_port_touch_ctx_t;
 #endif
 
@@ -100,6 +119,9 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg)
 
     /* LVGL init */
     lv_init();
+#if LV_USE_PROFILER && LVGL_PORT_HANDLE_FLUSH_READY
+    lv_profiler_set_track_name(LVGL_PORT_PROFILER_TRACK_PANEL, "panel");
+#endif
     /* Tick init */
     lvgl_port_timer_period_ms = cfg->timer_period_ms;
     ESP_RETURN_ON_ERROR(lvgl_port_tick_init(), TAG, "");
@@ -108,14 +130,15 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg)
     if (lvgl_port_ctx.task_max_sleep_ms == 0) {
         lvgl_port_ctx.task_max_sleep_ms = 500;
     }
+    lvgl_port_ctx.task_affinity = cfg->task_affinity;
     lvgl_port_ctx.lvgl_mux = xSemaphoreCreateRecursiveMutex();
     ESP_GOTO_ON_FALSE(lvgl_port_ctx.lvgl_mux, ESP_ERR_NO_MEM, err, TAG, "Create LVGL mutex fail!");
 
     BaseType_t res;
     if (cfg->task_affinity < 0) {
-        res = xTaskCreate(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, NULL);
+        res = xTaskCreate(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, &lvgl_port_ctx.task);
     } else {
-        res = xTaskCreatePinnedToCore(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, NULL, cfg->task_affinity);
+        res = xTaskCreatePinnedToCore(lvgl_port_task, "LVGL task", cfg->task_stack, NULL, cfg->task_priority, &lvgl_port_ctx.task, cfg->task_affinity);
     }
     ESP_GOTO_ON_FALSE(res == pdPASS, ESP_FAIL, err, TAG, "Create LVGL task fail!");
 
@@ -136,9 +159,22 @@ esp_err_t lvgl_port_resume(void)
         ret = esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_timer_period_ms * 1000);
     }
 
+    /* Wake up the LVGL task parked by lvgl_port_stop() */
+    lvgl_port_ctx.paused = false;
+    if (lvgl_port_ctx.task != NULL) {
+        xTaskNotifyGive(lvgl_port_ctx.task);
+    }
+
     return ret;
 }
 
+void lvgl_port_wake(void)
+{
+    if (lvgl_port_ctx.task != NULL) {
+        xTaskNotifyGive(lvgl_port_ctx.task);
+    }
+}
+
 esp_err_t lvgl_port_stop(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
@@ -148,6 +184,9 @@ esp_err_t lvgl_port_stop(void)
         ret = esp_timer_stop(lvgl_port_ctx.tick_timer);
     }
 
+    /* The LVGL task blocks until lvgl_port_resume() instead of polling */
+    lvgl_port_ctx.paused = true;
+
     return ret;
 }
 
@@ -163,6 +202,9 @@ esp_err_t lvgl_port_deinit(void)
     /* Stop running task */
     if (lvgl_port_ctx.running) {
         lvgl_port_ctx.running = false;
+        if (lvgl_port_ctx.task != NULL) {
+            xTaskNotifyGive(lvgl_port_ctx.task);
+        }
     } else {
         lvgl_port_task_deinit();
     }
@@ -238,8 +280,9 @@ lv_disp_t *lvgl_port_add_disp(const lvgl_port_display_cfg_t *disp_cfg)
 
     disp_ctx->disp_drv.draw_buf = disp_buf;
     disp_ctx->disp_drv.user_data = disp_ctx;
-    /* Force full_fresh */
-    disp_ctx->disp_drv.full_refresh = 1;
+    disp_ctx->disp_drv.rounder_cb = disp_cfg->rounder_cb;
+    disp_ctx->disp_drv.flush_cost = disp_cfg->flush_cost;
+    disp_ctx->disp_drv.full_refresh = disp_cfg->flags.full_refresh;
 
 #if LVGL_PORT_HANDLE_FLUSH_READY
     /* Register done callback */
@@ -249,8 +292,25 @@ lv_disp_t *lvgl_port_add_disp(const lvgl_port_display_cfg_t *disp_cfg)
     esp_lcd_panel_io_register_event_callbacks(disp_ctx->io_handle, &cbs, &disp_ctx->disp_drv);
 #endif
 
+#if LV_USE_DRAW_SW_MT && (configNUM_CORES > 1)
+    /* The band rendering helpers are started with the first display, run them on the other core than the LVGL task */
+    esp_pthread_cfg_t prev_pthread_cfg;
+    if (esp_pthread_get_cfg(&prev_pthread_cfg) != ESP_OK) {
+        prev_pthread_cfg = esp_pthread_get_default_config();
+    }
+    esp_pthread_cfg_t pthread_cfg = esp_pthread_get_default_config();
+    pthread_cfg.thread_name = "LVGL band";
+    pthread_cfg.prio = uxTaskPriorityGet(lvgl_port_ctx.task);
+    pthread_cfg.pin_to_core = (lvgl_port_ctx.task_affinity == 1) ? 0 : 1;
+    esp_pthread_set_cfg(&pthread_cfg);
+#endif
+
     disp = lv_disp_drv_register(&disp_ctx->disp_drv);
 
+#if LV_USE_DRAW_SW_MT && (configNUM_CORES > 1)
+    esp_pthread_set_cfg(&prev_pthread_cfg);
+#endif
+
 err:
     if (ret != ESP_OK) {
         if (buf1) {
@@ -316,7 +376,9 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
         return NULL;
     }
     touch_ctx->handle = touch_cfg->handle;
-    touch_ctx->touch_wait_cb = touch_cfg->touch_wait_cb;
+    touch_ctx->last_point.x = 0;
+    touch_ctx->last_point.y = 0;
+    touch_ctx->last_state = LV_INDEV_STATE_RELEASED;
 
     /* Register a touchpad input device */
     lv_indev_drv_init(&touch_ctx->indev_drv);
@@ -377,16 +439,22 @@ static void lvgl_port_task(void *arg)
     ESP_LOGI(TAG, "Starting LVGL task");
     lvgl_port_ctx.running = true;
     while (lvgl_port_ctx.running) {
+        if (lvgl_port_ctx.paused) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
         if (lvgl_port_lock(0)) {
             task_delay_ms = lv_timer_handler();
             lvgl_port_unlock();
         }
-        if ((task_delay_ms > lvgl_port_ctx.task_max_sleep_ms) || (1 == task_delay_ms)) {
+        if (task_delay_ms > lvgl_port_ctx.task_max_sleep_ms) {
             task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
         } else if (task_delay_ms < 1) {
             task_delay_ms = 1;
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        /* Sleep until the next timer is due (rounded up to whole ticks), or until lvgl_port_wake() */
+        TickType_t delay_ticks = (task_delay_ms * configTICK_RATE_HZ + 999) / 1000;
+        ulTaskNotifyTake(pdTRUE, delay_ticks);
     }
 
     lvgl_port_task_deinit();
@@ -417,6 +485,8 @@ static bool lvgl_port_flush_ready_callback(esp_lcd_panel_io_handle_t panel_io, e
     lvgl_port_display_ctx_t *disp_ctx = disp_drv->user_data;
     assert(disp_ctx != NULL);
 
+    LV_PROFILER_END_TRACK("panel_transfer", LVGL_PORT_PROFILER_TRACK_PANEL);
+
     if (disp_ctx->trans_done_sem) {
         xSemaphoreGiveFromISR(disp_ctx->trans_done_sem, &taskAwake);
     }
@@ -496,6 +566,7 @@ static void lvgl_port_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area,
             disp_ctx->trans_act = (disp_ctx->trans_act == disp_ctx->trans_buf_1) ? (disp_ctx->trans_buf_2) : (disp_ctx->trans_buf_1);
             to = disp_ctx->trans_act;
 
+            LV_PROFILER_BEGIN_TAG("rotate_copy");
             switch (rotate) {
             case LV_DISP_ROT_90:
                 for (int y = 0; y < height; y++) {
@@ -544,15 +615,21 @@ static void lvgl_port_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area,
             default:
                 break;
             }
+            LV_PROFILER_END_TAG("rotate_copy");
 
             if (0 == i) {
                 if (disp_ctx->draw_wait_cb) {
+                    LV_PROFILER_BEGIN_TAG("wait_tear");
                     disp_ctx->draw_wait_cb(disp_ctx->panel_handle->user_data);
+                    LV_PROFILER_END_TAG("wait_tear");
                 }
                 xSemaphoreGive(disp_ctx->trans_done_sem);
             }
 
+            LV_PROFILER_BEGIN_TAG("wait_transfer");
             xSemaphoreTake(disp_ctx->trans_done_sem, portMAX_DELAY);
+            LV_PROFILER_END_TAG("wait_transfer");
+            LVGL_PORT_PROFILER_TRANSFER_BEGIN();
             esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, x_draw_start, y_draw_start, x_draw_end + 1, y_draw_end + 1, to);
 
             if (LV_DISP_ROT_90 == rotate) {
@@ -566,11 +643,40 @@ static void lvgl_port_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area,
             }
         }
     } else {
+        LVGL_PORT_PROFILER_TRANSFER_BEGIN();
         esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, x_start, y_start, x_end + 1, y_end + 1, color_map);
     }
     lv_disp_flush_ready(drv);
 }
 
+#if LV_USE_PROFILER
+static void lvgl_port_profiler_write_cb(const char *buf, uint32_t len, void *user_data)
+{
+    fwrite(buf, 1, len, stdout);
+}
+
+void lvgl_port_profiler_dump(void)
+{
+    lv_profiler_stat_t stat;
+    lv_profiler_get_stat(&stat);
+    ESP_LOGI(TAG, "Profiler: %"PRIu32" events recorded, %"PRIu32" overwritten", stat.recorded, stat.overwritten);
+
+    lv_profiler_dump(lvgl_port_profiler_write_cb, NULL);
+    fflush(stdout);
+}
+
+uint8_t lvgl_port_profiler_tid_get(void)
+{
+    /* Task local, so a task keeps its track when it moves to an other core */
+    static __thread int tid = -1;
+    static int tid_next = 0;
+    if (tid < 0) {
+        tid = __atomic_fetch_add(&tid_next, 1, __ATOMIC_RELAXED) % LV_PROFILER_TRACK_FIRST;
+    }
+    return (uint8_t)tid;
+}
+#endif
+
 #ifdef ESP_LVGL_PORT_TOUCH_COMPONENT
 static void lvgl_port_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
 {
@@ -578,29 +684,20 @@ static void lvgl_port_touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *
     lvgl_port_touch_ctx_t *touch_ctx = (lvgl_port_touch_ctx_t *)indev_drv->user_data;
     assert(touch_ctx->handle);
 
-    uint16_t touchpad_x[1] = {0};
-    uint16_t touchpad_y[1] = {0};
-    uint8_t touchpad_cnt = 0;
-
-    /* Read data from touch controller into memory */
-    bool touch_int = false;
-    if (touch_ctx->touch_wait_cb) {
-        touch_int = touch_ctx->touch_wait_cb(touch_ctx->handle->config.user_data);
-    }
-    if (touch_int) {
-        esp_lcd_touch_read_data(touch_ctx->handle);
-        /* Read data from touch controller */
-        bool touchpad_pressed = esp_lcd_touch_get_coordinates(touch_ctx->handle, touchpad_x, touchpad_y, NULL, &touchpad_cnt, 1);
-
-        if (touchpad_pressed && touchpad_cnt > 0) {
-            data->point.x = touchpad_x[0];
-            data->point.y = touchpad_y[0];
-            data->state = LV_INDEV_STATE_PRESSED;
-            esp_rom_printf("Touchpad pressed: x=%d, y=%d\n", data->point.x, data->point.y);
-        } else {
-            data->state = LV_INDEV_STATE_RELEASED;
+    /* Events are queued by the touch reader task after the INT edge, the bus is not touched here */
+    esp_lcd_touch_event_t event;
+    if (esp_lcd_touch_get_event(touch_ctx->handle, &event)) {
+        touch_ctx->last_state = (event.points > 0) ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+        if (event.points > 0) {
+            touch_ctx->last_point.x = event.x;
+            touch_ctx->last_point.y = event.y;
         }
+        /* Let LVGL process every queued sample of a fast gesture in this read period */
+        data->continue_reading = (esp_lcd_touch_get_event_count(touch_ctx->handle) > 0);
     }
+
+    data->point = touch_ctx->last_point;
+    data->state = touch_ctx->last_state;
 }
 #endif
 
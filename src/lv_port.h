@@ -23,6 +23,7 @@ extern "C" {
 #endif
 
 typedef bool (*lvgl_port_wait_cb)(void *handle);
+typedef void (*lvgl_port_rounder_cb)(lv_disp_drv_t *drv, lv_area_t *area);
 
 /**
  * @brief Init configuration structure
@@ -39,6 +40,8 @@ typedef struct {
     esp_lcd_panel_io_handle_t io_handle;    /*!< LCD panel IO handle */
     esp_lcd_panel_handle_t panel_handle;    /*!< LCD panel handle */
     lvgl_port_wait_cb draw_wait_cb;
+    lvgl_port_rounder_cb rounder_cb;    /*!< Extend invalidated areas to what the panel can be written with (optional) */
+    uint32_t    flush_cost;     /*!< Fixed time of one flush in pixel times, invalidated areas are joined to save it (optional) */
 
     uint32_t    buffer_size;    /*!< Size of the buffer for the screen in pixels */
     uint32_t    trans_size;     /*!< Allocated buffer will be in SRAM to move framebuf */
@@ -48,6 +51,7 @@ typedef struct {
     struct {
         unsigned int buff_dma: 1;    /*!< Allocated LVGL buffer will be DMA capable */
         unsigned int buff_spiram: 1; /*!< Allocated LVGL buffer will be in PSRAM */
+        unsigned int full_refresh: 1; /*!< Always redraw and send the whole screen */
     } flags;
 } lvgl_port_display_cfg_t;
 
@@ -57,9 +61,7 @@ typedef struct {
  */
 typedef struct {
     lv_disp_t *disp;    /*!< LVGL display handle (returned from lvgl_port_add_disp) */
-    esp_lcd_touch_handle_t   handle;   /*!< LCD touch IO handle */
-
-    lvgl_port_wait_cb touch_wait_cb;
+    esp_lcd_touch_handle_t   handle;   /*!< LCD touch IO handle (events are queued by esp_lcd_touch_read_event) */
 } lvgl_port_touch_cfg_t;
 #endif
 
@@ -142,6 +144,51 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg);
 esp_err_t lvgl_port_remove_touch(lv_indev_t *touch);
 #endif
 
+/**
+ * @brief Stop LVGL timer and tick, and park the LVGL task
+ *
+ * @note The LVGL task stays blocked (no periodic wake-ups) until lvgl_port_resume() is called.
+ *
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_STATE     if the port is not initialized
+ */
+esp_err_t lvgl_port_stop(void);
+
+/**
+ * @brief Resume LVGL timer and tick, and wake up the LVGL task
+ *
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_STATE     if the port is not initialized
+ */
+esp_err_t lvgl_port_resume(void);
+
+/**
+ * @brief Wake up the LVGL task to run the timers now
+ *
+ * @note The LVGL task sleeps until the next LVGL timer is due. Call it after making a timer ready
+ *       (e.g. with lv_timer_ready()) from an other task. Can be called from any task.
+ */
+void lvgl_port_wake(void);
+
+#if LV_USE_PROFILER
+/**
+ * @brief Print the events recorded by the LVGL profiler to the serial console as Chrome trace JSON
+ *
+ * @note Save the output between the `[` and `]` lines as a .json file and open it with chrome://tracing
+ *       or https://ui.perfetto.dev. Can be called from any task, the recording is paused meanwhile.
+ */
+void lvgl_port_profiler_dump(void);
+
+/**
+ * @brief Get a small ID of the calling task for the LVGL profiler's tracks
+ *
+ * @return The ID of the task, assigned when the task records its first event
+ */
+uint8_t lvgl_port_profiler_tid_get(void);
+#endif
+
 /**
  * @brief Take LVGL mutex
  *
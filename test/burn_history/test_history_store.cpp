@@ -0,0 +1,420 @@
+// history_store: kodēšana/atkodēšana, robežgadījumi, bloku gredzens RAM un segmentu faili
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include "unity.h"
+#include "history_store.h"
+
+#define T0  1700000000u
+
+typedef struct {
+    uint32_t time;
+    hist_sample_t s;
+} rec_t;
+
+static std::vector<rec_t> got;
+static char tmp_dir[32];
+
+void setUp(void)
+{
+    got.clear();
+    snprintf(tmp_dir, sizeof(tmp_dir), "/tmp/histXXXXXX");
+    TEST_ASSERT_NOT_NULL(mkdtemp(tmp_dir));
+}
+
+void tearDown(void)
+{
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", tmp_dir);
+    TEST_ASSERT_EQUAL(0, system(cmd));
+}
+
+static void collect_cb(uint32_t time, const hist_sample_t *sample, void *user)
+{
+    (void)user;
+    got.push_back({time, *sample});
+}
+
+static uint32_t query(const hist_store_t *s, uint32_t from, uint32_t to)
+{
+    got.clear();
+    return hist_store_query(s, from, to, collect_cb, NULL);
+}
+
+static hist_sample_t sample(int temperature, uint8_t damper, uint8_t target, uint8_t phase)
+{
+    hist_sample_t s = {(int16_t)temperature, damper, target, phase};
+    return s;
+}
+
+// Pievieno paraugu glabātuvei un gaidāmajam rezultātam (ar temperatūras ierobežošanu)
+static void append(hist_store_t *s, std::vector<rec_t> &model, uint32_t time, hist_sample_t smp)
+{
+    hist_store_append(s, time, &smp);
+    if (smp.temperature < HIST_TEMP_MIN) smp.temperature = HIST_TEMP_MIN;
+    if (smp.temperature > HIST_TEMP_MAX) smp.temperature = HIST_TEMP_MAX;
+    model.push_back({time, smp});
+}
+
+static void assert_records(const rec_t *expected, size_t cnt)
+{
+    TEST_ASSERT_EQUAL_UINT32(cnt, got.size());
+    for (size_t i = 0; i < cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(expected[i].time, got[i].time);
+        TEST_ASSERT_EQUAL_INT16(expected[i].s.temperature, got[i].s.temperature);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].s.damper, got[i].s.damper);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].s.target, got[i].s.target);
+        TEST_ASSERT_EQUAL_UINT8(expected[i].s.phase, got[i].s.phase);
+    }
+}
+
+// Vaicājuma rezultāts ir pēdējie got.size() ieraksti no model (vecākie bloki izspiesti)
+static void assert_model_tail(const std::vector<rec_t> &model)
+{
+    TEST_ASSERT_TRUE(got.size() > 0);
+    TEST_ASSERT_TRUE(got.size() <= model.size());
+    assert_records(&model[model.size() - got.size()], got.size());
+}
+
+static uint32_t rnd_state = 12345;
+static uint32_t rnd(uint32_t n)
+{
+    rnd_state = rnd_state * 1103515245u + 12345u;
+    return (rnd_state >> 8) % n;
+}
+
+// Katrā paraugā mainās visi lauki: sliktākais gadījums blokam (33 biti paraugā)
+static hist_sample_t worst_sample(uint32_t i)
+{
+    return sample((int)(i * 37 % 600) - 100, (uint8_t)(i % 101), (uint8_t)(i * 7 % 128),
+                  (uint8_t)(i % BURN_PHASE_COUNT));
+}
+
+// Viena diennakts: dīkstāve, iekurināšana, AUTO, FILL, END un atdzišana, sensors ±1 °C trokšņo
+static void burn_day(hist_store_t *s, std::vector<rec_t> &model, uint32_t start)
+{
+    int temp = 20;
+    int damper = 0;
+    for (uint32_t i = 0; i < 86400; i++) {
+        uint32_t min = i / 60;
+        uint8_t phase = BURN_PHASE_IDLE;
+        int goal = 20;
+        if (min >= 360 && min < 420) {
+            phase = BURN_PHASE_MANUAL;
+            goal = 70;
+            damper = 100;
+        } else if (min >= 420 && min < 600) {
+            phase = min >= 560 ? BURN_PHASE_FILL : BURN_PHASE_AUTO;
+            goal = 88;
+            if (i % 45 == 0) damper = 30 + (int)rnd(50);
+        } else if (min >= 600 && min < 660) {
+            phase = BURN_PHASE_END;
+            goal = 60;
+            damper = 10;
+        } else {
+            damper = 0;
+        }
+        // Temperatūra tuvojas mērķim ar ~1 °C minūtē
+        if (i % 60 == 0 && temp != goal) temp += temp < goal ? 1 : -1;
+        int noise = rnd(50) == 0 ? (rnd(2) ? 1 : -1) : 0;
+        append(s, model, start + i, sample(temp + noise, (uint8_t)damper, 80, phase));
+    }
+}
+
+static void test_roundtrip_burn_day(void)
+{
+    static uint8_t ram[64 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 64, NULL, 0);
+
+    std::vector<rec_t> model;
+    burn_day(&s, model, T0);
+
+    TEST_ASSERT_EQUAL_UINT32(model.size(), query(&s, T0, T0 + 86400));
+    assert_records(model.data(), model.size());
+
+    // Daļējs intervāls bloka vidū
+    query(&s, T0 + 30000, T0 + 30010);
+    assert_records(&model[30000], 10);
+}
+
+static void test_temperature_edges(void)
+{
+    static uint8_t ram[4 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 4, NULL, 0);
+
+    // ±1 soļi, lēcieni starp 10 bitu robežām, DS18B20 diapazons un kļūdas vērtība,
+    // vērtības ārpus diapazona (saglabājas robežvērtība, nevis aptinas)
+    static const int temps[] = {
+        600, 0, 1, 0, -1, HIST_TEMP_MAX, HIST_TEMP_MAX - 1, HIST_TEMP_MAX, HIST_TEMP_MIN, HIST_TEMP_MIN + 1,
+        HIST_TEMP_MIN, HIST_TEMP_MAX, 512, 1000, HIST_TEMP_MAX, -513, -1000, 125, -55, -127, 85, 0,
+    };
+    std::vector<rec_t> model;
+    uint32_t t = T0;
+    for (int temp : temps) {
+        append(&s, model, t++, sample(temp, 50, 80, BURN_PHASE_AUTO));
+    }
+
+    // Pirmais paraugs (galvenē) arī tiek ierobežots
+    TEST_ASSERT_EQUAL_INT16(HIST_TEMP_MAX, model[0].s.temperature);
+    TEST_ASSERT_EQUAL_UINT32(model.size(), query(&s, T0, t));
+    assert_records(model.data(), model.size());
+    TEST_ASSERT_EQUAL_UINT32(1, hist_store_get_stats(&s)->blocks);
+}
+
+static void test_gap_edges(void)
+{
+    static uint8_t ram[4 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 4, NULL, 0);
+    std::vector<rec_t> model;
+
+    uint32_t t = T0;
+    append(&s, model, t, sample(20, 0, 80, BURN_PHASE_IDLE));
+    t += 2;     // 1 izlaista sekunde
+    append(&s, model, t, sample(21, 0, 80, BURN_PHASE_IDLE));
+    t += 1 + HIST_MAX_GAP;  // Garākais pārtraukums, kas vēl ir tajā pašā blokā
+    append(&s, model, t, sample(21, 0, 80, BURN_PHASE_IDLE));
+    TEST_ASSERT_EQUAL_UINT32(1, hist_store_get_stats(&s)->blocks);
+
+    t += 1 + HIST_MAX_GAP + 1;  // Par garu: jauns bloks
+    append(&s, model, t, sample(22, 5, 80, BURN_PHASE_AUTO));
+    TEST_ASSERT_EQUAL_UINT32(2, hist_store_get_stats(&s)->blocks);
+
+    t += 1;
+    append(&s, model, t, sample(23, 5, 80, BURN_PHASE_AUTO));
+
+    // Tas pats laiks vēlreiz tiek ignorēts
+    hist_sample_t dup = sample(99, 99, 99, BURN_PHASE_END);
+    hist_store_append(&s, t, &dup);
+
+    TEST_ASSERT_EQUAL_UINT32(model.size(), query(&s, T0, t + 1));
+    assert_records(model.data(), model.size());
+
+    // Intervāls, kas sākas pārtraukuma vidū
+    query(&s, T0 + 100, t + 1);
+    assert_records(&model[2], model.size() - 2);
+
+    // Laiks gāja atpakaļ (pulksteņa korekcija): jauns bloks, vecie dati paliek
+    append(&s, model, T0 - 100, sample(19, 0, 80, BURN_PHASE_IDLE));
+    TEST_ASSERT_EQUAL_UINT32(3, hist_store_get_stats(&s)->blocks);
+    query(&s, T0 - 100, T0 - 99);
+    assert_records(&model.back(), 1);
+}
+
+static void test_block_full_and_max_span(void)
+{
+    static uint8_t ram[16 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 16, NULL, 0);
+    std::vector<rec_t> model;
+
+    // Pilni bloki: katrs paraugs aizņem 33 bitus, blokā ietilpst (4096 - 20) * 8 / 33 + 1 paraugi
+    const uint32_t per_block = (HIST_BLOCK_SIZE - HIST_BLOCK_HDR_SIZE) * 8 / 33 + 1;
+    for (uint32_t i = 0; i < 3 * per_block; i++) {
+        append(&s, model, T0 + i, worst_sample(i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, hist_store_get_stats(&s)->blocks);
+    append(&s, model, T0 + 3 * per_block, worst_sample(3 * per_block));
+    TEST_ASSERT_EQUAL_UINT32(4, hist_store_get_stats(&s)->blocks);
+
+    // Nemainīgi paraugi: bloks beidzas pēc HIST_BLOCK_MAX_SPAN sekundēm
+    uint32_t t = T0 + 10000;
+    for (uint32_t i = 0; i < HIST_BLOCK_MAX_SPAN + 1; i++) {
+        append(&s, model, t + i, sample(20, 0, 80, BURN_PHASE_IDLE));
+    }
+    TEST_ASSERT_EQUAL_UINT32(6, hist_store_get_stats(&s)->blocks);
+
+    TEST_ASSERT_EQUAL_UINT32(model.size(), query(&s, T0, t + HIST_BLOCK_MAX_SPAN + 1));
+    assert_records(model.data(), model.size());
+}
+
+static void test_ram_ring_wraps(void)
+{
+    static uint8_t ram[3 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 3, NULL, 0);
+    std::vector<rec_t> model;
+
+    for (uint32_t i = 0; i < 10000; i++) {
+        append(&s, model, T0 + i, worst_sample(i));
+    }
+    TEST_ASSERT_TRUE(hist_store_get_stats(&s)->blocks > 3);
+
+    // Paliek tikai pēdējie 3 bloki: jaunākie paraugi bez robiem un bez atlikumiem no pārrakstītajiem blokiem
+    query(&s, T0, T0 + 10000);
+    assert_model_tail(model);
+    TEST_ASSERT_TRUE(got.size() > 2 * 900);
+    TEST_ASSERT_TRUE(got.size() <= 3 * 990);
+}
+
+static void test_flash_segments_and_restart(void)
+{
+    static uint8_t ram[2 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 2, tmp_dir, 6);
+    std::vector<rec_t> model;
+
+    // ~10 pilni bloki: segmentu faili iet pa apli, RAM ir tikai 2 jaunākie
+    uint32_t i;
+    for (i = 0; i < 10000; i++) {
+        append(&s, model, T0 + i, worst_sample(i));
+    }
+    TEST_ASSERT_TRUE(hist_store_flush(&s));
+
+    query(&s, T0, T0 + i);
+    assert_model_tail(model);
+    TEST_ASSERT_TRUE(got.size() > 5 * 900);     // 6 bloki no flash, ne tikai 2 no RAM
+    size_t kept = got.size();
+
+    // Bez izmaiņām flush neko neraksta
+    uint32_t writes = hist_store_get_stats(&s)->flash_writes;
+    TEST_ASSERT_TRUE(hist_store_flush(&s));
+    TEST_ASSERT_EQUAL_UINT32(writes, hist_store_get_stats(&s)->flash_writes);
+
+    // Pārstartēšana: vēsture tiek ielādēta no segmentu failiem un turpinās
+    static uint8_t ram2[2 * HIST_BLOCK_SIZE];
+    hist_store_t s2;
+    hist_store_init(&s2, ram2, 2, tmp_dir, 6);
+    query(&s2, T0, T0 + i);
+    TEST_ASSERT_EQUAL_UINT32(kept, got.size());
+    assert_model_tail(model);
+
+    for (uint32_t j = 0; j < 100; j++, i++) {
+        append(&s2, model, T0 + 600 + i, sample(30 + (int)(j % 3), 40, 80, BURN_PHASE_AUTO));
+    }
+    query(&s2, T0, T0 + 600 + i);
+    assert_model_tail(model);
+    TEST_ASSERT_TRUE(got.size() > 100);
+}
+
+static void test_flush_keeps_partial_block(void)
+{
+    static uint8_t ram[2 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 2, tmp_dir, 4);
+    std::vector<rec_t> model;
+
+    for (uint32_t i = 0; i < 100; i++) {
+        append(&s, model, T0 + i, sample(20 + (int)(i / 10), (uint8_t)i, 80, BURN_PHASE_AUTO));
+    }
+    TEST_ASSERT_TRUE(hist_store_flush(&s));
+    // Pēc flush pievienotais netiek saglabāts līdz nākamajai reizei
+    hist_sample_t lost = sample(50, 0, 80, BURN_PHASE_END);
+    hist_store_append(&s, T0 + 100, &lost);
+
+    static uint8_t ram2[2 * HIST_BLOCK_SIZE];
+    hist_store_t s2;
+    hist_store_init(&s2, ram2, 2, tmp_dir, 4);
+    TEST_ASSERT_EQUAL_UINT32(100, query(&s2, T0, T0 + 1000));
+    assert_records(model.data(), model.size());
+}
+
+static void test_buckets(void)
+{
+    static uint8_t ram[64 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 64, NULL, 0);
+    std::vector<rec_t> model;
+    burn_day(&s, model, T0);
+
+    // Pēdējā stunda ir tukša (dati sākas T0), pārējās salīdzinām ar modeli
+    const uint32_t cnt = 25;
+    hist_bucket_t b[cnt];
+    hist_store_buckets(&s, T0 - 3600, 3600, cnt, b);
+    TEST_ASSERT_EQUAL(0, b[0].cnt);
+    for (uint32_t i = 1; i < cnt; i++) {
+        int16_t tmin = INT16_MAX, tmax = INT16_MIN;
+        const rec_t *last = NULL;
+        for (const rec_t &r : model) {
+            if (r.time < T0 - 3600 + i * 3600 || r.time >= T0 + i * 3600) continue;
+            if (r.s.temperature < tmin) tmin = r.s.temperature;
+            if (r.s.temperature > tmax) tmax = r.s.temperature;
+            last = &r;
+        }
+        TEST_ASSERT_NOT_NULL(last);
+        TEST_ASSERT_EQUAL(3600, b[i].cnt);
+        TEST_ASSERT_EQUAL_INT16(tmin, b[i].temp_min);
+        TEST_ASSERT_EQUAL_INT16(tmax, b[i].temp_max);
+        TEST_ASSERT_EQUAL_UINT8(last->s.damper, b[i].damper);
+        TEST_ASSERT_EQUAL_UINT8(last->s.phase, b[i].phase);
+    }
+}
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void count_cb(uint32_t time, const hist_sample_t *sample, void *user)
+{
+    (void)time;
+    (void)sample;
+    (*(uint32_t *)user)++;
+}
+
+// Blīvums un ātrums ar ierīces iestatījumiem (32 RAM bloki, 160 segmentu faili), 7 degšanas dienas.
+// Skaitļi ir datora, ne ESP32-S3; salīdzināšanai starp izmaiņām kodekā.
+static void test_report_density_and_latency(void)
+{
+    static uint8_t ram[32 * HIST_BLOCK_SIZE];
+    hist_store_t s;
+    hist_store_init(&s, ram, 32, tmp_dir, 160);
+    std::vector<rec_t> model;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t day = 0; day < 7; day++) {
+        burn_day(&s, model, T0 + day * 86400);
+    }
+    double append_us = elapsed_us(start);
+    TEST_ASSERT_TRUE(hist_store_flush(&s));
+
+    const hist_stats_t *st = hist_store_get_stats(&s);
+    double payload = st->payload_bits / 8.0 / st->samples;
+    double with_blocks = (double)st->blocks * HIST_BLOCK_SIZE / st->samples;
+    double flash = (double)st->flash_bytes / st->samples;
+
+    uint32_t now = T0 + 7 * 86400;
+    hist_bucket_t b[300];
+    start = std::chrono::steady_clock::now();
+    hist_store_buckets(&s, now - 86400, 86400 / 300, 300, b);
+    double day_ram_us = elapsed_us(start);
+
+    uint32_t n = 0;
+    start = std::chrono::steady_clock::now();
+    hist_store_query(&s, T0, now, count_cb, &n);
+    double week_us = elapsed_us(start);
+    TEST_ASSERT_EQUAL_UINT32(model.size(), n);
+
+    printf("history_store: %u samples, %u blocks, %u flash writes\n", (unsigned)st->samples, (unsigned)st->blocks,
+           (unsigned)st->flash_writes);
+    printf("  density: %.3f B/sample payload, %.3f B/sample with 4 KB blocks, %.3f B/sample written to flash\n",
+           payload, with_blocks, flash);
+    printf("  append: %.1f ns/sample\n", append_us * 1000 / st->samples);
+    printf("  24 h in 300 buckets (RAM): %.0f us, 7 d query (RAM + flash): %.0f us\n", day_ram_us, week_us);
+
+    // README: ~0.16 B/sample kodēti, ~0.3 B/sample ar bloku astēm
+    TEST_ASSERT_TRUE(payload < 0.2);
+    TEST_ASSERT_TRUE(with_blocks < 0.35);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_roundtrip_burn_day);
+    RUN_TEST(test_temperature_edges);
+    RUN_TEST(test_gap_edges);
+    RUN_TEST(test_block_full_and_max_span);
+    RUN_TEST(test_ram_ring_wraps);
+    RUN_TEST(test_flash_segments_and_restart);
+    RUN_TEST(test_flush_keeps_partial_block);
+    RUN_TEST(test_buckets);
+    RUN_TEST(test_report_density_and_latency);
+    return UNITY_END();
+}
@@ -0,0 +1,263 @@
+// AXS15231B QSPI daļēja atjaunošana: RASET izlaišana, RAMWRC turpinājums un
+// esp_lcd_axs15231b_qspi_round_area(). Panel IO transakcijas un baitus pieraksta esp_stubs.
+
+#include <stdio.h>
+#include "unity.h"
+#include "esp_stubs.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_axs15231b.h"
+
+#define H_RES       320
+#define V_RES       480
+#define TRANS_SIZE  (H_RES * V_RES / 10)    // Kā esp_bsp.c
+#define BPP         2
+
+// Viss kadrs: katram TRANS_SIZE gabalam CASET + RAMWR/RAMWRC
+#define FULL_CHUNKS     (V_RES / (TRANS_SIZE / H_RES))
+#define FULL_BYTES      (H_RES * V_RES * BPP + FULL_CHUNKS * 2 * ESP_STUB_IO_HDR_BYTES + FULL_CHUNKS * 4)
+
+static esp_lcd_panel_t *panel;
+static uint8_t pixels[TRANS_SIZE * BPP];
+
+static esp_lcd_panel_t *panel_create(bool qspi_raset)
+{
+    axs15231b_vendor_config_t vendor = {
+        .flags = {
+            .use_qspi_interface = 1,
+            .qspi_raset = qspi_raset,
+        },
+    };
+    esp_lcd_panel_dev_config_t cfg = {
+        .reset_gpio_num = -1,
+        .color_space = LCD_RGB_ELEMENT_ORDER_RGB,
+        .bits_per_pixel = 16,
+        .vendor_config = &vendor,
+    };
+    esp_lcd_panel_handle_t p = NULL;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_panel_axs15231b((esp_lcd_panel_io_handle_t)1, &cfg, &p));
+    return p;
+}
+
+void setUp(void)
+{
+    esp_stub_reset();
+    panel = NULL;
+}
+
+void tearDown(void)
+{
+    if (panel) {
+        panel->del(panel);
+    }
+}
+
+static int op_cmd(const esp_stub_io_op_t *op)
+{
+    return (op->lcd_cmd >> 8) & 0xff;
+}
+
+static int op_first(const esp_stub_io_op_t *op)
+{
+    return (op->param[0] << 8) | op->param[1];
+}
+
+static int op_last(const esp_stub_io_op_t *op)
+{
+    return (op->param[2] << 8) | op->param[3];
+}
+
+static size_t count_cmd(int cmd)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < esp_stub_io_log_cnt; i++) {
+        n += op_cmd(&esp_stub_io_log[i]) == cmd;
+    }
+    return n;
+}
+
+// lvgl_port_flush_callback() (src/lv_port.c) gabalošana un pagriešana; hor_res/ver_res pēc pagriešanas
+static esp_err_t flush(int rotation, int hor_res, int ver_res, int x1, int y1, int x2, int y2)
+{
+    const int width = x2 - x1 + 1;
+    const int height = y2 - y1 + 1;
+    const bool by_x = rotation == 1 || rotation == 3;
+    const int len = by_x ? width : height;
+    const int other = by_x ? height : width;
+    const int max = TRANS_SIZE / other > len ? len : TRANS_SIZE / other;
+
+    for (int done = 0; done < len; done += max) {
+        const int n = len - done > max ? max : len - done;
+        int px1, py1, px2, py2;
+        switch (rotation) {
+        case 1: // 90: no kreisās kolonnas
+            px1 = ver_res - y2 - 1;
+            px2 = ver_res - y1 - 1;
+            py1 = x1 + done;
+            py2 = py1 + n - 1;
+            break;
+        case 2: // 180: no apakšējās rindas
+            px1 = hor_res - x2 - 1;
+            px2 = hor_res - x1 - 1;
+            py1 = ver_res - (y2 - done) - 1;
+            py2 = py1 + n - 1;
+            break;
+        case 3: // 270: no labās kolonnas
+            px1 = y1;
+            px2 = y2;
+            py1 = hor_res - (x2 - done) - 1;
+            py2 = py1 + n - 1;
+            break;
+        default:
+            px1 = x1;
+            px2 = x2;
+            py1 = y1 + done;
+            py2 = py1 + n - 1;
+            break;
+        }
+        esp_err_t err = panel->draw_bitmap(panel, px1, py1, px2 + 1, py2 + 1, pixels);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+// LVGL apgabals caur esp_bsp.c noapaļotāju un flush
+static esp_err_t flush_rounded(int rotation, int x1, int y1, int x2, int y2)
+{
+    const int hor_res = (rotation & 1) ? V_RES : H_RES;
+    const int ver_res = (rotation & 1) ? H_RES : V_RES;
+    esp_lcd_axs15231b_qspi_round_area(rotation, hor_res, ver_res, &x1, &y1, &x2, &y2);
+    return flush(rotation, hor_res, ver_res, x1, y1, x2, y2);
+}
+
+// Pārbauda, ka pierakstītās rindas ir viens nepārtraukts apgabals no rindas 0
+static void assert_contiguous_from_row_0(int x_first, int x_last, int rows)
+{
+    int next_row = 0;
+    size_t color_bytes = 0;
+    for (size_t i = 0; i < esp_stub_io_log_cnt; i++) {
+        const esp_stub_io_op_t *op = &esp_stub_io_log[i];
+        if (op_cmd(op) == LCD_CMD_CASET) {
+            TEST_ASSERT_EQUAL(x_first, op_first(op));
+            TEST_ASSERT_EQUAL(x_last, op_last(op));
+        } else {
+            TEST_ASSERT_TRUE(op->color);
+            TEST_ASSERT_EQUAL_HEX(next_row == 0 ? LCD_CMD_RAMWR : LCD_CMD_RAMWRC, op_cmd(op));
+            next_row += op->len / ((x_last - x_first + 1) * BPP);
+            color_bytes += op->len;
+        }
+    }
+    TEST_ASSERT_EQUAL(rows, next_row);
+    TEST_ASSERT_EQUAL((x_last - x_first + 1) * rows * BPP, color_bytes);
+}
+
+static void test_full_screen_uses_continuation(void)
+{
+    panel = panel_create(false);
+    TEST_ASSERT_EQUAL(ESP_OK, flush_rounded(0, 0, 0, H_RES - 1, V_RES - 1));
+
+    TEST_ASSERT_EQUAL(0, count_cmd(LCD_CMD_RASET));
+    TEST_ASSERT_EQUAL(1, count_cmd(LCD_CMD_RAMWR));
+    TEST_ASSERT_EQUAL(FULL_CHUNKS - 1, count_cmd(LCD_CMD_RAMWRC));
+    assert_contiguous_from_row_0(0, H_RES - 1, V_RES);
+    TEST_ASSERT_EQUAL(FULL_BYTES, esp_stub_io_bytes);
+}
+
+static void test_partial_update_without_raset(void)
+{
+    /* 200x40 uzraksts rindās 100..139: jāsūta rindas 0..139, bet tikai tā kolonnas */
+    panel = panel_create(false);
+    TEST_ASSERT_EQUAL(ESP_OK, flush_rounded(0, 20, 100, 219, 139));
+
+    TEST_ASSERT_EQUAL(0, count_cmd(LCD_CMD_RASET));
+    assert_contiguous_from_row_0(20, 219, 140);
+    TEST_ASSERT_LESS_THAN(FULL_BYTES / 5, esp_stub_io_bytes);
+    printf("partial 200x40 @ row 100, no RASET: %u B, full frame %u B\n",
+           (unsigned)esp_stub_io_bytes, (unsigned)FULL_BYTES);
+}
+
+static void test_partial_update_with_raset(void)
+{
+    /* Ar RASET tiek sūtīts tikai pats apgabals, katram gabalam savas rindas */
+    panel = panel_create(true);
+    TEST_ASSERT_EQUAL(ESP_OK, flush(0, H_RES, V_RES, 20, 100, 219, 139));
+
+    TEST_ASSERT_EQUAL(1, count_cmd(LCD_CMD_RASET));
+    TEST_ASSERT_EQUAL(1, count_cmd(LCD_CMD_RAMWR));
+    TEST_ASSERT_EQUAL(0, count_cmd(LCD_CMD_RAMWRC));
+    const esp_stub_io_op_t *raset = &esp_stub_io_log[1];
+    TEST_ASSERT_EQUAL_HEX(LCD_CMD_RASET, op_cmd(raset));
+    TEST_ASSERT_EQUAL(100, op_first(raset));
+    TEST_ASSERT_EQUAL(139, op_last(raset));
+    TEST_ASSERT_EQUAL(200 * 40 * BPP + 3 * ESP_STUB_IO_HDR_BYTES + 2 * 4, esp_stub_io_bytes);
+    printf("partial 200x40 @ row 100, RASET: %u B\n", (unsigned)esp_stub_io_bytes);
+}
+
+static void test_unaligned_area_is_rejected(void)
+{
+    /* Bez noapaļotāja: rakstīt no rindas 37 bez RASET nevar, uz kopnes nekas neaiziet */
+    panel = panel_create(false);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, panel->draw_bitmap(panel, 3, 37, 100, 40, pixels));
+    TEST_ASSERT_EQUAL(0, esp_stub_io_log_cnt);
+
+    /* Turpinājums der tikai ar tām pašām kolonnām un tieši nākamo rindu */
+    TEST_ASSERT_EQUAL(ESP_OK, panel->draw_bitmap(panel, 3, 0, 100, 10, pixels));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, panel->draw_bitmap(panel, 3, 11, 100, 20, pixels));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, panel->draw_bitmap(panel, 4, 10, 100, 20, pixels));
+    TEST_ASSERT_EQUAL(2, esp_stub_io_log_cnt);
+    TEST_ASSERT_EQUAL(ESP_OK, panel->draw_bitmap(panel, 3, 10, 100, 20, pixels));
+    TEST_ASSERT_EQUAL_HEX(LCD_CMD_RAMWRC, op_cmd(&esp_stub_io_log[3]));
+
+    /* Ar noapaļotāju tas pats apgabals iet cauri */
+    esp_stub_reset();
+    TEST_ASSERT_EQUAL(ESP_OK, flush_rounded(0, 3, 37, 99, 39));
+    assert_contiguous_from_row_0(3, 99, 40);
+}
+
+static void test_rounder_all_rotations(void)
+{
+    /* Katrā pagriezienā noapaļots apgabals sākas paneļa rindā 0 un turpinās bez RASET */
+    for (int rotation = 0; rotation < 4; rotation++) {
+        esp_stub_reset();
+        panel = panel_create(false);
+        TEST_ASSERT_EQUAL_MESSAGE(ESP_OK, flush_rounded(rotation, 57, 61, 131, 203), "rotation");
+        TEST_ASSERT_EQUAL(0, count_cmd(LCD_CMD_RASET));
+        TEST_ASSERT_EQUAL(1, count_cmd(LCD_CMD_RAMWR));
+        TEST_ASSERT_LESS_THAN(FULL_BYTES / 2, esp_stub_io_bytes);
+        panel->del(panel);
+        panel = NULL;
+    }
+
+    /* Kolonnas netiek mainītas */
+    int x1 = 57, y1 = 61, x2 = 131, y2 = 203;
+    esp_lcd_axs15231b_qspi_round_area(0, H_RES, V_RES, &x1, &y1, &x2, &y2);
+    TEST_ASSERT_EQUAL(57, x1);
+    TEST_ASSERT_EQUAL(0, y1);
+    TEST_ASSERT_EQUAL(131, x2);
+    TEST_ASSERT_EQUAL(203, y2);
+    x1 = 57, y1 = 61, x2 = 131, y2 = 203;
+    esp_lcd_axs15231b_qspi_round_area(2, H_RES, V_RES, &x1, &y1, &x2, &y2);
+    TEST_ASSERT_EQUAL(61, y1);
+    TEST_ASSERT_EQUAL(V_RES - 1, y2);
+    x1 = 57, y1 = 61, x2 = 131, y2 = 203;
+    esp_lcd_axs15231b_qspi_round_area(1, V_RES, H_RES, &x1, &y1, &x2, &y2);
+    TEST_ASSERT_EQUAL(0, x1);
+    TEST_ASSERT_EQUAL(131, x2);
+    x1 = 57, y1 = 61, x2 = 131, y2 = 203;
+    esp_lcd_axs15231b_qspi_round_area(3, V_RES, H_RES, &x1, &y1, &x2, &y2);
+    TEST_ASSERT_EQUAL(57, x1);
+    TEST_ASSERT_EQUAL(V_RES - 1, x2);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_full_screen_uses_continuation);
+    RUN_TEST(test_partial_update_without_raset);
+    RUN_TEST(test_partial_update_with_raset);
+    RUN_TEST(test_unaligned_area_is_rejected);
+    RUN_TEST(test_rounder_all_rotations);
+    return UNITY_END();
+}
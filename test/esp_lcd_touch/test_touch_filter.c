@@ -0,0 +1,250 @@
+// esp_lcd_touch_process_sample(): One-Euro filtrs un debounce uz sintētiskiem ierakstiem
+
+#include <stdlib.h>
+#include "unity.h"
+#include "touch_test_util.h"
+
+// Viens ieraksta paraugs: laiks [ms], punktu skaits, koordinātas
+typedef struct {
+    uint32_t ms;
+    uint8_t n;
+    uint16_t x;
+    uint16_t y;
+} trace_t;
+
+static esp_lcd_touch_t touch;
+static esp_lcd_touch_handle_t tp = &touch;
+
+void setUp(void)
+{
+    memset(&touch, 0, sizeof(touch));
+}
+
+void tearDown(void)
+{
+}
+
+static void set_filter(const esp_lcd_touch_filter_cfg_t *cfg)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_set_filter(tp, cfg));
+}
+
+// Apstrādā vienu paraugu; *x, *y un atgrieztais punktu skaits ir tas, ko redzētu LVGL
+static uint8_t sample(uint32_t ms, uint8_t n, uint16_t *x, uint16_t *y)
+{
+    uint8_t num = n;
+    esp_lcd_touch_process_sample(tp, x, y, &num, 1, ms);
+    return num;
+}
+
+static void test_zero_config_passes_samples_through(void)
+{
+    static const trace_t t[] = {
+        {0, 1, 10, 20}, {10, 1, 13, 19}, {20, 1, 200, 400}, {30, 0, 0, 0}, {40, 1, 5, 6},
+    };
+    for (size_t i = 0; i < sizeof(t) / sizeof(t[0]); i++) {
+        uint16_t x = t[i].x, y = t[i].y;
+        TEST_ASSERT_EQUAL(t[i].n, sample(t[i].ms, t[i].n, &x, &y));
+        if (t[i].n) {
+            TEST_ASSERT_EQUAL(t[i].x, x);
+            TEST_ASSERT_EQUAL(t[i].y, y);
+        }
+    }
+}
+
+static void test_filter_removes_jitter_at_rest(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    set_filter(&cfg);
+
+    /* Pirksts stāv uz (160, 240), sensors trīc ±3 px ik pēc 10 ms */
+    static const int8_t jitter[] = {3, -2, 1, -3, 2, 0, -1, 3, -3, 2, -2, 1, 0, -3, 3, -1};
+    int max_raw = 0;
+    int max_filtered = 0;
+    for (int i = 0; i < 100; i++) {
+        int dx = jitter[i % sizeof(jitter)];
+        int dy = jitter[(i + 5) % sizeof(jitter)];
+        uint16_t x = 160 + dx, y = 240 + dy;
+        TEST_ASSERT_EQUAL(1, sample(i * 10, 1, &x, &y));
+        if (i < 10) {
+            continue; /* Filtrs vēl iesilst */
+        }
+        if (abs(dx) > max_raw) {
+            max_raw = abs(dx);
+        }
+        if (abs((int)x - 160) > max_filtered) {
+            max_filtered = abs((int)x - 160);
+        }
+        if (abs((int)y - 240) > max_filtered) {
+            max_filtered = abs((int)y - 240);
+        }
+    }
+    TEST_ASSERT_EQUAL(3, max_raw);
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_filtered);
+}
+
+// Cik pikseļus filtrētais punkts atpaliek no pirksta vienmērīgā kustībā ar 1000 px/s
+static int lag_at_speed(uint16_t beta)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    cfg.beta = beta;
+    set_filter(&cfg);
+
+    uint16_t x = 0, y = 100;
+    for (int i = 0; i <= 30; i++) {
+        x = 10 + i * 10;
+        y = 100;
+        sample(i * 10, 1, &x, &y);
+    }
+    return (10 + 30 * 10) - x;
+}
+
+static void test_filter_follows_fast_movement(void)
+{
+    int lag_iir = lag_at_speed(0);
+    int lag_one_euro = lag_at_speed(20);
+
+    /* Filtrētais punkts neapsteidz pirkstu */
+    TEST_ASSERT_GREATER_OR_EQUAL(0, lag_one_euro);
+    /* 1000 px/s paceļ cutoff līdz ~21 Hz: atpaliek ap vienu paraugu (10 px),
+       kamēr tīrs 1,5 Hz IIR atpaliek par vairākiem desmitiem pikseļu */
+    TEST_ASSERT_LESS_OR_EQUAL(10, lag_one_euro);
+    TEST_ASSERT_GREATER_THAN(5 * lag_one_euro, lag_iir);
+}
+
+static void test_filter_restarts_on_new_press(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    cfg.debounce_release = 1;
+    set_filter(&cfg);
+
+    uint16_t x = 10, y = 10;
+    sample(0, 1, &x, &y);
+    x = 12, y = 11;
+    sample(10, 1, &x, &y);
+    sample(20, 0, &x, &y);
+
+    /* Jauns pieskāriens citur sākas tieši tur, nevis pa ceļam no vecā */
+    x = 300, y = 400;
+    TEST_ASSERT_EQUAL(1, sample(30, 1, &x, &y));
+    TEST_ASSERT_EQUAL(300, x);
+    TEST_ASSERT_EQUAL(400, y);
+}
+
+static void test_debounce_press(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = {0};
+    cfg.debounce_press = 2;
+    set_filter(&cfg);
+
+    uint16_t x = 50, y = 60;
+    /* Vienu paraugu garš pieskāriens ir troksnis */
+    TEST_ASSERT_EQUAL(0, sample(0, 1, &x, &y));
+    TEST_ASSERT_EQUAL(0, sample(10, 0, &x, &y));
+
+    x = 50, y = 60;
+    TEST_ASSERT_EQUAL(0, sample(20, 1, &x, &y));
+    x = 51, y = 61;
+    TEST_ASSERT_EQUAL(1, sample(30, 1, &x, &y));
+    TEST_ASSERT_EQUAL(51, x);
+    TEST_ASSERT_EQUAL(61, y);
+}
+
+static void test_debounce_release_holds_last_point(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = {0};
+    cfg.debounce_release = 2;
+    set_filter(&cfg);
+
+    uint16_t x = 70, y = 80;
+    TEST_ASSERT_EQUAL(1, sample(0, 1, &x, &y));
+
+    /* Viena parauga pārtraukums netiek ziņots kā atlaidiens */
+    x = y = 0;
+    TEST_ASSERT_EQUAL(1, sample(10, 0, &x, &y));
+    TEST_ASSERT_EQUAL(70, x);
+    TEST_ASSERT_EQUAL(80, y);
+    x = 72, y = 81;
+    TEST_ASSERT_EQUAL(1, sample(20, 1, &x, &y));
+
+    /* Divi tukši paraugi pēc kārtas ir atlaidiens */
+    x = y = 0;
+    TEST_ASSERT_EQUAL(1, sample(30, 0, &x, &y));
+    TEST_ASSERT_EQUAL(72, x);
+    TEST_ASSERT_EQUAL(0, sample(40, 0, &x, &y));
+}
+
+// Filtrēts gājiens ar 1000 px/s, sākot no laika start_ms
+static void play_movement(uint32_t start_ms, uint16_t *out, int cnt)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    set_filter(&cfg);
+
+    for (int i = 0; i < cnt; i++) {
+        uint16_t x = 10 + i * 10, y = 100;
+        sample(start_ms + i * 10, 1, &x, &y);
+        out[i] = x;
+    }
+}
+
+static void test_filter_timestamp_wraps(void)
+{
+    uint16_t ref[40];
+    uint16_t wrapped[40];
+
+    /* Milisekunžu skaitītājs pārtek gājiena vidū, rezultātam jābūt tam pašam */
+    play_movement(1000, ref, 40);
+    play_movement(UINT32_MAX - 195, wrapped, 40);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(ref, wrapped, 40);
+}
+
+static void test_filter_backward_timestamp(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    set_filter(&cfg);
+
+    uint16_t x = 100, y = 100;
+    sample(1000, 1, &x, &y);
+    x = 110, y = 100;
+    sample(1010, 1, &x, &y);
+
+    /* Laiks iet atpakaļ: apstrādā kā īsāko periodu, punkts paliek starp veco un jauno */
+    x = 200, y = 100;
+    TEST_ASSERT_EQUAL(1, sample(1005, 1, &x, &y));
+    TEST_ASSERT_GREATER_OR_EQUAL(100, x);
+    TEST_ASSERT_LESS_OR_EQUAL(200, x);
+    TEST_ASSERT_EQUAL(100, y);
+}
+
+static void test_filter_large_jump_max_beta(void)
+{
+    esp_lcd_touch_filter_cfg_t cfg = ESP_LCD_TOUCH_FILTER_DEFAULT_CONFIG();
+    cfg.beta = UINT16_MAX;
+
+    /* Milzīgs ātrums ar maksimālo beta nedrīkst pārpildīt cutoff aprēķinu:
+       ātrā kustībā filtrs gandrīz netraucē */
+    for (uint16_t jump = 1000; jump <= 64000; jump++) {
+        set_filter(&cfg);
+        uint16_t x = 0, y = 0;
+        sample(0, 1, &x, &y);
+        x = jump, y = 0;
+        TEST_ASSERT_EQUAL(1, sample(1, 1, &x, &y));
+        TEST_ASSERT_LESS_OR_EQUAL(jump, x);
+        TEST_ASSERT_GREATER_OR_EQUAL(jump - jump / 5, x);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_zero_config_passes_samples_through);
+    RUN_TEST(test_filter_removes_jitter_at_rest);
+    RUN_TEST(test_filter_follows_fast_movement);
+    RUN_TEST(test_filter_restarts_on_new_press);
+    RUN_TEST(test_debounce_press);
+    RUN_TEST(test_debounce_release_holds_last_point);
+    RUN_TEST(test_filter_timestamp_wraps);
+    RUN_TEST(test_filter_backward_timestamp);
+    RUN_TEST(test_filter_large_jump_max_beta);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+// AXS15231B atskaišu dekodēšana un esp_lcd_touch notikumu rinda
+
+#include "unity.h"
+#include "touch_test_util.h"
+
+#define QUEUE_LEN   CONFIG_ESP_LCD_TOUCH_EVENT_QUEUE_LEN
+
+static esp_lcd_touch_handle_t tp;
+
+void setUp(void)
+{
+    esp_stub_reset();
+    tp = touch_test_create();
+    TEST_ASSERT_NOT_NULL(tp);
+}
+
+void tearDown(void)
+{
+    esp_lcd_touch_del(tp);
+}
+
+// Viena atskaite laikā time_ms; num = 0 nozīmē atlaistu pirkstu
+static bool read_event(uint32_t time_ms, uint8_t num, uint16_t x, uint16_t y)
+{
+    bool pressed = false;
+    esp_stub_time_us = (int64_t)time_ms * 1000;
+    touch_test_set_report(num, x, y);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_event(tp, &pressed));
+    return pressed;
+}
+
+static void test_decoder_reads_one_point(void)
+{
+    touch_test_set_report(1, 300, 455);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+
+    /* 11 baitu lasīšanas komanda ar atskaites garumu 2 + 6 baiti */
+    static const uint8_t cmd[] = {0xb5, 0xab, 0xa5, 0x5a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00};
+    TEST_ASSERT_EQUAL(sizeof(cmd), esp_stub_tx_len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(cmd, esp_stub_tx, sizeof(cmd));
+
+    uint16_t x = 0, y = 0, strength = 0;
+    uint8_t num = 0;
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_coordinates(tp, &x, &y, &strength, &num, 1));
+    TEST_ASSERT_EQUAL(1, num);
+    TEST_ASSERT_EQUAL(300, x);
+    TEST_ASSERT_EQUAL(455, y);
+    TEST_ASSERT_EQUAL(0x20, strength);
+
+    /* Koordinātas tiek nolasītas tikai vienreiz */
+    TEST_ASSERT_FALSE(esp_lcd_touch_get_coordinates(tp, &x, &y, &strength, &num, 1));
+    TEST_ASSERT_EQUAL(0, num);
+}
+
+static void test_decoder_masks_event_bits(void)
+{
+    /* Notikuma biti (6..7) un neizmantotie biti nav daļa no koordinātām */
+    touch_test_set_report(1, 0x123, 0x1DF);
+    esp_stub_rx[2] |= 0xF0;
+    esp_stub_rx[4] |= 0xF0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+
+    uint16_t x = 0, y = 0;
+    uint8_t num = 0;
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &num, 1));
+    TEST_ASSERT_EQUAL(0x123, x);
+    TEST_ASSERT_EQUAL(0x1DF, y);
+}
+
+static void test_decoder_no_touch(void)
+{
+    touch_test_set_report(0, 100, 100);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+
+    uint16_t x = 0, y = 0;
+    uint8_t num = 0;
+    TEST_ASSERT_FALSE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &num, 1));
+    TEST_ASSERT_EQUAL(0, num);
+}
+
+static void test_decoder_clamps_point_count(void)
+{
+    /* Vairāk pirkstu, nekā nolasīts: paliek tie, kas ir atskaitē */
+    touch_test_set_report(5, 10, 20);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+
+    uint16_t x = 0, y = 0;
+    uint8_t num = 0;
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &num, 1));
+    TEST_ASSERT_EQUAL(1, num);
+    TEST_ASSERT_EQUAL(10, x);
+    TEST_ASSERT_EQUAL(20, y);
+}
+
+static void test_queue_keeps_order_and_timestamps(void)
+{
+    TEST_ASSERT_TRUE(read_event(100, 1, 50, 60));
+    TEST_ASSERT_TRUE(read_event(110, 1, 52, 61));
+    TEST_ASSERT_FALSE(read_event(120, 0, 0, 0));
+    /* Atkārtots atlaidiens netiek ierindots */
+    TEST_ASSERT_FALSE(read_event(130, 0, 0, 0));
+    TEST_ASSERT_EQUAL(3, esp_lcd_touch_get_event_count(tp));
+
+    esp_lcd_touch_event_t e;
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+    TEST_ASSERT_EQUAL(100, e.timestamp_ms);
+    TEST_ASSERT_EQUAL(1, e.points);
+    TEST_ASSERT_EQUAL(50, e.x);
+    TEST_ASSERT_EQUAL(60, e.y);
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+    TEST_ASSERT_EQUAL(110, e.timestamp_ms);
+    TEST_ASSERT_EQUAL(52, e.x);
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+    TEST_ASSERT_EQUAL(120, e.timestamp_ms);
+    TEST_ASSERT_EQUAL(0, e.points);
+    TEST_ASSERT_FALSE(esp_lcd_touch_get_event(tp, &e));
+    TEST_ASSERT_EQUAL(0, tp->events.dropped);
+}
+
+static void test_queue_full_merges_movement(void)
+{
+    /* Pilnā rindā kustība tiek apvienota ar pēdējo notikumu, nekas netiek zaudēts */
+    uint32_t i;
+    for (i = 0; i < QUEUE_LEN + 10; i++) {
+        read_event(100 + i, 1, i, 2 * i);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_LEN, esp_lcd_touch_get_event_count(tp));
+    TEST_ASSERT_EQUAL(0, tp->events.dropped);
+
+    esp_lcd_touch_event_t e;
+    for (i = 0; i < QUEUE_LEN - 1; i++) {
+        TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+        TEST_ASSERT_EQUAL(100 + i, e.timestamp_ms);
+    }
+    /* Pēdējais notikums satur jaunāko punktu */
+    TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+    TEST_ASSERT_EQUAL(100 + QUEUE_LEN + 9, e.timestamp_ms);
+    TEST_ASSERT_EQUAL(QUEUE_LEN + 9, e.x);
+    TEST_ASSERT_EQUAL(2 * (QUEUE_LEN + 9), e.y);
+}
+
+static void test_queue_full_drops_oldest(void)
+{
+    /* Pieskārieni un atlaidieni pārmaiņus: katrs ir pāreja, tos nevar apvienot */
+    uint32_t i;
+    for (i = 0; i < QUEUE_LEN + 3; i++) {
+        read_event(100 + i, (i & 1) ? 0 : 1, i, i);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_LEN, esp_lcd_touch_get_event_count(tp));
+    TEST_ASSERT_EQUAL(3, tp->events.dropped);
+
+    /* Paliek jaunākie notikumi pareizā secībā */
+    esp_lcd_touch_event_t e;
+    for (i = 3; i < QUEUE_LEN + 3; i++) {
+        TEST_ASSERT_TRUE(esp_lcd_touch_get_event(tp, &e));
+        TEST_ASSERT_EQUAL(100 + i, e.timestamp_ms);
+        TEST_ASSERT_EQUAL((i & 1) ? 0 : 1, e.points);
+    }
+    TEST_ASSERT_FALSE(esp_lcd_touch_get_event(tp, &e));
+}
+
+static void test_queue_full_release_is_not_lost(void)
+{
+    /* Pilna rinda, kas beidzas ar pieskārienu, un tad atlaidiens */
+    uint32_t i;
+    for (i = 0; i < QUEUE_LEN; i++) {
+        read_event(100 + i, (i & 1) ? 1 : 0, i, i);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_LEN - 1, esp_lcd_touch_get_event_count(tp)); /* pirmais atlaidiens netiek ierindots */
+    read_event(200, 1, 77, 77);
+    read_event(201, 0, 0, 0);
+    TEST_ASSERT_EQUAL(QUEUE_LEN, esp_lcd_touch_get_event_count(tp));
+
+    esp_lcd_touch_event_t e = {0};
+    esp_lcd_touch_event_t last = {0};
+    uint32_t prev_ms = 0;
+    while (esp_lcd_touch_get_event(tp, &e)) {
+        TEST_ASSERT_GREATER_THAN(prev_ms, e.timestamp_ms);
+        prev_ms = e.timestamp_ms;
+        last = e;
+    }
+    TEST_ASSERT_EQUAL(201, last.timestamp_ms);
+    TEST_ASSERT_EQUAL(0, last.points);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_decoder_reads_one_point);
+    RUN_TEST(test_decoder_masks_event_bits);
+    RUN_TEST(test_decoder_no_touch);
+    RUN_TEST(test_decoder_clamps_point_count);
+    RUN_TEST(test_queue_keeps_order_and_timestamps);
+    RUN_TEST(test_queue_full_merges_movement);
+    RUN_TEST(test_queue_full_drops_oldest);
+    RUN_TEST(test_queue_full_release_is_not_lost);
+    return UNITY_END();
+}
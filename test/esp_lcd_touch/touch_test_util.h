@@ -0,0 +1,34 @@
+#pragma once
+
+// Kopīgas palīgfunkcijas esp_lcd_touch testiem
+
+#include <string.h>
+#include "esp_stubs.h"
+#include "esp_lcd_axs15231b.h"
+
+// Nākamā nolasījuma AXS15231B atskaite: galvene (žests, punktu skaits) + 6 baiti punktam
+static inline void touch_test_set_report(uint8_t num, uint16_t x, uint16_t y)
+{
+    memset(esp_stub_rx, 0, sizeof(esp_stub_rx));
+    esp_stub_rx[1] = num;
+    esp_stub_rx[2] = (x >> 8) & 0x0F;
+    esp_stub_rx[3] = x & 0xFF;
+    esp_stub_rx[4] = (y >> 8) & 0x0F;
+    esp_stub_rx[5] = y & 0xFF;
+    esp_stub_rx[6] = 0x20; // weight
+}
+
+static inline esp_lcd_touch_handle_t touch_test_create(void)
+{
+    esp_lcd_touch_config_t cfg = {
+        .x_max = 320,
+        .y_max = 480,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+    };
+    esp_lcd_touch_handle_t tp = NULL;
+    if (esp_lcd_touch_new_i2c_axs15231b((esp_lcd_panel_io_handle_t)1, &cfg, &tp) != ESP_OK) {
+        return NULL;
+    }
+    return tp;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "esp_lcd_panel_interface.h"
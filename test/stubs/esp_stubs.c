@@ -0,0 +1,137 @@
+#include "esp_stubs.h"
+
+#include <string.h>
+#include "driver/gpio.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+
+int64_t esp_stub_time_us;
+uint8_t esp_stub_rx[ESP_STUB_IO_BUF_SIZE];
+uint8_t esp_stub_tx[ESP_STUB_IO_BUF_SIZE];
+size_t esp_stub_tx_len;
+uint32_t esp_stub_rx_cnt;
+esp_stub_io_op_t esp_stub_io_log[ESP_STUB_IO_LOG_SIZE];
+size_t esp_stub_io_log_cnt;
+size_t esp_stub_io_bytes;
+
+static void io_log(int lcd_cmd, bool color, const void *data, size_t len)
+{
+    if (esp_stub_io_log_cnt < ESP_STUB_IO_LOG_SIZE) {
+        esp_stub_io_op_t *op = &esp_stub_io_log[esp_stub_io_log_cnt];
+        op->lcd_cmd = lcd_cmd;
+        op->color = color;
+        op->len = len;
+        memset(op->param, 0, sizeof(op->param));
+        if (!color && data) {
+            memcpy(op->param, data, len < sizeof(op->param) ? len : sizeof(op->param));
+        }
+    }
+    esp_stub_io_log_cnt++;
+    esp_stub_io_bytes += ESP_STUB_IO_HDR_BYTES + len;
+}
+
+void esp_stub_reset(void)
+{
+    esp_stub_time_us = 0;
+    memset(esp_stub_rx, 0, sizeof(esp_stub_rx));
+    memset(esp_stub_tx, 0, sizeof(esp_stub_tx));
+    esp_stub_tx_len = 0;
+    esp_stub_rx_cnt = 0;
+    esp_stub_io_log_cnt = 0;
+    esp_stub_io_bytes = 0;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return esp_stub_time_us;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    esp_stub_time_us += (int64_t)ticks * 1000;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    (void)io;
+    if (param_size > sizeof(esp_stub_tx)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (param_size) {
+        memcpy(esp_stub_tx, param, param_size);
+    }
+    esp_stub_tx_len = param_size;
+    io_log(lcd_cmd, false, param, param_size);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size)
+{
+    (void)io;
+    (void)lcd_cmd;
+    if (param_size > sizeof(esp_stub_rx)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(param, esp_stub_rx, param_size);
+    esp_stub_rx_cnt++;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    (void)io;
+    io_log(lcd_cmd, true, color, color_size);
+    return ESP_OK;
+}
+
+esp_err_t gpio_config(const gpio_config_t *cfg)
+{
+    (void)cfg;
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    (void)gpio_num;
+    (void)level;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    (void)intr_alloc_flags;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    (void)gpio_num;
+    (void)isr_handler;
+    (void)args;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_OK;
+}
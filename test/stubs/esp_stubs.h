@@ -0,0 +1,41 @@
+#pragma once
+
+// ESP-IDF aizstājēji datora testiem: testi paši nosaka laiku un I2C atbildes
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_STUB_IO_BUF_SIZE    64
+#define ESP_STUB_IO_LOG_SIZE    256
+#define ESP_STUB_IO_HDR_BYTES   4                       // QSPI: opkods + 24 bitu adrese katrai transakcijai
+
+// Viena panel IO transakcija
+typedef struct {
+    int lcd_cmd;                                        // Kā nodots esp_lcd_panel_io_tx_*()
+    bool color;                                         // tx_color(), nevis tx_param()
+    size_t len;
+    uint8_t param[4];                                   // Pirmie parametru baiti (CASET/RASET)
+} esp_stub_io_op_t;
+
+extern int64_t esp_stub_time_us;                        // esp_timer_get_time()
+
+extern uint8_t esp_stub_rx[ESP_STUB_IO_BUF_SIZE];       // Ko atgriezīs esp_lcd_panel_io_rx_param()
+extern uint8_t esp_stub_tx[ESP_STUB_IO_BUF_SIZE];       // Pēdējais esp_lcd_panel_io_tx_param()
+extern size_t esp_stub_tx_len;
+extern uint32_t esp_stub_rx_cnt;                        // Nolasījumu skaits
+
+extern esp_stub_io_op_t esp_stub_io_log[ESP_STUB_IO_LOG_SIZE];  // tx_param()/tx_color() secībā
+extern size_t esp_stub_io_log_cnt;                      // Var būt lielāks par ESP_STUB_IO_LOG_SIZE
+extern size_t esp_stub_io_bytes;                        // Baiti uz kopnes, ieskaitot galvenes
+
+// Visu aizstājēju sākuma stāvoklis
+void esp_stub_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Testi paši nosaka laiku, sk. esp_stubs.h */
+int64_t esp_timer_get_time(void);
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_FREE_VAL            0xB33FFFFF
+#define portMUX_INITIALIZER_UNLOCKED {portMUX_FREE_VAL, 0}
+#define portMAX_DELAY               0xFFFFFFFF
+#define pdTRUE                      1
+#define pdFALSE                     0
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(ms))
+
+/* Testi ir vienpavediena, tāpēc kritiskās sekcijas nav vajadzīgas */
+#define portENTER_CRITICAL(mux)     ((void)(mux))
+#define portEXIT_CRITICAL(mux)      ((void)(mux))
+
+/* ESP-IDF to ņem no newlib sys/cdefs.h */
+#ifndef __containerof
+#define __containerof(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+#endif
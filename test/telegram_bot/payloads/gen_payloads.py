@@ -0,0 +1,69 @@
+# getUpdates atbildes testam un mērījumam (Bot API formātā, ar visiem laukiem,
+# ko Telegram sūta: from, entities, reply_markup, chat_instance...).
+# Ne-ASCII rakstzīmes ir \uXXXX, tāpat kā Telegram atbildēs.
+#
+#   python3 gen_payloads.py    (failus raksta šajā mapē)
+
+import json
+import os
+
+OUT = os.path.dirname(os.path.abspath(__file__))
+
+
+def user(i):
+    return {"id": 100000000 + i, "is_bot": False, "first_name": "Jānis", "last_name": "Bērziņš",
+            "username": "krasns_user%d" % i, "language_code": "lv"}
+
+
+def chat(i):
+    return {"id": 100000000 + i, "first_name": "Jānis", "last_name": "Bērziņš",
+            "username": "krasns_user%d" % i, "type": "private"}
+
+
+def message(uid, i, text):
+    m = {"message_id": 1000 + uid, "from": user(i), "chat": chat(i), "date": 1760870000 + uid, "text": text}
+    if text.startswith("/"):
+        m["entities"] = [{"offset": 0, "length": len(text), "type": "bot_command"}]
+    return m
+
+
+# Tāda pati kā create_main_keyboard() telegram_bot.cpp
+KEYBOARD = {"inline_keyboard": [
+    [{"text": "🔄 Info", "callback_data": "refresh"}],
+    [{"text": "🌡️ Set Target", "callback_data": "change_temp"}, {"text": "⚙️ kP", "callback_data": "change_kp"}],
+    [{"text": "❄️ Min Temp", "callback_data": "change_temp_min"}],
+]}
+
+
+def callback(uid, i, data):
+    bot_msg = {"message_id": 900 + uid,
+               "from": {"id": 7000000001, "is_bot": True, "first_name": "Krāsns", "username": "krasns_bot"},
+               "chat": chat(i), "date": 1760870000 + uid, "text": "🏠 Izvēlies darbību:", "reply_markup": KEYBOARD}
+    return {"id": "%d" % (4382000000000000000 + uid), "from": user(i), "message": bot_msg,
+            "chat_instance": "-%d" % (5000000000000000000 + uid), "data": data}
+
+
+def response(updates):
+    return json.dumps({"ok": True, "result": updates}, ensure_ascii=True, separators=(",", ":"))
+
+
+payloads = {
+    "message": response([{"update_id": 584120001, "message": message(1, 1, "/info")}]),
+    "callback": response([{"update_id": 584120002, "callback_query": callback(2, 1, "change_temp")}]),
+    # 4096 rakstzīmes (Telegram maksimums), ~10 KB ar \uXXXX
+    "long_text": response([{"update_id": 584120003,
+                            "message": message(3, 2, ("Ļoti garš teksts ar emocijzīmēm 🔥🌡️ " * 120)[:4096])}]),
+    "batch100": response([
+        {"update_id": 584120100 + k, "callback_query": callback(100 + k, k, ["refresh", "change_kp"][k % 4 // 2])}
+        if k % 2 else
+        {"update_id": 584120100 + k, "message": message(100 + k, k, "%d" % (k + 600) if k % 4 else "/time")}
+        for k in range(100)
+    ]),
+    "empty": json.dumps({"ok": True, "result": []}),
+    "error": json.dumps({"ok": False, "error_code": 409,
+                         "description": "Conflict: terminated by other getUpdates request"}),
+}
+
+for name, body in payloads.items():
+    with open(os.path.join(OUT, name + ".json"), "w") as f:
+        f.write(body)
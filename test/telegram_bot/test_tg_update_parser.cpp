@@ -0,0 +1,536 @@
+// tg_update_parser: getUpdates atbildes pa jebkura izmēra gabaliem, kļūdains
+// un nepilnīgs JSON, \u atšifrēšana un surogātu pāri, mērījums pret cJSON.
+// Atbildes ir payloads/ (gen_payloads.py).
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "tg_update_parser.h"
+#include "unity.h"
+
+#ifdef HAVE_CJSON
+#include "cJSON.h"
+#endif
+
+#ifdef COUNT_MALLOC
+#include <malloc.h>
+#endif
+
+static const char *const PAYLOADS[] = {"message",  "callback", "long_text",
+                                       "batch100", "empty",    "error"};
+
+static const size_t CHUNK_SIZES[] = {1, 2, 3, 7, 13, 64, 512, 1460};
+
+static tg_parser_t p;
+static tg_parser_t ref;
+
+void setUp(void) { tg_parser_reset(&p); }
+
+void tearDown(void) {}
+
+// ============================================
+// PALĪGFUNKCIJAS
+// ============================================
+
+static std::string load(const char *name) {
+  std::string path = std::string(PAYLOAD_DIR "/") + name + ".json";
+  FILE *f = fopen(path.c_str(), "rb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path.c_str());
+  std::string s;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    s.append(buf, n);
+  fclose(f);
+  return s;
+}
+
+static uint32_t rnd_state = 1;
+static uint32_t rnd(uint32_t n) {
+  rnd_state = rnd_state * 1103515245u + 12345u;
+  return (rnd_state >> 8) % n;
+}
+
+// chunk = 0: nejauši gabali 1..chunk_max
+static bool parse(tg_parser_t *parser, const std::string &body, size_t chunk,
+                  size_t chunk_max = 100) {
+  tg_parser_reset(parser);
+  size_t i = 0;
+  while (i < body.size()) {
+    size_t n = chunk ? chunk : 1 + rnd(chunk_max);
+    if (n > body.size() - i)
+      n = body.size() - i;
+    if (!tg_parser_feed(parser, body.data() + i, n))
+      return false;
+    i += n;
+  }
+  return tg_parser_finish(parser);
+}
+
+static bool parse_str(tg_parser_t *parser, const char *json, size_t chunk) {
+  return parse(parser, std::string(json), chunk);
+}
+
+static void assert_same_result(const tg_parser_t *a, const tg_parser_t *b,
+                               const char *msg) {
+  TEST_ASSERT_EQUAL_MESSAGE(a->ok, b->ok, msg);
+  TEST_ASSERT_EQUAL_MESSAGE(a->error, b->error, msg);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(a->bytes, b->bytes, msg);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(a->update_total, b->update_total, msg);
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(a->update_cnt, b->update_cnt, msg);
+  if (a->update_cnt)
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(a->updates, b->updates,
+                                     a->update_cnt * sizeof(tg_update_t), msg);
+}
+
+// Viens atjauninājums ar tekstu, kas padots pa vienam baitam un vienā gabalā
+static const tg_update_t *parse_text(const char *text_json) {
+  std::string body =
+      std::string("{\"ok\":true,\"result\":[{\"update_id\":7,\"message\":{"
+                  "\"text\":\"") +
+      text_json + "\",\"chat\":{\"id\":-1001234567890}}}]}";
+  TEST_ASSERT_TRUE(parse(&ref, body, body.size()));
+  TEST_ASSERT_TRUE(parse(&p, body, 1));
+  assert_same_result(&ref, &p, text_json);
+  TEST_ASSERT_EQUAL(1, p.update_cnt);
+  TEST_ASSERT_TRUE(p.updates[0].has_text);
+  // Lauks aiz teksta tiek nolasīts arī pēc apgriešanas
+  TEST_ASSERT_TRUE(p.updates[0].has_chat_id);
+  TEST_ASSERT_EQUAL_INT64(-1001234567890LL, p.updates[0].chat_id);
+  return &p.updates[0];
+}
+
+static void assert_message(const tg_update_t *u, int64_t update_id,
+                           int64_t chat_id, const char *text) {
+  TEST_ASSERT_TRUE(u->has_update_id);
+  TEST_ASSERT_EQUAL_INT64(update_id, u->update_id);
+  TEST_ASSERT_EQUAL(TG_UPDATE_MESSAGE, u->type);
+  TEST_ASSERT_TRUE(u->has_chat_id);
+  TEST_ASSERT_EQUAL_INT64(chat_id, u->chat_id);
+  TEST_ASSERT_TRUE(u->has_text);
+  TEST_ASSERT_EQUAL_STRING(text, u->text);
+}
+
+static void assert_callback(const tg_update_t *u, int64_t update_id,
+                            int64_t chat_id, const char *id,
+                            const char *data) {
+  TEST_ASSERT_TRUE(u->has_update_id);
+  TEST_ASSERT_EQUAL_INT64(update_id, u->update_id);
+  TEST_ASSERT_EQUAL(TG_UPDATE_CALLBACK, u->type);
+  TEST_ASSERT_TRUE(u->has_chat_id);
+  TEST_ASSERT_EQUAL_INT64(chat_id, u->chat_id);
+  TEST_ASSERT_EQUAL_STRING(id, u->callback_id);
+  TEST_ASSERT_EQUAL_STRING(data, u->callback_data);
+  // callback_query.message.text ir bota ziņa, nevis lietotāja teksts
+  TEST_ASSERT_FALSE(u->has_text);
+}
+
+// ============================================
+// ATBILDES
+// ============================================
+
+static void test_message(void) {
+  TEST_ASSERT_TRUE(parse(&p, load("message"), SIZE_MAX));
+  TEST_ASSERT_TRUE(p.ok);
+  TEST_ASSERT_EQUAL(1, p.update_total);
+  TEST_ASSERT_EQUAL(1, p.update_cnt);
+  assert_message(&p.updates[0], 584120001, 100000001, "/info");
+  TEST_ASSERT_FALSE(p.updates[0].text_truncated);
+}
+
+static void test_callback(void) {
+  TEST_ASSERT_TRUE(parse(&p, load("callback"), SIZE_MAX));
+  TEST_ASSERT_TRUE(p.ok);
+  TEST_ASSERT_EQUAL(1, p.update_cnt);
+  assert_callback(&p.updates[0], 584120002, 100000001, "4382000000000000002",
+                  "change_temp");
+}
+
+static void test_long_text_is_truncated(void) {
+  TEST_ASSERT_TRUE(parse(&p, load("long_text"), SIZE_MAX));
+  TEST_ASSERT_EQUAL(1, p.update_cnt);
+
+  // 4096 rakstzīmes (~10 KB \uXXXX) => pirmie 255 baiti UTF-8; šeit tā ir
+  // rakstzīmes robeža (UTF-8 simbola pārraušanu pārbauda test_truncation_*)
+  std::string expected;
+  while (expected.size() < TG_TEXT_MAX)
+    expected += "Ļoti garš teksts ar emocijzīmēm 🔥🌡️ ";
+  expected.resize(TG_TEXT_MAX - 1);
+  assert_message(&p.updates[0], 584120003, 100000002, expected.c_str());
+  TEST_ASSERT_TRUE(p.updates[0].text_truncated);
+}
+
+static void test_batch_keeps_first_updates(void) {
+  TEST_ASSERT_TRUE(parse(&p, load("batch100"), SIZE_MAX));
+  TEST_ASSERT_TRUE(p.ok);
+  TEST_ASSERT_EQUAL(100, p.update_total);
+  TEST_ASSERT_EQUAL(TG_MAX_UPDATES, p.update_cnt);
+  assert_message(&p.updates[0], 584120100, 100000000, "/time");
+  assert_callback(&p.updates[1], 584120101, 100000001, "4382000000000000101",
+                  "refresh");
+  assert_message(&p.updates[2], 584120102, 100000002, "602");
+  assert_callback(&p.updates[3], 584120103, 100000003, "4382000000000000103",
+                  "change_kp");
+}
+
+static void test_empty_and_error(void) {
+  TEST_ASSERT_TRUE(parse(&p, load("empty"), SIZE_MAX));
+  TEST_ASSERT_TRUE(p.ok);
+  TEST_ASSERT_EQUAL(0, p.update_total);
+  TEST_ASSERT_EQUAL(0, p.update_cnt);
+
+  // {"ok":false,...} ir korekts JSON, tikai ok = false
+  TEST_ASSERT_TRUE(parse(&p, load("error"), SIZE_MAX));
+  TEST_ASSERT_FALSE(p.ok);
+  TEST_ASSERT_FALSE(p.error);
+  TEST_ASSERT_EQUAL(0, p.update_total);
+}
+
+// ============================================
+// GABALU ROBEŽAS
+// ============================================
+
+static void test_chunk_sizes(void) {
+  for (const char *name : PAYLOADS) {
+    std::string body = load(name);
+    TEST_ASSERT_TRUE_MESSAGE(parse(&ref, body, body.size()), name);
+    TEST_ASSERT_EQUAL_UINT32(body.size(), ref.bytes);
+    for (size_t chunk : CHUNK_SIZES) {
+      char msg[64];
+      snprintf(msg, sizeof(msg), "%s, chunk %zu", name, chunk);
+      TEST_ASSERT_TRUE_MESSAGE(parse(&p, body, chunk), msg);
+      assert_same_result(&ref, &p, msg);
+    }
+  }
+}
+
+static void test_random_splits(void) {
+  for (const char *name : PAYLOADS) {
+    std::string body = load(name);
+    TEST_ASSERT_TRUE(parse(&ref, body, body.size()));
+    for (int k = 0; k < 200; k++) {
+      char msg[64];
+      snprintf(msg, sizeof(msg), "%s, split %d", name, k);
+      // Dažreiz sīki gabali (\uXXXX un atslēgu vidū), dažreiz lieli
+      TEST_ASSERT_TRUE_MESSAGE(parse(&p, body, 0, k & 1 ? 8 : 3000), msg);
+      assert_same_result(&ref, &p, msg);
+    }
+  }
+}
+
+// ============================================
+// KĻŪDAINS UN NEPILNĪGS JSON
+// ============================================
+
+// Katrs nepilns sākums ir korekts līdz šim, bet nav pabeigts dokuments
+static void test_truncated_input(void) {
+  for (const char *name : PAYLOADS) {
+    std::string body = load(name);
+    size_t step = body.size() > 20000 ? 97 : 1;
+    for (size_t len = 0; len < body.size(); len += step) {
+      tg_parser_reset(&p);
+      char msg[64];
+      snprintf(msg, sizeof(msg), "%s, %zu of %zu bytes", name, len,
+               body.size());
+      TEST_ASSERT_TRUE_MESSAGE(tg_parser_feed(&p, body.data(), len), msg);
+      TEST_ASSERT_FALSE_MESSAGE(tg_parser_finish(&p), msg);
+      TEST_ASSERT_FALSE_MESSAGE(p.error, msg);
+    }
+  }
+}
+
+static void test_malformed_input(void) {
+  static const char *const bad[] = {
+      "{\"ok\":tru}",      "{\"ok\":nul}",       "{\"ok\" true}",
+      "{\"ok\":true,}",    "{,}",                "[1,2}",
+      "{\"a\":1]",         "[1 2]",              "]",
+      "}",                 "{} x",               "{}{}",
+      "{\"a\":-}",         "{\"a\":+1}",         "{\"a\":.5}",
+      "{\"a\":\"\\x\"}",   "{\"a\":\"\\u12g4\"}", "{\"a\":\"x\ny\"}",
+      "{\"a\":\"\t\"}",    "{\"a\":'b'}",        "{a:1}",
+      "{\"ok\":true,\"result\":[{\"update_id\":1,\"message\":{\"text\":\"\\",
+  };
+  for (const char *json : bad) {
+    for (size_t chunk : {(size_t)1, strlen(json)}) {
+      TEST_ASSERT_FALSE_MESSAGE(parse_str(&p, json, chunk), json);
+    }
+    // Kļūda saglabājas līdz tg_parser_reset()
+    tg_parser_reset(&p);
+    if (!tg_parser_feed(&p, json, strlen(json))) {
+      TEST_ASSERT_TRUE_MESSAGE(p.error, json);
+      TEST_ASSERT_FALSE(tg_parser_feed(&p, "{}", 2));
+      TEST_ASSERT_FALSE(tg_parser_finish(&p));
+    }
+  }
+
+  // Atstarpes aiz dokumenta ir atļautas
+  TEST_ASSERT_TRUE(parse_str(&p, " {\"ok\" : true , \"result\" : [ ] }\r\n", 1));
+  TEST_ASSERT_TRUE(p.ok);
+}
+
+static void test_nesting_limit(void) {
+  std::string ok_doc = std::string(TG_DEPTH_MAX, '[') + std::string(TG_DEPTH_MAX, ']');
+  TEST_ASSERT_TRUE(parse(&p, ok_doc, 1));
+
+  std::string deep = std::string(TG_DEPTH_MAX + 1, '[') + std::string(TG_DEPTH_MAX + 1, ']');
+  TEST_ASSERT_FALSE(parse(&p, deep, 1));
+  TEST_ASSERT_TRUE(p.error);
+}
+
+static void test_numbers(void) {
+  // Tikai veseli skaitļi, kas ietilpst int64_t; pārējie tiek izlaisti
+  TEST_ASSERT_TRUE(parse_str(&p,
+                             "{\"ok\":true,\"result\":["
+                             "{\"update_id\":9223372036854775807,\"message\":{\"chat\":{\"id\":-9223372036854775807}}},"
+                             "{\"update_id\":9223372036854775808,\"message\":{\"chat\":{\"id\":1.5e3}}},"
+                             "{\"update_id\":-0,\"message\":{\"chat\":{\"id\":12E2,\"x\":[1,-2.5,3e-2]}}}]}",
+                             1));
+  TEST_ASSERT_EQUAL(3, p.update_cnt);
+  TEST_ASSERT_TRUE(p.updates[0].has_update_id);
+  TEST_ASSERT_EQUAL_INT64(INT64_MAX, p.updates[0].update_id);
+  TEST_ASSERT_EQUAL_INT64(-INT64_MAX, p.updates[0].chat_id);
+  TEST_ASSERT_FALSE(p.updates[1].has_update_id);
+  TEST_ASSERT_FALSE(p.updates[1].has_chat_id);
+  TEST_ASSERT_TRUE(p.updates[2].has_update_id);
+  TEST_ASSERT_EQUAL_INT64(0, p.updates[2].update_id);
+  TEST_ASSERT_FALSE(p.updates[2].has_chat_id);
+}
+
+// ============================================
+// ESCAPE SECĪBAS UN SUROGĀTI
+// ============================================
+
+static void test_escapes(void) {
+  const tg_update_t *u = parse_text("a\\\"b\\\\c\\/d\\b\\f\\n\\r\\te\\u0101\\u00C9\\u20ac");
+  TEST_ASSERT_EQUAL_STRING("a\"b\\c/d\b\f\n\r\te\xC4\x81\xC3\x89\xE2\x82\xAC", u->text);
+  TEST_ASSERT_FALSE(u->text_truncated);
+
+  // Neaizsargāts UTF-8 paliek kā ir
+  u = parse_text("Kr\xC4\x81sns \xF0\x9F\x94\xA5");
+  TEST_ASSERT_EQUAL_STRING("Kr\xC4\x81sns \xF0\x9F\x94\xA5", u->text);
+}
+
+static void test_surrogates(void) {
+  // Pāris => viens 4 baitu simbols
+  TEST_ASSERT_EQUAL_STRING("a\xF0\x9F\x94\xA5" "b", parse_text("a\\ud83d\\udd25b")->text);
+  TEST_ASSERT_EQUAL_STRING("\xF0\x9F\x8C\xA1\xEF\xB8\x8F",
+                           parse_text("\\uD83C\\uDF21\\uFE0F")->text);
+  TEST_ASSERT_EQUAL_STRING("\xF4\x8F\xBF\xBF", parse_text("\\udbff\\udfff")->text);
+
+  // Nepāra surogāti => U+FFFD (EF BF BD), pārējais teksts saglabājas
+  TEST_ASSERT_EQUAL_STRING("\xEF\xBF\xBDx", parse_text("\\ud83dx")->text);
+  TEST_ASSERT_EQUAL_STRING("x\xEF\xBF\xBD", parse_text("x\\udd25")->text);
+  TEST_ASSERT_EQUAL_STRING("x\xEF\xBF\xBD", parse_text("x\\ud83d")->text);
+  TEST_ASSERT_EQUAL_STRING("\xEF\xBF\xBD\n", parse_text("\\ud83d\\n")->text);
+  TEST_ASSERT_EQUAL_STRING("\xEF\xBF\xBD\xC4\x81", parse_text("\\ud83d\\u0101")->text);
+  TEST_ASSERT_EQUAL_STRING("\xEF\xBF\xBD\xF0\x9F\x94\xA5",
+                           parse_text("\\ud83d\\ud83d\\udd25")->text);
+  TEST_ASSERT_EQUAL_STRING("\xEF\xBF\xBD\xEF\xBF\xBD", parse_text("\\udd25\\ud83d")->text);
+}
+
+// ============================================
+// APGRIEŠANA
+// ============================================
+
+static void test_truncation_keeps_utf8(void) {
+  // 253 + 2 baiti = 255: ietilpst tieši
+  std::string a253(TG_TEXT_MAX - 3, 'a');
+  const tg_update_t *u = parse_text((a253 + "\\u0101").c_str());
+  TEST_ASSERT_EQUAL_STRING((a253 + "\xC4\x81").c_str(), u->text);
+  TEST_ASSERT_FALSE(u->text_truncated);
+
+  // 254 + 2 baiti: simbols netiek pārrauts
+  std::string a254(TG_TEXT_MAX - 2, 'a');
+  u = parse_text((a254 + "\\u0101").c_str());
+  TEST_ASSERT_EQUAL_STRING(a254.c_str(), u->text);
+  TEST_ASSERT_TRUE(u->text_truncated);
+
+  // 252 + 4 baiti (surogātu pāris) un 253 + 3 baiti
+  std::string a252(TG_TEXT_MAX - 4, 'a');
+  u = parse_text((a252 + "\\ud83d\\udd25bbb").c_str());
+  TEST_ASSERT_EQUAL_STRING(a252.c_str(), u->text);
+  TEST_ASSERT_TRUE(u->text_truncated);
+  u = parse_text((a253 + "\xE2\x82\xAC").c_str());
+  TEST_ASSERT_EQUAL_STRING(a253.c_str(), u->text);
+  TEST_ASSERT_TRUE(u->text_truncated);
+
+  // callback_query.data: 64 baiti ietilpst, 65 tiek apgriezti
+  std::string d64(TG_CB_DATA_MAX - 1, 'd');
+  std::string body = "{\"ok\":true,\"result\":[{\"update_id\":1,\"callback_query\":{\"id\":\"c1\",\"data\":\"" +
+                     d64 + "x\",\"message\":{\"chat\":{\"id\":5}}}}]}";
+  TEST_ASSERT_TRUE(parse(&p, body, 1));
+  TEST_ASSERT_EQUAL_STRING(d64.c_str(), p.updates[0].callback_data);
+  TEST_ASSERT_EQUAL_INT64(5, p.updates[0].chat_id);
+}
+
+// ============================================
+// MĒRĪJUMS
+// ============================================
+// Laiks (datorā) un malloc izsaukumi: tg_update_parser pa 1460 B gabaliem
+// (TCP segments) pret agrāko ceļu: viss atbildes teksts buferī, cJSON_Parse(),
+// lauku nolasīšana ar cJSON_GetObjectItem(), cJSON_Delete().
+
+#ifdef COUNT_MALLOC
+// GNU ld --wrap: skaita parsētāju un cJSON izsaukumus (ne libc/libstdc++ iekšējos)
+static size_t mallocs, live_bytes, peak_bytes;
+
+extern "C" {
+void *__real_malloc(size_t n);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t n);
+void __real_free(void *ptr);
+
+static void *counted(void *ptr) {
+  if (ptr) {
+    mallocs++;
+    live_bytes += malloc_usable_size(ptr);
+    if (live_bytes > peak_bytes)
+      peak_bytes = live_bytes;
+  }
+  return ptr;
+}
+
+void *__wrap_malloc(size_t n) { return counted(__real_malloc(n)); }
+void *__wrap_calloc(size_t n, size_t size) { return counted(__real_calloc(n, size)); }
+void *__wrap_realloc(void *ptr, size_t n) {
+  if (ptr)
+    live_bytes -= malloc_usable_size(ptr);
+  return counted(__real_realloc(ptr, n));
+}
+void __wrap_free(void *ptr) {
+  if (ptr)
+    live_bytes -= malloc_usable_size(ptr);
+  __real_free(ptr);
+}
+}
+
+static void malloc_reset(void) {
+  mallocs = 0;
+  live_bytes = 0;
+  peak_bytes = 0;
+}
+#endif
+
+typedef struct {
+  double ns;
+  size_t mallocs;
+  size_t peak_bytes;
+} bench_t;
+
+// Atkārto, līdz kopā ~50 ms; rezultāts ir vienam parsējumam
+template <typename F> static bench_t bench(F parse_once) {
+  bench_t r = {0, 0, 0};
+  int iters = 0;
+  double total = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  do {
+#ifdef COUNT_MALLOC
+    malloc_reset();
+#endif
+    parse_once();
+#ifdef COUNT_MALLOC
+    r.mallocs = mallocs;
+    r.peak_bytes = peak_bytes;
+#endif
+    iters++;
+    total = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+  } while (total < 50e6);
+  r.ns = total / iters;
+  return r;
+}
+
+static void stream_parse(const std::string &body) {
+  tg_parser_reset(&p);
+  for (size_t i = 0; i < body.size(); i += 1460)
+    tg_parser_feed(&p, body.data() + i, body.size() - i < 1460 ? body.size() - i : 1460);
+  TEST_ASSERT_TRUE(tg_parser_finish(&p));
+}
+
+#ifdef HAVE_CJSON
+static void cjson_parse(const std::string &body) {
+  cJSON *json = cJSON_Parse(body.c_str());
+  TEST_ASSERT_NOT_NULL(json);
+  volatile size_t found = 0;
+  cJSON *ok = cJSON_GetObjectItem(json, "ok");
+  if (cJSON_IsTrue(ok)) {
+    cJSON *result = cJSON_GetObjectItem(json, "result");
+    cJSON *update = NULL;
+    cJSON_ArrayForEach(update, result) {
+      cJSON *update_id = cJSON_GetObjectItem(update, "update_id");
+      cJSON *message = cJSON_GetObjectItem(update, "message");
+      cJSON *callback_query = cJSON_GetObjectItem(update, "callback_query");
+      if (update_id)
+        found++;
+      if (message) {
+        cJSON *chat = cJSON_GetObjectItem(message, "chat");
+        if (chat && cJSON_GetObjectItem(chat, "id"))
+          found++;
+        if (cJSON_GetObjectItem(message, "text"))
+          found++;
+      } else if (callback_query) {
+        cJSON *cb_message = cJSON_GetObjectItem(callback_query, "message");
+        cJSON *chat = cb_message ? cJSON_GetObjectItem(cb_message, "chat") : NULL;
+        if (chat && cJSON_GetObjectItem(chat, "id"))
+          found++;
+        if (cJSON_GetObjectItem(callback_query, "id") && cJSON_GetObjectItem(callback_query, "data"))
+          found++;
+      }
+    }
+  }
+  cJSON_Delete(json);
+}
+#endif
+
+static void test_report_parse_time_and_mallocs(void) {
+  printf("%-10s %7s | %-28s | %s\n", "payload", "bytes", "tg_update_parser (1460 B)",
+#ifdef HAVE_CJSON
+         "cJSON_Parse + GetObjectItem"
+#else
+         "cJSON: not found"
+#endif
+  );
+  for (const char *name : PAYLOADS) {
+    std::string body = load(name);
+    bench_t s = bench([&] { stream_parse(body); });
+    printf("%-10s %7zu | %8.0f ns %5.2f ns/B %2zu mallocs |", name, body.size(), s.ns,
+           s.ns / body.size(), s.mallocs);
+#ifdef HAVE_CJSON
+    bench_t c = bench([&] { cjson_parse(body); });
+    printf(" %8.0f ns %5.2f ns/B %5zu mallocs %7zu B peak", c.ns, c.ns / body.size(), c.mallocs,
+           c.peak_bytes);
+#endif
+    printf("\n");
+#ifdef COUNT_MALLOC
+    TEST_ASSERT_EQUAL_MESSAGE(0, s.mallocs, name);
+#endif
+  }
+#ifndef COUNT_MALLOC
+  printf("malloc counting needs GNU ld --wrap (Linux)\n");
+#endif
+#ifndef HAVE_CJSON
+  TEST_IGNORE_MESSAGE("cJSON.c not found (set CJSON_DIR or IDF_PATH, or install the PlatformIO "
+                      "framework-espidf package): comparison skipped");
+#endif
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_message);
+  RUN_TEST(test_callback);
+  RUN_TEST(test_long_text_is_truncated);
+  RUN_TEST(test_batch_keeps_first_updates);
+  RUN_TEST(test_empty_and_error);
+  RUN_TEST(test_chunk_sizes);
+  RUN_TEST(test_random_splits);
+  RUN_TEST(test_truncated_input);
+  RUN_TEST(test_malformed_input);
+  RUN_TEST(test_nesting_limit);
+  RUN_TEST(test_numbers);
+  RUN_TEST(test_escapes);
+  RUN_TEST(test_surrogates);
+  RUN_TEST(test_truncation_keeps_utf8);
+  RUN_TEST(test_report_parse_time_and_mallocs);
+  return UNITY_END();
+}